@@ -0,0 +1,50 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+using UnrealBuildTool;
+using System.IO;
+
+// Benchmarks runnable headless through the automation framework: decode cost
+// of every response type against recorded fixtures, and realtime soak runs.
+public class NakamaBenchmarks : ModuleRules
+{
+	public NakamaBenchmarks(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+#if UE_5_8_OR_LATER
+		CppStandard = CppStandardVersion.Cpp20;
+#endif
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core", "Json", "NakamaMockServer"
+			}
+			);
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"CoreUObject",
+				"NakamaHttp",
+				"NakamaUnreal"
+			}
+			);
+
+		PublicIncludePaths.Add(Path.Combine(ModuleDirectory, "Public"));
+		PrivateIncludePaths.Add(Path.Combine(ModuleDirectory, "Public"));
+	}
+}
@@ -0,0 +1,69 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Replays a realtime recording (see FNakamaRealtimeRecorder) through a realtime
+// client's decode and dispatch path and reports per-envelope costs. Pass the
+// file with -NakamaReplay=<path>; -NakamaReplayLoops=<n> repeats it (default 10).
+
+#include "NakamaDecodeBenchmark.h"
+#include "NakamaClient.h"
+#include "NakamaRealtimeClient.h"
+#include "NakamaRealtimeRecorder.h"
+#include "Misc/CommandLine.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNakamaRealtimeReplayBenchmark, "Nakama.Benchmark.Realtime.Replay", NAKAMA_BENCHMARK_TEST_MASK)
+bool FNakamaRealtimeReplayBenchmark::RunTest(const FString& Parameters)
+{
+	FString Path;
+	if (!FParse::Value(FCommandLine::Get(), TEXT("NakamaReplay="), Path))
+	{
+		AddInfo(TEXT("No recording given; pass -NakamaReplay=<file.nkrec>."));
+		return true;
+	}
+
+	TArray<FNakamaRecordedFrame> Frames;
+	if (!FNakamaRealtimeRecorder::LoadFromFile(Path, Frames))
+	{
+		AddError(FString::Printf(TEXT("Unable to load recording %s"), *Path));
+		return false;
+	}
+
+	int32 NumLoops = 10;
+	FParse::Value(FCommandLine::Get(), TEXT("NakamaReplayLoops="), NumLoops);
+
+	UNakamaClient* Client = UNakamaClient::CreateDefaultClient(TEXT("defaultkey"), TEXT("127.0.0.1"), 7350, false, false);
+	UNakamaRealtimeClient* Socket = Client->SetupRealtimeClient();
+
+	int64 NumReplayed = 0;
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 Loop = 0; Loop < NumLoops; ++Loop)
+	{
+		NumReplayed += Socket->ReplayFrames(Frames);
+	}
+	const double ElapsedSeconds = FMath::Max(FPlatformTime::Seconds() - StartTime, UE_SMALL_NUMBER);
+
+	const FNakamaRealtimeStats Stats = Socket->GetStats();
+	AddInfo(FString::Printf(TEXT("Replayed %lld frames (%lld bytes) in %.3fs: %.0f frames/s, decode %.3f ms (max %.3f), dispatch %.3f ms (max %.3f), %lld decode errors"),
+		NumReplayed, Stats.BytesReceived, ElapsedSeconds, NumReplayed / ElapsedSeconds,
+		Stats.DecodeTimeMs, Stats.MaxDecodeTimeMs, Stats.DispatchTimeMs, Stats.MaxDispatchTimeMs, Stats.DecodeErrors));
+	for (const FNakamaRealtimeEnvelopeStats& Envelope : Stats.Envelopes)
+	{
+		AddInfo(FString::Printf(TEXT("  %s: %lld frames, dispatch %.3f ms"), *Envelope.Type, Envelope.FramesReceived, Envelope.DispatchTimeMs));
+	}
+
+	Client->Destroy();
+	return true;
+}
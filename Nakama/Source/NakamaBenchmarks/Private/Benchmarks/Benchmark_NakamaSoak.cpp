@@ -0,0 +1,53 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Realtime soak run. Defaults to 16 clients against the in-process mock
+// server for 60 seconds; see FNakamaSoakSettings::FromCommandLine to scale it
+// up or point it at a real server.
+
+#include "NakamaDecodeBenchmark.h"
+#include "NakamaSoakHarness.h"
+#include "Misc/CommandLine.h"
+
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(FNakamaSoakWait, FAutomationTestBase*, Test, TSharedRef<FNakamaSoakHarness>, Harness);
+bool FNakamaSoakWait::Update()
+{
+	if (!Harness->IsFinished())
+	{
+		return false;
+	}
+
+	const FNakamaSoakReport& Report = Harness->GetReport();
+	Test->AddInfo(Report.ToString());
+	Test->TestTrue(TEXT("Clients ready"), Report.NumReady > 0);
+	Test->TestTrue(TEXT("Messages received"), Report.GetMessagesReceived() > 0);
+
+	FString CsvPath;
+	if (FParse::Value(FCommandLine::Get(), TEXT("NakamaSoakCsv="), CsvPath))
+	{
+		Report.AppendCsv(CsvPath);
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNakamaRealtimeSoakBenchmark, "Nakama.Benchmark.Soak.Realtime", NAKAMA_BENCHMARK_TEST_MASK)
+bool FNakamaRealtimeSoakBenchmark::RunTest(const FString& Parameters)
+{
+	const TSharedRef<FNakamaSoakHarness> Harness = MakeShared<FNakamaSoakHarness>(FNakamaSoakSettings::FromCommandLine());
+	Harness->Start();
+	ADD_LATENT_AUTOMATION_COMMAND(FNakamaSoakWait(this, Harness));
+	return true;
+}
@@ -0,0 +1,229 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaDecodeBenchmark.h"
+#include "NakamaBenchmarks.h"
+#include "NakamaMemory.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace
+{
+	constexpr int32 MediumItems = 100;
+	constexpr int32 HugeItems = 10000;
+	constexpr int32 MinIterations = 5;
+	constexpr int32 MaxIterations = 1000000;
+	constexpr int32 AllocationIterations = 5;
+
+	const TCHAR* SizeToString(ENakamaFixtureSize Size)
+	{
+		switch (Size)
+		{
+		case ENakamaFixtureSize::Medium: return TEXT("medium");
+		case ENakamaFixtureSize::Huge: return TEXT("huge");
+		default: return TEXT("small");
+		}
+	}
+
+	// Field holding the first non-empty array at the top level or one object
+	// below it (for payloads wrapped in an envelope field such as {"match": {...}}).
+	TSharedPtr<FJsonValue>* FindListToGrow(const TSharedPtr<FJsonObject>& Object, int32 Depth)
+	{
+		for (TPair<FString, TSharedPtr<FJsonValue>>& Field : Object->Values)
+		{
+			if (Field.Value.IsValid() && Field.Value->Type == EJson::Array && Field.Value->AsArray().Num() > 0)
+			{
+				return &Field.Value;
+			}
+		}
+
+		if (Depth > 0)
+		{
+			for (TPair<FString, TSharedPtr<FJsonValue>>& Field : Object->Values)
+			{
+				if (Field.Value.IsValid() && Field.Value->Type == EJson::Object)
+				{
+					if (TSharedPtr<FJsonValue>* List = FindListToGrow(Field.Value->AsObject(), Depth - 1))
+					{
+						return List;
+					}
+				}
+			}
+		}
+
+		return nullptr;
+	}
+
+	FNakamaDecodeBenchmarkResult Measure(
+		const TCHAR* TypeName,
+		ENakamaFixtureSize Size,
+		int32 NumItems,
+		const FString& Payload,
+		TFunctionRef<void(const FString&)> Decode)
+	{
+		FNakamaDecodeBenchmarkResult Result;
+		Result.TypeName = TypeName;
+		Result.Size = Size;
+		Result.NumItems = NumItems;
+		Result.PayloadBytes = FPlatformString::ConvertedLength<UTF8CHAR>(*Payload, Payload.Len());
+
+		// Warm up caches and any lazily initialized statics.
+		Decode(Payload);
+
+		const double BudgetSeconds = Size == ENakamaFixtureSize::Small ? 0.1 : 0.25;
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		uint64 ElapsedCycles = 0;
+		do
+		{
+			Decode(Payload);
+			Result.Iterations++;
+			ElapsedCycles = FPlatformTime::Cycles64() - StartCycles;
+		}
+		while ((Result.Iterations < MinIterations || FPlatformTime::ToSeconds64(ElapsedCycles) < BudgetSeconds) && Result.Iterations < MaxIterations);
+
+		Result.NanosecondsPerOp = FPlatformTime::ToSeconds64(ElapsedCycles) * 1e9 / Result.Iterations;
+
+		{
+			// The scope is per thread, so allocations elsewhere are not counted.
+			const bool bWasEnabled = FNakamaAllocationTracker::IsEnabled();
+			FNakamaAllocationTracker::Enable();
+			const FNakamaAllocationCounters Before = FNakamaAllocationTracker::GetCounters(ENakamaAllocScope::Benchmark);
+			{
+				const FNakamaAllocationScope Scope(ENakamaAllocScope::Benchmark);
+				for (int32 Iteration = 0; Iteration < AllocationIterations; ++Iteration)
+				{
+					Decode(Payload);
+				}
+			}
+			const FNakamaAllocationCounters After = FNakamaAllocationTracker::GetCounters(ENakamaAllocScope::Benchmark);
+			if (!bWasEnabled)
+			{
+				FNakamaAllocationTracker::Disable();
+			}
+
+			Result.AllocationsPerOp = static_cast<double>(After.NumAllocations - Before.NumAllocations) / AllocationIterations;
+			Result.BytesAllocatedPerOp = static_cast<double>(After.NumBytes - Before.NumBytes) / AllocationIterations;
+		}
+
+		return Result;
+	}
+
+	void Report(FAutomationTestBase& Test, const FNakamaDecodeBenchmarkResult& Result, const FString& CsvPath)
+	{
+		const FString Line = FString::Printf(TEXT("%s %s: %d items, %lld bytes, %.0f ns/op, %.1f allocs/op, %.0f bytes allocated/op (%d iterations)"),
+			*Result.TypeName, SizeToString(Result.Size), Result.NumItems, Result.PayloadBytes,
+			Result.NanosecondsPerOp, Result.AllocationsPerOp, Result.BytesAllocatedPerOp, Result.Iterations);
+
+		Test.AddInfo(Line);
+		UE_LOG(LogNakamaBenchmarks, Display, TEXT("%s"), *Line);
+
+		if (CsvPath.IsEmpty())
+		{
+			return;
+		}
+
+		FString Row;
+		if (!FPaths::FileExists(CsvPath))
+		{
+			Row = TEXT("type,size,items,payload_bytes,iterations,ns_per_op,allocs_per_op,bytes_allocated_per_op\n");
+		}
+		Row += FString::Printf(TEXT("%s,%s,%d,%lld,%d,%.1f,%.2f,%.1f\n"),
+			*Result.TypeName, SizeToString(Result.Size), Result.NumItems, Result.PayloadBytes,
+			Result.Iterations, Result.NanosecondsPerOp, Result.AllocationsPerOp, Result.BytesAllocatedPerOp);
+
+		FFileHelper::SaveStringToFile(Row, *CsvPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), FILEWRITE_Append);
+	}
+}
+
+bool FNakamaDecodeBenchmark::MakePayload(const TCHAR* Fixture, ENakamaFixtureSize Size, FString& OutPayload, int32& OutNumItems)
+{
+	TSharedPtr<FJsonObject> JsonObject;
+	const TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(Fixture);
+	if (!FJsonSerializer::Deserialize(JsonReader, JsonObject) || !JsonObject.IsValid())
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonValue>* List = FindListToGrow(JsonObject, 1);
+
+	if (Size == ENakamaFixtureSize::Small)
+	{
+		OutPayload = Fixture;
+		OutNumItems = List ? (*List)->AsArray().Num() : 1;
+		return true;
+	}
+
+	if (!List)
+	{
+		return false;
+	}
+
+	// Repeat the recorded entries; shared values serialize as independent copies.
+	const int32 TargetItems = Size == ENakamaFixtureSize::Medium ? MediumItems : HugeItems;
+	const TArray<TSharedPtr<FJsonValue>>& Recorded = (*List)->AsArray();
+	TArray<TSharedPtr<FJsonValue>> Grown;
+	Grown.Reserve(TargetItems);
+	for (int32 Index = 0; Index < TargetItems; ++Index)
+	{
+		Grown.Add(Recorded[Index % Recorded.Num()]);
+	}
+	*List = MakeShared<FJsonValueArray>(Grown);
+
+	OutPayload.Reset();
+	const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> JsonWriter = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&OutPayload);
+	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), JsonWriter);
+	JsonWriter->Close();
+
+	OutNumItems = TargetItems;
+	return true;
+}
+
+bool FNakamaDecodeBenchmark::Run(
+	FAutomationTestBase& Test,
+	const TCHAR* TypeName,
+	const TCHAR* Fixture,
+	TFunctionRef<void(const FString& Json)> Decode)
+{
+	FString CsvPath;
+	FParse::Value(FCommandLine::Get(), TEXT("NakamaBenchmarkCsv="), CsvPath);
+
+	for (const ENakamaFixtureSize Size : { ENakamaFixtureSize::Small, ENakamaFixtureSize::Medium, ENakamaFixtureSize::Huge })
+	{
+		FString Payload;
+		int32 NumItems = 0;
+		if (!MakePayload(Fixture, Size, Payload, NumItems))
+		{
+			if (Size == ENakamaFixtureSize::Small)
+			{
+				Test.AddError(FString::Printf(TEXT("%s fixture is not valid JSON"), TypeName));
+				return false;
+			}
+			continue;
+		}
+
+		Report(Test, Measure(TypeName, Size, NumItems, Payload, Decode), CsvPath);
+	}
+
+	return true;
+}
+
+void FNakamaDecodeBenchmark::KeepAlive(const void* Value)
+{
+	static const void* volatile Sink = nullptr;
+	Sink = Value;
+}
@@ -0,0 +1,724 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaSoakHarness.h"
+#include "NakamaBenchmarks.h"
+#include "NakamaClient.h"
+#include "NakamaRealtimeClient.h"
+#include "NakamaSession.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+	constexpr int32 MaxLatencySamples = 200000;
+	constexpr float SampleIntervalSeconds = 1.0f;
+	constexpr int64 MatchOpCode = 1;
+	constexpr int64 PartyOpCode = 2;
+
+	int64 UsedMemory()
+	{
+		return static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical);
+	}
+
+	double Percentile(TArray<float>& Sorted, double Percent)
+	{
+		if (Sorted.Num() == 0)
+		{
+			return 0.0;
+		}
+		const int32 Index = FMath::Clamp(FMath::CeilToInt(Percent / 100.0 * Sorted.Num()) - 1, 0, Sorted.Num() - 1);
+		return Sorted[Index];
+	}
+}
+
+FNakamaSoakSettings FNakamaSoakSettings::FromCommandLine()
+{
+	FNakamaSoakSettings Settings;
+	const TCHAR* CommandLine = FCommandLine::Get();
+	FParse::Value(CommandLine, TEXT("NakamaSoakClients="), Settings.NumClients);
+	FParse::Value(CommandLine, TEXT("NakamaSoakSeconds="), Settings.DurationSeconds);
+	FParse::Value(CommandLine, TEXT("NakamaSoakGroupSize="), Settings.GroupSize);
+	FParse::Value(CommandLine, TEXT("NakamaSoakMatchRate="), Settings.MatchDataPerSecond);
+	FParse::Value(CommandLine, TEXT("NakamaSoakChatRate="), Settings.ChatMessagesPerSecond);
+	FParse::Value(CommandLine, TEXT("NakamaSoakPartyRate="), Settings.PartyDataPerSecond);
+	FParse::Value(CommandLine, TEXT("NakamaSoakPayload="), Settings.PayloadBytes);
+
+	FString Server;
+	if (FParse::Value(CommandLine, TEXT("NakamaSoakServer="), Server))
+	{
+		FString Host, Port;
+		if (Server.Split(TEXT(":"), &Host, &Port))
+		{
+			Settings.Host = Host;
+			Settings.Port = FCString::Atoi(*Port);
+		}
+		else
+		{
+			Settings.Host = Server;
+		}
+		Settings.bUseMockServer = false;
+	}
+	FParse::Value(CommandLine, TEXT("NakamaSoakServerKey="), Settings.ServerKey);
+
+	Settings.NumClients = FMath::Max(1, Settings.NumClients);
+	Settings.GroupSize = FMath::Max(1, Settings.GroupSize);
+	Settings.PayloadBytes = FMath::Max(32, Settings.PayloadBytes);
+	return Settings;
+}
+
+FString FNakamaSoakReport::ToString() const
+{
+	const double Seconds = FMath::Max(MeasuredSeconds, 0.001);
+	return FString::Printf(
+		TEXT("%d/%d clients over %.0fs: sent %lld (%.0f/s), received %lld (%.0f/s), %lld send errors, %d disconnects | ")
+		TEXT("latency p50 %.2f ms, p99 %.2f ms, max %.2f ms | SDK %.1f us/msg, process CPU %.1f%% | ")
+		TEXT("GC %d runs, %.1f ms total, %.1f ms max | memory %+.1f MB (peak %.1f MB) | max pending requests %d"),
+		NumReady, NumClients, MeasuredSeconds,
+		GetMessagesSent(), GetMessagesSent() / Seconds, GetMessagesReceived(), GetMessagesReceived() / Seconds,
+		SendErrors, Disconnects,
+		LatencyP50Ms, LatencyP99Ms, LatencyMaxMs,
+		SdkMicrosecondsPerMessage, ProcessCpuPercent,
+		GcCount, GcTotalMs, GcMaxMs,
+		(MemoryEndBytes - MemoryStartBytes) / (1024.0 * 1024.0), MemoryPeakBytes / (1024.0 * 1024.0),
+		MaxPendingRequests);
+}
+
+void FNakamaSoakReport::AppendCsv(const FString& Path) const
+{
+	FString Row;
+	if (!FPaths::FileExists(Path))
+	{
+		Row = TEXT("clients,ready,seconds,match_sent,match_received,chat_sent,chat_received,party_sent,party_received,send_errors,disconnects,")
+			TEXT("p50_ms,p99_ms,max_ms,sdk_us_per_msg,cpu_percent,gc_count,gc_total_ms,gc_max_ms,memory_start,memory_end,memory_peak,max_pending\n");
+	}
+	Row += FString::Printf(TEXT("%d,%d,%.1f,%lld,%lld,%lld,%lld,%lld,%lld,%lld,%d,%.3f,%.3f,%.3f,%.2f,%.1f,%d,%.1f,%.1f,%lld,%lld,%lld,%d\n"),
+		NumClients, NumReady, MeasuredSeconds,
+		MatchDataSent, MatchDataReceived, ChatSent, ChatReceived, PartyDataSent, PartyDataReceived, SendErrors, Disconnects,
+		LatencyP50Ms, LatencyP99Ms, LatencyMaxMs, SdkMicrosecondsPerMessage, ProcessCpuPercent,
+		GcCount, GcTotalMs, GcMaxMs, MemoryStartBytes, MemoryEndBytes, MemoryPeakBytes, MaxPendingRequests);
+
+	FFileHelper::SaveStringToFile(Row, *Path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), FILEWRITE_Append);
+}
+
+FNakamaSoakHarness::FNakamaSoakHarness(const FNakamaSoakSettings& InSettings)
+	: Settings(InSettings)
+{
+}
+
+FNakamaSoakHarness::~FNakamaSoakHarness()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	FCoreUObjectDelegates::GetPreGarbageCollectDelegate().Remove(PreGcHandle);
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGcHandle);
+
+	if (MockServer.IsValid())
+	{
+		MockServer->Stop();
+	}
+}
+
+void FNakamaSoakHarness::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Collector.AddReferencedObject(Client);
+	Collector.AddReferencedObjects(Sockets);
+	Collector.AddReferencedObjects(Sessions);
+}
+
+void FNakamaSoakHarness::Start()
+{
+	check(Phase == EPhase::Idle);
+
+	RunId = FGuid::NewGuid().ToString(EGuidFormats::Digits).Left(8);
+	Report.NumClients = Settings.NumClients;
+
+	if (Settings.bUseMockServer)
+	{
+		MockServer = FNakamaMockServer::Create(Settings.MockSettings);
+		MockServer->Start();
+	}
+
+	// One REST client is enough: it only authenticates.
+	Client = UNakamaClient::CreateDefaultClient(Settings.ServerKey, Settings.Host, Settings.Port, Settings.bUseSSL, false);
+
+	Clients.SetNum(Settings.NumClients);
+	Sockets.SetNum(Settings.NumClients);
+	Sessions.SetNum(Settings.NumClients);
+
+	PreGcHandle = FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddRaw(this, &FNakamaSoakHarness::OnPreGarbageCollect);
+	PostGcHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FNakamaSoakHarness::OnPostGarbageCollect);
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &FNakamaSoakHarness::Tick));
+
+	Phase = EPhase::Connecting;
+	PhaseStartTime = FPlatformTime::Seconds();
+
+	UE_LOG(LogNakamaBenchmarks, Display, TEXT("Soak %s: connecting %d clients to %s"), *RunId, Settings.NumClients,
+		Settings.bUseMockServer ? TEXT("the mock server") : *FString::Printf(TEXT("%s:%d"), *Settings.Host, Settings.Port));
+
+	for (int32 Index = 0; Index < Settings.NumClients; ++Index)
+	{
+		ConnectClient(Index);
+	}
+}
+
+void FNakamaSoakHarness::ConnectClient(int32 Index)
+{
+	TWeakPtr<FNakamaSoakHarness> WeakThis = AsShared();
+
+	auto OnAuthenticated = [WeakThis, Index](UNakamaSession* Session)
+	{
+		TSharedPtr<FNakamaSoakHarness> Self = WeakThis.Pin();
+		if (!Self.IsValid() || Self->Phase != EPhase::Connecting)
+		{
+			return;
+		}
+
+		UNakamaRealtimeClient* Socket = Self->Client->SetupRealtimeClient();
+		Self->Sessions[Index] = Session;
+		Self->Sockets[Index] = Socket;
+		if (Self->MockServer.IsValid())
+		{
+			Self->MockServer->Attach(Socket);
+		}
+
+		Socket->SetMatchDataCallback([WeakThis](const FNakamaMatchData& Data)
+		{
+			TSharedPtr<FNakamaSoakHarness> Self = WeakThis.Pin();
+			if (Self.IsValid() && Self->IsMeasuring())
+			{
+				Self->Report.MatchDataReceived++;
+				Self->RecordLatency(Data.Data);
+			}
+		});
+		Socket->SetPartyDataCallback([WeakThis](const FNakamaPartyData& Data)
+		{
+			TSharedPtr<FNakamaSoakHarness> Self = WeakThis.Pin();
+			if (Self.IsValid() && Self->IsMeasuring())
+			{
+				Self->Report.PartyDataReceived++;
+				Self->RecordLatency(Data.Data);
+			}
+		});
+		Socket->SetChannelMessageCallback([WeakThis](const FNakamaChannelMessage& Message)
+		{
+			TSharedPtr<FNakamaSoakHarness> Self = WeakThis.Pin();
+			if (Self.IsValid() && Self->IsMeasuring())
+			{
+				Self->Report.ChatReceived++;
+				Self->RecordLatency(Message.Content);
+			}
+		});
+		Socket->SetDisconnectCallback([WeakThis](const FNakamaDisconnectInfo& Info)
+		{
+			TSharedPtr<FNakamaSoakHarness> Self = WeakThis.Pin();
+			if (Self.IsValid() && Self->Phase != EPhase::Finished)
+			{
+				Self->Report.Disconnects++;
+			}
+		});
+
+		Socket->Connect(Session, false,
+			[WeakThis, Index]()
+			{
+				if (TSharedPtr<FNakamaSoakHarness> Self = WeakThis.Pin())
+				{
+					Self->OnClientConnected(Index);
+				}
+			},
+			[WeakThis, Index](const FNakamaRtError& Error)
+			{
+				if (TSharedPtr<FNakamaSoakHarness> Self = WeakThis.Pin())
+				{
+					Self->OnClientFailed(Index, Error.Message);
+				}
+			});
+	};
+
+	auto OnError = [WeakThis, Index](const FNakamaError& Error)
+	{
+		if (TSharedPtr<FNakamaSoakHarness> Self = WeakThis.Pin())
+		{
+			Self->OnClientFailed(Index, Error.Message);
+		}
+	};
+
+	Client->AuthenticateCustom(FString::Printf(TEXT("soak-%s-%d"), *RunId, Index), FString(), true, {}, OnAuthenticated, OnError);
+}
+
+void FNakamaSoakHarness::OnClientConnected(int32 Index)
+{
+	if (Phase != EPhase::Connecting)
+	{
+		return;
+	}
+
+	Clients[Index].bConnected = true;
+	NumSettled++;
+	if (NumSettled == Settings.NumClients)
+	{
+		FormGroups();
+	}
+}
+
+void FNakamaSoakHarness::OnClientFailed(int32 Index, const FString& Reason)
+{
+	UE_LOG(LogNakamaBenchmarks, Warning, TEXT("Soak %s: client %d failed: %s"), *RunId, Index, *Reason);
+	Clients[Index].bFailed = true;
+
+	if (Phase == EPhase::Connecting)
+	{
+		NumSettled++;
+		if (NumSettled == Settings.NumClients)
+		{
+			FormGroups();
+		}
+	}
+}
+
+void FNakamaSoakHarness::FormGroups()
+{
+	Phase = EPhase::Joining;
+	PhaseStartTime = FPlatformTime::Seconds();
+
+	for (int32 Index = 0; Index < Clients.Num(); ++Index)
+	{
+		if (Clients[Index].bFailed)
+		{
+			continue;
+		}
+		if (Groups.Num() == 0 || Groups.Last().Members.Num() >= Settings.GroupSize)
+		{
+			Groups.AddDefaulted();
+		}
+		Clients[Index].Group = Groups.Num() - 1;
+		Groups.Last().Members.Add(Index);
+	}
+
+	if (Groups.Num() == 0)
+	{
+		Finish();
+		return;
+	}
+
+	for (int32 GroupIndex = 0; GroupIndex < Groups.Num(); ++GroupIndex)
+	{
+		JoinGroup(GroupIndex);
+	}
+}
+
+void FNakamaSoakHarness::JoinGroup(int32 GroupIndex)
+{
+	// The leader creates the match and the party; then every member joins the
+	// chat room, and everyone but the leader joins the match and the party.
+	FSoakGroup& Group = Groups[GroupIndex];
+	const int32 Leader = Group.Members[0];
+	Group.PendingJoins = 2;
+
+	TWeakPtr<FNakamaSoakHarness> WeakThis = AsShared();
+	auto OnLeaderStep = [WeakThis, GroupIndex, Leader](bool bSucceeded)
+	{
+		TSharedPtr<FNakamaSoakHarness> Self = WeakThis.Pin();
+		if (!Self.IsValid() || Self->Phase != EPhase::Joining)
+		{
+			return;
+		}
+
+		FSoakGroup& Group = Self->Groups[GroupIndex];
+		if (Group.PendingJoins < 0)
+		{
+			return; // the other leader step already failed the group
+		}
+		if (!bSucceeded)
+		{
+			Group.PendingJoins = -1;
+			for (const int32 Member : Group.Members)
+			{
+				Self->OnJoined(Member, false);
+			}
+			return;
+		}
+		if (--Group.PendingJoins > 0)
+		{
+			return;
+		}
+
+		const FString RoomName = FString::Printf(TEXT("soak-%s-%d"), *Self->RunId, GroupIndex);
+		for (const int32 Member : Group.Members)
+		{
+			UNakamaRealtimeClient* Socket = Self->Sockets[Member];
+			const bool bIsLeader = Member == Leader;
+
+			// Each member waits for its chat join, plus the match and party joins unless it is the leader.
+			TSharedRef<int32> Remaining = MakeShared<int32>(bIsLeader ? 1 : 3);
+			TSharedRef<bool> bAllSucceeded = MakeShared<bool>(true);
+			auto Step = [WeakThis, Member, Remaining, bAllSucceeded](bool bStepSucceeded)
+			{
+				*bAllSucceeded &= bStepSucceeded;
+				if (--(*Remaining) == 0)
+				{
+					if (TSharedPtr<FNakamaSoakHarness> Self = WeakThis.Pin())
+					{
+						Self->OnJoined(Member, *bAllSucceeded);
+					}
+				}
+			};
+
+			Socket->JoinChat(RoomName, ENakamaChannelType::ROOM, false, false,
+				[WeakThis, Member, Step](const FNakamaChannel& Channel)
+				{
+					if (TSharedPtr<FNakamaSoakHarness> Self = WeakThis.Pin())
+					{
+						Self->Clients[Member].ChannelId = Channel.Id;
+					}
+					Step(true);
+				},
+				[Step](const FNakamaRtError&) { Step(false); });
+
+			if (!bIsLeader)
+			{
+				Socket->JoinMatch(Group.MatchId, {},
+					[Step](const FNakamaMatch&) { Step(true); },
+					[Step](const FNakamaRtError&) { Step(false); });
+				Socket->JoinParty(Group.PartyId,
+					[Step]() { Step(true); },
+					[Step](const FNakamaRtError&) { Step(false); });
+			}
+		}
+	};
+
+	UNakamaRealtimeClient* LeaderSocket = Sockets[Leader];
+	LeaderSocket->CreateMatch(
+		[WeakThis, GroupIndex, OnLeaderStep](const FNakamaMatch& Match)
+		{
+			if (TSharedPtr<FNakamaSoakHarness> Self = WeakThis.Pin())
+			{
+				Self->Groups[GroupIndex].MatchId = Match.MatchId;
+			}
+			OnLeaderStep(true);
+		},
+		[OnLeaderStep](const FNakamaRtError&) { OnLeaderStep(false); });
+
+	LeaderSocket->CreateParty(true, Settings.GroupSize,
+		[WeakThis, GroupIndex, OnLeaderStep](const FNakamaParty& Party)
+		{
+			if (TSharedPtr<FNakamaSoakHarness> Self = WeakThis.Pin())
+			{
+				Self->Groups[GroupIndex].PartyId = Party.PartyId;
+			}
+			OnLeaderStep(true);
+		},
+		[OnLeaderStep](const FNakamaRtError&) { OnLeaderStep(false); });
+}
+
+void FNakamaSoakHarness::OnJoined(int32 Index, bool bSucceeded)
+{
+	if (Phase != EPhase::Joining)
+	{
+		return;
+	}
+
+	Clients[Index].bReady = bSucceeded;
+	if (!bSucceeded)
+	{
+		Clients[Index].bFailed = true;
+	}
+
+	const bool bAllSettled = !Clients.ContainsByPredicate([](const FSoakClient& SoakClient)
+	{
+		return !SoakClient.bReady && !SoakClient.bFailed;
+	});
+
+	if (bAllSettled)
+	{
+		Report.NumReady = Clients.FilterByPredicate([](const FSoakClient& C) { return C.bReady; }).Num();
+		UE_LOG(LogNakamaBenchmarks, Display, TEXT("Soak %s: %d/%d clients ready, warming up for %.0fs"),
+			*RunId, Report.NumReady, Settings.NumClients, Settings.WarmupSeconds);
+		Phase = EPhase::Warmup;
+		PhaseStartTime = FPlatformTime::Seconds();
+	}
+}
+
+void FNakamaSoakHarness::BeginMeasuring()
+{
+	for (UNakamaRealtimeClient* Socket : Sockets)
+	{
+		if (Socket)
+		{
+			Socket->ResetStats();
+		}
+	}
+
+	Report.MemoryStartBytes = UsedMemory();
+	Report.MemoryPeakBytes = Report.MemoryStartBytes;
+	FPlatformTime::GetCPUTime(); // prime the process CPU counter
+
+	MeasureStartCycles = FPlatformTime::Cycles64();
+	Phase = EPhase::Measuring;
+	PhaseStartTime = FPlatformTime::Seconds();
+	NextSampleTime = PhaseStartTime + SampleIntervalSeconds;
+}
+
+void FNakamaSoakHarness::Finish()
+{
+	if (Phase == EPhase::Measuring)
+	{
+		Report.MeasuredSeconds = FPlatformTime::Seconds() - PhaseStartTime;
+		Report.MemoryEndBytes = UsedMemory();
+		Report.MemoryPeakBytes = FMath::Max(Report.MemoryPeakBytes, Report.MemoryEndBytes);
+		Report.ProcessCpuPercent = NumCpuSamples > 0 ? CpuPercentSum / NumCpuSamples : 0.0;
+
+		double SdkMs = FPlatformTime::ToMilliseconds64(SendCycles);
+		for (UNakamaRealtimeClient* Socket : Sockets)
+		{
+			if (Socket)
+			{
+				const FNakamaRealtimeStats Stats = Socket->GetStats();
+				SdkMs += Stats.DecodeTimeMs + Stats.DispatchTimeMs;
+				Report.MaxPendingRequests = FMath::Max(Report.MaxPendingRequests, Stats.PendingRequests);
+			}
+		}
+		const int64 NumMessages = Report.GetMessagesSent() + Report.GetMessagesReceived();
+		Report.SdkMicrosecondsPerMessage = NumMessages > 0 ? SdkMs * 1000.0 / NumMessages : 0.0;
+
+		LatencySamples.Sort();
+		Report.LatencyP50Ms = Percentile(LatencySamples, 50.0);
+		Report.LatencyP99Ms = Percentile(LatencySamples, 99.0);
+	}
+	else
+	{
+		UE_LOG(LogNakamaBenchmarks, Warning, TEXT("Soak %s: stopped before measuring"), *RunId);
+	}
+
+	Phase = EPhase::Finished;
+
+	for (UNakamaRealtimeClient* Socket : Sockets)
+	{
+		if (Socket)
+		{
+			Socket->Disconnect();
+		}
+	}
+	if (MockServer.IsValid())
+	{
+		MockServer->Stop();
+	}
+
+	UE_LOG(LogNakamaBenchmarks, Display, TEXT("Soak %s: %s"), *RunId, *Report.ToString());
+}
+
+bool FNakamaSoakHarness::Tick(float DeltaTime)
+{
+	const double Now = FPlatformTime::Seconds();
+	switch (Phase)
+	{
+	case EPhase::Connecting:
+	case EPhase::Joining:
+		if (Now - PhaseStartTime > Settings.SetupTimeoutSeconds)
+		{
+			// Carry on with whoever made it; stragglers are left out.
+			UE_LOG(LogNakamaBenchmarks, Warning, TEXT("Soak %s: setup timed out"), *RunId);
+			for (int32 Index = 0; Index < Clients.Num(); ++Index)
+			{
+				if (Phase == EPhase::Connecting && !Clients[Index].bConnected)
+				{
+					Clients[Index].bFailed = true;
+				}
+			}
+			if (Phase == EPhase::Connecting)
+			{
+				NumSettled = Settings.NumClients;
+				FormGroups();
+			}
+			else
+			{
+				for (FSoakClient& SoakClient : Clients)
+				{
+					SoakClient.bFailed |= !SoakClient.bReady;
+				}
+				Report.NumReady = Clients.FilterByPredicate([](const FSoakClient& C) { return C.bReady; }).Num();
+				Phase = Report.NumReady > 0 ? EPhase::Warmup : EPhase::Finished;
+				PhaseStartTime = Now;
+			}
+		}
+		break;
+
+	case EPhase::Warmup:
+		SendTraffic(DeltaTime);
+		if (Now - PhaseStartTime >= Settings.WarmupSeconds)
+		{
+			BeginMeasuring();
+		}
+		break;
+
+	case EPhase::Measuring:
+		SendTraffic(DeltaTime);
+		if (Now >= NextSampleTime)
+		{
+			Sample();
+			NextSampleTime = Now + SampleIntervalSeconds;
+		}
+		if (Now - PhaseStartTime >= Settings.DurationSeconds)
+		{
+			Finish();
+		}
+		break;
+
+	default:
+		break;
+	}
+
+	return Phase != EPhase::Finished;
+}
+
+void FNakamaSoakHarness::SendTraffic(float DeltaTime)
+{
+	for (int32 Index = 0; Index < Clients.Num(); ++Index)
+	{
+		FSoakClient& SoakClient = Clients[Index];
+		UNakamaRealtimeClient* Socket = Sockets[Index];
+		if (!SoakClient.bReady || !Socket || !Socket->IsConnected())
+		{
+			continue;
+		}
+
+		const FSoakGroup& Group = Groups[SoakClient.Group];
+		SoakClient.MatchBudget += DeltaTime * Settings.MatchDataPerSecond;
+		SoakClient.ChatBudget += DeltaTime * Settings.ChatMessagesPerSecond;
+		SoakClient.PartyBudget += DeltaTime * Settings.PartyDataPerSecond;
+
+		const uint64 SendStart = FPlatformTime::Cycles64();
+		for (; SoakClient.MatchBudget >= 1.0; SoakClient.MatchBudget -= 1.0)
+		{
+			Socket->SendMatchData(Group.MatchId, MatchOpCode, MakePayload(), {});
+			Report.MatchDataSent += IsMeasuring() ? 1 : 0;
+		}
+		for (; SoakClient.PartyBudget >= 1.0; SoakClient.PartyBudget -= 1.0)
+		{
+			Socket->SendPartyData(Group.PartyId, PartyOpCode, MakePayload());
+			Report.PartyDataSent += IsMeasuring() ? 1 : 0;
+		}
+		for (; SoakClient.ChatBudget >= 1.0; SoakClient.ChatBudget -= 1.0)
+		{
+			// Chat content must be a JSON object.
+			TWeakPtr<FNakamaSoakHarness> WeakThis = AsShared();
+			Socket->WriteChatMessage(SoakClient.ChannelId, FString::Printf(TEXT("{\"t\":\"%s\"}"), *MakePayload()),
+				[](const FNakamaChannelMessageAck&) {},
+				[WeakThis](const FNakamaRtError&)
+				{
+					if (TSharedPtr<FNakamaSoakHarness> Self = WeakThis.Pin())
+					{
+						Self->Report.SendErrors += Self->IsMeasuring() ? 1 : 0;
+					}
+				});
+			Report.ChatSent += IsMeasuring() ? 1 : 0;
+		}
+		if (IsMeasuring())
+		{
+			SendCycles += FPlatformTime::Cycles64() - SendStart;
+		}
+	}
+}
+
+void FNakamaSoakHarness::Sample()
+{
+	Report.MemoryPeakBytes = FMath::Max(Report.MemoryPeakBytes, UsedMemory());
+
+	CpuPercentSum += FPlatformTime::GetCPUTime().CPUTimePct;
+	NumCpuSamples++;
+
+	for (UNakamaRealtimeClient* Socket : Sockets)
+	{
+		if (Socket)
+		{
+			Report.MaxPendingRequests = FMath::Max(Report.MaxPendingRequests, Socket->GetStats().PendingRequests);
+		}
+	}
+}
+
+FString FNakamaSoakHarness::MakePayload() const
+{
+	// "<send cycles>|" padded to the configured size.
+	FString Payload = FString::Printf(TEXT("%llu|"), FPlatformTime::Cycles64());
+	const int32 Padding = Settings.PayloadBytes - Payload.Len();
+	if (Padding > 0)
+	{
+		Payload += FString::ChrN(Padding, TEXT('x'));
+	}
+	return Payload;
+}
+
+void FNakamaSoakHarness::RecordLatency(const FString& Payload)
+{
+	// Chat content wraps the payload in {"t":"..."}.
+	int32 Start = 0;
+	if (Payload.StartsWith(TEXT("{\"t\":\"")))
+	{
+		Start = 6;
+	}
+
+	int32 End;
+	if (!Payload.FindChar(TEXT('|'), End) || End <= Start)
+	{
+		return;
+	}
+
+	const uint64 SentCycles = FCString::Strtoui64(*Payload.Mid(Start, End - Start), nullptr, 10);
+	if (SentCycles < MeasureStartCycles)
+	{
+		return; // sent during warmup
+	}
+
+	const float LatencyMs = static_cast<float>(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - SentCycles));
+	Report.LatencyMaxMs = FMath::Max(Report.LatencyMaxMs, static_cast<double>(LatencyMs));
+
+	NumLatencySamples++;
+	if (LatencySamples.Num() < MaxLatencySamples)
+	{
+		LatencySamples.Add(LatencyMs);
+	}
+	else
+	{
+		const int64 Slot = FMath::RandRange(static_cast<int64>(0), NumLatencySamples - 1);
+		if (Slot < MaxLatencySamples)
+		{
+			LatencySamples[Slot] = LatencyMs;
+		}
+	}
+}
+
+void FNakamaSoakHarness::OnPreGarbageCollect()
+{
+	GcStartTime = FPlatformTime::Seconds();
+}
+
+void FNakamaSoakHarness::OnPostGarbageCollect()
+{
+	if (!IsMeasuring() || GcStartTime == 0.0)
+	{
+		return;
+	}
+
+	const double Ms = (FPlatformTime::Seconds() - GcStartTime) * 1000.0;
+	Report.GcCount++;
+	Report.GcTotalMs += Ms;
+	Report.GcMaxMs = FMath::Max(Report.GcMaxMs, Ms);
+	GcStartTime = 0.0;
+}
@@ -0,0 +1,99 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#define NAKAMA_BENCHMARK_TEST_MASK EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter
+#else
+#define NAKAMA_BENCHMARK_TEST_MASK EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter
+#endif
+
+/** Fixture sizes a decode benchmark runs at. */
+enum class ENakamaFixtureSize : uint8
+{
+	Small,	// The recorded fixture as-is
+	Medium,	// Its main list replicated to 100 entries
+	Huge	// Its main list replicated to 10000 entries
+};
+
+struct NAKAMABENCHMARKS_API FNakamaDecodeBenchmarkResult
+{
+	FString TypeName;
+	ENakamaFixtureSize Size = ENakamaFixtureSize::Small;
+	int32 NumItems = 0;
+	int64 PayloadBytes = 0;
+	int32 Iterations = 0;
+	double NanosecondsPerOp = 0.0;
+	double AllocationsPerOp = 0.0;
+	double BytesAllocatedPerOp = 0.0;
+};
+
+/**
+ * Measures how long a JSON string constructor takes to decode a fixture, and
+ * how many heap allocations it makes doing so.
+ *
+ * Timing runs each size for a fixed time budget. Allocations are counted in a
+ * separate pass with FNakamaAllocationTracker, under the Benchmark scope on
+ * the calling thread, so the timed pass carries no counting overhead. The
+ * tracker is opt-in: run with -NakamaAllocTracking, otherwise (and in builds
+ * with NAKAMA_ALLOC_TRACKING=0) allocations are reported as zero.
+ *
+ * Results are reported on the test, logged to LogNakamaBenchmarks and, when
+ * -NakamaBenchmarkCsv=<path> is on the command line, appended to that file.
+ */
+class NAKAMABENCHMARKS_API FNakamaDecodeBenchmark
+{
+public:
+
+	/**
+	 * Runs Decode against the fixture at every size. Fixtures without a list
+	 * to grow only run at Small.
+	 *
+	 * @return False if the fixture is not valid JSON.
+	 */
+	static bool Run(
+		FAutomationTestBase& Test,
+		const TCHAR* TypeName,
+		const TCHAR* Fixture,
+		TFunctionRef<void(const FString& Json)> Decode
+	);
+
+	/** Builds the payload for a size; returns false if the fixture has no list to grow. */
+	static bool MakePayload(const TCHAR* Fixture, ENakamaFixtureSize Size, FString& OutPayload, int32& OutNumItems);
+
+	/** Opaque sink that keeps the compiler from discarding a decoded value. */
+	static void KeepAlive(const void* Value);
+};
+
+/**
+ * Declares an automation test "<Group>.<Type>" that benchmarks Type's JSON
+ * string constructor against Fixture.
+ */
+#define NAKAMA_DECODE_BENCHMARK(Group, Type, Fixture) \
+	IMPLEMENT_SIMPLE_AUTOMATION_TEST(Type##DecodeBenchmark, Group "." #Type, NAKAMA_BENCHMARK_TEST_MASK) \
+	bool Type##DecodeBenchmark::RunTest(const FString& Parameters) \
+	{ \
+		return FNakamaDecodeBenchmark::Run(*this, TEXT(#Type), Fixture, [](const FString& Json) \
+		{ \
+			const Type Decoded(Json); \
+			FNakamaDecodeBenchmark::KeepAlive(&Decoded); \
+		}); \
+	}
@@ -0,0 +1,227 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "NakamaMockServer.h"
+#include "UObject/GCObject.h"
+
+class UNakamaClient;
+class UNakamaRealtimeClient;
+class UNakamaSession;
+
+/** Shape of a soak run. Rates are per client. */
+struct NAKAMABENCHMARKS_API FNakamaSoakSettings
+{
+	int32 NumClients = 16;
+
+	/** Clients sharing one match, one chat room and one party. */
+	int32 GroupSize = 8;
+
+	/** Measured run time, after setup and warmup. */
+	float DurationSeconds = 60.0f;
+
+	/** Traffic runs but is not measured, so connection setup does not skew the results. */
+	float WarmupSeconds = 5.0f;
+
+	float MatchDataPerSecond = 10.0f;
+	float ChatMessagesPerSecond = 0.5f;
+	float PartyDataPerSecond = 1.0f;
+
+	/** Size of each match and party data payload. */
+	int32 PayloadBytes = 64;
+
+	/** Give up on clients that have not connected and joined after this long. */
+	float SetupTimeoutSeconds = 30.0f;
+
+	/** Run against an in-process FNakamaMockServer instead of Host:Port. */
+	bool bUseMockServer = true;
+	FNakamaMockServerSettings MockSettings;
+
+	FString ServerKey = TEXT("defaultkey");
+	FString Host = TEXT("127.0.0.1");
+	int32 Port = 7350;
+	bool bUseSSL = false;
+
+	/**
+	 * Defaults overridden by -NakamaSoakClients=, -NakamaSoakSeconds=,
+	 * -NakamaSoakGroupSize=, -NakamaSoakMatchRate=, -NakamaSoakChatRate=,
+	 * -NakamaSoakPartyRate=, -NakamaSoakPayload= and -NakamaSoakServer=host[:port]
+	 * (which turns the mock server off).
+	 */
+	static FNakamaSoakSettings FromCommandLine();
+};
+
+/** What a soak run measured. Latencies are send-to-receive within this process. */
+struct NAKAMABENCHMARKS_API FNakamaSoakReport
+{
+	int32 NumClients = 0;
+	int32 NumReady = 0;
+	int32 Disconnects = 0;
+	double MeasuredSeconds = 0.0;
+
+	int64 MatchDataSent = 0;
+	int64 MatchDataReceived = 0;
+	int64 ChatSent = 0;
+	int64 ChatReceived = 0;
+	int64 PartyDataSent = 0;
+	int64 PartyDataReceived = 0;
+	int64 SendErrors = 0;
+
+	double LatencyP50Ms = 0.0;
+	double LatencyP99Ms = 0.0;
+	double LatencyMaxMs = 0.0;
+
+	/** SDK time per message: send calls plus decode and dispatch of received frames. */
+	double SdkMicrosecondsPerMessage = 0.0;
+
+	/** Average process CPU usage while measuring, in percent of one core. */
+	double ProcessCpuPercent = 0.0;
+
+	int32 GcCount = 0;
+	double GcTotalMs = 0.0;
+	double GcMaxMs = 0.0;
+
+	int64 MemoryStartBytes = 0;
+	int64 MemoryEndBytes = 0;
+	int64 MemoryPeakBytes = 0;
+
+	/** Highest number of realtime requests awaiting a response on any one client. */
+	int32 MaxPendingRequests = 0;
+
+	int64 GetMessagesSent() const { return MatchDataSent + ChatSent + PartyDataSent; }
+	int64 GetMessagesReceived() const { return MatchDataReceived + ChatReceived + PartyDataReceived; }
+
+	FString ToString() const;
+
+	/** Append the report as a row to a CSV file, writing the header if the file is new. */
+	void AppendCsv(const FString& Path) const;
+};
+
+/**
+ * Load generator for the realtime client.
+ *
+ * Connects NumClients realtime clients (to a mock server or a real one),
+ * puts them in groups that share a match, a chat room and a party, and has
+ * every client send match data, chat messages and party data at the
+ * configured rates. Each payload carries its send time, so receivers measure
+ * send-to-receive latency. CPU, GC pauses, memory and pending request counts
+ * are sampled throughout, which is what exposes leaks such as unanswered
+ * request contexts piling up over a long run.
+ *
+ * Driven by the core ticker; the engine must keep ticking until IsFinished.
+ * Game thread only.
+ */
+class NAKAMABENCHMARKS_API FNakamaSoakHarness : public FGCObject, public TSharedFromThis<FNakamaSoakHarness>
+{
+public:
+
+	explicit FNakamaSoakHarness(const FNakamaSoakSettings& InSettings);
+	virtual ~FNakamaSoakHarness() override;
+
+	void Start();
+	bool IsFinished() const { return Phase == EPhase::Finished; }
+	const FNakamaSoakReport& GetReport() const { return Report; }
+
+	// FGCObject
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override { return TEXT("FNakamaSoakHarness"); }
+
+private:
+
+	enum class EPhase : uint8
+	{
+		Idle,
+		Connecting,
+		Joining,
+		Warmup,
+		Measuring,
+		Finished
+	};
+
+	struct FSoakClient
+	{
+		int32 Group = 0;
+		bool bConnected = false;
+		bool bReady = false;
+		bool bFailed = false;
+		FString ChannelId;
+		double MatchBudget = 0.0;
+		double ChatBudget = 0.0;
+		double PartyBudget = 0.0;
+	};
+
+	struct FSoakGroup
+	{
+		TArray<int32> Members;
+		FString MatchId;
+		FString PartyId;
+		int32 PendingJoins = 0;
+	};
+
+	void ConnectClient(int32 Index);
+	void OnClientConnected(int32 Index);
+	void OnClientFailed(int32 Index, const FString& Reason);
+	void FormGroups();
+	void JoinGroup(int32 GroupIndex);
+	void OnJoined(int32 Index, bool bSucceeded);
+	void BeginMeasuring();
+	void Finish();
+
+	bool Tick(float DeltaTime);
+	void SendTraffic(float DeltaTime);
+	void Sample();
+
+	FString MakePayload() const;
+	void RecordLatency(const FString& Payload);
+	bool IsMeasuring() const { return Phase == EPhase::Measuring; }
+
+	void OnPreGarbageCollect();
+	void OnPostGarbageCollect();
+
+	FNakamaSoakSettings Settings;
+	FNakamaSoakReport Report;
+	EPhase Phase = EPhase::Idle;
+	FString RunId;
+
+	TSharedPtr<FNakamaMockServer, ESPMode::ThreadSafe> MockServer;
+	TObjectPtr<UNakamaClient> Client;
+	TArray<TObjectPtr<UNakamaRealtimeClient>> Sockets;
+	TArray<TObjectPtr<UNakamaSession>> Sessions;
+	TArray<FSoakClient> Clients;
+	TArray<FSoakGroup> Groups;
+	int32 NumSettled = 0;
+
+	double PhaseStartTime = 0.0;
+	uint64 MeasureStartCycles = 0;
+	uint64 SendCycles = 0;
+
+	// Reservoir of latency samples, so percentiles stay exact-ish with bounded memory.
+	TArray<float> LatencySamples;
+	int64 NumLatencySamples = 0;
+
+	double NextSampleTime = 0.0;
+	double CpuPercentSum = 0.0;
+	int32 NumCpuSamples = 0;
+
+	double GcStartTime = 0.0;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	FDelegateHandle PreGcHandle;
+	FDelegateHandle PostGcHandle;
+};
@@ -0,0 +1,39 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaHttp.h"
+#include "NakamaMemory.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Modules/ModuleManager.h"
+
+void FNakamaHttpModule::StartupModule()
+{
+	// Only swap GMalloc when asked to: the proxy adds a call to every
+	// allocation in the process. Loaded PreDefault, so it is in place before
+	// any client exists.
+	if (FParse::Param(FCommandLine::Get(), TEXT("NakamaAllocTracking")))
+	{
+		FNakamaAllocationTracker::Install();
+		FNakamaAllocationTracker::Enable();
+	}
+}
+
+void FNakamaHttpModule::ShutdownModule()
+{
+}
+
+IMPLEMENT_MODULE(FNakamaHttpModule, NakamaHttp)
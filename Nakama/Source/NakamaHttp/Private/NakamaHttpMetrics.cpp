@@ -0,0 +1,283 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaHttpMetrics.h"
+#include "Misc/FileHelper.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "ProfilingDebugging/CountersTrace.h"
+
+DEFINE_STAT(STAT_NakamaHttpInFlight);
+DEFINE_STAT(STAT_NakamaHttpQueued);
+DEFINE_STAT(STAT_NakamaHttpCompleted);
+DEFINE_STAT(STAT_NakamaHttpRetries);
+DEFINE_STAT(STAT_NakamaHttpBytesSent);
+DEFINE_STAT(STAT_NakamaHttpBytesReceived);
+
+CSV_DEFINE_CATEGORY(Nakama, true);
+
+TRACE_DECLARE_INT_COUNTER(NakamaHttpRequests, TEXT("Nakama/Http/Requests"));
+TRACE_DECLARE_INT_COUNTER(NakamaHttpBytesReceived, TEXT("Nakama/Http/BytesReceived"));
+
+const double FNakamaLatencyHistogram::BucketUpperBoundsMs[FNakamaLatencyHistogram::NumBuckets - 1] =
+{
+	1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000, 10000
+};
+
+void FNakamaLatencyHistogram::Add(double Ms)
+{
+	int32 Bucket = 0;
+	while (Bucket < NumBuckets - 1 && Ms > BucketUpperBoundsMs[Bucket])
+	{
+		Bucket++;
+	}
+	Buckets[Bucket]++;
+	Count++;
+	TotalMs += Ms;
+	MaxMs = FMath::Max(MaxMs, Ms);
+}
+
+double FNakamaLatencyHistogram::GetPercentileMs(double Percentile) const
+{
+	if (Count == 0)
+	{
+		return 0.0;
+	}
+
+	const int64 Target = FMath::Max<int64>(1, FMath::CeilToInt64(Count * FMath::Clamp(Percentile, 0.0, 100.0) / 100.0));
+	int64 Seen = 0;
+	for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+	{
+		Seen += Buckets[Bucket];
+		if (Seen >= Target)
+		{
+			return Bucket < NumBuckets - 1 ? BucketUpperBoundsMs[Bucket] : MaxMs;
+		}
+	}
+	return MaxMs;
+}
+
+FNakamaHttpRequestTrace::FNakamaHttpRequestTrace(const FString& InBackend, const FString& InMethod, const FString& InEndpoint)
+	: Backend(InBackend)
+	, Method(InMethod)
+	, Endpoint(FNakamaHttpMetrics::NormalizeEndpoint(InEndpoint))
+	, SubmitTime(FPlatformTime::Seconds())
+{
+}
+
+namespace
+{
+	// Set by InvokeCallback when a completion handler finishes parsing.
+	thread_local double GCallbackStart = 0.0;
+
+	// Segments after which the next one names an object (RPC id, leaderboard,
+	// group, storage collection...) rather than a fixed route.
+	const TCHAR* const ParameterParents[] =
+	{
+		TEXT("channel"), TEXT("group"), TEXT("leaderboard"), TEXT("message"), TEXT("owner"),
+		TEXT("rpc"), TEXT("storage"), TEXT("tournament"), TEXT("user")
+	};
+
+	// Fixed routes that share a prefix with a parameterized one.
+	bool IsFixedRoute(const FString& Parent, const FString& Segment)
+	{
+		return Parent == TEXT("storage") && Segment == TEXT("delete");
+	}
+}
+
+FNakamaHttpMetrics& FNakamaHttpMetrics::Get()
+{
+	static FNakamaHttpMetrics Instance;
+	return Instance;
+}
+
+FString FNakamaHttpMetrics::NormalizeEndpoint(const FString& Endpoint)
+{
+	TArray<FString> Segments;
+	Endpoint.ParseIntoArray(Segments, TEXT("/"));
+
+	FString Result;
+	Result.Reserve(Endpoint.Len());
+	for (int32 Index = 0; Index < Segments.Num(); ++Index)
+	{
+		const FString& Segment = Segments[Index];
+		bool bAllDigits = true;
+		bool bAllHexOrDash = true;
+		for (const TCHAR Char : Segment)
+		{
+			bAllDigits &= FChar::IsDigit(Char);
+			bAllHexOrDash &= FChar::IsHexDigit(Char) || Char == TEXT('-');
+		}
+
+		bool bParameter = bAllDigits || (bAllHexOrDash && Segment.Len() >= 16);
+		if (!bParameter && Index > 0)
+		{
+			const FString& Parent = Segments[Index - 1];
+			for (const TCHAR* ParameterParent : ParameterParents)
+			{
+				if (Parent == ParameterParent)
+				{
+					bParameter = !IsFixedRoute(Parent, Segment);
+					break;
+				}
+			}
+		}
+
+		Result += TEXT("/");
+		Result += bParameter ? TEXT("{id}") : *Segment;
+	}
+	return Result;
+}
+
+double FNakamaHttpMetrics::ExchangeCallbackStart(double Seconds)
+{
+	const double Previous = GCallbackStart;
+	GCallbackStart = Seconds;
+	return Previous;
+}
+
+TSharedPtr<FNakamaHttpRequestTrace, ESPMode::ThreadSafe> FNakamaHttpMetrics::BeginRequest(const FString& Backend, const FString& Method, const FString& Endpoint) const
+{
+	if (!bEnabled)
+	{
+		return nullptr;
+	}
+	return MakeShared<FNakamaHttpRequestTrace, ESPMode::ThreadSafe>(Backend, Method, Endpoint);
+}
+
+FNakamaHttpEndpointMetrics& FNakamaHttpMetrics::FindOrAdd(const FNakamaHttpRequestTrace& Trace)
+{
+	const FString Key = Trace.Backend + TEXT(" ") + Trace.Method + TEXT(" ") + Trace.Endpoint;
+	if (FNakamaHttpEndpointMetrics* Existing = Endpoints.Find(Key))
+	{
+		return *Existing;
+	}
+
+	FNakamaHttpEndpointMetrics& Metrics = Endpoints.Add(Key);
+	Metrics.Backend = Trace.Backend;
+	Metrics.Method = Trace.Method;
+	Metrics.Endpoint = Trace.Endpoint;
+	return Metrics;
+}
+
+void FNakamaHttpMetrics::RecordAttempt(const FNakamaHttpRequestTrace& Trace, int32 HttpCode, double QueueSeconds, double NetworkSeconds, int64 BytesSent, int64 BytesReceived)
+{
+	if (!bEnabled)
+	{
+		return;
+	}
+
+	{
+		FScopeLock Lock(&Mutex);
+		FNakamaHttpEndpointMetrics& Metrics = FindOrAdd(Trace);
+		Metrics.BytesSent += BytesSent;
+		Metrics.BytesReceived += BytesReceived;
+		Metrics.StatusCodes.FindOrAdd(HttpCode)++;
+		Metrics.Queue.Add(QueueSeconds * 1000.0);
+		Metrics.Network.Add(NetworkSeconds * 1000.0);
+	}
+
+	INC_DWORD_STAT_BY(STAT_NakamaHttpBytesSent, BytesSent);
+	INC_DWORD_STAT_BY(STAT_NakamaHttpBytesReceived, BytesReceived);
+	CSV_CUSTOM_STAT(Nakama, HttpBytesReceived, static_cast<int32>(BytesReceived), ECsvCustomStatOp::Accumulate);
+	TRACE_COUNTER_ADD(NakamaHttpBytesReceived, BytesReceived);
+}
+
+void FNakamaHttpMetrics::RecordRequest(const FNakamaHttpRequestTrace& Trace, bool bSucceeded, bool bCancelled, double ParseSeconds, double CallbackSeconds)
+{
+	if (!bEnabled)
+	{
+		return;
+	}
+
+	const int32 NumRetries = FMath::Max(0, Trace.NumAttempts - 1);
+	const double TotalMs = (FPlatformTime::Seconds() - Trace.SubmitTime) * 1000.0;
+
+	{
+		FScopeLock Lock(&Mutex);
+		FNakamaHttpEndpointMetrics& Metrics = FindOrAdd(Trace);
+		Metrics.NumRequests++;
+		Metrics.NumRetries += NumRetries;
+		if (bSucceeded)
+		{
+			Metrics.NumSucceeded++;
+			Metrics.Parse.Add(ParseSeconds * 1000.0);
+		}
+		else if (bCancelled)
+		{
+			Metrics.NumCancelled++;
+		}
+		else
+		{
+			Metrics.NumFailed++;
+		}
+		Metrics.Callback.Add(CallbackSeconds * 1000.0);
+		Metrics.Total.Add(TotalMs);
+	}
+
+	INC_DWORD_STAT(STAT_NakamaHttpCompleted);
+	INC_DWORD_STAT_BY(STAT_NakamaHttpRetries, NumRetries);
+	CSV_CUSTOM_STAT(Nakama, HttpRequests, 1, ECsvCustomStatOp::Accumulate);
+	CSV_CUSTOM_STAT(Nakama, HttpRequestMs, static_cast<float>(TotalMs), ECsvCustomStatOp::Max);
+	TRACE_COUNTER_INCREMENT(NakamaHttpRequests);
+}
+
+TArray<FNakamaHttpEndpointMetrics> FNakamaHttpMetrics::GetSnapshot() const
+{
+	TArray<FNakamaHttpEndpointMetrics> Snapshot;
+	{
+		FScopeLock Lock(&Mutex);
+		Endpoints.GenerateValueArray(Snapshot);
+	}
+
+	Snapshot.Sort([](const FNakamaHttpEndpointMetrics& A, const FNakamaHttpEndpointMetrics& B)
+	{
+		return A.Total.TotalMs > B.Total.TotalMs;
+	});
+	return Snapshot;
+}
+
+void FNakamaHttpMetrics::Reset()
+{
+	FScopeLock Lock(&Mutex);
+	Endpoints.Empty();
+}
+
+bool FNakamaHttpMetrics::ExportCsv(const FString& FilePath) const
+{
+	FString Csv = TEXT("Backend,Method,Endpoint,Requests,Succeeded,Failed,Cancelled,Retries,BytesSent,BytesReceived,")
+		TEXT("QueueAvgMs,NetworkAvgMs,NetworkP50Ms,NetworkP99Ms,ParseAvgMs,CallbackAvgMs,TotalAvgMs,TotalP50Ms,TotalP99Ms,TotalMaxMs,StatusCodes\n");
+
+	for (const FNakamaHttpEndpointMetrics& Metrics : GetSnapshot())
+	{
+		TArray<FString> Codes;
+		for (const TPair<int32, int64>& Pair : Metrics.StatusCodes)
+		{
+			Codes.Add(FString::Printf(TEXT("%d:%lld"), Pair.Key, Pair.Value));
+		}
+
+		Csv += FString::Printf(TEXT("%s,%s,%s,%lld,%lld,%lld,%lld,%lld,%lld,%lld,%.2f,%.2f,%.0f,%.0f,%.2f,%.2f,%.2f,%.0f,%.0f,%.2f,%s\n"),
+			*Metrics.Backend, *Metrics.Method, *Metrics.Endpoint,
+			Metrics.NumRequests, Metrics.NumSucceeded, Metrics.NumFailed, Metrics.NumCancelled, Metrics.NumRetries,
+			Metrics.BytesSent, Metrics.BytesReceived,
+			Metrics.Queue.GetAverageMs(),
+			Metrics.Network.GetAverageMs(), Metrics.Network.GetPercentileMs(50), Metrics.Network.GetPercentileMs(99),
+			Metrics.Parse.GetAverageMs(), Metrics.Callback.GetAverageMs(),
+			Metrics.Total.GetAverageMs(), Metrics.Total.GetPercentileMs(50), Metrics.Total.GetPercentileMs(99), Metrics.Total.MaxMs,
+			*FString::Join(Codes, TEXT(" ")));
+	}
+
+	return FFileHelper::SaveStringToFile(Csv, *FilePath);
+}
@@ -0,0 +1,406 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaHttpPipeline.h"
+#include "Containers/Ticker.h"
+#include "Interfaces/IHttpResponse.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+void FNakamaHttpRequestGroup::Process(
+	const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request,
+	FNakamaHttpCompleteFn OnComplete,
+	const TSharedPtr<FNakamaHttpRequestTrace, ESPMode::ThreadSafe>& Trace)
+{
+	if (Trace.IsValid())
+	{
+		Trace->NumAttempts++;
+	}
+	FNakamaHttpPipeline::Get().Submit({ AsShared(), Request, MoveTemp(OnComplete), Trace, FPlatformTime::Seconds() });
+}
+
+void FNakamaHttpRequestGroup::CancelAll()
+{
+	// Queued requests never reached the HTTP module: resolve them directly.
+	for (FNakamaHttpPipeline::FQueuedRequest& Entry : FNakamaHttpPipeline::Get().RemoveQueued(this))
+	{
+		Entry.OnComplete(ENakamaHttpOutcome::Cancelled, 0, FString());
+	}
+
+	// Take ownership of the in-flight set under the lock, then release it before
+	// cancelling so a synchronous completion callback can re-enter the lock safely.
+	TArray<FHttpRequestPtr> ToCancel;
+	{
+		FScopeLock Lock(&ActiveRequestsMutex);
+		ToCancel = MoveTemp(ActiveRequests);
+		ActiveRequests.Empty();
+	}
+
+	// We deliberately do NOT unbind the completion delegate: CancelRequest drives
+	// it with bSuccess=false, and since the request is no longer active the
+	// completion handler resolves it as Cancelled, delivering a terminal callback
+	// instead of silently dropping the caller's.
+	for (const FHttpRequestPtr& Request : ToCancel)
+	{
+		Request->CancelRequest();
+	}
+}
+
+int32 FNakamaHttpRequestGroup::NumActive() const
+{
+	FScopeLock Lock(&ActiveRequestsMutex);
+	return ActiveRequests.Num();
+}
+
+FNakamaHttpPipeline& FNakamaHttpPipeline::Get()
+{
+	static FNakamaHttpPipeline Instance;
+	return Instance;
+}
+
+void FNakamaHttpPipeline::SetMaxConcurrentRequests(int32 InMaxConcurrentRequests)
+{
+	TArray<FQueuedRequest> ToStart;
+	{
+		FScopeLock Lock(&Mutex);
+		MaxConcurrentRequests = FMath::Max(0, InMaxConcurrentRequests);
+
+		// Raising (or removing) the cap releases queued requests right away.
+		while (NumQueued() > 0 && (MaxConcurrentRequests == 0 || Stats.NumInFlight < MaxConcurrentRequests))
+		{
+			ToStart.Add(PopQueued());
+			Stats.NumInFlight++;
+			DEC_DWORD_STAT(STAT_NakamaHttpQueued);
+		}
+		Stats.NumQueued = NumQueued();
+		Stats.PeakInFlight = FMath::Max(Stats.PeakInFlight, Stats.NumInFlight);
+	}
+
+	for (FQueuedRequest& Entry : ToStart)
+	{
+		Start(MoveTemp(Entry));
+	}
+}
+
+int32 FNakamaHttpPipeline::GetMaxConcurrentRequests() const
+{
+	FScopeLock Lock(&Mutex);
+	return MaxConcurrentRequests;
+}
+
+void FNakamaHttpPipeline::SetMaxQueuedRequests(int32 InMaxQueuedRequests, ENakamaOverflowPolicy Policy)
+{
+	TArray<FQueuedRequest> Evicted;
+	{
+		FScopeLock Lock(&Mutex);
+		MaxQueuedRequests = FMath::Max(0, InMaxQueuedRequests);
+		QueueOverflowPolicy = Policy;
+
+		// Lowering the cap below the current backlog evicts the oldest entries.
+		CompactQueue();
+		if (MaxQueuedRequests > 0 && Queue.Num() > MaxQueuedRequests)
+		{
+			const int32 NumEvicted = Queue.Num() - MaxQueuedRequests;
+			for (int32 Index = 0; Index < NumEvicted; ++Index)
+			{
+				Evicted.Add(MoveTemp(Queue[Index]));
+			}
+			Queue.RemoveAt(0, NumEvicted);
+			Stats.NumQueued = Queue.Num();
+			Stats.NumDropped += NumEvicted;
+		}
+	}
+
+	for (FQueuedRequest& Entry : Evicted)
+	{
+		DEC_DWORD_STAT(STAT_NakamaHttpQueued);
+		Entry.OnComplete(ENakamaHttpOutcome::Rejected, 0, FString());
+	}
+}
+
+int32 FNakamaHttpPipeline::GetMaxQueuedRequests() const
+{
+	FScopeLock Lock(&Mutex);
+	return MaxQueuedRequests;
+}
+
+FNakamaHttpStats FNakamaHttpPipeline::GetStats() const
+{
+	FScopeLock Lock(&Mutex);
+	return Stats;
+}
+
+void FNakamaHttpPipeline::Delay(float Seconds, TFunction<void()> Work)
+{
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+		[Work = MoveTemp(Work)](float /*DeltaTime*/) -> bool
+		{
+			Work();
+			return false; // one-shot: unregister after firing
+		}), Seconds);
+}
+
+void FNakamaHttpPipeline::Submit(FQueuedRequest&& Entry)
+{
+	// Entry refused or evicted by a full queue, resolved outside the lock.
+	TOptional<FQueuedRequest> Overflow;
+	bool bStartNow = false;
+	{
+		FScopeLock Lock(&Mutex);
+		if (MaxConcurrentRequests > 0 && Stats.NumInFlight >= MaxConcurrentRequests)
+		{
+			if (MaxQueuedRequests > 0 && NumQueued() >= MaxQueuedRequests)
+			{
+				if (QueueOverflowPolicy == ENakamaOverflowPolicy::Reject)
+				{
+					Stats.NumRejected++;
+					Overflow.Emplace(MoveTemp(Entry));
+				}
+				else
+				{
+					Stats.NumDropped++;
+					Overflow.Emplace(PopQueued());
+					Queue.Add(MoveTemp(Entry));
+				}
+			}
+			else
+			{
+				Queue.Add(MoveTemp(Entry));
+				Stats.NumQueued = NumQueued();
+				INC_DWORD_STAT(STAT_NakamaHttpQueued);
+			}
+		}
+		else
+		{
+			Stats.NumInFlight++;
+			Stats.PeakInFlight = FMath::Max(Stats.PeakInFlight, Stats.NumInFlight);
+			bStartNow = true;
+		}
+	}
+
+	if (Overflow.IsSet())
+	{
+		Overflow->OnComplete(ENakamaHttpOutcome::Rejected, 0, FString());
+	}
+	else if (bStartNow)
+	{
+		Start(MoveTemp(Entry));
+	}
+}
+
+void FNakamaHttpPipeline::Start(FQueuedRequest&& Entry)
+{
+	// The caller has already reserved an in-flight slot for this entry.
+	TSharedPtr<FNakamaHttpRequestGroup, ESPMode::ThreadSafe> Group = Entry.Group.Pin();
+	if (!Group.IsValid())
+	{
+		// Owning client released while the request was queued.
+		Finish(ENakamaHttpOutcome::Cancelled);
+		Entry.OnComplete(ENakamaHttpOutcome::Cancelled, 0, FString());
+		return;
+	}
+
+	{
+		FScopeLock Lock(&Mutex);
+		Stats.NumStarted++;
+	}
+	INC_DWORD_STAT(STAT_NakamaHttpInFlight);
+
+	{
+		FScopeLock Lock(&Group->ActiveRequestsMutex);
+		Group->ActiveRequests.Add(Entry.Request);
+	}
+
+	const TSharedRef<FAttempt, ESPMode::ThreadSafe> Attempt = MakeShared<FAttempt, ESPMode::ThreadSafe>();
+	Attempt->Group = Entry.Group;
+	Attempt->OnComplete = MoveTemp(Entry.OnComplete);
+	Attempt->Trace = Entry.Trace;
+	Attempt->StartTime = FPlatformTime::Seconds();
+	Attempt->QueueSeconds = Attempt->StartTime - Entry.SubmitTime;
+	Attempt->NetworkRegion = NAKAMA_TRACE_REGION_BEGIN(NakamaHttpChannel,
+		FString::Printf(TEXT("Nakama::Http::Network %s %s"), *Entry.Request->GetVerb(), *FNakamaHttpMetrics::NormalizeEndpoint(FPlatformHttp::GetUrlPath(Entry.Request->GetURL()))));
+
+	Entry.Request->OnProcessRequestComplete().BindLambda(
+		[Attempt](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
+	{
+		if (bSuccess && Response.IsValid())
+		{
+			Attempt->Resolve(Request, ENakamaHttpOutcome::Response, Response->GetResponseCode(), Response->GetContentAsString(), Response->GetContentLength());
+		}
+		else
+		{
+			Attempt->Resolve(Request, ENakamaHttpOutcome::ConnectionFailure, 0, FString(), 0);
+		}
+	});
+
+	TSharedPtr<FNakamaHttpInterceptFn, ESPMode::ThreadSafe> ActiveInterceptor;
+	{
+		FScopeLock Lock(&Mutex);
+		ActiveInterceptor = Interceptor;
+	}
+
+	if (ActiveInterceptor.IsValid())
+	{
+		const FHttpRequestPtr Request = Entry.Request;
+		const FNakamaHttpRespondFn Respond = [Attempt, Request](ENakamaHttpOutcome Outcome, int32 HttpCode, const FString& Body)
+		{
+			const int64 ResponseBytes = FPlatformString::ConvertedLength<UTF8CHAR>(*Body, Body.Len());
+			Attempt->Resolve(Request, Outcome, HttpCode, Body, ResponseBytes);
+		};
+
+		if ((*ActiveInterceptor)(Entry.Request, Respond))
+		{
+			return;
+		}
+	}
+
+	Entry.Request->ProcessRequest();
+}
+
+void FNakamaHttpPipeline::FAttempt::Resolve(const FHttpRequestPtr& Request, ENakamaHttpOutcome Reported, int32 HttpCode, const FString& Body, int64 ResponseBytes)
+{
+	if (bResolved.exchange(true))
+	{
+		return;
+	}
+
+	// Always deliver exactly one terminal outcome so the retry chain (and the
+	// caller's success/error callback) can never be silently dropped. A
+	// response is only forwarded when the request was still active: a
+	// cancelled request or a released group is an expected outcome, reported
+	// as Cancelled so it is not logged as a fault.
+	ENakamaHttpOutcome Outcome = Reported;
+	if (TSharedPtr<FNakamaHttpRequestGroup, ESPMode::ThreadSafe> PinnedGroup = Group.Pin())
+	{
+		FScopeLock Lock(&PinnedGroup->ActiveRequestsMutex);
+		if (PinnedGroup->ActiveRequests.Remove(Request) == 0)
+		{
+			Outcome = ENakamaHttpOutcome::Cancelled; // cancelled or already reaped
+		}
+	}
+	else
+	{
+		Outcome = ENakamaHttpOutcome::Cancelled; // client gone
+	}
+
+	const bool bDeliverResponse = Outcome == ENakamaHttpOutcome::Response;
+	NAKAMA_TRACE_REGION_END(NetworkRegion);
+
+	DEC_DWORD_STAT(STAT_NakamaHttpInFlight);
+	if (Trace.IsValid())
+	{
+		FNakamaHttpMetrics::Get().RecordAttempt(*Trace,
+			bDeliverResponse ? HttpCode : 0,
+			QueueSeconds,
+			FPlatformTime::Seconds() - StartTime,
+			Request.IsValid() ? Request->GetContentLength() : 0,
+			bDeliverResponse ? ResponseBytes : 0);
+	}
+
+	// Free the slot before running the callback so a retry queues behind
+	// requests that were already waiting.
+	FNakamaHttpPipeline::Get().Finish(Outcome);
+
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR("Nakama::Http::Complete", NakamaHttpChannel);
+	if (bDeliverResponse)
+	{
+		OnComplete(Outcome, HttpCode, Body);
+	}
+	else
+	{
+		OnComplete(Outcome, 0, FString());
+	}
+}
+
+void FNakamaHttpPipeline::SetInterceptor(FNakamaHttpInterceptFn InInterceptor)
+{
+	FScopeLock Lock(&Mutex);
+	Interceptor = InInterceptor ? MakeShared<FNakamaHttpInterceptFn, ESPMode::ThreadSafe>(MoveTemp(InInterceptor)) : nullptr;
+}
+
+void FNakamaHttpPipeline::Finish(ENakamaHttpOutcome Outcome)
+{
+	TOptional<FQueuedRequest> Next;
+	{
+		FScopeLock Lock(&Mutex);
+		Stats.NumInFlight--;
+		switch (Outcome)
+		{
+		case ENakamaHttpOutcome::Response: Stats.NumResponses++; break;
+		case ENakamaHttpOutcome::ConnectionFailure: Stats.NumConnectionFailures++; break;
+		case ENakamaHttpOutcome::Cancelled: Stats.NumCancelled++; break;
+		case ENakamaHttpOutcome::Rejected: break; // never started, counted by Submit
+		}
+
+		if (NumQueued() > 0 && (MaxConcurrentRequests == 0 || Stats.NumInFlight < MaxConcurrentRequests))
+		{
+			Next.Emplace(PopQueued());
+			Stats.NumQueued = NumQueued();
+			Stats.NumInFlight++;
+		}
+	}
+
+	if (Next.IsSet())
+	{
+		DEC_DWORD_STAT(STAT_NakamaHttpQueued);
+		Start(MoveTemp(Next.GetValue()));
+	}
+}
+
+TArray<FNakamaHttpPipeline::FQueuedRequest> FNakamaHttpPipeline::RemoveQueued(const FNakamaHttpRequestGroup* Group)
+{
+	TArray<FQueuedRequest> Removed;
+	FScopeLock Lock(&Mutex);
+	CompactQueue();
+	for (int32 Index = Queue.Num() - 1; Index >= 0; --Index)
+	{
+		if (Queue[Index].Group.HasSameObject(Group))
+		{
+			Removed.Insert(MoveTemp(Queue[Index]), 0);
+			Queue.RemoveAt(Index);
+			DEC_DWORD_STAT(STAT_NakamaHttpQueued);
+		}
+	}
+	Stats.NumQueued = Queue.Num();
+	Stats.NumCancelled += Removed.Num();
+	return Removed;
+}
+
+FNakamaHttpPipeline::FQueuedRequest FNakamaHttpPipeline::PopQueued()
+{
+	FQueuedRequest Entry = MoveTemp(Queue[QueueHead++]);
+	if (QueueHead == Queue.Num())
+	{
+		Queue.Reset();
+		QueueHead = 0;
+	}
+	else if (QueueHead >= 64 && QueueHead * 2 >= Queue.Num())
+	{
+		// Drop the consumed prefix once it is at least half the array, so a
+		// long backlog drains in linear time instead of shifting on every pop.
+		CompactQueue();
+	}
+	return Entry;
+}
+
+void FNakamaHttpPipeline::CompactQueue()
+{
+	if (QueueHead > 0)
+	{
+		Queue.RemoveAt(0, QueueHead);
+		QueueHead = 0;
+	}
+}
@@ -0,0 +1,224 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaMemory.h"
+#include "HAL/MemoryBase.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include <atomic>
+
+LLM_DEFINE_TAG(Nakama);
+LLM_DEFINE_TAG(Nakama_Requests);
+LLM_DEFINE_TAG(Nakama_Responses);
+LLM_DEFINE_TAG(Nakama_Realtime);
+LLM_DEFINE_TAG(Satori);
+
+namespace
+{
+	constexpr int32 NumScopes = static_cast<int32>(ENakamaAllocScope::Num);
+
+	thread_local ENakamaAllocScope CurrentScope = ENakamaAllocScope::None;
+
+	std::atomic<bool> bCounting{false};
+	std::atomic<int64> NumAllocations[NumScopes] = {};
+	std::atomic<int64> NumBytes[NumScopes] = {};
+
+	// Forwards to the real allocator, counting allocations made inside a scope.
+	class FTrackingMalloc final : public FMalloc
+	{
+	public:
+		FMalloc* Inner = nullptr;
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			Track(Count);
+			return Inner->Malloc(Count, Alignment);
+		}
+
+		virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+		{
+			Track(Count);
+			return Inner->TryMalloc(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			Track(Count);
+			return Inner->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			Track(Count);
+			return Inner->TryRealloc(Original, Count, Alignment);
+		}
+
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3)
+		virtual void* MallocZeroed(SIZE_T Count, uint32 Alignment) override
+		{
+			Track(Count);
+			return Inner->MallocZeroed(Count, Alignment);
+		}
+
+		virtual void* TryMallocZeroed(SIZE_T Count, uint32 Alignment) override
+		{
+			Track(Count);
+			return Inner->TryMallocZeroed(Count, Alignment);
+		}
+#endif
+
+		// Everything else is the inner allocator's, so stats, trimming and
+		// console commands behave as if the proxy were not there.
+		virtual void Free(void* Original) override { Inner->Free(Original); }
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+		virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+		virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+		virtual void InitializeStatsMetadata() override { Inner->InitializeStatsMetadata(); }
+		virtual void UpdateStats() override { Inner->UpdateStats(); }
+		virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+		virtual void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+		virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+		virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+		virtual bool Exec(UWorld* InWorld, const TCHAR* Cmd, FOutputDevice& Ar) override { return Inner->Exec(InWorld, Cmd, Ar); }
+		virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+		virtual void OnMallocInitialized() override { Inner->OnMallocInitialized(); }
+		virtual void OnPreFork() override { Inner->OnPreFork(); }
+		virtual void OnPostFork() override { Inner->OnPostFork(); }
+#if ENGINE_MAJOR_VERSION >= 5
+		virtual uint64 GetTotalFreeCachedMemory() override { return Inner->GetTotalFreeCachedMemory(); }
+#endif
+
+	private:
+		static void Track(SIZE_T Count)
+		{
+			// Stays installed after Disable, so the disabled path must stay cheap.
+			if (!bCounting.load(std::memory_order_relaxed))
+			{
+				return;
+			}
+
+			const ENakamaAllocScope Scope = CurrentScope;
+			if (Scope != ENakamaAllocScope::None && Count > 0)
+			{
+				const int32 Index = static_cast<int32>(Scope);
+				NumAllocations[Index].fetch_add(1, std::memory_order_relaxed);
+				NumBytes[Index].fetch_add(static_cast<int64>(Count), std::memory_order_relaxed);
+			}
+		}
+	};
+
+	// Installed once and never freed or removed, so no thread can be left
+	// calling into a proxy that was taken out from under it.
+	FTrackingMalloc* Proxy = nullptr;
+}
+
+void FNakamaAllocationTracker::Install()
+{
+#if NAKAMA_ALLOC_TRACKING
+	check(IsInGameThread());
+	if (Proxy)
+	{
+		return;
+	}
+
+	FTrackingMalloc* NewProxy = new FTrackingMalloc();
+	NewProxy->Inner = GMalloc;
+
+	// Inner must be visible to other threads before they can reach the proxy.
+	FPlatformMisc::MemoryBarrier();
+	GMalloc = NewProxy;
+	Proxy = NewProxy;
+#endif
+}
+
+bool FNakamaAllocationTracker::IsInstalled()
+{
+	return Proxy != nullptr;
+}
+
+void FNakamaAllocationTracker::Enable()
+{
+#if NAKAMA_ALLOC_TRACKING
+	bCounting = true;
+#endif
+}
+
+void FNakamaAllocationTracker::Disable()
+{
+	bCounting = false;
+}
+
+bool FNakamaAllocationTracker::IsEnabled()
+{
+	return bCounting;
+}
+
+FNakamaAllocationCounters FNakamaAllocationTracker::GetCounters(ENakamaAllocScope Scope)
+{
+	FNakamaAllocationCounters Counters;
+	const int32 Index = static_cast<int32>(Scope);
+	if (Index > 0 && Index < NumScopes)
+	{
+		Counters.NumAllocations = NumAllocations[Index].load(std::memory_order_relaxed);
+		Counters.NumBytes = NumBytes[Index].load(std::memory_order_relaxed);
+	}
+	return Counters;
+}
+
+void FNakamaAllocationTracker::Reset()
+{
+	for (int32 Index = 0; Index < NumScopes; ++Index)
+	{
+		NumAllocations[Index] = 0;
+		NumBytes[Index] = 0;
+	}
+}
+
+const TCHAR* FNakamaAllocationTracker::GetScopeName(ENakamaAllocScope Scope)
+{
+	switch (Scope)
+	{
+	case ENakamaAllocScope::Requests: return TEXT("Requests");
+	case ENakamaAllocScope::Responses: return TEXT("Responses");
+	case ENakamaAllocScope::RealtimeSend: return TEXT("RealtimeSend");
+	case ENakamaAllocScope::RealtimeReceive: return TEXT("RealtimeReceive");
+	case ENakamaAllocScope::RealtimeDispatch: return TEXT("RealtimeDispatch");
+	case ENakamaAllocScope::SatoriRequests: return TEXT("SatoriRequests");
+	case ENakamaAllocScope::SatoriResponses: return TEXT("SatoriResponses");
+	case ENakamaAllocScope::Benchmark: return TEXT("Benchmark");
+	default: return TEXT("None");
+	}
+}
+
+FString FNakamaAllocationTracker::ToString()
+{
+	FString Out;
+	for (int32 Index = 1; Index < NumScopes; ++Index)
+	{
+		const ENakamaAllocScope Scope = static_cast<ENakamaAllocScope>(Index);
+		const FNakamaAllocationCounters Counters = GetCounters(Scope);
+		Out += FString::Printf(TEXT("%s: %lld allocations, %lld bytes\n"), GetScopeName(Scope), Counters.NumAllocations, Counters.NumBytes);
+	}
+	return Out;
+}
+
+ENakamaAllocScope FNakamaAllocationTracker::ExchangeScope(ENakamaAllocScope Scope)
+{
+	const ENakamaAllocScope Previous = CurrentScope;
+	CurrentScope = Scope;
+	return Previous;
+}
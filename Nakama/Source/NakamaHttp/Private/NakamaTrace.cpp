@@ -0,0 +1,90 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaTrace.h"
+#include "Misc/EngineVersionComparison.h"
+
+#if !UE_VERSION_OLDER_THAN(5, 2, 0)
+	#include "ProfilingDebugging/MiscTrace.h"
+	#define NAKAMA_TRACE_REGIONS 1
+#else
+	#define NAKAMA_TRACE_REGIONS 0
+#endif
+
+// Engines with region ids can keep overlapping regions of the same name apart.
+#if NAKAMA_TRACE_REGIONS && defined(TRACE_BEGIN_REGION_WITH_ID)
+	#define NAKAMA_TRACE_REGION_IDS 1
+#else
+	#define NAKAMA_TRACE_REGION_IDS 0
+#endif
+
+UE_TRACE_CHANNEL_DEFINE(NakamaHttpChannel);
+
+#if NAKAMA_TRACE_REGIONS
+// Only logged for regions that were begun, i.e. while their channel is enabled.
+UE_TRACE_EVENT_BEGIN(NakamaTrace, RegionBegin)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, RequestId)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Name)
+UE_TRACE_EVENT_END()
+#endif
+
+namespace
+{
+	std::atomic<uint64> NextRequestId{1};
+}
+
+FNakamaTraceRegion::FNakamaTraceRegion(const FString& InName)
+	: FNakamaTraceRegion(InName, NextRequestId.fetch_add(1, std::memory_order_relaxed))
+{
+}
+
+FNakamaTraceRegion::FNakamaTraceRegion(const FString& InName, uint64 InRequestId)
+	: Name(InName)
+	, RequestId(InRequestId)
+{
+#if NAKAMA_TRACE_REGIONS
+	UE_TRACE_LOG(NakamaTrace, RegionBegin, TraceLogChannel)
+		<< RegionBegin.Cycle(FPlatformTime::Cycles64())
+		<< RegionBegin.RequestId(RequestId)
+		<< RegionBegin.Name(*Name, Name.Len());
+#endif
+
+#if NAKAMA_TRACE_REGION_IDS
+	RegionId = TRACE_BEGIN_REGION_WITH_ID(*Name);
+#elif NAKAMA_TRACE_REGIONS
+	TRACE_BEGIN_REGION(*Name);
+#endif
+}
+
+FNakamaTraceRegion::~FNakamaTraceRegion()
+{
+	End();
+}
+
+void FNakamaTraceRegion::End()
+{
+	if (!bOpen.exchange(false))
+	{
+		return;
+	}
+
+#if NAKAMA_TRACE_REGION_IDS
+	TRACE_END_REGION_WITH_ID(RegionId);
+#elif NAKAMA_TRACE_REGIONS
+	TRACE_END_REGION(*Name);
+#endif
+}
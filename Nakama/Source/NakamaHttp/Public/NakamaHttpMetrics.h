@@ -0,0 +1,176 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include <atomic>
+
+DECLARE_STATS_GROUP(TEXT("Nakama"), STATGROUP_Nakama, STATCAT_Advanced);
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("HTTP Requests In Flight"), STAT_NakamaHttpInFlight, STATGROUP_Nakama, NAKAMAHTTP_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("HTTP Requests Queued"), STAT_NakamaHttpQueued, STATGROUP_Nakama, NAKAMAHTTP_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("HTTP Requests Completed"), STAT_NakamaHttpCompleted, STATGROUP_Nakama, NAKAMAHTTP_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("HTTP Retries"), STAT_NakamaHttpRetries, STATGROUP_Nakama, NAKAMAHTTP_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("HTTP Bytes Sent"), STAT_NakamaHttpBytesSent, STATGROUP_Nakama, NAKAMAHTTP_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("HTTP Bytes Received"), STAT_NakamaHttpBytesReceived, STATGROUP_Nakama, NAKAMAHTTP_API);
+
+/**
+ * Fixed-bucket latency histogram in milliseconds. Bucket upper bounds are
+ * 1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000, 10000 ms; the last
+ * bucket holds everything slower.
+ */
+struct NAKAMAHTTP_API FNakamaLatencyHistogram
+{
+	static constexpr int32 NumBuckets = 14;
+	static const double BucketUpperBoundsMs[NumBuckets - 1];
+
+	int64 Buckets[NumBuckets] = {};
+	int64 Count = 0;
+	double TotalMs = 0.0;
+	double MaxMs = 0.0;
+
+	void Add(double Ms);
+
+	double GetAverageMs() const { return Count > 0 ? TotalMs / Count : 0.0; }
+
+	/** Upper bound of the bucket holding the given percentile (0-100). */
+	double GetPercentileMs(double Percentile) const;
+};
+
+/** Aggregated metrics of one endpoint (backend, verb and normalized path). */
+struct NAKAMAHTTP_API FNakamaHttpEndpointMetrics
+{
+	FString Backend;
+	FString Method;
+	FString Endpoint;
+
+	/** Logical requests, each possibly spanning several attempts. */
+	int64 NumRequests = 0;
+	int64 NumSucceeded = 0;
+	int64 NumFailed = 0;
+	int64 NumCancelled = 0;
+
+	/** Attempts beyond the first. */
+	int64 NumRetries = 0;
+
+	int64 BytesSent = 0;
+	int64 BytesReceived = 0;
+
+	/** Responses per HTTP status; 0 counts attempts that got no response. */
+	TMap<int32, int64> StatusCodes;
+
+	/** Time waiting for a concurrency slot, per attempt. */
+	FNakamaLatencyHistogram Queue;
+
+	/** Time on the wire, per attempt. */
+	FNakamaLatencyHistogram Network;
+
+	/** Time parsing the response body before the caller's callback, per successful request. */
+	FNakamaLatencyHistogram Parse;
+
+	/** Time in the caller's success or error callback. */
+	FNakamaLatencyHistogram Callback;
+
+	/** From submission to the caller's callback returning, including retry delays. */
+	FNakamaLatencyHistogram Total;
+};
+
+/**
+ * Per-request record filled in by the transport and the client while a
+ * request runs, then folded into FNakamaHttpMetrics.
+ */
+struct NAKAMAHTTP_API FNakamaHttpRequestTrace
+{
+	FString Backend;
+	FString Method;
+	FString Endpoint;
+
+	double SubmitTime = 0.0;
+	int32 NumAttempts = 0;
+
+	FNakamaHttpRequestTrace(const FString& InBackend, const FString& InMethod, const FString& InEndpoint);
+};
+
+/**
+ * Process-wide per-endpoint request metrics for all Nakama and Satori
+ * clients. Thread-safe. Also feeds the STATGROUP_Nakama stats ("stat Nakama")
+ * and, when the CSV profiler or Unreal Insights is capturing, the Nakama CSV
+ * category and trace counters.
+ */
+class NAKAMAHTTP_API FNakamaHttpMetrics
+{
+public:
+
+	static FNakamaHttpMetrics& Get();
+
+	/** Recording is on by default; turning it off makes every Record call a no-op. */
+	void SetEnabled(bool bInEnabled) { bEnabled = bInEnabled; }
+	bool IsEnabled() const { return bEnabled; }
+
+	/**
+	 * Replace path parameters with "{id}" so per-object endpoints aggregate
+	 * under one key: ID-like segments (numbers, UUIDs, long hex strings) and
+	 * the segment naming the object after rpc, leaderboard, tournament, group,
+	 * user, channel, storage, message and owner.
+	 */
+	static FString NormalizeEndpoint(const FString& Endpoint);
+
+	/**
+	 * Call a client's success callback with its already parsed result. The
+	 * arguments are evaluated first, so the time before this call is recorded
+	 * as parsing and the time inside it as the callback.
+	 */
+	template <typename TCallback, typename... TArgs>
+	static void InvokeCallback(const TCallback& Callback, TArgs&&... Args)
+	{
+		ExchangeCallbackStart(FPlatformTime::Seconds());
+		Callback(Forward<TArgs>(Args)...);
+	}
+
+	/**
+	 * Set this thread's parse/callback split time and return the previous one
+	 * (0 if unset). Used by the clients around each completion handler.
+	 */
+	static double ExchangeCallbackStart(double Seconds);
+
+	/** Create the trace for a new logical request, or null while recording is disabled. */
+	TSharedPtr<FNakamaHttpRequestTrace, ESPMode::ThreadSafe> BeginRequest(const FString& Backend, const FString& Method, const FString& Endpoint) const;
+
+	/** Record one attempt. Called by the transport. */
+	void RecordAttempt(const FNakamaHttpRequestTrace& Trace, int32 HttpCode, double QueueSeconds, double NetworkSeconds, int64 BytesSent, int64 BytesReceived);
+
+	/** Record the end of a logical request. Called by the client once the caller's callback has returned. */
+	void RecordRequest(const FNakamaHttpRequestTrace& Trace, bool bSucceeded, bool bCancelled, double ParseSeconds, double CallbackSeconds);
+
+	/** Copy of all endpoint metrics, busiest endpoint (by total time) first. */
+	TArray<FNakamaHttpEndpointMetrics> GetSnapshot() const;
+
+	/** Clear all endpoint metrics. */
+	void Reset();
+
+	/** Write the snapshot as CSV, one row per endpoint. */
+	bool ExportCsv(const FString& FilePath) const;
+
+private:
+
+	FNakamaHttpEndpointMetrics& FindOrAdd(const FNakamaHttpRequestTrace& Trace);
+
+	mutable FCriticalSection Mutex;
+	TMap<FString, FNakamaHttpEndpointMetrics> Endpoints;
+	std::atomic<bool> bEnabled { true };
+};
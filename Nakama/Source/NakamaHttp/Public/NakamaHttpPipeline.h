@@ -0,0 +1,191 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+#include "NakamaHttpMetrics.h"
+#include "NakamaTrace.h"
+
+/** How a single HTTP attempt resolved. */
+enum class ENakamaHttpOutcome : uint8
+{
+	Response,          // a response arrived (any HTTP status)
+	ConnectionFailure, // transport-level failure, no response (retry-terminal)
+	Cancelled,         // request cancelled or owning client released (not a fault)
+	Rejected,          // turned away or dropped by a full request queue (not retried)
+};
+
+/** What a bounded SDK queue does with a new entry once it is full. */
+enum class ENakamaOverflowPolicy : uint8
+{
+	Reject,     // fail the new entry and keep everything already queued
+	DropOldest, // fail the oldest queued entry to make room for the new one
+};
+
+/** Terminal callback for one attempt. HttpCode and Body are only meaningful for Response. */
+using FNakamaHttpCompleteFn = TFunction<void(ENakamaHttpOutcome /*Outcome*/, int32 /*HttpCode*/, const FString& /*Body*/)>;
+
+/** Answer to an intercepted request. Body is only meaningful for Response. */
+using FNakamaHttpRespondFn = TFunction<void(ENakamaHttpOutcome /*Outcome*/, int32 /*HttpCode*/, const FString& /*Body*/)>;
+
+/**
+ * Looks at an outgoing request and returns true to answer it through Respond
+ * (once, at any later time) instead of sending it over the network. Used to
+ * run clients against an in-process stand-in server.
+ */
+using FNakamaHttpInterceptFn = TFunction<bool(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& /*Request*/, const FNakamaHttpRespondFn& /*Respond*/)>;
+
+/** Process-wide transport counters (see FNakamaHttpPipeline::GetStats). */
+struct FNakamaHttpStats
+{
+	int32 NumInFlight = 0;
+	int32 NumQueued = 0;
+	int32 PeakInFlight = 0;
+	int64 NumStarted = 0;
+	int64 NumResponses = 0;
+	int64 NumConnectionFailures = 0;
+	int64 NumCancelled = 0;
+	int64 NumRejected = 0; // refused by a full queue under ENakamaOverflowPolicy::Reject
+	int64 NumDropped = 0;  // evicted from a full queue under ENakamaOverflowPolicy::DropOldest
+};
+
+/**
+ * The requests of one client. Cancelling a group cancels its in-flight and
+ * queued requests without touching other clients' traffic. When the group
+ * is released, anything still attached to it resolves as Cancelled.
+ */
+class NAKAMAHTTP_API FNakamaHttpRequestGroup : public TSharedFromThis<FNakamaHttpRequestGroup, ESPMode::ThreadSafe>
+{
+public:
+
+	/**
+	 * Submit a fully built request through the shared pipeline. OnComplete is
+	 * called exactly once, on the thread the HTTP module completes on. If a
+	 * Trace is given, the attempt's queue and network time, bytes and status
+	 * are recorded against it (see FNakamaHttpMetrics).
+	 */
+	void Process(
+		const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request,
+		FNakamaHttpCompleteFn OnComplete,
+		const TSharedPtr<FNakamaHttpRequestTrace, ESPMode::ThreadSafe>& Trace = nullptr);
+
+	/** Cancel every queued and in-flight request; each resolves as Cancelled. */
+	void CancelAll();
+
+	/** Number of requests of this group currently on the wire. */
+	int32 NumActive() const;
+
+private:
+
+	friend class FNakamaHttpPipeline;
+
+	TArray<FHttpRequestPtr> ActiveRequests;
+	mutable FCriticalSection ActiveRequestsMutex;
+};
+
+/**
+ * HTTP pipeline shared by every Nakama and Satori client in the process.
+ *
+ * Requests are started immediately while fewer than MaxConcurrentRequests are
+ * in flight and queued in FIFO order otherwise, so one budget covers all
+ * backend traffic of the game. Thread-safe.
+ */
+class NAKAMAHTTP_API FNakamaHttpPipeline
+{
+public:
+
+	static FNakamaHttpPipeline& Get();
+
+	/** Cap on concurrently running requests across all clients. 0 (default) means unlimited. */
+	void SetMaxConcurrentRequests(int32 InMaxConcurrentRequests);
+	int32 GetMaxConcurrentRequests() const;
+
+	/**
+	 * Cap on requests waiting for a free slot across all clients, for a fixed
+	 * memory ceiling on long-running processes. Only applies while
+	 * MaxConcurrentRequests is set. Requests turned away by Policy resolve as
+	 * Rejected. 0 (default) means unlimited.
+	 */
+	void SetMaxQueuedRequests(int32 InMaxQueuedRequests, ENakamaOverflowPolicy Policy = ENakamaOverflowPolicy::Reject);
+	int32 GetMaxQueuedRequests() const;
+
+	/** Snapshot of the transport counters. */
+	FNakamaHttpStats GetStats() const;
+
+	/**
+	 * Route every request started from now on through Interceptor before it
+	 * reaches the network. Pass nullptr to go back to the HTTP module. Queueing,
+	 * cancellation, metrics and stats apply to intercepted requests as usual.
+	 */
+	void SetInterceptor(FNakamaHttpInterceptFn Interceptor);
+
+	/**
+	 * Run Work once after Seconds on the core ticker. Work always runs, so a
+	 * retry scheduled for a since-released client still resolves its callbacks.
+	 */
+	static void Delay(float Seconds, TFunction<void()> Work);
+
+private:
+
+	friend class FNakamaHttpRequestGroup;
+
+	struct FQueuedRequest
+	{
+		TWeakPtr<FNakamaHttpRequestGroup, ESPMode::ThreadSafe> Group;
+		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request;
+		FNakamaHttpCompleteFn OnComplete;
+		TSharedPtr<FNakamaHttpRequestTrace, ESPMode::ThreadSafe> Trace;
+		double SubmitTime = 0.0;
+	};
+
+	// One started request. Resolved exactly once, by the HTTP module or by an
+	// interceptor's Respond, whichever comes first.
+	struct FAttempt
+	{
+		TWeakPtr<FNakamaHttpRequestGroup, ESPMode::ThreadSafe> Group;
+		FNakamaHttpCompleteFn OnComplete;
+		TSharedPtr<FNakamaHttpRequestTrace, ESPMode::ThreadSafe> Trace;
+		double StartTime = 0.0;
+		double QueueSeconds = 0.0;
+		FNakamaTraceRegionPtr NetworkRegion;
+		std::atomic<bool> bResolved{false};
+
+		void Resolve(const FHttpRequestPtr& Request, ENakamaHttpOutcome Reported, int32 HttpCode, const FString& Body, int64 ResponseBytes);
+	};
+
+	void Submit(FQueuedRequest&& Entry);
+	void Start(FQueuedRequest&& Entry);
+	void Finish(ENakamaHttpOutcome Outcome);
+	TArray<FQueuedRequest> RemoveQueued(const FNakamaHttpRequestGroup* Group);
+
+	// Queue helpers, called with Mutex held.
+	int32 NumQueued() const { return Queue.Num() - QueueHead; }
+	FQueuedRequest PopQueued();
+	void CompactQueue();
+
+	mutable FCriticalSection Mutex;
+
+	// Waiting requests are Queue[QueueHead..], oldest first.
+	TArray<FQueuedRequest> Queue;
+	int32 QueueHead = 0;
+	int32 MaxConcurrentRequests = 0;
+	int32 MaxQueuedRequests = 0;
+	ENakamaOverflowPolicy QueueOverflowPolicy = ENakamaOverflowPolicy::Reject;
+	FNakamaHttpStats Stats;
+	TSharedPtr<FNakamaHttpInterceptFn, ESPMode::ThreadSafe> Interceptor;
+};
@@ -0,0 +1,122 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+
+// Low Level Memory tracker tags for SDK allocations, shown under "Nakama" and
+// "Satori" in memreport -llm and the Unreal Insights memory view.
+LLM_DECLARE_TAG_API(Nakama, NAKAMAHTTP_API);
+LLM_DECLARE_TAG_API(Nakama_Requests, NAKAMAHTTP_API);
+LLM_DECLARE_TAG_API(Nakama_Responses, NAKAMAHTTP_API);
+LLM_DECLARE_TAG_API(Nakama_Realtime, NAKAMAHTTP_API);
+LLM_DECLARE_TAG_API(Satori, NAKAMAHTTP_API);
+
+// Build-time switch for the allocation counters. Scopes compile to the LLM
+// tag alone when it is 0, e.g. add "NAKAMA_ALLOC_TRACKING=0" to
+// PublicDefinitions. Shipping builds leave it off. Even when compiled in,
+// nothing is counted unless the proxy is installed (-NakamaAllocTracking).
+#ifndef NAKAMA_ALLOC_TRACKING
+	#define NAKAMA_ALLOC_TRACKING !UE_BUILD_SHIPPING
+#endif
+
+/** SDK code paths allocations are counted against. */
+enum class ENakamaAllocScope : uint8
+{
+	None,
+	Requests,          // Building and submitting Nakama REST requests
+	Responses,         // Parsing Nakama REST responses and running their callbacks
+	RealtimeSend,      // Serializing and sending realtime envelopes
+	RealtimeReceive,   // Decoding received realtime frames
+	RealtimeDispatch,  // Building realtime messages and running their callbacks
+	SatoriRequests,
+	SatoriResponses,
+	Benchmark,         // Code measured by the NakamaBenchmarks decode benchmarks
+	Num
+};
+
+struct NAKAMAHTTP_API FNakamaAllocationCounters
+{
+	int64 NumAllocations = 0;
+	int64 NumBytes = 0;
+};
+
+/**
+ * Optional per-scope heap allocation counters.
+ *
+ * While enabled, every allocation made inside a NAKAMA_MEMORY_SCOPE is
+ * counted against that scope's counters, on any thread. Counting goes through
+ * a forwarding proxy installed as GMalloc, which is opt-in: NakamaHttp only
+ * installs it when the command line has -NakamaAllocTracking, and then never
+ * removes it. The swap is not synchronized with other threads; a thread that
+ * still sees the previous GMalloc just allocates without being counted, and
+ * the proxy forwards every call to that same allocator, so mixing the two is
+ * safe. Without the proxy, Enable counts nothing. Enable and Disable only
+ * switch counting and are safe to call from any thread at any time.
+ */
+class NAKAMAHTTP_API FNakamaAllocationTracker
+{
+public:
+
+	/** Install the counting proxy as GMalloc. Called once by the NakamaHttp module at startup when -NakamaAllocTracking is set. */
+	static void Install();
+
+	/** Whether the counting proxy is installed, i.e. whether Enable will count anything. */
+	static bool IsInstalled();
+
+	static void Enable();
+	static void Disable();
+	static bool IsEnabled();
+
+	static FNakamaAllocationCounters GetCounters(ENakamaAllocScope Scope);
+	static void Reset();
+
+	static const TCHAR* GetScopeName(ENakamaAllocScope Scope);
+
+	/** One line per scope with its counts, for logs and test output. */
+	static FString ToString();
+
+	/** Make Scope current on this thread and return the previous one. */
+	static ENakamaAllocScope ExchangeScope(ENakamaAllocScope Scope);
+};
+
+/** Counts allocations on this thread against a scope until it goes out of scope. */
+class FNakamaAllocationScope
+{
+public:
+	explicit FNakamaAllocationScope(ENakamaAllocScope Scope)
+		: Previous(FNakamaAllocationTracker::ExchangeScope(Scope))
+	{
+	}
+
+	~FNakamaAllocationScope()
+	{
+		FNakamaAllocationTracker::ExchangeScope(Previous);
+	}
+
+private:
+	ENakamaAllocScope Previous;
+};
+
+#if NAKAMA_ALLOC_TRACKING
+	#define NAKAMA_MEMORY_SCOPE(Tag, Scope) \
+		LLM_SCOPE_BYTAG(Tag); \
+		const FNakamaAllocationScope ANONYMOUS_VARIABLE(NakamaAllocationScope)(ENakamaAllocScope::Scope)
+#else
+	#define NAKAMA_MEMORY_SCOPE(Tag, Scope) LLM_SCOPE_BYTAG(Tag)
+#endif
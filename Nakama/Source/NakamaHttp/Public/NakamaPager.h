@@ -0,0 +1,274 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Describes how to page through a list struct. Specialize for each list type:
+ *
+ *   static const FString& GetCursor(const ListType& Page); // cursor of the page after this one
+ *   static TArray<ItemType>& GetItems(ListType& Page);
+ */
+template <typename ListType>
+struct TNakamaPageTraits;
+
+/**
+ * Walks a cursor-based list endpoint page by page.
+ *
+ * Fetch is called with the cursor of the page to load (empty for the first
+ * page unless a start cursor was given). While the caller consumes a page, the
+ * following one is already requested, so scrolling a long list costs one
+ * round trip up front rather than one per page. Paging ends when the server
+ * returns an empty page or cursor, a cursor it already returned, or when
+ * MaxItems items have been delivered (the last page is trimmed to the budget).
+ *
+ * Pending requests keep the pager alive; Cancel drops them and any prefetched
+ * page without calling back. Must be used from the game thread.
+ */
+template <typename ListType, typename ErrorType>
+class TNakamaPager : public TSharedFromThis<TNakamaPager<ListType, ErrorType>>
+{
+public:
+
+	using FPageCallback = TFunction<void(const ListType& Page)>;
+	using FErrorCallback = TFunction<void(const ErrorType& Error)>;
+	using FFetchPage = TFunction<void(const FString& Cursor, const FPageCallback& OnPage, const FErrorCallback& OnError)>;
+
+	static TSharedRef<TNakamaPager> Create(FFetchPage Fetch, const FString& StartCursor = FString())
+	{
+		return MakeShareable(new TNakamaPager(MoveTemp(Fetch), StartCursor));
+	}
+
+	/** Total items to deliver before stopping, 0 for no limit. */
+	int32 MaxItems = 0;
+
+	/** Request the following page as soon as one is delivered. */
+	bool bPrefetch = true;
+
+	/**
+	 * Deliver the next page, from the prefetch if it already arrived. Calling
+	 * Next with no pages left delivers an empty page. A failed page can be
+	 * retried by calling Next again.
+	 */
+	void Next(FPageCallback OnPage, FErrorCallback OnError)
+	{
+		if (bCancelled)
+		{
+			return;
+		}
+
+		check(!PendingOnPage && !PendingOnError);
+		PendingOnPage = MoveTemp(OnPage);
+		PendingOnError = MoveTemp(OnError);
+
+		if (State == EState::Idle)
+		{
+			if (bExhausted)
+			{
+				ReadyPage.Emplace();
+				State = EState::Ready;
+			}
+			else
+			{
+				StartFetch();
+			}
+		}
+		TryDeliver();
+	}
+
+	/**
+	 * Deliver every remaining page in order. OnPage may return false to stop
+	 * early; OnComplete runs once paging ends or is stopped, but not on error
+	 * or Cancel.
+	 */
+	void ForEachPage(TFunction<bool(const ListType& Page)> OnPage, TFunction<void()> OnComplete, FErrorCallback OnError)
+	{
+		if (!HasMore())
+		{
+			if (OnComplete) { OnComplete(); }
+			return;
+		}
+
+		TSharedRef<TNakamaPager> Self = this->AsShared();
+		Next(
+			[Self, OnPage, OnComplete, OnError](const ListType& Page)
+			{
+				if (OnPage && !OnPage(Page))
+				{
+					Self->Cancel();
+					if (OnComplete) { OnComplete(); }
+					return;
+				}
+				Self->ForEachPage(OnPage, OnComplete, OnError);
+			},
+			OnError);
+	}
+
+	/** Stop paging. Callbacks for pages not yet delivered are dropped. */
+	void Cancel()
+	{
+		bCancelled = true;
+		ReadyPage.Reset();
+		ReadyError.Reset();
+		PendingOnPage = nullptr;
+		PendingOnError = nullptr;
+	}
+
+	/** @return True while Next can deliver a non-empty page. */
+	bool HasMore() const
+	{
+		return !bCancelled && (!bExhausted || (State == EState::Ready && ReadyPage.IsSet()));
+	}
+
+	bool IsCancelled() const { return bCancelled; }
+
+	/** @return Items delivered so far. */
+	int32 GetNumItems() const { return NumDeliveredItems; }
+
+	/** @return Pages delivered so far. */
+	int32 GetNumPages() const { return NumDeliveredPages; }
+
+	/**
+	 * @return Cursor of the next page to fetch, for resuming later. When
+	 * MaxItems trimmed the last page, this is that page's own cursor, so
+	 * resuming fetches it again rather than skipping the trimmed items.
+	 */
+	const FString& GetCursor() const { return Cursor; }
+
+private:
+
+	using FTraits = TNakamaPageTraits<ListType>;
+
+	enum class EState : uint8
+	{
+		Idle,
+		InFlight,
+		Ready, // ReadyPage or ReadyError is set
+	};
+
+	TNakamaPager(FFetchPage InFetch, const FString& StartCursor)
+		: Fetch(MoveTemp(InFetch))
+		, Cursor(StartCursor)
+	{
+	}
+
+	void StartFetch()
+	{
+		State = EState::InFlight;
+		TSharedRef<TNakamaPager> Self = this->AsShared();
+		Fetch(Cursor,
+			[Self](const ListType& Page)
+			{
+				Self->HandlePage(Page);
+			},
+			[Self](const ErrorType& Error)
+			{
+				if (!Self->bCancelled)
+				{
+					Self->ReadyError.Emplace(Error);
+					Self->State = EState::Ready;
+					Self->TryDeliver();
+				}
+			});
+	}
+
+	void HandlePage(const ListType& Received)
+	{
+		if (bCancelled)
+		{
+			return;
+		}
+
+		ListType Page = Received;
+		auto& Items = FTraits::GetItems(Page);
+		const FString& NextCursor = FTraits::GetCursor(Page);
+
+		// A page cut short by MaxItems keeps the cursor it was fetched with:
+		// NextCursor would skip the items trimmed from it.
+		bool bTrimmed = false;
+		if (MaxItems > 0 && NumFetchedItems + Items.Num() >= MaxItems)
+		{
+			bTrimmed = NumFetchedItems + Items.Num() > MaxItems;
+			Items.SetNum(MaxItems - NumFetchedItems);
+			bExhausted = true;
+		}
+		if (Items.Num() == 0 || NextCursor.IsEmpty() || NextCursor == Cursor)
+		{
+			bExhausted = true;
+		}
+
+		NumFetchedItems += Items.Num();
+		if (!bTrimmed)
+		{
+			Cursor = NextCursor;
+		}
+		ReadyPage.Emplace(MoveTemp(Page));
+		State = EState::Ready;
+		TryDeliver();
+	}
+
+	void TryDeliver()
+	{
+		if (State != EState::Ready || (!PendingOnPage && !PendingOnError))
+		{
+			return;
+		}
+
+		FPageCallback OnPage = MoveTemp(PendingOnPage);
+		FErrorCallback OnError = MoveTemp(PendingOnError);
+		PendingOnPage = nullptr;
+		PendingOnError = nullptr;
+		State = EState::Idle;
+
+		if (ReadyError.IsSet())
+		{
+			// The cursor did not advance, so the next Next retries this page.
+			const ErrorType Error = MoveTemp(ReadyError.GetValue());
+			ReadyError.Reset();
+			if (OnError) { OnError(Error); }
+			return;
+		}
+
+		ListType Page = MoveTemp(ReadyPage.GetValue());
+		ReadyPage.Reset();
+		NumDeliveredPages++;
+		NumDeliveredItems += FTraits::GetItems(Page).Num();
+
+		// Overlap the next round trip with the caller's handling of this page.
+		if (bPrefetch && !bExhausted)
+		{
+			StartFetch();
+		}
+
+		if (OnPage) { OnPage(Page); }
+	}
+
+	FFetchPage Fetch;
+	FString Cursor;
+	EState State = EState::Idle;
+	bool bExhausted = false;
+	bool bCancelled = false;
+	int32 NumFetchedItems = 0;
+	int32 NumDeliveredItems = 0;
+	int32 NumDeliveredPages = 0;
+
+	TOptional<ListType> ReadyPage;
+	TOptional<ErrorType> ReadyError;
+	FPageCallback PendingOnPage;
+	FErrorCallback PendingOnError;
+};
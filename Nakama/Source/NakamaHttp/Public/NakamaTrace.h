@@ -0,0 +1,75 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Trace.h"
+#include <atomic>
+
+// Insights channel for REST request activity (enable with -trace=default,NakamaHttp).
+UE_TRACE_CHANNEL_EXTERN(NakamaHttpChannel, NAKAMAHTTP_API);
+
+/**
+ * A named span of wall time that may begin and end on different threads or
+ * ticks, shown as a timing region in Unreal Insights. The region ends when
+ * End is called or the object is destroyed, whichever happens first.
+ *
+ * Names must be fixed per call site or endpoint: Insights makes one timer per
+ * distinct name, so per-request details do not belong in them. Each region
+ * carries a request id instead (the given one, or a sequence number), logged
+ * with its name as a NakamaTrace.RegionBegin event. Overlapping regions with
+ * the same name are told apart by id on engines that support it, and paired
+ * by name on older ones. Regions need Unreal Engine 5.2 or later; on older
+ * engines they are no-ops.
+ */
+class NAKAMAHTTP_API FNakamaTraceRegion
+{
+public:
+
+	/** Without a request id, the region gets the next sequence number. */
+	explicit FNakamaTraceRegion(const FString& InName);
+	FNakamaTraceRegion(const FString& InName, uint64 InRequestId);
+	~FNakamaTraceRegion();
+
+	FNakamaTraceRegion(const FNakamaTraceRegion&) = delete;
+	FNakamaTraceRegion& operator=(const FNakamaTraceRegion&) = delete;
+
+	void End();
+
+private:
+
+	FString Name;
+	uint64 RequestId = 0;
+	uint64 RegionId = 0;
+	std::atomic<bool> bOpen{true};
+};
+
+using FNakamaTraceRegionPtr = TSharedPtr<FNakamaTraceRegion, ESPMode::ThreadSafe>;
+
+/**
+ * Begin a region if Channel is enabled, returning a null pointer otherwise.
+ * NameExpr and the optional request id are only evaluated when the channel is
+ * enabled, so building them costs nothing while tracing is off.
+ */
+#define NAKAMA_TRACE_REGION_BEGIN(Channel, NameExpr, ...) \
+	(UE_TRACE_CHANNELEXPR_IS_ENABLED(Channel) \
+		? FNakamaTraceRegionPtr(MakeShared<FNakamaTraceRegion, ESPMode::ThreadSafe>(NameExpr, ##__VA_ARGS__)) \
+		: FNakamaTraceRegionPtr())
+
+/** End a region returned by NAKAMA_TRACE_REGION_BEGIN, if any. */
+#define NAKAMA_TRACE_REGION_END(Region) \
+	do { if (Region.IsValid()) { Region->End(); } } while (0)
@@ -0,0 +1,50 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+using UnrealBuildTool;
+using System.IO;
+
+// In-process stand-in for a Nakama server: answers REST requests and realtime
+// frames locally so clients can be exercised without a running server.
+public class NakamaMockServer : ModuleRules
+{
+	public NakamaMockServer(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+#if UE_5_8_OR_LATER
+		CppStandard = CppStandardVersion.Cpp20;
+#endif
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core", "HTTP", "WebSockets", "Json", "NakamaHttp"
+			}
+			);
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"CoreUObject",
+				"NakamaUnreal"
+			}
+			);
+
+		PublicIncludePaths.Add(Path.Combine(ModuleDirectory, "Public"));
+		PrivateIncludePaths.Add(Path.Combine(ModuleDirectory, "Public"));
+	}
+}
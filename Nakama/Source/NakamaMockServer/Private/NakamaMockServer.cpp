@@ -0,0 +1,1178 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaMockServer.h"
+#include "NakamaMockWebSocket.h"
+#include "NakamaJsonMergePatch.h"
+#include "NakamaRealtimeClient.h"
+#include "NakamaUtils.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Misc/Base64.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "Modules/ModuleManager.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+DEFINE_LOG_CATEGORY(LogNakamaMockServer);
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, NakamaMockServer)
+
+namespace
+{
+	TSharedPtr<FJsonObject> ParseJson(const FString& Json)
+	{
+		TSharedPtr<FJsonObject> Object;
+		const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+		FJsonSerializer::Deserialize(Reader, Object);
+		return Object;
+	}
+
+	void CopyField(const FJsonObject& From, FJsonObject& To, const FString& Name)
+	{
+		if (const TSharedPtr<FJsonValue> Value = From.TryGetField(Name))
+		{
+			To.SetField(Name, Value);
+		}
+	}
+
+	FString NewId()
+	{
+		return FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensLower);
+	}
+
+	FString Now()
+	{
+		return FDateTime::UtcNow().ToIso8601();
+	}
+
+	FString Base64UrlEncode(const FString& Text)
+	{
+		const FTCHARToUTF8 Utf8(*Text);
+		FString Encoded = FBase64::Encode(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+		Encoded.ReplaceInline(TEXT("+"), TEXT("-"));
+		Encoded.ReplaceInline(TEXT("/"), TEXT("_"));
+		while (Encoded.EndsWith(TEXT("=")))
+		{
+			Encoded = Encoded.LeftChop(1);
+		}
+		return Encoded;
+	}
+
+	void SplitUrl(const FString& Url, FString& OutHost, FString& OutPath, FString& OutQuery)
+	{
+		FString Rest = Url;
+		const int32 SchemeEnd = Rest.Find(TEXT("://"));
+		if (SchemeEnd != INDEX_NONE)
+		{
+			Rest = Rest.RightChop(SchemeEnd + 3);
+		}
+
+		int32 PathStart;
+		if (!Rest.FindChar(TEXT('/'), PathStart))
+		{
+			PathStart = Rest.Len();
+		}
+
+		OutHost = Rest.Left(PathStart);
+		int32 PortStart;
+		if (OutHost.FindChar(TEXT(':'), PortStart))
+		{
+			OutHost = OutHost.Left(PortStart);
+		}
+
+		const FString PathAndQuery = Rest.RightChop(PathStart);
+		if (!PathAndQuery.Split(TEXT("?"), &OutPath, &OutQuery))
+		{
+			OutPath = PathAndQuery;
+			OutQuery.Empty();
+		}
+		if (OutPath.IsEmpty())
+		{
+			OutPath = TEXT("/");
+		}
+	}
+
+	FString StorageId(const FString& Collection, const FString& Key, const FString& UserId)
+	{
+		return Collection + TEXT("/") + Key + TEXT("/") + UserId;
+	}
+
+	// Storage permissions arrive as numbers or numeric strings.
+	int32 GetPermission(const FJsonObject& Object, const FString& Name, int32 Default)
+	{
+		double Number = Default;
+		const TSharedPtr<FJsonValue> Value = Object.TryGetField(Name);
+		return Value.IsValid() && Value->TryGetNumber(Number) ? static_cast<int32>(Number) : Default;
+	}
+
+	FNakamaMockResponse ErrorResponse(int32 HttpCode, int32 GrpcCode, const FString& Message)
+	{
+		const TSharedRef<FJsonObject> Error = MakeShared<FJsonObject>();
+		Error->SetStringField(TEXT("error"), Message);
+		Error->SetNumberField(TEXT("code"), GrpcCode);
+		Error->SetStringField(TEXT("message"), Message);
+		return FNakamaMockResponse(HttpCode, FNakamaUtils::EncodeJson(Error));
+	}
+
+	TSharedRef<FJsonObject> MakePresence(const FNakamaMockWebSocket& Socket)
+	{
+		const TSharedRef<FJsonObject> Presence = MakeShared<FJsonObject>();
+		Presence->SetStringField(TEXT("user_id"), Socket.GetUserId());
+		Presence->SetStringField(TEXT("session_id"), Socket.GetSessionId());
+		Presence->SetStringField(TEXT("username"), Socket.GetUsername());
+		return Presence;
+	}
+
+	TArray<TSharedPtr<FJsonValue>> ToValues(const TArray<TSharedRef<FJsonObject>>& Objects)
+	{
+		TArray<TSharedPtr<FJsonValue>> Values;
+		for (const TSharedRef<FJsonObject>& Object : Objects)
+		{
+			Values.Add(MakeShared<FJsonValueObject>(Object));
+		}
+		return Values;
+	}
+
+	// {"<Type>": {"<Key>": [Presence]}} for presence join/leave events.
+	FString PresenceEvent(const FString& Type, const FString& IdField, const FString& Id, const FString& Key, const FNakamaMockWebSocket& Socket)
+	{
+		const TSharedRef<FJsonObject> Event = MakeShared<FJsonObject>();
+		Event->SetStringField(IdField, Id);
+		Event->SetArrayField(Key, { MakeShared<FJsonValueObject>(MakePresence(Socket)) });
+
+		const TSharedRef<FJsonObject> Envelope = MakeShared<FJsonObject>();
+		Envelope->SetObjectField(Type, Event);
+		return FNakamaUtils::EncodeJson(Envelope);
+	}
+}
+
+FString FNakamaMockRequest::GetQueryParam(const FString& Name) const
+{
+	TArray<FString> Pairs;
+	Query.ParseIntoArray(Pairs, TEXT("&"));
+	for (const FString& Pair : Pairs)
+	{
+		FString Key, Value;
+		if (Pair.Split(TEXT("="), &Key, &Value) && Key == Name)
+		{
+			return FGenericPlatformHttp::UrlDecode(Value);
+		}
+	}
+	return FString();
+}
+
+TArray<FString> FNakamaMockRequest::GetQueryParams(const FString& Name) const
+{
+	TArray<FString> Values;
+	TArray<FString> Pairs;
+	Query.ParseIntoArray(Pairs, TEXT("&"));
+	for (const FString& Pair : Pairs)
+	{
+		FString Key, Value;
+		if (Pair.Split(TEXT("="), &Key, &Value) && Key == Name)
+		{
+			Values.Add(FGenericPlatformHttp::UrlDecode(Value));
+		}
+	}
+	return Values;
+}
+
+TSharedRef<FNakamaMockServer, ESPMode::ThreadSafe> FNakamaMockServer::Create(const FNakamaMockServerSettings& Settings)
+{
+	TSharedRef<FNakamaMockServer, ESPMode::ThreadSafe> Server = MakeShareable(new FNakamaMockServer());
+	Server->Settings = Settings;
+	Server->AddDefaultRoutes();
+	return Server;
+}
+
+FNakamaMockServer::~FNakamaMockServer()
+{
+	if (bRunning)
+	{
+		Stop();
+	}
+}
+
+void FNakamaMockServer::Start()
+{
+	if (bRunning)
+	{
+		return;
+	}
+
+	{
+		FScopeLock Lock(&Mutex);
+		Random.Initialize(Settings.RandomSeed);
+		bRunning = true;
+	}
+
+	HttpRequests = 0;
+	HttpErrorsInjected = 0;
+	ConnectionFailuresInjected = 0;
+	FramesReceived = 0;
+	FramesSent = 0;
+	RealtimeErrorsInjected = 0;
+
+	TWeakPtr<FNakamaMockServer, ESPMode::ThreadSafe> WeakThis = AsShared();
+	FNakamaHttpPipeline::Get().SetInterceptor(
+		[WeakThis](const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request, const FNakamaHttpRespondFn& Respond)
+	{
+		TSharedPtr<FNakamaMockServer, ESPMode::ThreadSafe> Server = WeakThis.Pin();
+		return Server.IsValid() && Server->Intercept(Request, Respond);
+	});
+
+	PushAccumulator = 0.0;
+	PushTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FNakamaMockServer::TickPush));
+
+	UE_LOG(LogNakamaMockServer, Log, TEXT("Mock server started (host: %s)"), Settings.Host.IsEmpty() ? TEXT("any") : *Settings.Host);
+}
+
+void FNakamaMockServer::Stop()
+{
+	if (!bRunning)
+	{
+		return;
+	}
+
+	{
+		FScopeLock Lock(&Mutex);
+		bRunning = false;
+	}
+
+	FNakamaHttpPipeline::Get().SetInterceptor(nullptr);
+	FTSTicker::GetCoreTicker().RemoveTicker(PushTickerHandle);
+	PushTickerHandle.Reset();
+
+	DropConnections();
+
+	UE_LOG(LogNakamaMockServer, Log, TEXT("Mock server stopped"));
+}
+
+void FNakamaMockServer::SetRoute(const FString& Verb, const FString& Path, FNakamaMockRouteFn Handler)
+{
+	FRouteEntry Entry;
+	Entry.Verb = Verb;
+	Entry.bPrefix = Path.EndsWith(TEXT("*"));
+	Entry.Path = Entry.bPrefix ? Path.LeftChop(1) : Path;
+	Entry.Handler = MoveTemp(Handler);
+
+	FScopeLock Lock(&Mutex);
+	Routes.Add(MoveTemp(Entry));
+}
+
+void FNakamaMockServer::SetCannedResponse(const FString& Verb, const FString& Path, int32 Code, const FString& Body)
+{
+	const FNakamaMockResponse Response(Code, Body);
+	SetRoute(Verb, Path, [Response](const FNakamaMockRequest&) { return Response; });
+}
+
+void FNakamaMockServer::ClearRoutes()
+{
+	FScopeLock Lock(&Mutex);
+	Routes.Empty();
+}
+
+TSharedRef<IWebSocket> FNakamaMockServer::CreateWebSocket()
+{
+	return MakeShared<FNakamaMockWebSocket>(AsShared());
+}
+
+void FNakamaMockServer::Attach(UNakamaRealtimeClient* Client)
+{
+	if (Client)
+	{
+		Client->UseCustomWebsocket(CreateWebSocket());
+	}
+}
+
+void FNakamaMockServer::DropConnections()
+{
+	TArray<TSharedPtr<FNakamaMockWebSocket>> Connected;
+	{
+		FScopeLock Lock(&Mutex);
+		for (const TWeakPtr<FNakamaMockWebSocket>& Socket : Sockets)
+		{
+			Connected.Add(Socket.Pin());
+		}
+	}
+
+	for (const TSharedPtr<FNakamaMockWebSocket>& Socket : Connected)
+	{
+		if (Socket.IsValid())
+		{
+			Socket->Disconnect(1006, TEXT("Connection dropped by mock server"), false);
+		}
+	}
+}
+
+void FNakamaMockServer::Broadcast(const FString& Envelope)
+{
+	TArray<TSharedPtr<FNakamaMockWebSocket>> Connected;
+	{
+		FScopeLock Lock(&Mutex);
+		for (const TWeakPtr<FNakamaMockWebSocket>& Socket : Sockets)
+		{
+			Connected.Add(Socket.Pin());
+		}
+	}
+
+	for (const TSharedPtr<FNakamaMockWebSocket>& Socket : Connected)
+	{
+		if (Socket.IsValid())
+		{
+			Socket->Deliver(Envelope);
+		}
+	}
+}
+
+FString FNakamaMockServer::CreateToken(const FString& UserId, const FString& Username)
+{
+	const int64 IssuedAt = FDateTime::UtcNow().ToUnixTimestamp();
+
+	const TSharedRef<FJsonObject> Claims = MakeShared<FJsonObject>();
+	Claims->SetStringField(TEXT("tid"), NewId());
+	Claims->SetStringField(TEXT("uid"), UserId);
+	Claims->SetStringField(TEXT("usn"), Username);
+	Claims->SetObjectField(TEXT("vrs"), MakeShared<FJsonObject>());
+	Claims->SetNumberField(TEXT("exp"), static_cast<double>(IssuedAt + Settings.TokenExpirySeconds));
+	Claims->SetNumberField(TEXT("iat"), static_cast<double>(IssuedAt));
+
+	// The client only reads the claims; the signature is never verified locally.
+	const FString Token = Base64UrlEncode(TEXT("{\"alg\":\"HS256\",\"typ\":\"JWT\"}"))
+		+ TEXT(".") + Base64UrlEncode(FNakamaUtils::EncodeJson(Claims))
+		+ TEXT(".") + Base64UrlEncode(TEXT("mock"));
+
+	FScopeLock Lock(&Mutex);
+	Tokens.Add(Token, UserId);
+	Usernames.Add(UserId, Username);
+	return Token;
+}
+
+FNakamaMockServerStats FNakamaMockServer::GetStats() const
+{
+	FNakamaMockServerStats Stats;
+	Stats.HttpRequests = HttpRequests;
+	Stats.HttpErrorsInjected = HttpErrorsInjected;
+	Stats.ConnectionFailuresInjected = ConnectionFailuresInjected;
+	Stats.FramesReceived = FramesReceived;
+	Stats.FramesSent = FramesSent;
+	Stats.RealtimeErrorsInjected = RealtimeErrorsInjected;
+
+	FScopeLock Lock(&Mutex);
+	Stats.ConnectedSockets = Sockets.Num();
+	return Stats;
+}
+
+bool FNakamaMockServer::Intercept(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request, const FNakamaHttpRespondFn& Respond)
+{
+	FString Host;
+	FNakamaMockRequest MockRequest;
+	SplitUrl(Request->GetURL(), Host, MockRequest.Path, MockRequest.Query);
+
+	float Latency;
+	bool bConnectionFailure;
+	bool bHttpError;
+	int32 ErrorCode = 0;
+	{
+		FScopeLock Lock(&Mutex);
+		if (!bRunning || (!Settings.Host.IsEmpty() && Host != Settings.Host))
+		{
+			return false;
+		}
+
+		const FString Authorization = Request->GetHeader(TEXT("Authorization"));
+		if (Authorization.StartsWith(TEXT("Bearer ")))
+		{
+			if (const FString* UserId = Tokens.Find(Authorization.RightChop(7)))
+			{
+				MockRequest.UserId = *UserId;
+			}
+		}
+
+		Latency = NextLatency();
+		bConnectionFailure = Roll(Settings.ConnectionFailureRate);
+		bHttpError = !bConnectionFailure && Settings.HttpErrorCodes.Num() > 0 && Roll(Settings.HttpErrorRate);
+		if (bHttpError)
+		{
+			ErrorCode = Settings.HttpErrorCodes[Random.RandRange(0, Settings.HttpErrorCodes.Num() - 1)];
+		}
+	}
+
+	HttpRequests++;
+
+	if (bConnectionFailure)
+	{
+		ConnectionFailuresInjected++;
+		FNakamaHttpPipeline::Delay(Latency, [Respond]()
+		{
+			Respond(ENakamaHttpOutcome::ConnectionFailure, 0, FString());
+		});
+		return true;
+	}
+
+	FNakamaMockResponse Response;
+	if (bHttpError)
+	{
+		HttpErrorsInjected++;
+		Response = ErrorResponse(ErrorCode, ErrorCode == 500 ? 13 : 14, TEXT("Injected error"));
+	}
+	else
+	{
+		MockRequest.Verb = Request->GetVerb();
+		const TArray<uint8>& Content = Request->GetContent();
+		const FUTF8ToTCHAR Body(reinterpret_cast<const ANSICHAR*>(Content.GetData()), Content.Num());
+		MockRequest.Body = FString(Body.Length(), Body.Get());
+		Response = Route(MockRequest);
+	}
+
+	FNakamaHttpPipeline::Delay(Latency, [Respond, Response]()
+	{
+		Respond(ENakamaHttpOutcome::Response, Response.Code, Response.Body);
+	});
+	return true;
+}
+
+FNakamaMockResponse FNakamaMockServer::Route(const FNakamaMockRequest& Request)
+{
+	auto Matches = [&Request](const FRouteEntry& Entry)
+	{
+		return (Entry.Verb == TEXT("*") || Entry.Verb.Equals(Request.Verb, ESearchCase::IgnoreCase))
+			&& (Entry.bPrefix ? Request.Path.StartsWith(Entry.Path) : Request.Path == Entry.Path);
+	};
+
+	// Copy the handler out so it can call back into the server.
+	FNakamaMockRouteFn Handler;
+	{
+		FScopeLock Lock(&Mutex);
+		for (const TArray<FRouteEntry>* Table : { &Routes, &DefaultRoutes })
+		{
+			for (int32 i = Table->Num() - 1; i >= 0 && !Handler; --i)
+			{
+				if (Matches((*Table)[i]))
+				{
+					Handler = (*Table)[i].Handler;
+				}
+			}
+			if (Handler)
+			{
+				break;
+			}
+		}
+	}
+
+	return Handler ? Handler(Request) : FNakamaMockResponse();
+}
+
+void FNakamaMockServer::AddDefaultRoutes()
+{
+	auto Add = [this](const FString& Verb, const FString& Path, FNakamaMockRouteFn Handler)
+	{
+		FRouteEntry Entry;
+		Entry.Verb = Verb;
+		Entry.bPrefix = Path.EndsWith(TEXT("*"));
+		Entry.Path = Entry.bPrefix ? Path.LeftChop(1) : Path;
+		Entry.Handler = MoveTemp(Handler);
+		DefaultRoutes.Add(MoveTemp(Entry));
+	};
+
+	// Raw pointer captures are safe: the routes are owned by the server.
+	Add(TEXT("POST"), TEXT("/v2/account/authenticate/*"), [this](const FNakamaMockRequest& Request)
+	{
+		return Authenticate(Request);
+	});
+
+	Add(TEXT("POST"), TEXT("/v2/account/session/refresh"), [this](const FNakamaMockRequest& Request)
+	{
+		const TSharedPtr<FJsonObject> Body = ParseJson(Request.Body);
+		FString RefreshToken;
+		if (Body.IsValid())
+		{
+			Body->TryGetStringField(TEXT("token"), RefreshToken);
+		}
+
+		FString UserId;
+		FString Username;
+		{
+			FScopeLock Lock(&Mutex);
+			const FString* Found = Tokens.Find(RefreshToken);
+			if (!Found)
+			{
+				return ErrorResponse(401, 16, TEXT("Refresh token invalid or expired."));
+			}
+			UserId = *Found;
+			Username = Usernames.FindRef(UserId);
+		}
+		return FNakamaMockResponse(200, SessionJson(UserId, Username, false));
+	});
+
+	Add(TEXT("GET"), TEXT("/v2/account"), [this](const FNakamaMockRequest& Request)
+	{
+		if (Request.UserId.IsEmpty())
+		{
+			return ErrorResponse(401, 16, TEXT("Auth token invalid"));
+		}
+
+		const TSharedRef<FJsonObject> User = MakeShared<FJsonObject>();
+		User->SetStringField(TEXT("id"), Request.UserId);
+		{
+			FScopeLock Lock(&Mutex);
+			User->SetStringField(TEXT("username"), Usernames.FindRef(Request.UserId));
+		}
+		User->SetStringField(TEXT("create_time"), Now());
+		User->SetStringField(TEXT("update_time"), Now());
+
+		const TSharedRef<FJsonObject> Account = MakeShared<FJsonObject>();
+		Account->SetObjectField(TEXT("user"), User);
+		Account->SetStringField(TEXT("wallet"), TEXT("{}"));
+		return FNakamaMockResponse(200, FNakamaUtils::EncodeJson(Account));
+	});
+
+	Add(TEXT("PUT"), TEXT("/v2/storage/delete"), [this](const FNakamaMockRequest& Request)
+	{
+		return DeleteStorage(Request);
+	});
+
+	Add(TEXT("PUT"), TEXT("/v2/storage"), [this](const FNakamaMockRequest& Request)
+	{
+		return WriteStorage(Request);
+	});
+
+	Add(TEXT("POST"), TEXT("/v2/storage"), [this](const FNakamaMockRequest& Request)
+	{
+		return ReadStorage(Request);
+	});
+
+	// RPCs echo their payload, except the storage patch RPC. The body is the payload encoded as a JSON string.
+	Add(TEXT("*"), TEXT("/v2/rpc/*"), [this](const FNakamaMockRequest& Request)
+	{
+		FString Payload = Request.GetQueryParam(TEXT("payload"));
+		if (!Request.Body.IsEmpty())
+		{
+			TSharedPtr<FJsonValue> Value;
+			const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Request.Body);
+			if (!FJsonSerializer::Deserialize(Reader, Value) || !Value.IsValid() || !Value->TryGetString(Payload))
+			{
+				Payload = Request.Body;
+			}
+		}
+
+		const FString Id = Request.Path.RightChop(FCString::Strlen(TEXT("/v2/rpc/")));
+		if (!Settings.StoragePatchRpcId.IsEmpty() && Id == Settings.StoragePatchRpcId)
+		{
+			const FNakamaMockResponse Written = PatchStorage(Request, Payload);
+			if (Written.Code != 200)
+			{
+				return Written;
+			}
+			Payload = Written.Body;
+		}
+
+		const TSharedRef<FJsonObject> Rpc = MakeShared<FJsonObject>();
+		Rpc->SetStringField(TEXT("id"), Id);
+		Rpc->SetStringField(TEXT("payload"), Payload);
+		return FNakamaMockResponse(200, FNakamaUtils::EncodeJson(Rpc));
+	});
+}
+
+FNakamaMockResponse FNakamaMockServer::WriteStorage(const FNakamaMockRequest& Request)
+{
+	if (Request.UserId.IsEmpty())
+	{
+		return ErrorResponse(401, 16, TEXT("Auth token invalid"));
+	}
+
+	const TSharedPtr<FJsonObject> Body = ParseJson(Request.Body);
+	const TArray<TSharedPtr<FJsonValue>>* Objects = nullptr;
+	if (!Body.IsValid() || !Body->TryGetArrayField(TEXT("objects"), Objects))
+	{
+		return ErrorResponse(400, 3, TEXT("Invalid Argument"));
+	}
+
+	FScopeLock Lock(&Mutex);
+
+	// Like the server, the batch is applied only if every version check passes.
+	TArray<TSharedRef<FJsonObject>> Written;
+	for (const TSharedPtr<FJsonValue>& Value : *Objects)
+	{
+		const TSharedPtr<FJsonObject>* Object = nullptr;
+		if (!Value.IsValid() || !Value->TryGetObject(Object))
+		{
+			return ErrorResponse(400, 3, TEXT("Invalid Argument"));
+		}
+
+		const FString Collection = (*Object)->GetStringField(TEXT("collection"));
+		const FString Key = (*Object)->GetStringField(TEXT("key"));
+		FString Version;
+		(*Object)->TryGetStringField(TEXT("version"), Version);
+
+		const TSharedRef<FJsonObject>* Existing = StorageObjects.Find(StorageId(Collection, Key, Request.UserId));
+		const bool bVersionOk = Version.IsEmpty()
+			|| (Version == TEXT("*") ? Existing == nullptr : (Existing && (*Existing)->GetStringField(TEXT("version")) == Version));
+		if (!bVersionOk)
+		{
+			return ErrorResponse(400, 3, TEXT("Storage write rejected - version check failed."));
+		}
+
+		const FString StoredValue = (*Object)->GetStringField(TEXT("value"));
+		const TSharedRef<FJsonObject> Stored = MakeShared<FJsonObject>();
+		Stored->SetStringField(TEXT("collection"), Collection);
+		Stored->SetStringField(TEXT("key"), Key);
+		Stored->SetStringField(TEXT("user_id"), Request.UserId);
+		Stored->SetStringField(TEXT("value"), StoredValue);
+		Stored->SetStringField(TEXT("version"), FMD5::HashAnsiString(*StoredValue));
+		Stored->SetNumberField(TEXT("permission_read"), GetPermission(**Object, TEXT("permission_read"), 1));
+		Stored->SetNumberField(TEXT("permission_write"), GetPermission(**Object, TEXT("permission_write"), 1));
+		Stored->SetStringField(TEXT("create_time"), Existing ? (*Existing)->GetStringField(TEXT("create_time")) : Now());
+		Stored->SetStringField(TEXT("update_time"), Now());
+		Written.Add(Stored);
+	}
+
+	TArray<TSharedPtr<FJsonValue>> Acks;
+	for (const TSharedRef<FJsonObject>& Stored : Written)
+	{
+		StorageObjects.Add(StorageId(Stored->GetStringField(TEXT("collection")), Stored->GetStringField(TEXT("key")), Request.UserId), Stored);
+
+		const TSharedRef<FJsonObject> Ack = MakeShared<FJsonObject>();
+		CopyField(*Stored, *Ack, TEXT("collection"));
+		CopyField(*Stored, *Ack, TEXT("key"));
+		CopyField(*Stored, *Ack, TEXT("version"));
+		CopyField(*Stored, *Ack, TEXT("user_id"));
+		Acks.Add(MakeShared<FJsonValueObject>(Ack));
+	}
+
+	const TSharedRef<FJsonObject> Response = MakeShared<FJsonObject>();
+	Response->SetArrayField(TEXT("acks"), Acks);
+	return FNakamaMockResponse(200, FNakamaUtils::EncodeJson(Response));
+}
+
+FNakamaMockResponse FNakamaMockServer::PatchStorage(const FNakamaMockRequest& Request, const FString& Payload)
+{
+	const TSharedPtr<FJsonObject> Body = ParseJson(Payload);
+	const TArray<TSharedPtr<FJsonValue>>* Objects = nullptr;
+	if (!Body.IsValid() || !Body->TryGetArrayField(TEXT("objects"), Objects))
+	{
+		return ErrorResponse(400, 3, TEXT("Invalid Argument"));
+	}
+
+	// Patches become whole values, which then go through the regular write and its version checks.
+	TArray<TSharedPtr<FJsonValue>> Writes;
+	{
+		FScopeLock Lock(&Mutex);
+		for (const TSharedPtr<FJsonValue>& Value : *Objects)
+		{
+			const TSharedPtr<FJsonObject>* Object = nullptr;
+			if (!Value.IsValid() || !Value->TryGetObject(Object))
+			{
+				return ErrorResponse(400, 3, TEXT("Invalid Argument"));
+			}
+
+			const TSharedRef<FJsonObject> Write = MakeShared<FJsonObject>();
+			Write->Values = (*Object)->Values;
+
+			const TSharedPtr<FJsonObject>* Patch = nullptr;
+			if ((*Object)->TryGetObjectField(TEXT("patch"), Patch))
+			{
+				const FString Id = StorageId((*Object)->GetStringField(TEXT("collection")), (*Object)->GetStringField(TEXT("key")), Request.UserId);
+				const TSharedRef<FJsonObject>* Existing = StorageObjects.Find(Id);
+				FString Patched;
+				if (!FNakamaJsonMergePatch::Apply(Existing ? (*Existing)->GetStringField(TEXT("value")) : TEXT("{}"), FNakamaUtils::EncodeJson(*Patch), Patched))
+				{
+					return ErrorResponse(400, 3, TEXT("Invalid patch"));
+				}
+				Write->RemoveField(TEXT("patch"));
+				Write->SetStringField(TEXT("value"), Patched);
+			}
+			Writes.Add(MakeShared<FJsonValueObject>(Write));
+		}
+	}
+
+	const TSharedRef<FJsonObject> WriteBody = MakeShared<FJsonObject>();
+	WriteBody->SetArrayField(TEXT("objects"), Writes);
+
+	FNakamaMockRequest WriteRequest = Request;
+	WriteRequest.Body = FNakamaUtils::EncodeJson(WriteBody);
+	return WriteStorage(WriteRequest);
+}
+
+FNakamaMockResponse FNakamaMockServer::ReadStorage(const FNakamaMockRequest& Request)
+{
+	const TSharedPtr<FJsonObject> Body = ParseJson(Request.Body);
+	const TArray<TSharedPtr<FJsonValue>>* ObjectIds = nullptr;
+	if (!Body.IsValid() || !Body->TryGetArrayField(TEXT("object_ids"), ObjectIds))
+	{
+		return ErrorResponse(400, 3, TEXT("Invalid Argument"));
+	}
+
+	TArray<TSharedPtr<FJsonValue>> Objects;
+	{
+		FScopeLock Lock(&Mutex);
+		for (const TSharedPtr<FJsonValue>& Value : *ObjectIds)
+		{
+			const TSharedPtr<FJsonObject>* ObjectId = nullptr;
+			if (Value.IsValid() && Value->TryGetObject(ObjectId))
+			{
+				const FString Id = StorageId((*ObjectId)->GetStringField(TEXT("collection")), (*ObjectId)->GetStringField(TEXT("key")), (*ObjectId)->GetStringField(TEXT("user_id")));
+				if (const TSharedRef<FJsonObject>* Stored = StorageObjects.Find(Id))
+				{
+					Objects.Add(MakeShared<FJsonValueObject>(*Stored));
+				}
+			}
+		}
+	}
+
+	const TSharedRef<FJsonObject> Response = MakeShared<FJsonObject>();
+	Response->SetArrayField(TEXT("objects"), Objects);
+	return FNakamaMockResponse(200, FNakamaUtils::EncodeJson(Response));
+}
+
+FNakamaMockResponse FNakamaMockServer::DeleteStorage(const FNakamaMockRequest& Request)
+{
+	if (Request.UserId.IsEmpty())
+	{
+		return ErrorResponse(401, 16, TEXT("Auth token invalid"));
+	}
+
+	const TSharedPtr<FJsonObject> Body = ParseJson(Request.Body);
+	const TArray<TSharedPtr<FJsonValue>>* ObjectIds = nullptr;
+	if (!Body.IsValid() || !Body->TryGetArrayField(TEXT("object_ids"), ObjectIds))
+	{
+		return ErrorResponse(400, 3, TEXT("Invalid Argument"));
+	}
+
+	FScopeLock Lock(&Mutex);
+	TArray<FString> Ids;
+	for (const TSharedPtr<FJsonValue>& Value : *ObjectIds)
+	{
+		const TSharedPtr<FJsonObject>* ObjectId = nullptr;
+		if (!Value.IsValid() || !Value->TryGetObject(ObjectId))
+		{
+			return ErrorResponse(400, 3, TEXT("Invalid Argument"));
+		}
+
+		const FString Id = StorageId((*ObjectId)->GetStringField(TEXT("collection")), (*ObjectId)->GetStringField(TEXT("key")), Request.UserId);
+		FString Version;
+		(*ObjectId)->TryGetStringField(TEXT("version"), Version);
+		const TSharedRef<FJsonObject>* Existing = StorageObjects.Find(Id);
+		if (!Version.IsEmpty() && (!Existing || (*Existing)->GetStringField(TEXT("version")) != Version))
+		{
+			return ErrorResponse(400, 3, TEXT("Storage delete rejected - version check failed."));
+		}
+		Ids.Add(Id);
+	}
+
+	for (const FString& Id : Ids)
+	{
+		StorageObjects.Remove(Id);
+	}
+	return FNakamaMockResponse(200, TEXT("{}"));
+}
+
+FNakamaMockResponse FNakamaMockServer::Authenticate(const FNakamaMockRequest& Request)
+{
+	// One account per provider + identifier, created on first use unless create=false.
+	const FString Provider = FPaths::GetCleanFilename(Request.Path);
+	const TSharedPtr<FJsonObject> Body = ParseJson(Request.Body);
+	FString Identifier;
+	if (Body.IsValid())
+	{
+		for (const TCHAR* Field : { TEXT("id"), TEXT("email"), TEXT("token") })
+		{
+			if (Body->TryGetStringField(Field, Identifier) && !Identifier.IsEmpty())
+			{
+				break;
+			}
+		}
+	}
+	const FString Key = Provider + TEXT(":") + Identifier;
+
+	FString UserId;
+	FString Username;
+	bool bCreated = false;
+	{
+		FScopeLock Lock(&Mutex);
+		if (const FString* Existing = Identities.Find(Key))
+		{
+			UserId = *Existing;
+			Username = Usernames.FindRef(UserId);
+		}
+		else if (Request.GetQueryParam(TEXT("create")) == TEXT("false"))
+		{
+			return ErrorResponse(404, 5, TEXT("User account not found."));
+		}
+		else
+		{
+			UserId = NewId();
+			Username = Request.GetQueryParam(TEXT("username"));
+			if (Username.IsEmpty())
+			{
+				Username = TEXT("mock_") + UserId.Left(8);
+			}
+			Identities.Add(Key, UserId);
+			bCreated = true;
+		}
+	}
+
+	return FNakamaMockResponse(200, SessionJson(UserId, Username, bCreated));
+}
+
+FString FNakamaMockServer::SessionJson(const FString& UserId, const FString& Username, bool bCreated)
+{
+	const TSharedRef<FJsonObject> Session = MakeShared<FJsonObject>();
+	Session->SetBoolField(TEXT("created"), bCreated);
+	Session->SetStringField(TEXT("token"), CreateToken(UserId, Username));
+	Session->SetStringField(TEXT("refresh_token"), CreateToken(UserId, Username));
+	return FNakamaUtils::EncodeJson(Session);
+}
+
+float FNakamaMockServer::NextLatency()
+{
+	FScopeLock Lock(&Mutex);
+	const float Min = FMath::Max(0.0f, Settings.MinLatencySeconds);
+	const float Max = FMath::Max(Min, Settings.MaxLatencySeconds);
+	return Random.FRandRange(Min, Max);
+}
+
+bool FNakamaMockServer::Roll(float Rate)
+{
+	FScopeLock Lock(&Mutex);
+	return Rate > 0.0f && Random.FRand() < Rate;
+}
+
+void FNakamaMockServer::OnSocketConnected(const TSharedRef<FNakamaMockWebSocket>& Socket)
+{
+	FScopeLock Lock(&Mutex);
+	Sockets.Add(Socket);
+}
+
+void FNakamaMockServer::OnSocketClosed(FNakamaMockWebSocket* Socket)
+{
+	// Called from the socket's destructor too, where weak pointers to it no longer pin.
+	auto IsClosedOrStale = [Socket](const TWeakPtr<FNakamaMockWebSocket>& Member)
+	{
+		const TSharedPtr<FNakamaMockWebSocket> Pinned = Member.Pin();
+		return !Pinned.IsValid() || Pinned.Get() == Socket;
+	};
+
+	FScopeLock Lock(&Mutex);
+	Sockets.RemoveAll(IsClosedOrStale);
+	for (auto It = Groups.CreateIterator(); It; ++It)
+	{
+		It->Value.RemoveAll(IsClosedOrStale);
+		if (It->Value.Num() == 0)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void FNakamaMockServer::Join(const FString& GroupId, const TSharedRef<FNakamaMockWebSocket>& Socket)
+{
+	FScopeLock Lock(&Mutex);
+	TArray<TWeakPtr<FNakamaMockWebSocket>>& Members = Groups.FindOrAdd(GroupId);
+	if (!Members.ContainsByPredicate([&Socket](const TWeakPtr<FNakamaMockWebSocket>& Member) { return Member.Pin() == Socket; }))
+	{
+		Members.Add(Socket);
+	}
+}
+
+void FNakamaMockServer::Leave(const FString& GroupId, FNakamaMockWebSocket* Socket)
+{
+	FScopeLock Lock(&Mutex);
+	if (TArray<TWeakPtr<FNakamaMockWebSocket>>* Members = Groups.Find(GroupId))
+	{
+		Members->RemoveAll([Socket](const TWeakPtr<FNakamaMockWebSocket>& Member) { return Member.Pin().Get() == Socket; });
+		if (Members->Num() == 0)
+		{
+			Groups.Remove(GroupId);
+		}
+	}
+}
+
+void FNakamaMockServer::Relay(const FString& GroupId, const FString& Envelope, const FNakamaMockWebSocket* Except)
+{
+	TArray<TSharedPtr<FNakamaMockWebSocket>> Members;
+	{
+		FScopeLock Lock(&Mutex);
+		if (const TArray<TWeakPtr<FNakamaMockWebSocket>>* Found = Groups.Find(GroupId))
+		{
+			for (const TWeakPtr<FNakamaMockWebSocket>& Member : *Found)
+			{
+				Members.Add(Member.Pin());
+			}
+		}
+	}
+
+	for (const TSharedPtr<FNakamaMockWebSocket>& Member : Members)
+	{
+		if (Member.IsValid() && Member.Get() != Except)
+		{
+			Member->Deliver(Envelope);
+		}
+	}
+}
+
+TArray<TSharedRef<FJsonObject>> FNakamaMockServer::MemberPresences(const FString& GroupId, const FNakamaMockWebSocket* Except) const
+{
+	TArray<TSharedRef<FJsonObject>> Presences;
+	FScopeLock Lock(&Mutex);
+	if (const TArray<TWeakPtr<FNakamaMockWebSocket>>* Found = Groups.Find(GroupId))
+	{
+		for (const TWeakPtr<FNakamaMockWebSocket>& Member : *Found)
+		{
+			const TSharedPtr<FNakamaMockWebSocket> Pinned = Member.Pin();
+			if (Pinned.IsValid() && Pinned.Get() != Except)
+			{
+				Presences.Add(MakePresence(*Pinned));
+			}
+		}
+	}
+	return Presences;
+}
+
+void FNakamaMockServer::HandleFrame(const TSharedRef<FNakamaMockWebSocket>& Socket, const FString& Frame)
+{
+	FramesReceived++;
+
+	const TSharedPtr<FJsonObject> Envelope = ParseJson(Frame);
+	if (!Envelope.IsValid())
+	{
+		UE_LOG(LogNakamaMockServer, Warning, TEXT("Mock server dropped a frame that is not JSON"));
+		return;
+	}
+
+	// An envelope carries an optional cid and exactly one message field.
+	FString Cid;
+	Envelope->TryGetStringField(TEXT("cid"), Cid);
+	FString Type;
+	TSharedPtr<FJsonObject> Message;
+	for (const auto& Field : Envelope->Values)
+	{
+		if (Field.Key != TEXT("cid"))
+		{
+			Type = Field.Key;
+			const TSharedPtr<FJsonObject>* Object;
+			if (Field.Value.IsValid() && Field.Value->TryGetObject(Object))
+			{
+				Message = *Object;
+			}
+			break;
+		}
+	}
+	if (!Message.IsValid())
+	{
+		Message = MakeShared<FJsonObject>();
+	}
+
+	const TSharedRef<FJsonObject> Reply = MakeShared<FJsonObject>();
+	Reply->SetStringField(TEXT("cid"), Cid);
+
+	if (!Cid.IsEmpty() && Roll(Settings.RealtimeErrorRate))
+	{
+		RealtimeErrorsInjected++;
+		const TSharedRef<FJsonObject> Error = MakeShared<FJsonObject>();
+		Error->SetNumberField(TEXT("code"), 0); // RUNTIME_EXCEPTION
+		Error->SetStringField(TEXT("message"), TEXT("Injected error"));
+		Reply->SetObjectField(TEXT("error"), Error);
+		Socket->Deliver(FNakamaUtils::EncodeJson(Reply));
+		return;
+	}
+
+	const TSharedRef<FJsonObject> Self = MakePresence(*Socket);
+
+	if (Type == TEXT("ping"))
+	{
+		Reply->SetObjectField(TEXT("pong"), MakeShared<FJsonObject>());
+	}
+	else if (Type == TEXT("match_create") || Type == TEXT("match_join"))
+	{
+		FString MatchId;
+		if (!Message->TryGetStringField(TEXT("match_id"), MatchId) || MatchId.IsEmpty())
+		{
+			MatchId = NewId() + TEXT(".");
+		}
+
+		const TArray<TSharedRef<FJsonObject>> Others = MemberPresences(MatchId, &Socket.Get());
+		Join(MatchId, Socket);
+		Relay(MatchId, PresenceEvent(TEXT("match_presence_event"), TEXT("match_id"), MatchId, TEXT("joins"), *Socket), &Socket.Get());
+
+		const TSharedRef<FJsonObject> Match = MakeShared<FJsonObject>();
+		Match->SetStringField(TEXT("match_id"), MatchId);
+		Match->SetBoolField(TEXT("authoritative"), false);
+		Match->SetStringField(TEXT("label"), FString());
+		Match->SetNumberField(TEXT("size"), Others.Num() + 1);
+		Match->SetArrayField(TEXT("presences"), ToValues(Others));
+		Match->SetObjectField(TEXT("self"), Self);
+		Reply->SetObjectField(TEXT("match"), Match);
+	}
+	else if (Type == TEXT("match_leave"))
+	{
+		const FString MatchId = Message->GetStringField(TEXT("match_id"));
+		Leave(MatchId, &Socket.Get());
+		Relay(MatchId, PresenceEvent(TEXT("match_presence_event"), TEXT("match_id"), MatchId, TEXT("leaves"), *Socket), &Socket.Get());
+	}
+	else if (Type == TEXT("match_data_send"))
+	{
+		const TSharedRef<FJsonObject> Data = MakeShared<FJsonObject>();
+		Data->SetStringField(TEXT("match_id"), Message->GetStringField(TEXT("match_id")));
+		Data->SetObjectField(TEXT("presence"), Self);
+		CopyField(*Message, *Data, TEXT("op_code"));
+		CopyField(*Message, *Data, TEXT("data"));
+		Data->SetBoolField(TEXT("reliable"), true);
+
+		const TSharedRef<FJsonObject> Out = MakeShared<FJsonObject>();
+		Out->SetObjectField(TEXT("match_data"), Data);
+		Relay(Data->GetStringField(TEXT("match_id")), FNakamaUtils::EncodeJson(Out), &Socket.Get());
+	}
+	else if (Type == TEXT("party_create"))
+	{
+		const FString PartyId = NewId() + TEXT(".");
+		Join(PartyId, Socket);
+
+		const TSharedRef<FJsonObject> Party = MakeShared<FJsonObject>();
+		Party->SetStringField(TEXT("party_id"), PartyId);
+		Party->SetBoolField(TEXT("open"), Message->HasField(TEXT("open")) && Message->GetBoolField(TEXT("open")));
+		Party->SetNumberField(TEXT("max_size"), Message->HasField(TEXT("max_size")) ? Message->GetNumberField(TEXT("max_size")) : 0);
+		Party->SetObjectField(TEXT("self"), Self);
+		Party->SetObjectField(TEXT("leader"), Self);
+		Party->SetArrayField(TEXT("presences"), { MakeShared<FJsonValueObject>(Self) });
+		Reply->SetObjectField(TEXT("party"), Party);
+	}
+	else if (Type == TEXT("party_join"))
+	{
+		const FString PartyId = Message->GetStringField(TEXT("party_id"));
+		Join(PartyId, Socket);
+		Relay(PartyId, PresenceEvent(TEXT("party_presence_event"), TEXT("party_id"), PartyId, TEXT("joins"), *Socket), &Socket.Get());
+	}
+	else if (Type == TEXT("party_leave"))
+	{
+		const FString PartyId = Message->GetStringField(TEXT("party_id"));
+		Leave(PartyId, &Socket.Get());
+		Relay(PartyId, PresenceEvent(TEXT("party_presence_event"), TEXT("party_id"), PartyId, TEXT("leaves"), *Socket), &Socket.Get());
+	}
+	else if (Type == TEXT("party_data_send"))
+	{
+		const TSharedRef<FJsonObject> Data = MakeShared<FJsonObject>();
+		Data->SetStringField(TEXT("party_id"), Message->GetStringField(TEXT("party_id")));
+		Data->SetObjectField(TEXT("presence"), Self);
+		CopyField(*Message, *Data, TEXT("op_code"));
+		CopyField(*Message, *Data, TEXT("data"));
+
+		const TSharedRef<FJsonObject> Out = MakeShared<FJsonObject>();
+		Out->SetObjectField(TEXT("party_data"), Data);
+		Relay(Data->GetStringField(TEXT("party_id")), FNakamaUtils::EncodeJson(Out), &Socket.Get());
+	}
+	else if (Type == TEXT("channel_join"))
+	{
+		const FString Target = Message->GetStringField(TEXT("target"));
+		const int32 ChannelType = Message->HasField(TEXT("type")) ? static_cast<int32>(Message->GetNumberField(TEXT("type"))) : 1;
+		const FString ChannelId = FString::Printf(TEXT("%d...%s"), ChannelType + 1, *Target);
+
+		const TArray<TSharedRef<FJsonObject>> Others = MemberPresences(ChannelId, &Socket.Get());
+		Join(ChannelId, Socket);
+		Relay(ChannelId, PresenceEvent(TEXT("channel_presence_event"), TEXT("channel_id"), ChannelId, TEXT("joins"), *Socket), &Socket.Get());
+
+		const TSharedRef<FJsonObject> Channel = MakeShared<FJsonObject>();
+		Channel->SetStringField(TEXT("id"), ChannelId);
+		Channel->SetArrayField(TEXT("presences"), ToValues(Others));
+		Channel->SetObjectField(TEXT("self"), Self);
+		Channel->SetStringField(TEXT("room_name"), Target);
+		Reply->SetObjectField(TEXT("channel"), Channel);
+	}
+	else if (Type == TEXT("channel_leave"))
+	{
+		Leave(Message->GetStringField(TEXT("channel_id")), &Socket.Get());
+	}
+	else if (Type == TEXT("channel_message_send"))
+	{
+		const FString ChannelId = Message->GetStringField(TEXT("channel_id"));
+		const FString MessageId = NewId();
+		const FString Time = Now();
+
+		const TSharedRef<FJsonObject> Ack = MakeShared<FJsonObject>();
+		Ack->SetStringField(TEXT("channel_id"), ChannelId);
+		Ack->SetStringField(TEXT("message_id"), MessageId);
+		Ack->SetNumberField(TEXT("code"), 0);
+		Ack->SetStringField(TEXT("username"), Socket->GetUsername());
+		Ack->SetStringField(TEXT("create_time"), Time);
+		Ack->SetStringField(TEXT("update_time"), Time);
+		Ack->SetBoolField(TEXT("persistent"), true);
+		Reply->SetObjectField(TEXT("channel_message_ack"), Ack);
+
+		const TSharedRef<FJsonObject> ChannelMessage = MakeShared<FJsonObject>();
+		ChannelMessage->SetStringField(TEXT("channel_id"), ChannelId);
+		ChannelMessage->SetStringField(TEXT("message_id"), MessageId);
+		ChannelMessage->SetNumberField(TEXT("code"), 0);
+		ChannelMessage->SetStringField(TEXT("sender_id"), Socket->GetUserId());
+		ChannelMessage->SetStringField(TEXT("username"), Socket->GetUsername());
+		ChannelMessage->SetStringField(TEXT("content"), Message->GetStringField(TEXT("content")));
+		ChannelMessage->SetStringField(TEXT("create_time"), Time);
+		ChannelMessage->SetStringField(TEXT("update_time"), Time);
+		ChannelMessage->SetBoolField(TEXT("persistent"), true);
+
+		// Like the server, the sender receives its own message too.
+		const TSharedRef<FJsonObject> Out = MakeShared<FJsonObject>();
+		Out->SetObjectField(TEXT("channel_message"), ChannelMessage);
+		Relay(ChannelId, FNakamaUtils::EncodeJson(Out), nullptr);
+	}
+	else if (Type == TEXT("rpc"))
+	{
+		const TSharedRef<FJsonObject> Rpc = MakeShared<FJsonObject>();
+		Rpc->SetStringField(TEXT("id"), Message->GetStringField(TEXT("id")));
+		Rpc->SetStringField(TEXT("payload"), Message->GetStringField(TEXT("payload")));
+		Reply->SetObjectField(TEXT("rpc"), Rpc);
+	}
+
+	// Anything else is acknowledged with an empty reply.
+	if (!Cid.IsEmpty())
+	{
+		Socket->Deliver(FNakamaUtils::EncodeJson(Reply));
+	}
+}
+
+bool FNakamaMockServer::TickPush(float DeltaTime)
+{
+	const float Rate = Settings.PushMessagesPerSecond;
+	if (Rate <= 0.0f)
+	{
+		PushAccumulator = 0.0;
+		return true;
+	}
+
+	PushAccumulator += DeltaTime * Rate;
+	while (PushAccumulator >= 1.0)
+	{
+		PushAccumulator -= 1.0;
+
+		const TSharedRef<FJsonObject> Notification = MakeShared<FJsonObject>();
+		Notification->SetStringField(TEXT("id"), NewId());
+		Notification->SetStringField(TEXT("subject"), TEXT("mock"));
+		Notification->SetStringField(TEXT("content"), TEXT("{}"));
+		Notification->SetNumberField(TEXT("code"), 0);
+		Notification->SetStringField(TEXT("create_time"), Now());
+		Notification->SetBoolField(TEXT("persistent"), false);
+
+		const TSharedRef<FJsonObject> Notifications = MakeShared<FJsonObject>();
+		Notifications->SetArrayField(TEXT("notifications"), { MakeShared<FJsonValueObject>(Notification) });
+
+		const TSharedRef<FJsonObject> Envelope = MakeShared<FJsonObject>();
+		Envelope->SetObjectField(TEXT("notifications"), Notifications);
+		Broadcast(FNakamaUtils::EncodeJson(Envelope));
+	}
+	return true;
+}
@@ -0,0 +1,163 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaMockWebSocket.h"
+#include "NakamaMockServer.h"
+#include "Misc/Guid.h"
+
+FNakamaMockWebSocket::FNakamaMockWebSocket(const TSharedRef<FNakamaMockServer, ESPMode::ThreadSafe>& InServer)
+	: Server(InServer)
+	, UserId(FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensLower))
+	, SessionId(FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensLower))
+{
+	Username = TEXT("mock_") + UserId.Left(8);
+}
+
+FNakamaMockWebSocket::~FNakamaMockWebSocket()
+{
+	if (bConnected)
+	{
+		if (TSharedPtr<FNakamaMockServer, ESPMode::ThreadSafe> PinnedServer = Server.Pin())
+		{
+			PinnedServer->OnSocketClosed(this);
+		}
+	}
+}
+
+void FNakamaMockWebSocket::Connect()
+{
+	TSharedPtr<FNakamaMockServer, ESPMode::ThreadSafe> PinnedServer = Server.Pin();
+	if (!PinnedServer.IsValid() || bConnected || bConnecting)
+	{
+		return;
+	}
+
+	bConnecting = true;
+	const uint32 ConnectGeneration = ++Generation;
+	const bool bFail = !PinnedServer->IsRunning() || PinnedServer->Roll(PinnedServer->Settings.ConnectionFailureRate);
+	if (bFail && PinnedServer->IsRunning())
+	{
+		PinnedServer->ConnectionFailuresInjected++;
+	}
+
+	TWeakPtr<FNakamaMockWebSocket> WeakThis = AsShared();
+	FNakamaHttpPipeline::Delay(PinnedServer->NextLatency(), [WeakThis, ConnectGeneration, bFail]()
+	{
+		TSharedPtr<FNakamaMockWebSocket> Self = WeakThis.Pin();
+		if (!Self.IsValid() || Self->Generation != ConnectGeneration)
+		{
+			return;
+		}
+
+		Self->bConnecting = false;
+		TSharedPtr<FNakamaMockServer, ESPMode::ThreadSafe> PinnedServer = Self->Server.Pin();
+		if (bFail || !PinnedServer.IsValid())
+		{
+			Self->ConnectionErrorEvent.Broadcast(TEXT("Mock server refused the connection"));
+			return;
+		}
+
+		Self->bConnected = true;
+		PinnedServer->OnSocketConnected(Self.ToSharedRef());
+		Self->ConnectedEvent.Broadcast();
+	});
+}
+
+void FNakamaMockWebSocket::Close(int32 Code, const FString& Reason)
+{
+	if (!bConnected)
+	{
+		// Abort a pending connect; there is nothing to report.
+		bConnecting = false;
+		++Generation;
+		return;
+	}
+
+	Disconnect(Code, Reason, true);
+}
+
+void FNakamaMockWebSocket::Disconnect(int32 Code, const FString& Reason, bool bWasClean)
+{
+	if (!bConnected)
+	{
+		return;
+	}
+
+	bConnected = false;
+	++Generation;
+	if (TSharedPtr<FNakamaMockServer, ESPMode::ThreadSafe> PinnedServer = Server.Pin())
+	{
+		PinnedServer->OnSocketClosed(this);
+	}
+
+	// Like a real socket, the close is reported asynchronously.
+	TWeakPtr<FNakamaMockWebSocket> WeakThis = AsShared();
+	FNakamaHttpPipeline::Delay(0.0f, [WeakThis, Code, Reason, bWasClean]()
+	{
+		if (TSharedPtr<FNakamaMockWebSocket> Self = WeakThis.Pin())
+		{
+			Self->ClosedEvent.Broadcast(Code, Reason, bWasClean);
+		}
+	});
+}
+
+void FNakamaMockWebSocket::Send(const FString& Data)
+{
+	TSharedPtr<FNakamaMockServer, ESPMode::ThreadSafe> PinnedServer = Server.Pin();
+	if (!bConnected || !PinnedServer.IsValid())
+	{
+		return;
+	}
+
+	MessageSentEvent.Broadcast(Data);
+	PinnedServer->HandleFrame(AsShared(), Data);
+}
+
+void FNakamaMockWebSocket::Send(const void* Data, SIZE_T Size, bool bIsBinary)
+{
+	// Nakama's realtime protocol is JSON text; binary frames are not used by the client.
+	if (!bIsBinary)
+	{
+		const FUTF8ToTCHAR Converted(static_cast<const ANSICHAR*>(Data), static_cast<int32>(Size));
+		Send(FString(Converted.Length(), Converted.Get()));
+	}
+}
+
+void FNakamaMockWebSocket::Deliver(const FString& Envelope)
+{
+	TSharedPtr<FNakamaMockServer, ESPMode::ThreadSafe> PinnedServer = Server.Pin();
+	if (!bConnected || !PinnedServer.IsValid())
+	{
+		return;
+	}
+
+	PinnedServer->FramesSent++;
+
+	// Frames on one socket arrive in the order they were sent, whatever latency each one drew.
+	const double Now = FPlatformTime::Seconds();
+	LastDeliverTime = FMath::Max(Now + PinnedServer->NextLatency(), LastDeliverTime);
+
+	const uint32 DeliverGeneration = Generation;
+	TWeakPtr<FNakamaMockWebSocket> WeakThis = AsShared();
+	FNakamaHttpPipeline::Delay(static_cast<float>(LastDeliverTime - Now), [WeakThis, DeliverGeneration, Envelope]()
+	{
+		TSharedPtr<FNakamaMockWebSocket> Self = WeakThis.Pin();
+		if (Self.IsValid() && Self->bConnected && Self->Generation == DeliverGeneration)
+		{
+			Self->MessageEvent.Broadcast(Envelope);
+		}
+	});
+}
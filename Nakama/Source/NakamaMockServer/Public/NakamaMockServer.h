@@ -0,0 +1,242 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Math/RandomStream.h"
+#include "NakamaHttpPipeline.h"
+#include <atomic>
+
+class FJsonObject;
+class FNakamaMockWebSocket;
+class IWebSocket;
+class UNakamaRealtimeClient;
+
+NAKAMAMOCKSERVER_API DECLARE_LOG_CATEGORY_EXTERN(LogNakamaMockServer, Log, All);
+
+/** Knobs for the simulated network and server behaviour. Rates are 0..1. */
+struct NAKAMAMOCKSERVER_API FNakamaMockServerSettings
+{
+	/** Only requests to this host are answered; empty answers every request. */
+	FString Host;
+
+	/** Delay before each response, connect and realtime reply, drawn uniformly from [Min, Max] seconds. */
+	float MinLatencySeconds = 0.0f;
+	float MaxLatencySeconds = 0.0f;
+
+	/** Fraction of REST requests answered with one of HttpErrorCodes instead of their route. */
+	float HttpErrorRate = 0.0f;
+
+	/** Codes used for injected REST errors. The defaults are the ones the client retries. */
+	TArray<int32> HttpErrorCodes = { 500, 502, 503, 504 };
+
+	/** Fraction of REST requests and socket connects that fail as if the host were unreachable. */
+	float ConnectionFailureRate = 0.0f;
+
+	/** Fraction of realtime requests (frames with a cid) answered with an error envelope. */
+	float RealtimeErrorRate = 0.0f;
+
+	/** Unsolicited notifications pushed to each connected socket per second. */
+	float PushMessagesPerSecond = 0.0f;
+
+	/** Lifetime of issued session tokens. */
+	int32 TokenExpirySeconds = 3600;
+
+	/** Seed for latency and error injection, so a failing run can be replayed. */
+	int32 RandomSeed = 0;
+
+	/** RPC served as the merge-patch storage writer used by UNakamaStorageMirror::PatchRpcId; empty for none. */
+	FString StoragePatchRpcId;
+};
+
+/** A REST request as seen by a route handler. */
+struct NAKAMAMOCKSERVER_API FNakamaMockRequest
+{
+	FString Verb;
+	FString Path;  // e.g. /v2/account, without the query string
+	FString Query; // raw query string without the leading '?'
+	FString Body;
+	FString UserId; // from the bearer token, empty for basic auth or unknown tokens
+
+	/** URL-decoded value of the first query parameter called Name, empty if absent. */
+	FString GetQueryParam(const FString& Name) const;
+
+	/** URL-decoded values of every query parameter called Name, for repeated ones such as "ids". */
+	TArray<FString> GetQueryParams(const FString& Name) const;
+};
+
+/** A canned REST response. */
+struct NAKAMAMOCKSERVER_API FNakamaMockResponse
+{
+	FNakamaMockResponse() = default;
+	FNakamaMockResponse(int32 InCode, const FString& InBody) : Code(InCode), Body(InBody) {}
+
+	int32 Code = 200;
+	FString Body = TEXT("{}");
+};
+
+using FNakamaMockRouteFn = TFunction<FNakamaMockResponse(const FNakamaMockRequest& Request)>;
+
+/** Running totals since Start, for assertions in tests and soak runs. */
+struct NAKAMAMOCKSERVER_API FNakamaMockServerStats
+{
+	int64 HttpRequests = 0;
+	int64 HttpErrorsInjected = 0;
+	int64 ConnectionFailuresInjected = 0;
+	int64 FramesReceived = 0;
+	int64 FramesSent = 0;
+	int64 RealtimeErrorsInjected = 0;
+	int32 ConnectedSockets = 0;
+};
+
+/**
+ * In-process stand-in for a Nakama server.
+ *
+ * While started, every request going through the shared HTTP pipeline (to
+ * Settings.Host, or to any host if it is empty) is answered from a route
+ * table instead of the network: authentication issues parseable session
+ * tokens, GET /v2/account returns the caller, RPCs echo their payload, storage
+ * objects are kept in memory with version checks, and any other path answers
+ * 200 "{}" unless a route overrides it. Realtime clients
+ * are attached to mock sockets that answer requests by cid, relay match,
+ * party and chat traffic between each other and can push notifications.
+ *
+ * Latency, HTTP error codes, connection failures and realtime errors are
+ * injected at configurable rates, which makes retry, timeout and reconnect
+ * paths reproducible offline. Responses are always delivered on the core
+ * ticker, never from inside the call that sent the request.
+ *
+ * Only one server can be started at a time. Game thread only.
+ */
+class NAKAMAMOCKSERVER_API FNakamaMockServer : public TSharedFromThis<FNakamaMockServer, ESPMode::ThreadSafe>
+{
+public:
+
+	static TSharedRef<FNakamaMockServer, ESPMode::ThreadSafe> Create(const FNakamaMockServerSettings& Settings = FNakamaMockServerSettings());
+
+	~FNakamaMockServer();
+
+	/** Start answering HTTP requests. Resets stats. */
+	void Start();
+
+	/** Stop answering HTTP requests and drop all socket connections. Requests already answered still complete. */
+	void Stop();
+
+	bool IsRunning() const { return bRunning; }
+
+	/** Settings may be changed at any time; they apply to the next request or frame. */
+	FNakamaMockServerSettings Settings;
+
+	/**
+	 * Answer Verb + Path with Handler. A path ending in '*' matches by prefix.
+	 * Later routes take precedence over earlier ones and over the defaults.
+	 */
+	void SetRoute(const FString& Verb, const FString& Path, FNakamaMockRouteFn Handler);
+
+	/** Answer Verb + Path with a fixed response. */
+	void SetCannedResponse(const FString& Verb, const FString& Path, int32 Code, const FString& Body);
+
+	/** Remove all routes added with SetRoute or SetCannedResponse. */
+	void ClearRoutes();
+
+	/** Create an unconnected socket bound to this server. */
+	TSharedRef<IWebSocket> CreateWebSocket();
+
+	/** Make Client use a new mock socket on its next Connect. */
+	void Attach(UNakamaRealtimeClient* Client);
+
+	/** Close every connected socket with code 1006, as a lost connection would. */
+	void DropConnections();
+
+	/** Push a raw envelope to every connected socket. */
+	void Broadcast(const FString& Envelope);
+
+	/** Issue a session token for UserId; it is accepted by GET /v2/account and friends. */
+	FString CreateToken(const FString& UserId, const FString& Username);
+
+	FNakamaMockServerStats GetStats() const;
+
+private:
+
+	friend class FNakamaMockWebSocket;
+
+	FNakamaMockServer() = default;
+
+	bool Intercept(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request, const FNakamaHttpRespondFn& Respond);
+	FNakamaMockResponse Route(const FNakamaMockRequest& Request);
+	void AddDefaultRoutes();
+
+	FNakamaMockResponse Authenticate(const FNakamaMockRequest& Request);
+	FNakamaMockResponse WriteStorage(const FNakamaMockRequest& Request);
+	FNakamaMockResponse ReadStorage(const FNakamaMockRequest& Request);
+	FNakamaMockResponse DeleteStorage(const FNakamaMockRequest& Request);
+	FNakamaMockResponse PatchStorage(const FNakamaMockRequest& Request, const FString& Payload);
+	FString SessionJson(const FString& UserId, const FString& Username, bool bCreated);
+
+	// Random draws are shared between the HTTP and realtime paths.
+	float NextLatency();
+	bool Roll(float Rate);
+
+	// Realtime. Groups are match, party and channel ids mapped to their members.
+	void OnSocketConnected(const TSharedRef<FNakamaMockWebSocket>& Socket);
+	void OnSocketClosed(FNakamaMockWebSocket* Socket);
+	void HandleFrame(const TSharedRef<FNakamaMockWebSocket>& Socket, const FString& Frame);
+	void Join(const FString& GroupId, const TSharedRef<FNakamaMockWebSocket>& Socket);
+	void Leave(const FString& GroupId, FNakamaMockWebSocket* Socket);
+	void Relay(const FString& GroupId, const FString& Envelope, const FNakamaMockWebSocket* Except);
+	TArray<TSharedRef<FJsonObject>> MemberPresences(const FString& GroupId, const FNakamaMockWebSocket* Except) const;
+	bool TickPush(float DeltaTime);
+
+	struct FRouteEntry
+	{
+		FString Verb;
+		FString Path;
+		bool bPrefix = false;
+		FNakamaMockRouteFn Handler;
+	};
+	TArray<FRouteEntry> DefaultRoutes;
+	TArray<FRouteEntry> Routes;
+
+	// Issued tokens to the user they identify.
+	TMap<FString, FString> Tokens;
+
+	// Provider + identifier (e.g. "device:abc") to user id, and user id to username.
+	TMap<FString, FString> Identities;
+	TMap<FString, FString> Usernames;
+
+	// Storage objects by collection, key and owner.
+	TMap<FString, TSharedRef<FJsonObject>> StorageObjects;
+
+	TArray<TWeakPtr<FNakamaMockWebSocket>> Sockets;
+	TMap<FString, TArray<TWeakPtr<FNakamaMockWebSocket>>> Groups;
+
+	FRandomStream Random;
+	FTSTicker::FDelegateHandle PushTickerHandle;
+	double PushAccumulator = 0.0;
+
+	bool bRunning = false;
+
+	std::atomic<int64> HttpRequests{0};
+	std::atomic<int64> HttpErrorsInjected{0};
+	std::atomic<int64> ConnectionFailuresInjected{0};
+	std::atomic<int64> FramesReceived{0};
+	std::atomic<int64> FramesSent{0};
+	std::atomic<int64> RealtimeErrorsInjected{0};
+
+	mutable FCriticalSection Mutex;
+};
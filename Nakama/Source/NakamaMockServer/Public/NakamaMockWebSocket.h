@@ -0,0 +1,88 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IWebSocket.h"
+#include "Misc/EngineVersionComparison.h"
+
+class FNakamaMockServer;
+
+/**
+ * IWebSocket connected to an FNakamaMockServer instead of the network.
+ * Created through FNakamaMockServer::CreateWebSocket; every connection gets
+ * its own user and session id, reported in the presences the server sends.
+ */
+class NAKAMAMOCKSERVER_API FNakamaMockWebSocket : public IWebSocket, public TSharedFromThis<FNakamaMockWebSocket>
+{
+public:
+
+	FNakamaMockWebSocket(const TSharedRef<FNakamaMockServer, ESPMode::ThreadSafe>& InServer);
+	virtual ~FNakamaMockWebSocket() override;
+
+	// IWebSocket
+	virtual void Connect() override;
+	virtual void Close(int32 Code = 1000, const FString& Reason = FString()) override;
+	virtual bool IsConnected() override { return bConnected; }
+	virtual void Send(const FString& Data) override;
+	virtual void Send(const void* Data, SIZE_T Size, bool bIsBinary = false) override;
+#if !UE_VERSION_OLDER_THAN(5, 3, 0)
+	virtual void SetTextMessageMemoryLimit(uint64 TextMessageMemoryLimit) override {}
+#endif
+	virtual FWebSocketConnectedEvent& OnConnected() override { return ConnectedEvent; }
+	virtual FWebSocketConnectionErrorEvent& OnConnectionError() override { return ConnectionErrorEvent; }
+	virtual FWebSocketClosedEvent& OnClosed() override { return ClosedEvent; }
+	virtual FWebSocketMessageEvent& OnMessage() override { return MessageEvent; }
+	virtual FWebSocketBinaryMessageEvent& OnBinaryMessage() override { return BinaryMessageEvent; }
+	virtual FWebSocketRawMessageEvent& OnRawMessage() override { return RawMessageEvent; }
+	virtual FWebSocketMessageSentEvent& OnMessageSent() override { return MessageSentEvent; }
+
+	const FString& GetUserId() const { return UserId; }
+	const FString& GetSessionId() const { return SessionId; }
+	const FString& GetUsername() const { return Username; }
+
+	/** Deliver an envelope to the client after the server's simulated latency. */
+	void Deliver(const FString& Envelope);
+
+	/** Drop the connection from the server side. */
+	void Disconnect(int32 Code, const FString& Reason, bool bWasClean);
+
+private:
+
+	TWeakPtr<FNakamaMockServer, ESPMode::ThreadSafe> Server;
+
+	FString UserId;
+	FString SessionId;
+	FString Username;
+
+	bool bConnected = false;
+	bool bConnecting = false;
+
+	// Bumped on every connect and close so replies for a previous connection are dropped.
+	uint32 Generation = 0;
+
+	// Time the last delivered envelope is due, to keep deliveries ordered.
+	double LastDeliverTime = 0.0;
+
+	FWebSocketConnectedEvent ConnectedEvent;
+	FWebSocketConnectionErrorEvent ConnectionErrorEvent;
+	FWebSocketClosedEvent ClosedEvent;
+	FWebSocketMessageEvent MessageEvent;
+	FWebSocketBinaryMessageEvent BinaryMessageEvent;
+	FWebSocketRawMessageEvent RawMessageEvent;
+	FWebSocketMessageSentEvent MessageSentEvent;
+};
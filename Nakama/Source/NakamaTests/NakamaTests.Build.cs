@@ -61,6 +61,7 @@ public class NakamaTests : ModuleRules
 				"Engine",
 				"JsonUtilities",
 				"Json",
+				"NakamaMockServer",
 
 				// ... private dependencies that you statically link with here ...
 			}
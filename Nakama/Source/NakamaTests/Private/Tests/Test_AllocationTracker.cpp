@@ -0,0 +1,73 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaTestBase.h"
+#include "NakamaMemory.h"
+
+#if NAKAMA_ALLOC_TRACKING
+
+// Allocations are counted against the innermost scope and nothing outside one is counted.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNakamaAllocationTrackerScopes, "Nakama.Base.Memory.AllocationScopes", NAKAMA_MODULE_TEST_MASK)
+bool FNakamaAllocationTrackerScopes::RunTest(const FString& Parameters)
+{
+	if (!FNakamaAllocationTracker::IsInstalled())
+	{
+		AddInfo(TEXT("Allocation tracking is not installed, run with -NakamaAllocTracking"));
+		return true;
+	}
+
+	const bool bWasEnabled = FNakamaAllocationTracker::IsEnabled();
+	FNakamaAllocationTracker::Enable();
+	FNakamaAllocationTracker::Reset();
+
+	{
+		NAKAMA_MEMORY_SCOPE(Nakama_Requests, Requests);
+		TArray<uint8> Outer;
+		Outer.SetNumUninitialized(1024);
+
+		{
+			NAKAMA_MEMORY_SCOPE(Nakama_Responses, Responses);
+			TArray<uint8> Inner;
+			Inner.SetNumUninitialized(4096);
+		}
+	}
+
+	const FNakamaAllocationCounters Requests = FNakamaAllocationTracker::GetCounters(ENakamaAllocScope::Requests);
+	const FNakamaAllocationCounters Responses = FNakamaAllocationTracker::GetCounters(ENakamaAllocScope::Responses);
+	const FNakamaAllocationCounters Dispatch = FNakamaAllocationTracker::GetCounters(ENakamaAllocScope::RealtimeDispatch);
+
+	TestTrue("Outer scope counted", Requests.NumAllocations >= 1 && Requests.NumBytes >= 1024);
+	TestTrue("Inner scope counted", Responses.NumAllocations >= 1 && Responses.NumBytes >= 4096);
+	TestTrue("Inner allocation not counted against outer scope", Requests.NumBytes < 4096);
+	TestEqual("Unused scope untouched", Dispatch.NumAllocations, static_cast<int64>(0));
+
+	// Disabling only stops counting; the proxy stays installed.
+	FNakamaAllocationTracker::Disable();
+	{
+		NAKAMA_MEMORY_SCOPE(Nakama_Requests, Requests);
+		TArray<uint8> Uncounted;
+		Uncounted.SetNumUninitialized(8192);
+	}
+	TestEqual("Nothing counted while disabled", FNakamaAllocationTracker::GetCounters(ENakamaAllocScope::Requests).NumBytes, Requests.NumBytes);
+
+	if (bWasEnabled)
+	{
+		FNakamaAllocationTracker::Enable();
+	}
+	return true;
+}
+
+#endif // NAKAMA_ALLOC_TRACKING
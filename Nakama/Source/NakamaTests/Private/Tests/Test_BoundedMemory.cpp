@@ -0,0 +1,155 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaTestBase.h"
+#include "NakamaMockServer.h"
+#include "NakamaRealtimeClient.h"
+#include "NakamaHttpPipeline.h"
+
+// With one request on the wire and room for one more in the queue, a third request is rejected.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(BoundedHttpQueueReject, FNakamaTestBase, "Nakama.Base.BoundedMemory.HttpQueueReject", NAKAMA_MODULE_TEST_MASK)
+inline bool BoundedHttpQueueReject::RunTest(const FString& Parameters)
+{
+	InitiateTest();
+
+	FNakamaMockServerSettings Settings;
+	Settings.MinLatencySeconds = 0.1f;
+	Settings.MaxLatencySeconds = 0.1f;
+	TSharedRef<FNakamaMockServer, ESPMode::ThreadSafe> Server = FNakamaMockServer::Create(Settings);
+	Server->Start();
+
+	FNakamaHttpPipeline& Pipeline = FNakamaHttpPipeline::Get();
+	const int32 PreviousMaxConcurrent = Pipeline.GetMaxConcurrentRequests();
+	const int32 PreviousMaxQueued = Pipeline.GetMaxQueuedRequests();
+	const int64 PreviousRejected = Pipeline.GetStats().NumRejected;
+	Pipeline.SetMaxConcurrentRequests(1);
+	Pipeline.SetMaxQueuedRequests(1, ENakamaOverflowPolicy::Reject);
+
+	struct FCounts
+	{
+		int32 NumSucceeded = 0;
+		int32 NumRejected = 0;
+		int32 NumOther = 0;
+	};
+	TSharedRef<FCounts> Counts = MakeShared<FCounts>();
+
+	auto Finish = [this, Server, Counts, PreviousMaxConcurrent, PreviousMaxQueued, PreviousRejected]()
+	{
+		if (Counts->NumSucceeded + Counts->NumRejected + Counts->NumOther < 3)
+		{
+			return;
+		}
+
+		FNakamaHttpPipeline& Pipeline = FNakamaHttpPipeline::Get();
+		TestEqual("Succeeded", Counts->NumSucceeded, 2);
+		TestEqual("Rejected", Counts->NumRejected, 1);
+		TestEqual("Other failures", Counts->NumOther, 0);
+		TestEqual("Pipeline rejected count", Pipeline.GetStats().NumRejected - PreviousRejected, static_cast<int64>(1));
+
+		Pipeline.SetMaxQueuedRequests(PreviousMaxQueued);
+		Pipeline.SetMaxConcurrentRequests(PreviousMaxConcurrent);
+		Server->Stop();
+		StopTest();
+	};
+
+	for (int32 Index = 0; Index < 3; ++Index)
+	{
+		Client->AuthenticateCustom(FGuid::NewGuid().ToString(), "", true, {},
+			[Counts, Finish](UNakamaSession*)
+			{
+				Counts->NumSucceeded++;
+				Finish();
+			},
+			[Counts, Finish](const FNakamaError& Error)
+			{
+				(Error.Code == ENakamaErrorCode::ResourceExhausted ? Counts->NumRejected : Counts->NumOther)++;
+				Finish();
+			});
+	}
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForAsyncQueries(this));
+	return true;
+}
+
+// With a cap of one pending realtime request, a second request evicts the first under DropOldest.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(BoundedRealtimeDropOldest, FNakamaTestBase, "Nakama.Base.BoundedMemory.RealtimeDropOldest", NAKAMA_MODULE_TEST_MASK)
+inline bool BoundedRealtimeDropOldest::RunTest(const FString& Parameters)
+{
+	InitiateTest();
+
+	FNakamaMockServerSettings Settings;
+	Settings.MinLatencySeconds = 0.05f;
+	Settings.MaxLatencySeconds = 0.05f;
+	TSharedRef<FNakamaMockServer, ESPMode::ThreadSafe> Server = FNakamaMockServer::Create(Settings);
+	Server->Start();
+
+	auto successCallback = [this, Server](UNakamaSession* session)
+	{
+		Session = session;
+		Socket = Client->SetupRealtimeClient();
+		Socket->SetMaxPendingRequests(1, ENakamaOverflowPolicy::DropOldest);
+		Server->Attach(Socket);
+
+		Socket->SetConnectCallback([this, Server]()
+		{
+			TSharedRef<bool> bFirstDropped = MakeShared<bool>(false);
+
+			Socket->RPC(TEXT("echo"), FString(TEXT("{\"n\":1}")),
+				[this](const FNakamaRPC&)
+				{
+					TestFalse("Evicted request must not succeed", true);
+				},
+				[this, bFirstDropped](const FNakamaRtError& Error)
+				{
+					TestEqual("Eviction error code", Error.Code, ENakamaRtErrorCode::REQUEST_LIMIT);
+					*bFirstDropped = true;
+				});
+
+			Socket->RPC(TEXT("echo"), FString(TEXT("{\"n\":2}")),
+				[this, Server, bFirstDropped](const FNakamaRPC& Rpc)
+				{
+					TestEqual("Echoed payload", Rpc.Payload, FString(TEXT("{\"n\":2}")));
+					TestTrue("First request evicted", *bFirstDropped);
+
+					const FNakamaRealtimeStats Stats = Socket->GetStats();
+					TestEqual("Dropped", Stats.DroppedRequests, static_cast<int64>(1));
+					TestEqual("Pending", Stats.PendingRequests, 0);
+					Server->Stop();
+					StopTest();
+				},
+				[this, Server](const FNakamaRtError& Error)
+				{
+					TestFalse(FString::Printf(TEXT("RPC failed: %s"), *Error.Message), true);
+					Server->Stop();
+					StopTest();
+				});
+		});
+
+		Socket->Connect(Session, true);
+	};
+
+	auto errorCallback = [this, Server](const FNakamaError& Error)
+	{
+		TestFalse("Authentication failed", true);
+		Server->Stop();
+		StopTest();
+	};
+
+	Client->AuthenticateCustom(FGuid::NewGuid().ToString(), "", true, {}, successCallback, errorCallback);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForAsyncQueries(this));
+	return true;
+}
@@ -0,0 +1,206 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaTestBase.h"
+#include "NakamaMockServer.h"
+#include "NakamaChatHistory.h"
+#include "NakamaUtils.h"
+#include "UObject/StrongObjectPtr.h"
+#include "Dom/JsonObject.h"
+
+namespace
+{
+	using FMockChannel = TSharedRef<TArray<TSharedPtr<FJsonValue>>, ESPMode::ThreadSafe>;
+
+	// Message m<Index>, created Index seconds into the day.
+	TSharedRef<FJsonObject> MockMessage(int32 Index)
+	{
+		const TSharedRef<FJsonObject> Message = MakeShared<FJsonObject>();
+		Message->SetStringField(TEXT("channel_id"), TEXT("room"));
+		Message->SetStringField(TEXT("message_id"), FString::Printf(TEXT("m%d"), Index));
+		Message->SetStringField(TEXT("content"), TEXT("{}"));
+		Message->SetStringField(TEXT("create_time"), FDateTime(2026, 1, 1, 0, 0, Index).ToIso8601());
+		Message->SetStringField(TEXT("update_time"), FDateTime(2026, 1, 1, 0, 0, Index).ToIso8601());
+		return Message;
+	}
+
+	void AddMockMessages(const FMockChannel& Channel, int32 First, int32 Last)
+	{
+		for (int32 Index = First; Index <= Last; ++Index)
+		{
+			Channel->Add(MakeShared<FJsonValueObject>(MockMessage(Index)));
+		}
+	}
+
+	// Newest first like the server with forward=false, with the cursor as the offset.
+	FNakamaMockResponse MockChannelPage(const FNakamaMockRequest& Request, const FMockChannel& Channel)
+	{
+		const int32 Offset = FCString::Atoi(*Request.GetQueryParam(TEXT("cursor")));
+		const FString LimitParam = Request.GetQueryParam(TEXT("limit"));
+		const int32 Limit = LimitParam.IsEmpty() ? 100 : FCString::Atoi(*LimitParam);
+
+		TArray<TSharedPtr<FJsonValue>> Messages;
+		const int32 End = FMath::Min(Offset + Limit, Channel->Num());
+		for (int32 Index = Offset; Index < End; ++Index)
+		{
+			Messages.Add((*Channel)[Channel->Num() - 1 - Index]);
+		}
+
+		const TSharedRef<FJsonObject> Body = MakeShared<FJsonObject>();
+		Body->SetArrayField(TEXT("messages"), Messages);
+		if (End < Channel->Num())
+		{
+			Body->SetStringField(TEXT("next_cursor"), FString::FromInt(End));
+		}
+		return FNakamaMockResponse(200, FNakamaUtils::EncodeJson(Body));
+	}
+
+	FNakamaChannelMessage LiveMessage(int32 Index, int32 Code = 0)
+	{
+		FNakamaChannelMessage Message(MockMessage(Index));
+		Message.code = Code;
+		return Message;
+	}
+
+	FString JoinIds(const TArray<FNakamaChannelMessage>& Messages)
+	{
+		TArray<FString> Ids;
+		for (const FNakamaChannelMessage& Message : Messages)
+		{
+			Ids.Add(Message.MessageId);
+		}
+		return FString::Join(Ids, TEXT(","));
+	}
+}
+
+// History and live messages merge in order, without duplicates, and apply updates and removals.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(ChatHistoryLoad, FNakamaTestBase, "Nakama.Base.ChatHistory.Load", NAKAMA_MODULE_TEST_MASK)
+inline bool ChatHistoryLoad::RunTest(const FString& Parameters)
+{
+	InitiateTest();
+
+	FMockChannel ServerMessages = MakeShared<TArray<TSharedPtr<FJsonValue>>, ESPMode::ThreadSafe>();
+	AddMockMessages(ServerMessages, 1, 5);
+
+	TSharedRef<FNakamaMockServer, ESPMode::ThreadSafe> Server = FNakamaMockServer::Create();
+	Server->SetRoute(TEXT("GET"), TEXT("/v2/channel/*"), [ServerMessages](const FNakamaMockRequest& Request)
+	{
+		return MockChannelPage(Request, ServerMessages);
+	});
+	Server->Start();
+
+	TSharedRef<TStrongObjectPtr<UNakamaChatHistory>> History = MakeShared<TStrongObjectPtr<UNakamaChatHistory>>(UNakamaChatHistory::CreateChatHistory(Client));
+
+	auto Fail = [this, Server](const FString& What, const FNakamaError& Error)
+	{
+		TestFalse(FString::Printf(TEXT("%s failed: %s"), *What, *Error.Message), true);
+		Server->Stop();
+		StopTest();
+	};
+
+	auto successCallback = [this, Server, History, Fail](UNakamaSession* session)
+	{
+		(*History)->LoadHistory(session, TEXT("room"), [this, Server, History](const TArray<FNakamaChannelMessage>& Messages)
+		{
+			TestEqual("Oldest first", JoinIds(Messages), FString(TEXT("m1,m2,m3,m4,m5")));
+
+			(*History)->AddMessage(LiveMessage(5));
+			(*History)->AddMessage(LiveMessage(6));
+			(*History)->AddMessage(LiveMessage(2, 2));
+
+			FNakamaChannelMessage Edited = LiveMessage(3, 1);
+			Edited.Content = TEXT("{\"edited\":true}");
+			(*History)->AddMessage(Edited);
+
+			const TArray<FNakamaChannelMessage> Merged = (*History)->GetMessages(TEXT("room"));
+			TestEqual("Merged", JoinIds(Merged), FString(TEXT("m1,m3,m4,m5,m6")));
+			TestEqual("Updated in place", Merged[1].Content, Edited.Content);
+			TestEqual("One request", (*History)->GetNumRequests(), 1);
+			Server->Stop();
+			StopTest();
+		}, [Fail](const FNakamaError& Error) { Fail(TEXT("Load"), Error); });
+	};
+
+	auto errorCallback = [Fail](const FNakamaError& Error)
+	{
+		Fail(TEXT("Authentication"), Error);
+	};
+
+	Client->AuthenticateDevice(FGuid::NewGuid().ToString(), true, {}, {}, successCallback, errorCallback);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForAsyncQueries(this));
+	return true;
+}
+
+// A gap is closed by paging back from the newest message until a cached one is reached.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(ChatHistoryBackfill, FNakamaTestBase, "Nakama.Base.ChatHistory.Backfill", NAKAMA_MODULE_TEST_MASK)
+inline bool ChatHistoryBackfill::RunTest(const FString& Parameters)
+{
+	InitiateTest();
+
+	FMockChannel ServerMessages = MakeShared<TArray<TSharedPtr<FJsonValue>>, ESPMode::ThreadSafe>();
+	AddMockMessages(ServerMessages, 1, 4);
+
+	TSharedRef<FNakamaMockServer, ESPMode::ThreadSafe> Server = FNakamaMockServer::Create();
+	Server->SetRoute(TEXT("GET"), TEXT("/v2/channel/*"), [ServerMessages](const FNakamaMockRequest& Request)
+	{
+		return MockChannelPage(Request, ServerMessages);
+	});
+	Server->Start();
+
+	TSharedRef<TStrongObjectPtr<UNakamaChatHistory>> History = MakeShared<TStrongObjectPtr<UNakamaChatHistory>>(UNakamaChatHistory::CreateChatHistory(Client));
+	(*History)->PageSize = 3;
+
+	auto Fail = [this, Server](const FString& What, const FNakamaError& Error)
+	{
+		TestFalse(FString::Printf(TEXT("%s failed: %s"), *What, *Error.Message), true);
+		Server->Stop();
+		StopTest();
+	};
+
+	auto successCallback = [this, Server, History, Fail, ServerMessages](UNakamaSession* session)
+	{
+		(*History)->LoadHistory(session, TEXT("room"), [this, Server, History, Fail, ServerMessages, session](const TArray<FNakamaChannelMessage>& Messages)
+		{
+			TestEqual("First page", JoinIds(Messages), FString(TEXT("m2,m3,m4")));
+
+			// Offline while five messages are sent.
+			(*History)->MarkGap(TEXT("room"));
+			AddMockMessages(ServerMessages, 5, 9);
+			TestTrue("Gap marked", (*History)->HasGap(TEXT("room")));
+
+			(*History)->Backfill(session, TEXT("room"), [this, Server, History](int32 NumAdded)
+			{
+				TestEqual("Added", NumAdded, 5);
+				TestEqual("Two pages for the gap", (*History)->GetNumRequests(), 3);
+				TestEqual("Contiguous", JoinIds((*History)->GetMessages(TEXT("room"))), FString(TEXT("m2,m3,m4,m5,m6,m7,m8,m9")));
+				TestFalse("Gap closed", (*History)->HasGap(TEXT("room")));
+				Server->Stop();
+				StopTest();
+			}, [Fail](const FNakamaError& Error) { Fail(TEXT("Backfill"), Error); });
+		}, [Fail](const FNakamaError& Error) { Fail(TEXT("Load"), Error); });
+	};
+
+	auto errorCallback = [Fail](const FNakamaError& Error)
+	{
+		Fail(TEXT("Authentication"), Error);
+	};
+
+	Client->AuthenticateDevice(FGuid::NewGuid().ToString(), true, {}, {}, successCallback, errorCallback);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForAsyncQueries(this));
+	return true;
+}
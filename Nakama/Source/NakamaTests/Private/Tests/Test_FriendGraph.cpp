@@ -0,0 +1,177 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaTestBase.h"
+#include "NakamaMockServer.h"
+#include "NakamaFriendGraph.h"
+#include "NakamaUtils.h"
+#include "UObject/StrongObjectPtr.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include <atomic>
+
+namespace
+{
+	// f1..f3 are friends, f4 sent an invite and f5 was invited; the cursor is the offset.
+	FNakamaMockResponse MockFriendsPage(const FNakamaMockRequest& Request)
+	{
+		static const int32 States[] = { 0, 0, 0, 2, 1 };
+
+		const int32 Offset = FCString::Atoi(*Request.GetQueryParam(TEXT("cursor")));
+		const FString LimitParam = Request.GetQueryParam(TEXT("limit"));
+		const int32 Limit = LimitParam.IsEmpty() ? 100 : FCString::Atoi(*LimitParam);
+
+		const int32 End = FMath::Min(Offset + Limit, 5);
+		TArray<TSharedPtr<FJsonValue>> Friends;
+		for (int32 Index = Offset; Index < End; ++Index)
+		{
+			const TSharedRef<FJsonObject> User = MakeShared<FJsonObject>();
+			User->SetStringField(TEXT("id"), FString::Printf(TEXT("f%d"), Index + 1));
+			User->SetStringField(TEXT("username"), FString::Printf(TEXT("user%d"), Index + 1));
+
+			const TSharedRef<FJsonObject> Friend = MakeShared<FJsonObject>();
+			Friend->SetObjectField(TEXT("user"), User);
+			Friend->SetNumberField(TEXT("state"), States[Index]);
+			Friends.Add(MakeShared<FJsonValueObject>(Friend));
+		}
+
+		const TSharedRef<FJsonObject> Body = MakeShared<FJsonObject>();
+		Body->SetArrayField(TEXT("friends"), Friends);
+		if (End < 5)
+		{
+			Body->SetStringField(TEXT("cursor"), FString::FromInt(End));
+		}
+		return FNakamaMockResponse(200, FNakamaUtils::EncodeJson(Body));
+	}
+
+	FString JoinFriends(const TArray<FNakamaFriend>& Friends)
+	{
+		TArray<FString> Ids;
+		for (const FNakamaFriend& Friend : Friends)
+		{
+			Ids.Add(FString::Printf(TEXT("%s:%d"), *Friend.NakamaUser.Id, static_cast<int32>(Friend.UserState)));
+		}
+		return FString::Join(Ids, TEXT(","));
+	}
+}
+
+// All pages are listed once, changes are applied locally without listing again, and the graph survives a reload.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FriendGraphReconcile, FNakamaTestBase, "Nakama.Base.FriendGraph.Reconcile", NAKAMA_MODULE_TEST_MASK)
+inline bool FriendGraphReconcile::RunTest(const FString& Parameters)
+{
+	InitiateTest();
+
+	TSharedRef<std::atomic<int32>, ESPMode::ThreadSafe> NumLists = MakeShared<std::atomic<int32>, ESPMode::ThreadSafe>(0);
+
+	TSharedRef<FNakamaMockServer, ESPMode::ThreadSafe> Server = FNakamaMockServer::Create();
+	Server->SetRoute(TEXT("GET"), TEXT("/v2/friend"), [NumLists](const FNakamaMockRequest& Request)
+	{
+		++(*NumLists);
+		return MockFriendsPage(Request);
+	});
+	Server->SetCannedResponse(TEXT("POST"), TEXT("/v2/friend"), 200, TEXT("{}"));
+	Server->SetCannedResponse(TEXT("DELETE"), TEXT("/v2/friend"), 200, TEXT("{}"));
+	Server->SetCannedResponse(TEXT("POST"), TEXT("/v2/friend/block"), 200, TEXT("{}"));
+	Server->Start();
+
+	const FString SaveUserId = FGuid::NewGuid().ToString();
+	TSharedRef<TStrongObjectPtr<UNakamaFriendGraph>> Graph = MakeShared<TStrongObjectPtr<UNakamaFriendGraph>>(UNakamaFriendGraph::CreateFriendGraph(Client));
+	(*Graph)->PageSize = 2;
+	TestFalse("Nothing saved yet", (*Graph)->Load(SaveUserId));
+
+	auto Fail = [this, Server](const FString& What, const FNakamaError& Error)
+	{
+		TestFalse(FString::Printf(TEXT("%s failed: %s"), *What, *Error.Message), true);
+		Server->Stop();
+		StopTest();
+	};
+
+	auto successCallback = [this, Server, Graph, Fail, NumLists, SaveUserId](UNakamaSession* session)
+	{
+		(*Graph)->Refresh(session, [this, Server, Graph, Fail, NumLists, SaveUserId, session](int32 NumFriends)
+		{
+			TestEqual("All relationships", NumFriends, 5);
+			TestEqual("Three pages", NumLists->load(), 3);
+			TestEqual("Friends", (*Graph)->GetFriends(ENakamaFriendState::FRIEND).Num(), 3);
+
+			// Accepting f4's invite and inviting a new user.
+			(*Graph)->AddFriends(session, { TEXT("f4"), TEXT("f9") }, {}, [this, Server, Graph, Fail, NumLists, SaveUserId, session]()
+			{
+				(*Graph)->BlockFriends(session, {}, { TEXT("user5") }, [this, Server, Graph, Fail, NumLists, SaveUserId, session]()
+				{
+					(*Graph)->DeleteFriends(session, { TEXT("f1") }, {}, [this, Server, Graph, NumLists, SaveUserId]()
+					{
+						const FString Expected = TEXT("f9:1,f2:0,f3:0,f4:0,f5:3");
+						TestEqual("Reconciled", JoinFriends((*Graph)->GetFriends()), Expected);
+						TestEqual("No relisting", NumLists->load(), 3);
+
+						TStrongObjectPtr<UNakamaFriendGraph> Reloaded(UNakamaFriendGraph::CreateFriendGraph(Client));
+						TestTrue("Saved", Reloaded->Load(SaveUserId));
+						TestEqual("Reloaded", JoinFriends(Reloaded->GetFriends()), Expected);
+
+						IFileManager::Get().Delete(*FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Nakama"), FString::Printf(TEXT("Friends_%s.json"), *SaveUserId)));
+						Server->Stop();
+						StopTest();
+					}, [Fail](const FNakamaError& Error) { Fail(TEXT("Delete"), Error); });
+				}, [Fail](const FNakamaError& Error) { Fail(TEXT("Block"), Error); });
+			}, [Fail](const FNakamaError& Error) { Fail(TEXT("Add"), Error); });
+		}, [Fail](const FNakamaError& Error) { Fail(TEXT("Refresh"), Error); });
+	};
+
+	auto errorCallback = [Fail](const FNakamaError& Error)
+	{
+		Fail(TEXT("Authentication"), Error);
+	};
+
+	Client->AuthenticateDevice(FGuid::NewGuid().ToString(), true, {}, {}, successCallback, errorCallback);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForAsyncQueries(this));
+	return true;
+}
+
+// Loading another user starts from an empty graph and never writes the previous user's relationships to the new file.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FriendGraphSwitchUser, FNakamaTestBase, "Nakama.Base.FriendGraph.SwitchUser", NAKAMA_MODULE_TEST_MASK)
+inline bool FriendGraphSwitchUser::RunTest(const FString& Parameters)
+{
+	// User IDs end up in file names, so include characters a path cannot hold.
+	const FString UserA = TEXT("a/") + FGuid::NewGuid().ToString();
+	const FString UserB = TEXT("b:") + FGuid::NewGuid().ToString();
+	auto SaveFile = [](const FString& UserId)
+	{
+		return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Nakama"), FString::Printf(TEXT("Friends_%s.json"), *FPaths::MakeValidFileName(UserId)));
+	};
+
+	FFileHelper::SaveStringToFile(TEXT("{\"friends\":[{\"user\":{\"id\":\"f1\",\"username\":\"user1\"},\"state\":0}]}"), *SaveFile(UserA));
+
+	TStrongObjectPtr<UNakamaFriendGraph> Graph(UNakamaFriendGraph::CreateFriendGraph(nullptr));
+	TestTrue("Loaded A", Graph->Load(UserA));
+	TestEqual("A's friends", Graph->GetFriends().Num(), 1);
+
+	TestFalse("Nothing saved for B", Graph->Load(UserB));
+	TestEqual("B starts empty", Graph->GetFriends().Num(), 0);
+	TestFalse("B is not loaded", Graph->IsLoaded());
+
+	TestTrue("Saved B", Graph->Save());
+	FString SavedB;
+	TestTrue("B's file is in the saved directory", FFileHelper::LoadFileToString(SavedB, *SaveFile(UserB)));
+	TestFalse("B's file holds none of A's friends", SavedB.Contains(TEXT("f1")));
+
+	IFileManager::Get().Delete(*SaveFile(UserA));
+	IFileManager::Get().Delete(*SaveFile(UserB));
+	return true;
+}
@@ -0,0 +1,57 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaTestBase.h"
+#include "NakamaHttpMetrics.h"
+
+// ID-like path segments and the object named after a parameterized route collapse to {id}; fixed segments are kept.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(HttpMetricsNormalizeEndpoint, FNakamaTestBase, "Nakama.Base.HttpMetrics.NormalizeEndpoint", NAKAMA_MODULE_TEST_MASK)
+inline bool HttpMetricsNormalizeEndpoint::RunTest(const FString& Parameters)
+{
+	TestEqual(TEXT("static path"), FNakamaHttpMetrics::NormalizeEndpoint(TEXT("/v2/account")), FString(TEXT("/v2/account")));
+	TestEqual(TEXT("uuid"), FNakamaHttpMetrics::NormalizeEndpoint(TEXT("/v2/group/1b6c2f4e-6d0a-4c57-9a39-1f0e2d3c4b5a/join")), FString(TEXT("/v2/group/{id}/join")));
+	TestEqual(TEXT("numeric"), FNakamaHttpMetrics::NormalizeEndpoint(TEXT("/v1/message/42")), FString(TEXT("/v1/message/{id}")));
+	TestEqual(TEXT("short hex word kept"), FNakamaHttpMetrics::NormalizeEndpoint(TEXT("/v2/group/1b6c2f4e-6d0a-4c57-9a39-1f0e2d3c4b5a/add")), FString(TEXT("/v2/group/{id}/add")));
+	TestEqual(TEXT("rpc id"), FNakamaHttpMetrics::NormalizeEndpoint(TEXT("/v2/rpc/claim_reward")), FString(TEXT("/v2/rpc/{id}")));
+	TestEqual(TEXT("leaderboard and owner"), FNakamaHttpMetrics::NormalizeEndpoint(TEXT("/v2/leaderboard/weekly/owner/player_one")), FString(TEXT("/v2/leaderboard/{id}/owner/{id}")));
+	TestEqual(TEXT("group name"), FNakamaHttpMetrics::NormalizeEndpoint(TEXT("/v2/group/Knights/join")), FString(TEXT("/v2/group/{id}/join")));
+	TestEqual(TEXT("storage collection"), FNakamaHttpMetrics::NormalizeEndpoint(TEXT("/v2/storage/saves")), FString(TEXT("/v2/storage/{id}")));
+	TestEqual(TEXT("fixed storage route"), FNakamaHttpMetrics::NormalizeEndpoint(TEXT("/v2/storage/delete")), FString(TEXT("/v2/storage/delete")));
+	TestEqual(TEXT("list route"), FNakamaHttpMetrics::NormalizeEndpoint(TEXT("/v2/group")), FString(TEXT("/v2/group")));
+	return true;
+}
+
+// Samples land in the first bucket whose bound they do not exceed; percentiles report bucket bounds.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(HttpMetricsHistogram, FNakamaTestBase, "Nakama.Base.HttpMetrics.Histogram", NAKAMA_MODULE_TEST_MASK)
+inline bool HttpMetricsHistogram::RunTest(const FString& Parameters)
+{
+	FNakamaLatencyHistogram Histogram;
+	TestEqual(TEXT("empty p50"), Histogram.GetPercentileMs(50), 0.0);
+
+	for (int32 i = 0; i < 98; ++i)
+	{
+		Histogram.Add(3.0); // (2, 5] bucket
+	}
+	Histogram.Add(150.0);   // (100, 200] bucket
+	Histogram.Add(20000.0); // overflow bucket
+
+	TestEqual(TEXT("count"), Histogram.Count, static_cast<int64>(100));
+	TestEqual(TEXT("p50"), Histogram.GetPercentileMs(50), 5.0);
+	TestEqual(TEXT("p99"), Histogram.GetPercentileMs(99), 200.0);
+	TestEqual(TEXT("p100 is max"), Histogram.GetPercentileMs(100), 20000.0);
+	TestEqual(TEXT("max"), Histogram.MaxMs, 20000.0);
+	return true;
+}
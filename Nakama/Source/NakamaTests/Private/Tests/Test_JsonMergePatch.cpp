@@ -0,0 +1,52 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaTestBase.h"
+#include "NakamaJsonMergePatch.h"
+
+// A patch holds only what changed and turns the original into the modified value.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(JsonMergePatchRoundTrip, FNakamaTestBase, "Nakama.Base.JsonMergePatch.RoundTrip", NAKAMA_MODULE_TEST_MASK)
+inline bool JsonMergePatchRoundTrip::RunTest(const FString& Parameters)
+{
+	const FString Original = TEXT("{\"gold\":10,\"name\":\"bag\",\"items\":{\"sword\":1,\"shield\":1},\"tags\":[\"a\"]}");
+	const FString Modified = TEXT("{\"gold\":12,\"name\":\"bag\",\"items\":{\"sword\":1,\"bow\":1},\"tags\":[\"a\",\"b\"]}");
+
+	FString Patch;
+	TestTrue("Patch created", FNakamaJsonMergePatch::Create(Original, Modified, Patch));
+	TestEqual("Patch", Patch, FString(TEXT("{\"gold\":12,\"items\":{\"shield\":null,\"bow\":1},\"tags\":[\"a\",\"b\"]}")));
+
+	FString Patched;
+	TestTrue("Patch applied", FNakamaJsonMergePatch::Apply(Original, Patch, Patched));
+	FString Expected;
+	FNakamaJsonMergePatch::Apply(Modified, TEXT("{}"), Expected);
+	TestEqual("Round trip", Patched, Expected);
+
+	FString Unchanged;
+	TestTrue("Empty patch", FNakamaJsonMergePatch::Create(Original, Original, Unchanged));
+	TestEqual("Nothing changed", Unchanged, FString(TEXT("{}")));
+	return true;
+}
+
+// Values a merge patch cannot express are refused so the caller writes them whole.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(JsonMergePatchInexpressible, FNakamaTestBase, "Nakama.Base.JsonMergePatch.Inexpressible", NAKAMA_MODULE_TEST_MASK)
+inline bool JsonMergePatchInexpressible::RunTest(const FString& Parameters)
+{
+	FString Patch;
+	TestFalse("Null member", FNakamaJsonMergePatch::Create(TEXT("{\"a\":1}"), TEXT("{\"a\":null}"), Patch));
+	TestFalse("Not an object", FNakamaJsonMergePatch::Create(TEXT("[1]"), TEXT("[2]"), Patch));
+	TestFalse("Not JSON", FNakamaJsonMergePatch::Create(TEXT("{\"a\":1}"), TEXT("plain text"), Patch));
+	return true;
+}
@@ -0,0 +1,201 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaTestBase.h"
+#include "NakamaMockServer.h"
+#include "NakamaLeaderboardView.h"
+#include "NakamaUtils.h"
+#include "UObject/StrongObjectPtr.h"
+#include "Dom/JsonObject.h"
+
+namespace
+{
+	TSharedRef<FJsonObject> MockRecord(const FString& OwnerId, int64 Rank)
+	{
+		const TSharedRef<FJsonObject> Record = MakeShared<FJsonObject>();
+		Record->SetStringField(TEXT("leaderboard_id"), TEXT("weekly"));
+		Record->SetStringField(TEXT("owner_id"), OwnerId);
+		Record->SetNumberField(TEXT("score"), 1000 - Rank);
+		Record->SetNumberField(TEXT("rank"), Rank);
+		return Record;
+	}
+
+	// Records p1, p2, ... ranked in order, PageSize per page, with the cursor as the offset.
+	FNakamaMockResponse MockLeaderboardPage(const FNakamaMockRequest& Request, int32 PageSize)
+	{
+		const int32 Offset = FCString::Atoi(*Request.GetQueryParam(TEXT("cursor")));
+
+		TArray<TSharedPtr<FJsonValue>> Records;
+		for (int32 Rank = Offset + 1; Rank <= Offset + PageSize; ++Rank)
+		{
+			Records.Add(MakeShared<FJsonValueObject>(MockRecord(FString::Printf(TEXT("p%d"), Rank), Rank)));
+		}
+
+		const TSharedRef<FJsonObject> Body = MakeShared<FJsonObject>();
+		Body->SetArrayField(TEXT("records"), Records);
+		Body->SetStringField(TEXT("next_cursor"), FString::FromInt(Offset + PageSize));
+		return FNakamaMockResponse(200, FNakamaUtils::EncodeJson(Body));
+	}
+
+	FString JoinOwners(const TArray<FNakamaLeaderboardRecord>& Records)
+	{
+		TArray<FString> Owners;
+		for (const FNakamaLeaderboardRecord& Record : Records)
+		{
+			Owners.Add(FString::Printf(TEXT("%s@%lld"), *Record.OwnerId, Record.Rank));
+		}
+		return FString::Join(Owners, TEXT(","));
+	}
+}
+
+// Pages are served from the cache while fresh and new pages merge into the rank order.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(LeaderboardViewPages, FNakamaTestBase, "Nakama.Base.LeaderboardView.Pages", NAKAMA_MODULE_TEST_MASK)
+inline bool LeaderboardViewPages::RunTest(const FString& Parameters)
+{
+	InitiateTest();
+
+	TSharedRef<FNakamaMockServer, ESPMode::ThreadSafe> Server = FNakamaMockServer::Create();
+	Server->SetRoute(TEXT("GET"), TEXT("/v2/leaderboard/weekly"), [](const FNakamaMockRequest& Request)
+	{
+		return MockLeaderboardPage(Request, 5);
+	});
+	Server->Start();
+
+	TSharedRef<TStrongObjectPtr<UNakamaLeaderboardView>> View = MakeShared<TStrongObjectPtr<UNakamaLeaderboardView>>(UNakamaLeaderboardView::CreateLeaderboardView(Client, TEXT("weekly"), 5));
+
+	auto Fail = [this, Server](const FString& What, const FNakamaError& Error)
+	{
+		TestFalse(FString::Printf(TEXT("%s failed: %s"), *What, *Error.Message), true);
+		Server->Stop();
+		StopTest();
+	};
+
+	auto successCallback = [this, Server, View, Fail](UNakamaSession* session)
+	{
+		(*View)->ListPage(session, FString(), [this, Server, View, Fail, session](const FNakamaLeaderboardRecordList& First)
+		{
+			TestEqual("First page", First.Records.Num(), 5);
+			TestEqual("Next cursor", First.NextCursor, FString(TEXT("5")));
+
+			bool bServedFromCache = false;
+			(*View)->ListPage(session, FString(), [&bServedFromCache](const FNakamaLeaderboardRecordList&)
+			{
+				bServedFromCache = true;
+			}, nullptr);
+			TestTrue("Cached page answered at once", bServedFromCache);
+			TestEqual("One request so far", (*View)->GetNumRequests(), 1);
+
+			(*View)->ListPage(session, First.NextCursor, [this, Server, View](const FNakamaLeaderboardRecordList& Second)
+			{
+				TestEqual("Second page", JoinOwners(Second.Records), FString(TEXT("p6@6,p7@7,p8@8,p9@9,p10@10")));
+				TestEqual("Merged ranks", (*View)->GetRecords(4, 7).Num(), 4);
+				TestEqual("Two requests", (*View)->GetNumRequests(), 2);
+				Server->Stop();
+				StopTest();
+			}, [Fail](const FNakamaError& Error) { Fail(TEXT("Second page"), Error); });
+		}, [Fail](const FNakamaError& Error) { Fail(TEXT("First page"), Error); });
+	};
+
+	auto errorCallback = [Fail](const FNakamaError& Error)
+	{
+		Fail(TEXT("Authentication"), Error);
+	};
+
+	Client->AuthenticateDevice(FGuid::NewGuid().ToString(), true, {}, {}, successCallback, errorCallback);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForAsyncQueries(this));
+	return true;
+}
+
+// An around-owner window merges with pages, and a written record moves the player's row up.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(LeaderboardViewWrite, FNakamaTestBase, "Nakama.Base.LeaderboardView.Write", NAKAMA_MODULE_TEST_MASK)
+inline bool LeaderboardViewWrite::RunTest(const FString& Parameters)
+{
+	InitiateTest();
+
+	TSharedRef<FNakamaMockServer, ESPMode::ThreadSafe> Server = FNakamaMockServer::Create();
+	Server->SetRoute(TEXT("GET"), TEXT("/v2/leaderboard/weekly"), [](const FNakamaMockRequest& Request)
+	{
+		return MockLeaderboardPage(Request, 5);
+	});
+	// The owner sits at rank 10, between p8, p9 and p11, p12.
+	Server->SetRoute(TEXT("GET"), TEXT("/v2/leaderboard/weekly/owner/*"), [](const FNakamaMockRequest& Request)
+	{
+		TArray<TSharedPtr<FJsonValue>> Records;
+		for (int32 Rank = 8; Rank <= 12; ++Rank)
+		{
+			const FString Owner = Rank == 10 ? Request.UserId : FString::Printf(TEXT("p%d"), Rank == 11 || Rank == 12 ? Rank - 1 : Rank);
+			Records.Add(MakeShared<FJsonValueObject>(MockRecord(Owner, Rank)));
+		}
+		const TSharedRef<FJsonObject> Body = MakeShared<FJsonObject>();
+		Body->SetArrayField(TEXT("records"), Records);
+		return FNakamaMockResponse(200, FNakamaUtils::EncodeJson(Body));
+	});
+	Server->SetRoute(TEXT("POST"), TEXT("/v2/leaderboard/weekly"), [](const FNakamaMockRequest& Request)
+	{
+		return FNakamaMockResponse(200, FNakamaUtils::EncodeJson(MockRecord(Request.UserId, 3)));
+	});
+	Server->Start();
+
+	TSharedRef<TStrongObjectPtr<UNakamaLeaderboardView>> View = MakeShared<TStrongObjectPtr<UNakamaLeaderboardView>>(UNakamaLeaderboardView::CreateLeaderboardView(Client, TEXT("weekly"), 5));
+
+	auto Fail = [this, Server](const FString& What, const FNakamaError& Error)
+	{
+		TestFalse(FString::Printf(TEXT("%s failed: %s"), *What, *Error.Message), true);
+		Server->Stop();
+		StopTest();
+	};
+
+	auto successCallback = [this, Server, View, Fail](UNakamaSession* session)
+	{
+		(*View)->ListPage(session, FString(), [this, Server, View, Fail, session](const FNakamaLeaderboardRecordList&)
+		{
+			(*View)->ListAroundOwner(session, session->GetUserId(), [this, Server, View, Fail, session](const TArray<FNakamaLeaderboardRecord>& Window)
+			{
+				TestEqual("Window size", Window.Num(), 5);
+
+				FNakamaLeaderboardRecord Own;
+				TestTrue("Own row cached", (*View)->FindRecord(session->GetUserId(), Own));
+				TestEqual("Own rank", Own.Rank, static_cast<int64>(10));
+
+				(*View)->WriteRecord(session, 5000, {}, {}, [this, Server, View, session](const FNakamaLeaderboardRecord& Written)
+				{
+					const FString Me = session->GetUserId();
+					TestEqual("Rows shifted", JoinOwners((*View)->GetRecords(1, 6)),
+						FString::Printf(TEXT("p1@1,p2@2,%s@3,p3@4,p4@5,p5@6"), *Me));
+
+					FNakamaLeaderboardRecord Moved;
+					TestTrue("Row below old rank", (*View)->FindRecord(TEXT("p9"), Moved));
+					TestEqual("p9 moved down", Moved.Rank, static_cast<int64>(10));
+					TestTrue("Row after old rank", (*View)->FindRecord(TEXT("p10"), Moved));
+					TestEqual("p10 unchanged", Moved.Rank, static_cast<int64>(11));
+					Server->Stop();
+					StopTest();
+				}, [Fail](const FNakamaError& Error) { Fail(TEXT("Write"), Error); });
+			}, [Fail](const FNakamaError& Error) { Fail(TEXT("Around owner"), Error); });
+		}, [Fail](const FNakamaError& Error) { Fail(TEXT("First page"), Error); });
+	};
+
+	auto errorCallback = [Fail](const FNakamaError& Error)
+	{
+		Fail(TEXT("Authentication"), Error);
+	};
+
+	Client->AuthenticateDevice(FGuid::NewGuid().ToString(), true, {}, {}, successCallback, errorCallback);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForAsyncQueries(this));
+	return true;
+}
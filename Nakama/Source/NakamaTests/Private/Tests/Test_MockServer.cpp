@@ -0,0 +1,112 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaTestBase.h"
+#include "NakamaMockServer.h"
+#include "NakamaRealtimeClient.h"
+
+// Authentication succeeds once the client has retried through two 503s.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(MockServerRetryTransient, FNakamaTestBase, "Nakama.Base.MockServer.RetryTransient", NAKAMA_MODULE_TEST_MASK)
+inline bool MockServerRetryTransient::RunTest(const FString& Parameters)
+{
+	InitiateTest();
+	Client->RetryBaseDelayMs = 10;
+
+	TSharedRef<FNakamaMockServer, ESPMode::ThreadSafe> Server = FNakamaMockServer::Create();
+	TSharedRef<int32, ESPMode::ThreadSafe> NumAttempts = MakeShared<int32, ESPMode::ThreadSafe>(0);
+	FNakamaMockServer* RawServer = &Server.Get(); // the route is owned by the server
+	Server->SetRoute(TEXT("POST"), TEXT("/v2/account/authenticate/device"), [NumAttempts, RawServer](const FNakamaMockRequest&)
+	{
+		return ++(*NumAttempts) <= 2
+			? FNakamaMockResponse(503, TEXT("{}"))
+			: FNakamaMockResponse(200, FString::Printf(TEXT("{\"token\":\"%s\"}"), *RawServer->CreateToken(TEXT("retry-user"), TEXT("retry"))));
+	});
+	Server->Start();
+
+	auto successCallback = [this, Server, NumAttempts](UNakamaSession* session)
+	{
+		TestEqual("Attempts", *NumAttempts, 3);
+		TestEqual("User id from mock token", session->GetUserId(), FString(TEXT("retry-user")));
+		TestEqual("Requests seen", Server->GetStats().HttpRequests, static_cast<int64>(3));
+		Server->Stop();
+		StopTest();
+	};
+
+	auto errorCallback = [this, Server](const FNakamaError& Error)
+	{
+		TestFalse(FString::Printf(TEXT("Authentication failed: %s"), *Error.Message), true);
+		Server->Stop();
+		StopTest();
+	};
+
+	Client->AuthenticateDevice(FGuid::NewGuid().ToString(), true, {}, {}, successCallback, errorCallback);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForAsyncQueries(this));
+	return true;
+}
+
+// A realtime client attached to the mock connects and gets its RPC echoed back.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(MockServerRealtimeRpc, FNakamaTestBase, "Nakama.Base.MockServer.RealtimeRpc", NAKAMA_MODULE_TEST_MASK)
+inline bool MockServerRealtimeRpc::RunTest(const FString& Parameters)
+{
+	InitiateTest();
+
+	FNakamaMockServerSettings Settings;
+	Settings.MinLatencySeconds = 0.01f;
+	Settings.MaxLatencySeconds = 0.05f;
+	TSharedRef<FNakamaMockServer, ESPMode::ThreadSafe> Server = FNakamaMockServer::Create(Settings);
+	Server->Start();
+
+	auto successCallback = [this, Server](UNakamaSession* session)
+	{
+		Session = session;
+		Socket = Client->SetupRealtimeClient();
+		Server->Attach(Socket);
+
+		Socket->SetConnectCallback([this, Server]()
+		{
+			auto rpcSuccess = [this, Server](const FNakamaRPC& Rpc)
+			{
+				TestEqual("Echoed payload", Rpc.Payload, FString(TEXT("{\"ping\":1}")));
+				Server->Stop();
+				StopTest();
+			};
+
+			auto rpcError = [this, Server](const FNakamaRtError& Error)
+			{
+				TestFalse(FString::Printf(TEXT("RPC failed: %s"), *Error.Message), true);
+				Server->Stop();
+				StopTest();
+			};
+
+			Socket->RPC(TEXT("echo"), FString(TEXT("{\"ping\":1}")), rpcSuccess, rpcError);
+		});
+
+		Socket->Connect(Session, true);
+	};
+
+	auto errorCallback = [this, Server](const FNakamaError& Error)
+	{
+		TestFalse("Authentication failed", true);
+		Server->Stop();
+		StopTest();
+	};
+
+	Client->AuthenticateCustom(FGuid::NewGuid().ToString(), "", true, {}, successCallback, errorCallback);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForAsyncQueries(this));
+	return true;
+}
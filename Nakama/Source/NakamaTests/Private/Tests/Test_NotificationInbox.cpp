@@ -0,0 +1,255 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaTestBase.h"
+#include "NakamaMockServer.h"
+#include "NakamaNotificationInbox.h"
+#include "NakamaUtils.h"
+#include "UObject/StrongObjectPtr.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+
+namespace
+{
+	struct FMockInbox
+	{
+		FCriticalSection Mutex;
+		int32 NumNotifications = 0;
+		int32 NumLists = 0;
+		TArray<FString> DeleteRequests;
+	};
+	using FMockInboxRef = TSharedRef<FMockInbox, ESPMode::ThreadSafe>;
+
+	// Notifications n1, n2, ... listed oldest first, with the cacheable cursor as the offset.
+	void SetMockInboxRoutes(FNakamaMockServer& Server, const FMockInboxRef& Inbox)
+	{
+		Server.SetRoute(TEXT("GET"), TEXT("/v2/notification"), [Inbox](const FNakamaMockRequest& Request)
+		{
+			FScopeLock Lock(&Inbox->Mutex);
+			Inbox->NumLists++;
+
+			const int32 Offset = FCString::Atoi(*Request.GetQueryParam(TEXT("cacheable_cursor")));
+			const int32 Limit = FCString::Atoi(*Request.GetQueryParam(TEXT("limit")));
+			const int32 End = FMath::Min(Offset + Limit, Inbox->NumNotifications);
+
+			TArray<TSharedPtr<FJsonValue>> Notifications;
+			for (int32 Index = Offset + 1; Index <= End; ++Index)
+			{
+				const TSharedRef<FJsonObject> Notification = MakeShared<FJsonObject>();
+				Notification->SetStringField(TEXT("id"), FString::Printf(TEXT("n%d"), Index));
+				Notification->SetStringField(TEXT("subject"), TEXT("gift"));
+				Notification->SetNumberField(TEXT("code"), 100);
+				Notification->SetStringField(TEXT("create_time"), FDateTime(2026, 1, 1, 0, 0, Index).ToIso8601());
+				Notification->SetBoolField(TEXT("persistent"), true);
+				Notifications.Add(MakeShared<FJsonValueObject>(Notification));
+			}
+
+			const TSharedRef<FJsonObject> Body = MakeShared<FJsonObject>();
+			Body->SetArrayField(TEXT("notifications"), Notifications);
+			if (End > Offset)
+			{
+				Body->SetStringField(TEXT("cacheable_cursor"), FString::FromInt(End));
+			}
+			return FNakamaMockResponse(200, FNakamaUtils::EncodeJson(Body));
+		});
+
+		Server.SetRoute(TEXT("DELETE"), TEXT("/v2/notification"), [Inbox](const FNakamaMockRequest& Request)
+		{
+			const TArray<FString> Ids = Request.GetQueryParams(TEXT("ids"));
+
+			FScopeLock Lock(&Inbox->Mutex);
+			Inbox->DeleteRequests.Add(FString::Join(Ids, TEXT(",")));
+			return FNakamaMockResponse(200, TEXT("{}"));
+		});
+	}
+
+	FNakamaNotification LiveNotification(int32 Index)
+	{
+		FNakamaNotification Notification;
+		Notification.Id = FString::Printf(TEXT("n%d"), Index);
+		Notification.CreateTime = FDateTime(2026, 1, 1, 0, 0, Index);
+		Notification.Persistent = true;
+		return Notification;
+	}
+}
+
+// Sync continues from the cacheable cursor, skips realtime deliveries, and the state survives a reload.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(NotificationInboxSync, FNakamaTestBase, "Nakama.Base.NotificationInbox.Sync", NAKAMA_MODULE_TEST_MASK)
+inline bool NotificationInboxSync::RunTest(const FString& Parameters)
+{
+	InitiateTest();
+
+	FMockInboxRef MockInbox = MakeShared<FMockInbox, ESPMode::ThreadSafe>();
+	MockInbox->NumNotifications = 3;
+
+	TSharedRef<FNakamaMockServer, ESPMode::ThreadSafe> Server = FNakamaMockServer::Create();
+	SetMockInboxRoutes(*Server, MockInbox);
+	Server->Start();
+
+	const FString SaveUserId = FGuid::NewGuid().ToString();
+	TSharedRef<TStrongObjectPtr<UNakamaNotificationInbox>> Inbox = MakeShared<TStrongObjectPtr<UNakamaNotificationInbox>>(UNakamaNotificationInbox::CreateNotificationInbox(Client));
+	(*Inbox)->PageSize = 2;
+	(*Inbox)->Load(SaveUserId);
+
+	auto Fail = [this, Server](const FString& What, const FNakamaError& Error)
+	{
+		TestFalse(FString::Printf(TEXT("%s failed: %s"), *What, *Error.Message), true);
+		Server->Stop();
+		StopTest();
+	};
+
+	auto successCallback = [this, Server, Inbox, Fail, MockInbox, SaveUserId](UNakamaSession* session)
+	{
+		(*Inbox)->Sync(session, [this, Server, Inbox, Fail, MockInbox, SaveUserId, session](int32 NumAdded)
+		{
+			TestEqual("First sync", NumAdded, 3);
+			TestEqual("Cursor", (*Inbox)->GetCacheableCursor(), FString(TEXT("3")));
+			TestEqual("Two pages", MockInbox->NumLists, 2);
+
+			// Delivered on the socket, then listed again by the next sync.
+			(*Inbox)->AddNotifications({ LiveNotification(4) });
+			{
+				FScopeLock Lock(&MockInbox->Mutex);
+				MockInbox->NumNotifications = 5;
+			}
+
+			(*Inbox)->Sync(session, [this, Server, Inbox, MockInbox, SaveUserId](int32 NumAdded)
+			{
+				TestEqual("Only the unseen one", NumAdded, 1);
+				TestEqual("One more page", MockInbox->NumLists, 3);
+				TestEqual("Newest first", (*Inbox)->GetNotifications()[0].Id, FString(TEXT("n5")));
+
+				TStrongObjectPtr<UNakamaNotificationInbox> Reloaded(UNakamaNotificationInbox::CreateNotificationInbox(Client));
+				TestTrue("Saved", Reloaded->Load(SaveUserId));
+				TestEqual("Reloaded notifications", Reloaded->Num(), 5);
+				TestEqual("Reloaded cursor", Reloaded->GetCacheableCursor(), FString(TEXT("5")));
+
+				IFileManager::Get().Delete(*FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Nakama"), FString::Printf(TEXT("Notifications_%s.json"), *SaveUserId)));
+				Server->Stop();
+				StopTest();
+			}, [Fail](const FNakamaError& Error) { Fail(TEXT("Second sync"), Error); });
+		}, [Fail](const FNakamaError& Error) { Fail(TEXT("First sync"), Error); });
+	};
+
+	auto errorCallback = [Fail](const FNakamaError& Error)
+	{
+		Fail(TEXT("Authentication"), Error);
+	};
+
+	Client->AuthenticateDevice(FGuid::NewGuid().ToString(), true, {}, {}, successCallback, errorCallback);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForAsyncQueries(this));
+	return true;
+}
+
+// Deletes within the window share one request, and a rejected delete restores the notification.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(NotificationInboxDelete, FNakamaTestBase, "Nakama.Base.NotificationInbox.Delete", NAKAMA_MODULE_TEST_MASK)
+inline bool NotificationInboxDelete::RunTest(const FString& Parameters)
+{
+	InitiateTest();
+
+	FMockInboxRef MockInbox = MakeShared<FMockInbox, ESPMode::ThreadSafe>();
+	MockInbox->NumNotifications = 3;
+
+	TSharedRef<FNakamaMockServer, ESPMode::ThreadSafe> Server = FNakamaMockServer::Create();
+	SetMockInboxRoutes(*Server, MockInbox);
+	Server->Start();
+
+	TSharedRef<TStrongObjectPtr<UNakamaNotificationInbox>> Inbox = MakeShared<TStrongObjectPtr<UNakamaNotificationInbox>>(UNakamaNotificationInbox::CreateNotificationInbox(Client));
+	(*Inbox)->DeleteBatchWindowSeconds = 0.2f;
+
+	auto Fail = [this, Server](const FString& What, const FNakamaError& Error)
+	{
+		TestFalse(FString::Printf(TEXT("%s failed: %s"), *What, *Error.Message), true);
+		Server->Stop();
+		StopTest();
+	};
+
+	auto successCallback = [this, Server, Inbox, Fail, MockInbox](UNakamaSession* session)
+	{
+		(*Inbox)->Sync(session, [this, Server, Inbox, Fail, MockInbox, session](int32)
+		{
+			(*Inbox)->DeleteNotifications(session, { TEXT("n1") }, nullptr, [Fail](const FNakamaError& Error) { Fail(TEXT("Delete n1"), Error); });
+			(*Inbox)->DeleteNotifications(session, { TEXT("n2") }, [this, Server, Inbox, Fail, MockInbox, session]()
+			{
+				TestEqual("One request", MockInbox->DeleteRequests.Num(), 1);
+				TestEqual("Batched ids", MockInbox->DeleteRequests[0], FString(TEXT("n1,n2")));
+				TestEqual("Removed", (*Inbox)->Num(), 1);
+
+				Server->SetCannedResponse(TEXT("DELETE"), TEXT("/v2/notification"), 400, TEXT("{\"code\":3,\"message\":\"invalid\"}"));
+				(*Inbox)->DeleteBatchWindowSeconds = 0.0f;
+				(*Inbox)->DeleteNotifications(session, { TEXT("n3") }, [Fail]()
+				{
+					Fail(TEXT("Rejected delete"), FNakamaError());
+				}, [this, Server, Inbox](const FNakamaError& Error)
+				{
+					FNakamaNotification Restored;
+					TestTrue("Restored", (*Inbox)->FindNotification(TEXT("n3"), Restored));
+					Server->Stop();
+					StopTest();
+				});
+				TestEqual("Removed before the answer", (*Inbox)->Num(), 0);
+			}, [Fail](const FNakamaError& Error) { Fail(TEXT("Delete n2"), Error); });
+			TestEqual("Removed at once", (*Inbox)->Num(), 1);
+		}, [Fail](const FNakamaError& Error) { Fail(TEXT("Sync"), Error); });
+	};
+
+	auto errorCallback = [Fail](const FNakamaError& Error)
+	{
+		Fail(TEXT("Authentication"), Error);
+	};
+
+	Client->AuthenticateDevice(FGuid::NewGuid().ToString(), true, {}, {}, successCallback, errorCallback);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForAsyncQueries(this));
+	return true;
+}
+
+// Loading another user starts from an empty inbox and never writes the previous user's notifications to the new file.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(NotificationInboxSwitchUser, FNakamaTestBase, "Nakama.Base.NotificationInbox.SwitchUser", NAKAMA_MODULE_TEST_MASK)
+inline bool NotificationInboxSwitchUser::RunTest(const FString& Parameters)
+{
+	// User IDs end up in file names, so include characters a path cannot hold.
+	const FString UserA = TEXT("a/") + FGuid::NewGuid().ToString();
+	const FString UserB = TEXT("b:") + FGuid::NewGuid().ToString();
+	auto SaveFile = [](const FString& UserId)
+	{
+		return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Nakama"), FString::Printf(TEXT("Notifications_%s.json"), *FPaths::MakeValidFileName(UserId)));
+	};
+
+	TStrongObjectPtr<UNakamaNotificationInbox> Inbox(UNakamaNotificationInbox::CreateNotificationInbox(nullptr));
+	Inbox->Load(UserA);
+	Inbox->AddNotifications({ LiveNotification(1), LiveNotification(2) });
+	TestEqual("A's notifications", Inbox->Num(), 2);
+
+	TestFalse("Nothing saved for B", Inbox->Load(UserB));
+	TestEqual("B starts empty", Inbox->Num(), 0);
+	TestTrue("B has no cursor", Inbox->GetCacheableCursor().IsEmpty());
+
+	TestTrue("Saved B", Inbox->Save());
+	FString SavedB;
+	TestTrue("B's file is in the saved directory", FFileHelper::LoadFileToString(SavedB, *SaveFile(UserB)));
+	TestFalse("B's file holds none of A's notifications", SavedB.Contains(TEXT("n1")));
+
+	TestTrue("A reloads", Inbox->Load(UserA));
+	TestEqual("A's notifications were saved", Inbox->Num(), 2);
+
+	IFileManager::Get().Delete(*SaveFile(UserA));
+	IFileManager::Get().Delete(*SaveFile(UserB));
+	return true;
+}
@@ -0,0 +1,127 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaTestBase.h"
+#include "NakamaPagers.h"
+
+namespace
+{
+	// In-memory storage listing of NumObjects objects served PageSize at a time.
+	struct FFakeStorageListing
+	{
+		int32 NumObjects = 10;
+		int32 PageSize = 3;
+		TArray<FString> RequestedCursors;
+		TArray<TFunction<void()>> PendingResponses;
+
+		FNakamaStorageObjectPager::FFetchPage MakeFetch(bool bAnswerImmediately)
+		{
+			return [this, bAnswerImmediately](const FString& Cursor, const FNakamaStorageObjectPager::FPageCallback& OnPage, const FNakamaStorageObjectPager::FErrorCallback&)
+			{
+				RequestedCursors.Add(Cursor);
+				const int32 Start = Cursor.IsEmpty() ? 0 : FCString::Atoi(*Cursor);
+
+				FNakamaStorageObjectList Page;
+				for (int32 Index = Start; Index < FMath::Min(Start + PageSize, NumObjects); ++Index)
+				{
+					Page.Objects.AddDefaulted_GetRef().Key = FString::FromInt(Index);
+				}
+				if (Start + PageSize < NumObjects)
+				{
+					Page.Cursor = FString::FromInt(Start + PageSize);
+				}
+
+				TFunction<void()> Respond = [OnPage, Page]() { OnPage(Page); };
+				if (bAnswerImmediately)
+				{
+					Respond();
+				}
+				else
+				{
+					PendingResponses.Add(MoveTemp(Respond));
+				}
+			};
+		}
+
+		void RespondOldest()
+		{
+			TFunction<void()> Respond = MoveTemp(PendingResponses[0]);
+			PendingResponses.RemoveAt(0);
+			Respond();
+		}
+	};
+}
+
+// The next page is requested as soon as one is delivered, and the item budget trims the last page.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(PagerPrefetchBudget, FNakamaTestBase, "Nakama.Base.Pager.PrefetchBudget", NAKAMA_MODULE_TEST_MASK)
+inline bool PagerPrefetchBudget::RunTest(const FString& Parameters)
+{
+	FFakeStorageListing Listing;
+	const TSharedRef<FNakamaStorageObjectPager> Pager = FNakamaStorageObjectPager::Create(Listing.MakeFetch(false));
+	Pager->MaxItems = 7;
+
+	TArray<int32> PageSizes;
+	auto OnPage = [&PageSizes](const FNakamaStorageObjectList& Page) { PageSizes.Add(Page.Objects.Num()); };
+
+	Pager->Next(OnPage, nullptr);
+	TestEqual(TEXT("first request"), Listing.RequestedCursors.Num(), 1);
+	Listing.RespondOldest();
+	TestEqual(TEXT("first page"), PageSizes.Num(), 1);
+	TestEqual(TEXT("prefetched"), Listing.RequestedCursors.Num(), 2);
+
+	// The prefetched page is delivered without another request.
+	Listing.RespondOldest();
+	Pager->Next(OnPage, nullptr);
+	TestEqual(TEXT("second page from prefetch"), PageSizes.Num(), 2);
+	TestEqual(TEXT("third requested"), Listing.RequestedCursors.Num(), 3);
+
+	Pager->Next(OnPage, nullptr);
+	Listing.RespondOldest();
+	TestTrue(TEXT("pages"), PageSizes == TArray<int32>({ 3, 3, 1 }));
+	TestEqual(TEXT("budget reached"), Pager->GetNumItems(), 7);
+	TestFalse(TEXT("no more pages"), Pager->HasMore());
+	TestEqual(TEXT("no request past the budget"), Listing.RequestedCursors.Num(), 3);
+	TestEqual(TEXT("trimmed page keeps its own cursor"), Pager->GetCursor(), Listing.RequestedCursors.Last());
+	return true;
+}
+
+// ForEachPage walks every page and completes; Cancel drops responses still in flight.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(PagerStreamCancel, FNakamaTestBase, "Nakama.Base.Pager.StreamCancel", NAKAMA_MODULE_TEST_MASK)
+inline bool PagerStreamCancel::RunTest(const FString& Parameters)
+{
+	FFakeStorageListing Listing;
+	const TSharedRef<FNakamaStorageObjectPager> Pager = FNakamaStorageObjectPager::Create(Listing.MakeFetch(true));
+
+	int32 NumItems = 0;
+	bool bCompleted = false;
+	Pager->ForEachPage(
+		[&NumItems](const FNakamaStorageObjectList& Page) { NumItems += Page.Objects.Num(); return true; },
+		[&bCompleted]() { bCompleted = true; },
+		nullptr);
+	TestTrue(TEXT("completed"), bCompleted);
+	TestEqual(TEXT("all items"), NumItems, 10);
+	TestEqual(TEXT("cursors"), FString::Join(Listing.RequestedCursors, TEXT(",")), FString(TEXT(",3,6,9")));
+
+	FFakeStorageListing Slow;
+	const TSharedRef<FNakamaStorageObjectPager> Cancelled = FNakamaStorageObjectPager::Create(Slow.MakeFetch(false));
+	bool bDelivered = false;
+	Cancelled->Next([&bDelivered](const FNakamaStorageObjectList&) { bDelivered = true; }, nullptr);
+	Cancelled->Cancel();
+	Slow.RespondOldest();
+	TestFalse(TEXT("cancelled page dropped"), bDelivered);
+	TestFalse(TEXT("cancelled has no more"), Cancelled->HasMore());
+	return true;
+}
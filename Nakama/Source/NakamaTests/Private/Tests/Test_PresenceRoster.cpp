@@ -0,0 +1,93 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaTestBase.h"
+#include "NakamaPresenceRoster.h"
+#include "UObject/StrongObjectPtr.h"
+
+namespace
+{
+	FNakamaUserPresence MockPresence(const FString& UserId, const FString& SessionId)
+	{
+		FNakamaUserPresence Presence;
+		Presence.UserID = UserId;
+		Presence.SessionID = SessionId;
+		Presence.Username = UserId;
+		return Presence;
+	}
+
+	FString JoinSessions(const TArray<FNakamaUserPresence>& Presences)
+	{
+		TArray<FString> Sessions;
+		for (const FNakamaUserPresence& Presence : Presences)
+		{
+			Sessions.Add(Presence.SessionID);
+		}
+		return FString::Join(Sessions, TEXT(","));
+	}
+}
+
+// Leaves keep the join order of the others, and deltas only report real changes.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(PresenceRosterOrder, FNakamaTestBase, "Nakama.Base.PresenceRoster.Order", NAKAMA_MODULE_TEST_MASK)
+inline bool PresenceRosterOrder::RunTest(const FString& Parameters)
+{
+	FNakamaPresenceRoster Roster;
+	FNakamaPresenceRosterDelta Delta = Roster.Apply({ MockPresence(TEXT("a"), TEXT("s1")), MockPresence(TEXT("b"), TEXT("s2")), MockPresence(TEXT("c"), TEXT("s3")) }, {});
+	TestEqual("Joined", JoinSessions(Delta.Joined), FString(TEXT("s1,s2,s3")));
+
+	Delta = Roster.Apply({ MockPresence(TEXT("d"), TEXT("s4")) }, { MockPresence(TEXT("b"), TEXT("s2")), MockPresence(TEXT("x"), TEXT("s9")) });
+	TestEqual("Left", JoinSessions(Delta.Left), FString(TEXT("s2")));
+	TestEqual("Order kept", JoinSessions(Roster.ToArray()), FString(TEXT("s1,s3,s4")));
+
+	FNakamaUserPresence Updated = MockPresence(TEXT("a"), TEXT("s1"));
+	Updated.Status = TEXT("away");
+	Delta = Roster.Apply({ Updated }, {});
+	TestTrue("Rejoin is not a join", Delta.IsEmpty());
+	TestEqual("Updated in place", Roster.Find(TEXT("s1"))->Status, FString(TEXT("away")));
+	TestEqual("Order after update", JoinSessions(Roster.ToArray()), FString(TEXT("s1,s3,s4")));
+
+	Roster.Remove(TEXT("s4"));
+	Roster.Add(MockPresence(TEXT("e"), TEXT("s5")));
+	TestEqual("Tail reused", JoinSessions(Roster.ToArray()), FString(TEXT("s1,s3,s5")));
+	TestEqual("Num", Roster.Num(), 3);
+	return true;
+}
+
+// A user stays present until their last session leaves.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(PresenceRosterUsers, FNakamaTestBase, "Nakama.Base.PresenceRoster.Users", NAKAMA_MODULE_TEST_MASK)
+inline bool PresenceRosterUsers::RunTest(const FString& Parameters)
+{
+	TStrongObjectPtr<UNakamaPresenceRosters> Rosters(UNakamaPresenceRosters::CreatePresenceRosters());
+
+	FNakamaMatch Match;
+	Match.MatchId = TEXT("match");
+	Match.Me = MockPresence(TEXT("me"), TEXT("s0"));
+	Match.Pressences = { MockPresence(TEXT("a"), TEXT("s1")), MockPresence(TEXT("a"), TEXT("s2")) };
+	Rosters->TrackMatch(Match);
+	TestEqual("Tracked", JoinSessions(Rosters->GetPresences(TEXT("match"))), FString(TEXT("s0,s1,s2")));
+
+	Rosters->Apply(TEXT("match"), {}, { MockPresence(TEXT("a"), TEXT("s1")) });
+	const FNakamaPresenceRoster* Roster = Rosters->FindRoster(TEXT("match"));
+	TestTrue("Second session keeps the user", Roster && Roster->ContainsUser(TEXT("a")));
+
+	Rosters->Apply(TEXT("match"), {}, { MockPresence(TEXT("a"), TEXT("s2")) });
+	TestFalse("User gone", Roster->ContainsUser(TEXT("a")));
+	TestTrue("Local user present", Rosters->IsPresent(TEXT("match"), TEXT("s0")));
+
+	Rosters->RemoveRoster(TEXT("match"));
+	TestEqual("Removed", Rosters->GetPresences(TEXT("match")).Num(), 0);
+	return true;
+}
@@ -0,0 +1,94 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaTestBase.h"
+#include "NakamaRealtimeRecorder.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+
+// A full ring overwrites its oldest frames and skips frames that can never fit.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(RealtimeRecorderRing, FNakamaTestBase, "Nakama.Base.RealtimeRecorder.Ring", NAKAMA_MODULE_TEST_MASK)
+inline bool RealtimeRecorderRing::RunTest(const FString& Parameters)
+{
+	// Room for three 16-byte headers plus 10-byte payloads, with a remainder so records wrap.
+	FNakamaRealtimeRecorderSettings Settings;
+	Settings.CapacityBytes = 3 * (16 + 10) + 7;
+	const TSharedRef<FNakamaRealtimeRecorder, ESPMode::ThreadSafe> Recorder = FNakamaRealtimeRecorder::Create(Settings);
+
+	for (int32 Index = 0; Index < 5; ++Index)
+	{
+		Recorder->Record(Index % 2 ? ENakamaFrameDirection::Outbound : ENakamaFrameDirection::Inbound, FString::Printf(TEXT("frame-%04d"), Index));
+	}
+	Recorder->Record(ENakamaFrameDirection::Inbound, FString::ChrN(Settings.CapacityBytes, TEXT('x')));
+
+	const TArray<FNakamaRecordedFrame> Frames = Recorder->GetFrames();
+	TestEqual(TEXT("frames kept"), Frames.Num(), 3);
+	TestEqual(TEXT("overwritten"), Recorder->GetNumOverwritten(), static_cast<int64>(2));
+	TestEqual(TEXT("skipped"), Recorder->GetNumSkipped(), static_cast<int64>(1));
+	if (Frames.Num() == 3)
+	{
+		TestEqual(TEXT("oldest kept"), Frames[0].Frame, FString(TEXT("frame-0002")));
+		TestEqual(TEXT("newest kept"), Frames[2].Frame, FString(TEXT("frame-0004")));
+		TestTrue(TEXT("direction kept"), Frames[1].Direction == ENakamaFrameDirection::Outbound);
+		TestTrue(TEXT("timestamps ordered"), Frames[0].TimeSeconds <= Frames[2].TimeSeconds);
+	}
+
+	Recorder->Clear();
+	TestEqual(TEXT("cleared"), Recorder->GetNumFrames(), 0);
+	return true;
+}
+
+// A saved recording loads back unchanged and replays through the client's event dispatch.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(RealtimeRecorderReplay, FNakamaTestBase, "Nakama.Base.RealtimeRecorder.Replay", NAKAMA_MODULE_TEST_MASK)
+inline bool RealtimeRecorderReplay::RunTest(const FString& Parameters)
+{
+	const TSharedRef<FNakamaRealtimeRecorder, ESPMode::ThreadSafe> Recorder = FNakamaRealtimeRecorder::Create();
+	Recorder->Record(ENakamaFrameDirection::Outbound, TEXT("{\"cid\":\"1\",\"match_join\":{\"match_id\":\"m1\"}}"));
+	Recorder->Record(ENakamaFrameDirection::Inbound, TEXT("{\"cid\":\"1\",\"match\":{\"match_id\":\"m1\",\"size\":1}}"));
+	Recorder->Record(ENakamaFrameDirection::Inbound, TEXT("{\"match_data\":{\"match_id\":\"m1\",\"op_code\":\"3\",\"data\":\"\"}}"));
+	Recorder->Record(ENakamaFrameDirection::Inbound, TEXT("{\"match_data\":{\"match_id\":\"m1\",\"op_code\":\"4\",\"data\":\"\"}}"));
+
+	const FString Path = FPaths::CreateTempFilename(*FPaths::ProjectSavedDir(), TEXT("NakamaRecorder"), TEXT(".nkrec"));
+	TestTrue(TEXT("saved"), Recorder->SaveToFile(Path));
+
+	TArray<FNakamaRecordedFrame> Frames;
+	TestTrue(TEXT("loaded"), FNakamaRealtimeRecorder::LoadFromFile(Path, Frames));
+	IFileManager::Get().Delete(*Path);
+	TestEqual(TEXT("loaded frames"), Frames.Num(), 4);
+	if (Frames.Num() == 4)
+	{
+		TestEqual(TEXT("loaded payload"), Frames[2].Frame, Recorder->GetFrames()[2].Frame);
+	}
+
+	Client = CreateClient();
+	Socket = Client->SetupRealtimeClient();
+
+	TArray<int64> OpCodes;
+	Socket->SetMatchDataCallback([&OpCodes](const FNakamaMatchData& MatchData)
+	{
+		OpCodes.Add(MatchData.OpCode);
+	});
+
+	TestEqual(TEXT("inbound frames replayed"), Socket->ReplayFrames(Frames), 3);
+	TestEqual(TEXT("match data dispatched"), OpCodes.Num(), 2);
+	if (OpCodes.Num() == 2)
+	{
+		TestEqual(TEXT("dispatch order"), OpCodes[1], static_cast<int64>(4));
+	}
+	TestEqual(TEXT("replay counted"), Socket->GetStats().FramesReceived, static_cast<int64>(3));
+	TestFalse(TEXT("client left inactive"), Socket->bIsActive);
+	return true;
+}
@@ -0,0 +1,63 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaTestBase.h"
+#include "NakamaRealtimeStats.h"
+#include "Dom/JsonObject.h"
+
+// Envelope names map to their own slot; anything unknown lands in "other".
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(RealtimeStatsEnvelopeType, FNakamaTestBase, "Nakama.Base.RealtimeStats.EnvelopeType", NAKAMA_MODULE_TEST_MASK)
+inline bool RealtimeStatsEnvelopeType::RunTest(const FString& Parameters)
+{
+	const int32 MatchData = FNakamaRealtimeSocketCounters::GetEnvelopeTypeIndex(TEXT("match_data"));
+	TestEqual(TEXT("match_data name"), FString(FNakamaRealtimeSocketCounters::GetEnvelopeTypeName(MatchData)), FString(TEXT("match_data")));
+	TestEqual(TEXT("unknown is other"), FNakamaRealtimeSocketCounters::GetEnvelopeTypeIndex(TEXT("not_an_envelope")), 0);
+
+	FJsonObject Envelope;
+	Envelope.SetStringField(TEXT("cid"), TEXT("3"));
+	Envelope.SetObjectField(TEXT("match_data"), MakeShared<FJsonObject>());
+	TestEqual(TEXT("cid is skipped"), FNakamaRealtimeSocketCounters::GetEnvelopeTypeIndex(Envelope), MatchData);
+	return true;
+}
+
+// Per-type counters are summed into the totals and only active types are listed.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(RealtimeStatsSnapshot, FNakamaTestBase, "Nakama.Base.RealtimeStats.Snapshot", NAKAMA_MODULE_TEST_MASK)
+inline bool RealtimeStatsSnapshot::RunTest(const FString& Parameters)
+{
+	FNakamaRealtimeSocketCounters Counters;
+	const int32 Ping = FNakamaRealtimeSocketCounters::GetEnvelopeTypeIndex(TEXT("ping"));
+	const int32 MatchData = FNakamaRealtimeSocketCounters::GetEnvelopeTypeIndex(TEXT("match_data"));
+
+	Counters.RecordSent(Ping, TEXT("{\"ping\":{},\"cid\":\"1\"}"));
+	Counters.RecordReceived(MatchData, TEXT("{\"match_data\":{}}"));
+	Counters.RecordReceived(MatchData, TEXT("{\"match_data\":{\"op_code\":\"1\"}}"));
+	Counters.RecordDecode(0, false);
+
+	FNakamaRealtimeStats Stats;
+	Counters.GetSnapshot(Stats);
+	TestEqual(TEXT("frames sent"), Stats.FramesSent, static_cast<int64>(1));
+	TestEqual(TEXT("bytes sent"), Stats.BytesSent, static_cast<int64>(21));
+	TestEqual(TEXT("frames received"), Stats.FramesReceived, static_cast<int64>(2));
+	TestEqual(TEXT("bytes received"), Stats.BytesReceived, static_cast<int64>(17 + 30));
+	TestEqual(TEXT("decode errors"), Stats.DecodeErrors, static_cast<int64>(1));
+	TestEqual(TEXT("active types"), Stats.Envelopes.Num(), 2);
+
+	Counters.Reset();
+	Counters.GetSnapshot(Stats);
+	TestEqual(TEXT("reset frames"), Stats.FramesReceived, static_cast<int64>(0));
+	TestEqual(TEXT("reset types"), Stats.Envelopes.Num(), 0);
+	return true;
+}
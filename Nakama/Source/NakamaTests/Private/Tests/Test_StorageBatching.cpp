@@ -0,0 +1,187 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaTestBase.h"
+#include "NakamaMockServer.h"
+#include "NakamaUtils.h"
+#include "Dom/JsonObject.h"
+
+namespace
+{
+	TArray<FNakamaStoreObjectWrite> MakeBatchWrites(int32 Num)
+	{
+		TArray<FNakamaStoreObjectWrite> Writes;
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			FNakamaStoreObjectWrite& Write = Writes.AddDefaulted_GetRef();
+			Write.Collection = TEXT("migration");
+			Write.Key = FString::Printf(TEXT("k%d"), Index);
+			Write.Value = FString::Printf(TEXT("{\"index\":%d}"), Index);
+			Write.PermissionRead = ENakamaStoragePermissionRead::OWNER_READ;
+			Write.PermissionWrite = ENakamaStoragePermissionWrite::OWNER_WRITE;
+		}
+		return Writes;
+	}
+
+	// Acknowledges every object of a write request; fails the request holding FailKey.
+	FNakamaMockResponse MockBatchWrite(const FNakamaMockRequest& Request, const FString& FailKey, TArray<int32>& OutBatchSizes)
+	{
+		TSharedPtr<FJsonObject> Body = FNakamaUtils::DeserializeJsonObject(Request.Body);
+		const TArray<TSharedPtr<FJsonValue>>* Objects = nullptr;
+		if (!Body.IsValid() || !Body->TryGetArrayField(TEXT("objects"), Objects))
+		{
+			return FNakamaMockResponse(400, TEXT("{\"code\":3,\"message\":\"Invalid Argument\"}"));
+		}
+
+		OutBatchSizes.Add(Objects->Num());
+		TArray<TSharedPtr<FJsonValue>> Acks;
+		for (const TSharedPtr<FJsonValue>& Object : *Objects)
+		{
+			const FString Key = Object->AsObject()->GetStringField(TEXT("key"));
+			if (Key == FailKey)
+			{
+				return FNakamaMockResponse(400, TEXT("{\"code\":3,\"message\":\"Rejected\"}"));
+			}
+
+			const TSharedRef<FJsonObject> Ack = MakeShared<FJsonObject>();
+			Ack->SetStringField(TEXT("collection"), TEXT("migration"));
+			Ack->SetStringField(TEXT("key"), Key);
+			Ack->SetStringField(TEXT("version"), TEXT("v1"));
+			Acks.Add(MakeShared<FJsonValueObject>(Ack));
+		}
+
+		const TSharedRef<FJsonObject> Response = MakeShared<FJsonObject>();
+		Response->SetArrayField(TEXT("acks"), Acks);
+		return FNakamaMockResponse(200, FNakamaUtils::EncodeJson(Response));
+	}
+}
+
+// Large writes are split by object count and body size, and the acks come back joined in request order.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(StorageBatchingSplit, FNakamaTestBase, "Nakama.Base.StorageBatching.Split", NAKAMA_MODULE_TEST_MASK)
+inline bool StorageBatchingSplit::RunTest(const FString& Parameters)
+{
+	InitiateTest();
+
+	TSharedRef<FNakamaMockServer, ESPMode::ThreadSafe> Server = FNakamaMockServer::Create();
+	TSharedRef<TArray<int32>, ESPMode::ThreadSafe> BatchSizes = MakeShared<TArray<int32>, ESPMode::ThreadSafe>();
+	Server->SetRoute(TEXT("PUT"), TEXT("/v2/storage"), [BatchSizes](const FNakamaMockRequest& Request)
+	{
+		return MockBatchWrite(Request, FString(), *BatchSizes);
+	});
+	Server->Start();
+
+	Client->StorageBatchMaxObjects = 3;
+	Client->StorageBatchMaxParallel = 2;
+
+	auto successCallback = [this, Server, BatchSizes](UNakamaSession* session)
+	{
+		Client->WriteStorageObjects(session, MakeBatchWrites(8),
+			[this, Server, BatchSizes, session](const FNakamaStoreObjectAcks& Acks)
+			{
+				TestEqual("Requests by count", BatchSizes->Num(), 3);
+				TestEqual("All acks", Acks.StorageObjects.Num(), 8);
+				if (Acks.StorageObjects.Num() == 8)
+				{
+					TestEqual("First ack", Acks.StorageObjects[0].Key, FString(TEXT("k0")));
+					TestEqual("Last ack", Acks.StorageObjects[7].Key, FString(TEXT("k7")));
+				}
+
+				// A byte limit below two objects sends each on its own.
+				BatchSizes->Reset();
+				Client->StorageBatchMaxBytes = 150;
+				Client->WriteStorageObjects(session, MakeBatchWrites(2),
+					[this, Server, BatchSizes](const FNakamaStoreObjectAcks& Acks)
+					{
+						TestEqual("Requests by size", BatchSizes->Num(), 2);
+						TestEqual("Sized acks", Acks.StorageObjects.Num(), 2);
+						Server->Stop();
+						StopTest();
+					},
+					[this, Server](const FNakamaError& Error)
+					{
+						TestFalse(FString::Printf(TEXT("Sized write failed: %s"), *Error.Message), true);
+						Server->Stop();
+						StopTest();
+					});
+			},
+			[this, Server](const FNakamaError& Error)
+			{
+				TestFalse(FString::Printf(TEXT("Write failed: %s"), *Error.Message), true);
+				Server->Stop();
+				StopTest();
+			});
+	};
+
+	auto errorCallback = [this, Server](const FNakamaError& Error)
+	{
+		TestFalse(FString::Printf(TEXT("Authentication failed: %s"), *Error.Message), true);
+		Server->Stop();
+		StopTest();
+	};
+
+	Client->AuthenticateDevice(FGuid::NewGuid().ToString(), true, {}, {}, successCallback, errorCallback);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForAsyncQueries(this));
+	return true;
+}
+
+// A failed request is reported once and stops the remaining ones from being sent.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(StorageBatchingFailure, FNakamaTestBase, "Nakama.Base.StorageBatching.Failure", NAKAMA_MODULE_TEST_MASK)
+inline bool StorageBatchingFailure::RunTest(const FString& Parameters)
+{
+	InitiateTest();
+
+	TSharedRef<FNakamaMockServer, ESPMode::ThreadSafe> Server = FNakamaMockServer::Create();
+	TSharedRef<TArray<int32>, ESPMode::ThreadSafe> BatchSizes = MakeShared<TArray<int32>, ESPMode::ThreadSafe>();
+	Server->SetRoute(TEXT("PUT"), TEXT("/v2/storage"), [BatchSizes](const FNakamaMockRequest& Request)
+	{
+		return MockBatchWrite(Request, TEXT("k2"), *BatchSizes);
+	});
+	Server->Start();
+
+	Client->StorageBatchMaxObjects = 2;
+	Client->StorageBatchMaxParallel = 1;
+
+	auto successCallback = [this, Server, BatchSizes](UNakamaSession* session)
+	{
+		Client->WriteStorageObjects(session, MakeBatchWrites(10),
+			[this, Server](const FNakamaStoreObjectAcks&)
+			{
+				TestFalse("Failed batch reported success", true);
+				Server->Stop();
+				StopTest();
+			},
+			[this, Server, BatchSizes](const FNakamaError& Error)
+			{
+				TestTrue("Error code", Error.Code == ENakamaErrorCode::InvalidArgument);
+				TestEqual("Stopped after the failed request", BatchSizes->Num(), 2);
+				Server->Stop();
+				StopTest();
+			});
+	};
+
+	auto errorCallback = [this, Server](const FNakamaError& Error)
+	{
+		TestFalse(FString::Printf(TEXT("Authentication failed: %s"), *Error.Message), true);
+		Server->Stop();
+		StopTest();
+	};
+
+	Client->AuthenticateDevice(FGuid::NewGuid().ToString(), true, {}, {}, successCallback, errorCallback);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForAsyncQueries(this));
+	return true;
+}
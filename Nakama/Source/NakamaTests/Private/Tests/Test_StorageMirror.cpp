@@ -0,0 +1,234 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaTestBase.h"
+#include "NakamaMockServer.h"
+#include "NakamaStorageMirror.h"
+#include "UObject/StrongObjectPtr.h"
+
+namespace
+{
+	FNakamaStoreObjectWrite MakeMirrorWrite(const FString& Key, const FString& Value)
+	{
+		FNakamaStoreObjectWrite Write;
+		Write.Collection = TEXT("saves");
+		Write.Key = Key;
+		Write.Value = Value;
+		Write.PermissionRead = ENakamaStoragePermissionRead::OWNER_READ;
+		Write.PermissionWrite = ENakamaStoragePermissionWrite::OWNER_WRITE;
+		return Write;
+	}
+}
+
+// Writes are batched into one request and served from memory; a change made elsewhere surfaces as a conflict.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(StorageMirrorConflict, FNakamaTestBase, "Nakama.Base.StorageMirror.Conflict", NAKAMA_MODULE_TEST_MASK)
+inline bool StorageMirrorConflict::RunTest(const FString& Parameters)
+{
+	InitiateTest();
+
+	TSharedRef<FNakamaMockServer, ESPMode::ThreadSafe> Server = FNakamaMockServer::Create();
+	Server->Start();
+
+	TSharedRef<TStrongObjectPtr<UNakamaStorageMirror>> Mirror = MakeShared<TStrongObjectPtr<UNakamaStorageMirror>>(UNakamaStorageMirror::CreateStorageMirror(Client));
+	(*Mirror)->FlushDelaySeconds = 60.0f;
+
+	auto Fail = [this, Server](const FString& What, const FNakamaError& Error)
+	{
+		TestFalse(FString::Printf(TEXT("%s failed: %s"), *What, *Error.Message), true);
+		Server->Stop();
+		StopTest();
+	};
+
+	auto successCallback = [this, Server, Mirror, Fail](UNakamaSession* session)
+	{
+		(*Mirror)->WriteObject(session, MakeMirrorWrite(TEXT("a"), TEXT("{\"level\":1}")));
+		(*Mirror)->WriteObject(session, MakeMirrorWrite(TEXT("b"), TEXT("{\"level\":2}")));
+		TestEqual("Pending writes", (*Mirror)->GetNumPendingWrites(), 2);
+
+		(*Mirror)->Flush([this, Server, Mirror, Fail, session](const FNakamaStoreObjectAcks& Acks)
+		{
+			TestEqual("One batch", Acks.StorageObjects.Num(), 2);
+			TestEqual("Nothing pending", (*Mirror)->GetNumPendingWrites(), 0);
+
+			FNakamaStoreObjectData Object;
+			TestTrue("Served from memory", (*Mirror)->GetObject(TEXT("saves"), TEXT("a"), session->GetUserId(), Object));
+			TestEqual("Mirrored value", Object.Value, FString(TEXT("{\"level\":1}")));
+
+			// Another device changes "a" behind the mirror's back.
+			Client->WriteStorageObjects(session, { MakeMirrorWrite(TEXT("a"), TEXT("{\"level\":7}")) },
+				[this, Server, Mirror, Fail, session](const FNakamaStoreObjectAcks&)
+				{
+					(*Mirror)->WriteObject(session, MakeMirrorWrite(TEXT("a"), TEXT("{\"level\":3}")));
+					(*Mirror)->Flush([this, Server](const FNakamaStoreObjectAcks&)
+					{
+						TestFalse("Stale write accepted", true);
+						Server->Stop();
+						StopTest();
+					},
+					[this, Server, Mirror, Fail, session](const FNakamaError&)
+					{
+						TestEqual("Conflicts", (*Mirror)->GetNumConflicts(), 1);
+
+						FNakamaStoreObjectData Object;
+						TestTrue("Local change kept", (*Mirror)->GetObject(TEXT("saves"), TEXT("a"), session->GetUserId(), Object));
+						TestEqual("Local value", Object.Value, FString(TEXT("{\"level\":3}")));
+
+						(*Mirror)->ResolveConflict(TEXT("saves"), TEXT("a"), session->GetUserId(), true);
+						(*Mirror)->Flush([this, Server, Mirror](const FNakamaStoreObjectAcks& Acks)
+						{
+							TestEqual("Resolved write", Acks.StorageObjects.Num(), 1);
+							TestEqual("No conflicts", (*Mirror)->GetNumConflicts(), 0);
+							TestEqual("Nothing pending", (*Mirror)->GetNumPendingWrites(), 0);
+							Server->Stop();
+							StopTest();
+						}, [Fail](const FNakamaError& Error) { Fail(TEXT("Resolved flush"), Error); });
+					});
+				}, [Fail](const FNakamaError& Error) { Fail(TEXT("External write"), Error); });
+		}, [Fail](const FNakamaError& Error) { Fail(TEXT("Flush"), Error); });
+	};
+
+	auto errorCallback = [Fail](const FNakamaError& Error)
+	{
+		Fail(TEXT("Authentication"), Error);
+	};
+
+	Client->AuthenticateDevice(FGuid::NewGuid().ToString(), true, {}, {}, successCallback, errorCallback);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForAsyncQueries(this));
+	return true;
+}
+
+// With a patch RPC, changes to objects the server already has are sent as merge patches.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(StorageMirrorPatch, FNakamaTestBase, "Nakama.Base.StorageMirror.Patch", NAKAMA_MODULE_TEST_MASK)
+inline bool StorageMirrorPatch::RunTest(const FString& Parameters)
+{
+	InitiateTest();
+
+	FNakamaMockServerSettings Settings;
+	Settings.StoragePatchRpcId = TEXT("storage_patch");
+	TSharedRef<FNakamaMockServer, ESPMode::ThreadSafe> Server = FNakamaMockServer::Create(Settings);
+	Server->Start();
+
+	TSharedRef<TStrongObjectPtr<UNakamaStorageMirror>> Mirror = MakeShared<TStrongObjectPtr<UNakamaStorageMirror>>(UNakamaStorageMirror::CreateStorageMirror(Client));
+	(*Mirror)->FlushDelaySeconds = 60.0f;
+	(*Mirror)->PatchRpcId = TEXT("storage_patch");
+
+	auto Fail = [this, Server](const FString& What, const FNakamaError& Error)
+	{
+		TestFalse(FString::Printf(TEXT("%s failed: %s"), *What, *Error.Message), true);
+		Server->Stop();
+		StopTest();
+	};
+
+	FString Inventory = TEXT("{\"gold\":1");
+	for (int32 Index = 0; Index < 50; ++Index)
+	{
+		Inventory += FString::Printf(TEXT(",\"item%d\":{\"count\":%d,\"durability\":100}"), Index, Index);
+	}
+	const FString Original = Inventory + TEXT("}");
+	const FString Modified = Original.Replace(TEXT("\"gold\":1"), TEXT("\"gold\":2"));
+
+	auto successCallback = [this, Server, Mirror, Fail, Original, Modified](UNakamaSession* session)
+	{
+		(*Mirror)->WriteObject(session, MakeMirrorWrite(TEXT("inventory"), Original));
+		(*Mirror)->Flush([this, Server, Mirror, Fail, Modified, session](const FNakamaStoreObjectAcks&)
+		{
+			TestEqual("First write is whole", (*Mirror)->GetNumPatchedWrites(), 0);
+
+			(*Mirror)->WriteObject(session, MakeMirrorWrite(TEXT("inventory"), Modified));
+			(*Mirror)->Flush([this, Server, Mirror, Fail, Modified, session](const FNakamaStoreObjectAcks& Acks)
+			{
+				TestEqual("Patched ack", Acks.StorageObjects.Num(), 1);
+				TestEqual("Second write is a patch", (*Mirror)->GetNumPatchedWrites(), 1);
+
+				FNakamaReadStorageObjectId Id;
+				Id.Collection = TEXT("saves");
+				Id.Key = TEXT("inventory");
+				Id.UserId = session->GetUserId();
+				Client->ReadStorageObjects(session, { Id }, [this, Server, Modified](const FNakamaStorageObjectList& List)
+				{
+					TestEqual("Stored objects", List.Objects.Num(), 1);
+					if (List.Objects.Num() == 1)
+					{
+						TestTrue("Server value patched", List.Objects[0].Value.Contains(TEXT("\"gold\":2")));
+						TestTrue("Rest kept", List.Objects[0].Value.Contains(TEXT("\"item49\"")));
+					}
+					Server->Stop();
+					StopTest();
+				}, [Fail](const FNakamaError& Error) { Fail(TEXT("Read"), Error); });
+			}, [Fail](const FNakamaError& Error) { Fail(TEXT("Patch flush"), Error); });
+		}, [Fail](const FNakamaError& Error) { Fail(TEXT("Flush"), Error); });
+	};
+
+	auto errorCallback = [Fail](const FNakamaError& Error)
+	{
+		Fail(TEXT("Authentication"), Error);
+	};
+
+	Client->AuthenticateDevice(FGuid::NewGuid().ToString(), true, {}, {}, successCallback, errorCallback);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForAsyncQueries(this));
+	return true;
+}
+
+// A server without the patch RPC gets whole values instead.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(StorageMirrorPatchFallback, FNakamaTestBase, "Nakama.Base.StorageMirror.PatchFallback", NAKAMA_MODULE_TEST_MASK)
+inline bool StorageMirrorPatchFallback::RunTest(const FString& Parameters)
+{
+	InitiateTest();
+
+	TSharedRef<FNakamaMockServer, ESPMode::ThreadSafe> Server = FNakamaMockServer::Create();
+	Server->SetCannedResponse(TEXT("POST"), TEXT("/v2/rpc/storage_patch"), 404, TEXT("{\"code\":5,\"message\":\"RPC function not found\"}"));
+	Server->Start();
+
+	TSharedRef<TStrongObjectPtr<UNakamaStorageMirror>> Mirror = MakeShared<TStrongObjectPtr<UNakamaStorageMirror>>(UNakamaStorageMirror::CreateStorageMirror(Client));
+	(*Mirror)->FlushDelaySeconds = 60.0f;
+	(*Mirror)->PatchRpcId = TEXT("storage_patch");
+
+	auto Fail = [this, Server](const FString& What, const FNakamaError& Error)
+	{
+		TestFalse(FString::Printf(TEXT("%s failed: %s"), *What, *Error.Message), true);
+		Server->Stop();
+		StopTest();
+	};
+
+	auto successCallback = [this, Server, Mirror, Fail](UNakamaSession* session)
+	{
+		(*Mirror)->WriteObject(session, MakeMirrorWrite(TEXT("a"), TEXT("{\"level\":1,\"name\":\"a long enough name to patch\"}")));
+		(*Mirror)->Flush([this, Server, Mirror, Fail, session](const FNakamaStoreObjectAcks&)
+		{
+			(*Mirror)->WriteObject(session, MakeMirrorWrite(TEXT("a"), TEXT("{\"level\":2,\"name\":\"a long enough name to patch\"}")));
+			(*Mirror)->Flush([this, Server, Mirror](const FNakamaStoreObjectAcks& Acks)
+			{
+				TestEqual("Whole write ack", Acks.StorageObjects.Num(), 1);
+				TestEqual("Nothing patched", (*Mirror)->GetNumPatchedWrites(), 0);
+				TestEqual("Nothing pending", (*Mirror)->GetNumPendingWrites(), 0);
+				Server->Stop();
+				StopTest();
+			}, [Fail](const FNakamaError& Error) { Fail(TEXT("Fallback flush"), Error); });
+		}, [Fail](const FNakamaError& Error) { Fail(TEXT("Flush"), Error); });
+	};
+
+	auto errorCallback = [Fail](const FNakamaError& Error)
+	{
+		Fail(TEXT("Authentication"), Error);
+	};
+
+	Client->AuthenticateDevice(FGuid::NewGuid().ToString(), true, {}, {}, successCallback, errorCallback);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForAsyncQueries(this));
+	return true;
+}
@@ -0,0 +1,132 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaTestBase.h"
+#include "NakamaMockServer.h"
+#include "NakamaUserDirectory.h"
+#include "NakamaUtils.h"
+#include "UObject/StrongObjectPtr.h"
+#include "Dom/JsonObject.h"
+
+namespace
+{
+	// Answers GET /v2/user with a user for every requested ID except those starting with "unknown".
+	FNakamaMockResponse MockGetUsers(const FNakamaMockRequest& Request)
+	{
+		TArray<TSharedPtr<FJsonValue>> Users;
+		for (const FString& Id : Request.GetQueryParams(TEXT("ids")))
+		{
+			if (!Id.StartsWith(TEXT("unknown")))
+			{
+				const TSharedRef<FJsonObject> User = MakeShared<FJsonObject>();
+				User->SetStringField(TEXT("id"), Id);
+				User->SetStringField(TEXT("username"), TEXT("name-") + Id);
+				Users.Add(MakeShared<FJsonValueObject>(User));
+			}
+		}
+
+		const TSharedRef<FJsonObject> Body = MakeShared<FJsonObject>();
+		Body->SetArrayField(TEXT("users"), Users);
+		return FNakamaMockResponse(200, FNakamaUtils::EncodeJson(Body));
+	}
+}
+
+// Overlapping lookups in the same window share one request per batch, and repeats are served from the cache.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(UserDirectoryBatching, FNakamaTestBase, "Nakama.Base.UserDirectory.Batching", NAKAMA_MODULE_TEST_MASK)
+inline bool UserDirectoryBatching::RunTest(const FString& Parameters)
+{
+	InitiateTest();
+
+	TSharedRef<FNakamaMockServer, ESPMode::ThreadSafe> Server = FNakamaMockServer::Create();
+	TSharedRef<int32, ESPMode::ThreadSafe> NumUserRequests = MakeShared<int32, ESPMode::ThreadSafe>(0);
+	Server->SetRoute(TEXT("GET"), TEXT("/v2/user"), [NumUserRequests](const FNakamaMockRequest& Request)
+	{
+		++(*NumUserRequests);
+		return MockGetUsers(Request);
+	});
+	Server->Start();
+
+	TSharedRef<TStrongObjectPtr<UNakamaUserDirectory>> Directory = MakeShared<TStrongObjectPtr<UNakamaUserDirectory>>(UNakamaUserDirectory::CreateUserDirectory(Client));
+	(*Directory)->MaxBatchSize = 3;
+
+	auto successCallback = [this, Server, Directory, NumUserRequests](UNakamaSession* session)
+	{
+		TSharedRef<int32> NumPending = MakeShared<int32>(2);
+		auto Finish = [this, Server, Directory, NumUserRequests, NumPending, session]()
+		{
+			if (--(*NumPending) > 0)
+			{
+				return;
+			}
+
+			// Four distinct IDs with a batch size of three.
+			TestEqual("Batched requests", *NumUserRequests, 2);
+			TestEqual("Directory requests", (*Directory)->GetNumRequests(), 2);
+
+			(*Directory)->GetUsers(session, { TEXT("a"), TEXT("d") },
+				[this, Server, NumUserRequests](const TArray<FNakamaUser>& Users)
+				{
+					TestEqual("Cached users", Users.Num(), 2);
+					TestEqual("No request for cached users", *NumUserRequests, 2);
+					Server->Stop();
+					StopTest();
+				},
+				[this, Server](const FNakamaError& Error)
+				{
+					TestFalse(FString::Printf(TEXT("Cached lookup failed: %s"), *Error.Message), true);
+					Server->Stop();
+					StopTest();
+				});
+		};
+
+		auto errorCallback = [this, Finish](const FNakamaError& Error)
+		{
+			TestFalse(FString::Printf(TEXT("Lookup failed: %s"), *Error.Message), true);
+			Finish();
+		};
+
+		(*Directory)->GetUsers(session, { TEXT("a"), TEXT("b"), TEXT("unknown-1") },
+			[this, Finish](const TArray<FNakamaUser>& Users)
+			{
+				TestEqual("First lookup size", Users.Num(), 2);
+				if (Users.Num() == 2)
+				{
+					TestEqual("Requested order", Users[1].Id, FString(TEXT("b")));
+					TestEqual("Username", Users[0].Username, FString(TEXT("name-a")));
+				}
+				Finish();
+			}, errorCallback);
+
+		(*Directory)->GetUsers(session, { TEXT("b"), TEXT("d") },
+			[this, Finish](const TArray<FNakamaUser>& Users)
+			{
+				TestEqual("Second lookup size", Users.Num(), 2);
+				Finish();
+			}, errorCallback);
+	};
+
+	auto errorCallback = [this, Server](const FNakamaError& Error)
+	{
+		TestFalse(FString::Printf(TEXT("Authentication failed: %s"), *Error.Message), true);
+		Server->Stop();
+		StopTest();
+	};
+
+	Client->AuthenticateDevice(FGuid::NewGuid().ToString(), true, {}, {}, successCallback, errorCallback);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForAsyncQueries(this));
+	return true;
+}
@@ -0,0 +1,487 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaChatHistory.h"
+#include "NakamaClient.h"
+#include "NakamaRealtimeClient.h"
+#include "NakamaSession.h"
+#include "NakamaUtils.h"
+#include "NakamaLoggingMacros.h"
+#include "Algo/BinarySearch.h"
+
+namespace
+{
+	// Messages are ordered by creation time, with the ID breaking ties so the order is stable.
+	bool IsBefore(const FNakamaChannelMessage& A, const FNakamaChannelMessage& B)
+	{
+		if (A.CreateTime != B.CreateTime)
+		{
+			return A.CreateTime < B.CreateTime;
+		}
+		return A.MessageId < B.MessageId;
+	}
+
+	int32 FindMessage(const TArray<FNakamaChannelMessage>& Messages, const FString& MessageId)
+	{
+		// Updates and removals usually target recent messages.
+		for (int32 Index = Messages.Num() - 1; Index >= 0; --Index)
+		{
+			if (Messages[Index].MessageId == MessageId)
+			{
+				return Index;
+			}
+		}
+		return INDEX_NONE;
+	}
+}
+
+UNakamaChatHistory* UNakamaChatHistory::CreateChatHistory(UNakamaClient* Client, int32 MaxMessagesPerChannel)
+{
+	UNakamaChatHistory* History = NewObject<UNakamaChatHistory>();
+	History->Client = Client;
+	History->MaxMessagesPerChannel = FMath::Max(MaxMessagesPerChannel, 1);
+	return History;
+}
+
+void UNakamaChatHistory::BindRealtimeClient(UNakamaRealtimeClient* RealtimeClient)
+{
+	if (UNakamaRealtimeClient* Previous = BoundRealtimeClient.Get())
+	{
+		Previous->ChannelMessageReceivedNative.Remove(RealtimeHandles[0]);
+		Previous->DisconnectedEventNative.Remove(RealtimeHandles[1]);
+		Previous->ConnectedEventNative.Remove(RealtimeHandles[2]);
+	}
+	RealtimeHandles.Reset();
+	BoundRealtimeClient = RealtimeClient;
+
+	if (RealtimeClient)
+	{
+		RealtimeHandles.Add(RealtimeClient->ChannelMessageReceivedNative.AddUObject(this, &UNakamaChatHistory::HandleChannelMessage));
+		RealtimeHandles.Add(RealtimeClient->DisconnectedEventNative.AddUObject(this, &UNakamaChatHistory::HandleDisconnected));
+		RealtimeHandles.Add(RealtimeClient->ConnectedEventNative.AddUObject(this, &UNakamaChatHistory::HandleConnected));
+	}
+}
+
+void UNakamaChatHistory::LoadHistory(
+	UNakamaSession* Session,
+	const FString& ChannelId,
+	const TFunction<void(const TArray<FNakamaChannelMessage>& Messages)>& SuccessCallback,
+	const TFunction<void(const FNakamaError& Error)>& ErrorCallback)
+{
+	TWeakObjectPtr<UNakamaChatHistory> WeakThis(this);
+	auto Respond = [WeakThis, ChannelId, SuccessCallback](int32 NumAdded)
+	{
+		UNakamaChatHistory* Self = WeakThis.Get();
+		if (Self && SuccessCallback)
+		{
+			SuccessCallback(Self->GetMessages(ChannelId));
+		}
+	};
+
+	const FChannel* Channel = Channels.Find(ChannelId);
+	if (Channel && Channel->bLoaded && !Channel->bGap && !Channel->bBackfilling)
+	{
+		if (IsValid(Session))
+		{
+			BackfillSession = Session;
+		}
+		Respond(0);
+		return;
+	}
+
+	// The first load is a one page backfill, so it shares the in-flight request with a reconnect.
+	Backfill(Session, ChannelId, Respond, ErrorCallback);
+}
+
+void UNakamaChatHistory::LoadOlder(
+	UNakamaSession* Session,
+	const FString& ChannelId,
+	const TFunction<void(const TArray<FNakamaChannelMessage>& Messages, bool bHasMore)>& SuccessCallback,
+	const TFunction<void(const FNakamaError& Error)>& ErrorCallback)
+{
+	const FChannel* Channel = Channels.Find(ChannelId);
+	if (!Channel || !Channel->bLoaded)
+	{
+		TWeakObjectPtr<UNakamaChatHistory> WeakThis(this);
+		LoadHistory(Session, ChannelId, [WeakThis, ChannelId, SuccessCallback](const TArray<FNakamaChannelMessage>& Messages)
+		{
+			const FChannel* Loaded = WeakThis.IsValid() ? WeakThis->Channels.Find(ChannelId) : nullptr;
+			if (Loaded && SuccessCallback)
+			{
+				SuccessCallback(Messages, !Loaded->OlderCursor.IsEmpty());
+			}
+		}, ErrorCallback);
+		return;
+	}
+
+	if (Channel->OlderCursor.IsEmpty())
+	{
+		if (SuccessCallback) { SuccessCallback({}, false); }
+		return;
+	}
+
+	TWeakObjectPtr<UNakamaChatHistory> WeakThis(this);
+	auto OnPage = [WeakThis, ChannelId, SuccessCallback](const FNakamaChannelMessageList& Page)
+	{
+		UNakamaChatHistory* Self = WeakThis.Get();
+		FChannel* Loaded = Self ? Self->Channels.Find(ChannelId) : nullptr;
+		if (!Loaded)
+		{
+			return;
+		}
+
+		Loaded->OlderCursor = Page.NextCursor;
+
+		// Older than everything cached, so a full channel drops them again right away.
+		bool bChanged = false;
+		for (const FNakamaChannelMessage& Message : Page.Messages)
+		{
+			bChanged |= Self->InsertMessage(*Loaded, Message);
+		}
+		if (bChanged)
+		{
+			Self->ChangedEvent.Broadcast(ChannelId);
+		}
+
+		if (SuccessCallback)
+		{
+			TArray<FNakamaChannelMessage> Messages = Page.Messages;
+			Messages.Sort(&IsBefore);
+			SuccessCallback(Messages, !Page.NextCursor.IsEmpty());
+		}
+	};
+
+	FetchPage(Session, ChannelId, Channel->OlderCursor, OnPage, ErrorCallback);
+}
+
+void UNakamaChatHistory::Backfill(
+	UNakamaSession* Session,
+	const FString& ChannelId,
+	const TFunction<void(int32 NumAdded)>& SuccessCallback,
+	const TFunction<void(const FNakamaError& Error)>& ErrorCallback)
+{
+	if (!FNakamaUtils::IsClientActive(Client))
+	{
+		if (ErrorCallback) { ErrorCallback(FNakamaUtils::HandleInvalidClient()); }
+		return;
+	}
+
+	if (IsValid(Session))
+	{
+		BackfillSession = Session;
+	}
+
+	FChannel& Channel = Channels.FindOrAdd(ChannelId);
+	if (SuccessCallback) { Channel.OnBackfilled.Add(SuccessCallback); }
+	if (ErrorCallback) { Channel.OnBackfillError.Add(ErrorCallback); }
+	if (Channel.bBackfilling)
+	{
+		return;
+	}
+	Channel.bBackfilling = true;
+
+	// Without a marked gap, catch up from the newest message held.
+	if (Channel.bLoaded && !Channel.bGap)
+	{
+		Channel.GapAnchor = Channel.Messages.Num() > 0 ? Channel.Messages.Last().CreateTime : FDateTime::MinValue();
+	}
+
+	const int32 Pages = Channel.bLoaded ? FMath::Max(MaxBackfillPages, 1) : 1;
+	ContinueBackfill(Session, ChannelId, FString(), Pages, 0);
+}
+
+void UNakamaChatHistory::AddMessage(const FNakamaChannelMessage& Message)
+{
+	if (InsertMessage(Channels.FindOrAdd(Message.ChannelId), Message))
+	{
+		ChangedEvent.Broadcast(Message.ChannelId);
+	}
+}
+
+TArray<FNakamaChannelMessage> UNakamaChatHistory::GetMessages(const FString& ChannelId) const
+{
+	const FChannel* Channel = Channels.Find(ChannelId);
+	return Channel ? Channel->Messages : TArray<FNakamaChannelMessage>();
+}
+
+bool UNakamaChatHistory::HasGap(const FString& ChannelId) const
+{
+	const FChannel* Channel = Channels.Find(ChannelId);
+	return Channel && Channel->bGap;
+}
+
+void UNakamaChatHistory::MarkGap(const FString& ChannelId)
+{
+	FChannel* Channel = Channels.Find(ChannelId);
+	if (!Channel || !Channel->bLoaded || Channel->bGap)
+	{
+		return;
+	}
+
+	Channel->bGap = true;
+	Channel->GapAnchor = Channel->Messages.Num() > 0 ? Channel->Messages.Last().CreateTime : FDateTime::MinValue();
+}
+
+void UNakamaChatHistory::RemoveChannel(const FString& ChannelId)
+{
+	Channels.Remove(ChannelId);
+}
+
+void UNakamaChatHistory::Clear()
+{
+	Channels.Empty();
+}
+
+void UNakamaChatHistory::BeginDestroy()
+{
+	BindRealtimeClient(nullptr);
+	Super::BeginDestroy();
+}
+
+bool UNakamaChatHistory::InsertMessage(FChannel& Channel, const FNakamaChannelMessage& Message)
+{
+	const bool bKnown = Channel.MessageIds.Contains(Message.MessageId);
+
+	// Code 2 is a removal, code 1 an update of an earlier message.
+	if (Message.code == 2)
+	{
+		if (!bKnown)
+		{
+			return false;
+		}
+		Channel.Messages.RemoveAt(FindMessage(Channel.Messages, Message.MessageId));
+		Channel.MessageIds.Remove(Message.MessageId);
+		return true;
+	}
+
+	if (bKnown)
+	{
+		FNakamaChannelMessage& Existing = Channel.Messages[FindMessage(Channel.Messages, Message.MessageId)];
+		if (Message.code != 1 && Message.UpdateTime <= Existing.UpdateTime)
+		{
+			return false;
+		}
+
+		// Keep the original creation time so the position stays valid.
+		const FDateTime CreateTime = Existing.CreateTime;
+		Existing = Message;
+		Existing.CreateTime = CreateTime;
+		return true;
+	}
+
+	// Live messages arrive in order, so appending is the common case.
+	if (Channel.Messages.Num() == 0 || !IsBefore(Message, Channel.Messages.Last()))
+	{
+		Channel.Messages.Add(Message);
+	}
+	else
+	{
+		const int32 Index = Algo::UpperBound(Channel.Messages, Message, &IsBefore);
+		if (Index == 0 && Channel.Messages.Num() >= MaxMessagesPerChannel)
+		{
+			// Older than everything in a full channel.
+			return false;
+		}
+		Channel.Messages.Insert(Message, Index);
+	}
+	Channel.MessageIds.Add(Message.MessageId);
+
+	if (Channel.Messages.Num() > MaxMessagesPerChannel)
+	{
+		const int32 NumEvicted = Channel.Messages.Num() - MaxMessagesPerChannel;
+		for (int32 Index = 0; Index < NumEvicted; ++Index)
+		{
+			Channel.MessageIds.Remove(Channel.Messages[Index].MessageId);
+		}
+		Channel.Messages.RemoveAt(0, NumEvicted);
+	}
+	return true;
+}
+
+void UNakamaChatHistory::FetchPage(
+	UNakamaSession* Session,
+	const FString& ChannelId,
+	const FString& Cursor,
+	const TFunction<void(const FNakamaChannelMessageList& Page)>& OnPage,
+	const TFunction<void(const FNakamaError& Error)>& OnError)
+{
+	if (!FNakamaUtils::IsClientActive(Client))
+	{
+		if (OnError) { OnError(FNakamaUtils::HandleInvalidClient()); }
+		return;
+	}
+
+	++NumRequests;
+
+	// Newest first, so the first page holds the latest messages and NextCursor moves back in time.
+	Client->ListChannelMessages(
+		Session,
+		ChannelId,
+		FMath::Max(PageSize, 1),
+		Cursor.IsEmpty() ? TOptional<FString>() : TOptional<FString>(Cursor),
+		false,
+		OnPage,
+		OnError);
+}
+
+void UNakamaChatHistory::ContinueBackfill(UNakamaSession* Session, const FString& ChannelId, const FString& Cursor, int32 PagesLeft, int32 NumAdded)
+{
+	TWeakObjectPtr<UNakamaChatHistory> WeakThis(this);
+	TWeakObjectPtr<UNakamaSession> WeakSession(Session);
+
+	auto OnPage = [WeakThis, WeakSession, ChannelId, PagesLeft, NumAdded](const FNakamaChannelMessageList& Page)
+	{
+		UNakamaChatHistory* Self = WeakThis.Get();
+		FChannel* Channel = Self ? Self->Channels.Find(ChannelId) : nullptr;
+		if (!Channel)
+		{
+			return;
+		}
+
+		int32 Added = 0;
+		bool bReachedAnchor = false;
+		for (const FNakamaChannelMessage& Message : Page.Messages)
+		{
+			bReachedAnchor |= Message.CreateTime <= Channel->GapAnchor;
+			Added += Self->InsertMessage(*Channel, Message) ? 1 : 0;
+		}
+		if (Added > 0)
+		{
+			Self->ChangedEvent.Broadcast(ChannelId);
+		}
+
+		if (!Channel->bLoaded)
+		{
+			Channel->bLoaded = true;
+			Channel->OlderCursor = Page.NextCursor;
+		}
+		else if (!bReachedAnchor && !Page.NextCursor.IsEmpty())
+		{
+			if (PagesLeft > 1)
+			{
+				if (UNakamaSession* LiveSession = WeakSession.Get())
+				{
+					Self->ContinueBackfill(LiveSession, ChannelId, Page.NextCursor, PagesLeft - 1, NumAdded + Added);
+					return;
+				}
+
+				// The session is gone, so the gap is not known to be too long: keep the cache and the gap for the next load.
+				FNakamaError Error;
+				Error.Message = TEXT("Session is no longer valid, chat history backfill stopped.");
+				Self->FinishBackfill(ChannelId, NumAdded + Added, &Error);
+				return;
+			}
+
+			// Too far behind to close the gap: drop the stale messages so the cache stays contiguous,
+			// LoadOlder continues from where the backfill stopped.
+			NAKAMA_LOGF_WARN(TEXT("Chat history: gap in channel '%s' is longer than %d pages, dropping older messages."), *ChannelId, Self->MaxBackfillPages);
+			const FDateTime Anchor = Channel->GapAnchor;
+			Channel->Messages.RemoveAll([Channel, Anchor](const FNakamaChannelMessage& Message)
+			{
+				if (Message.CreateTime <= Anchor)
+				{
+					Channel->MessageIds.Remove(Message.MessageId);
+					return true;
+				}
+				return false;
+			});
+			Channel->OlderCursor = Page.NextCursor;
+			Self->ChangedEvent.Broadcast(ChannelId);
+		}
+
+		Self->FinishBackfill(ChannelId, NumAdded + Added, nullptr);
+	};
+
+	auto OnError = [WeakThis, ChannelId, NumAdded](const FNakamaError& Error)
+	{
+		if (UNakamaChatHistory* Self = WeakThis.Get())
+		{
+			Self->FinishBackfill(ChannelId, NumAdded, &Error);
+		}
+	};
+
+	FetchPage(Session, ChannelId, Cursor, OnPage, OnError);
+}
+
+void UNakamaChatHistory::FinishBackfill(const FString& ChannelId, int32 NumAdded, const FNakamaError* Error)
+{
+	FChannel* Channel = Channels.Find(ChannelId);
+	if (!Channel)
+	{
+		return;
+	}
+
+	TArray<TFunction<void(int32 NumAdded)>> OnBackfilled = MoveTemp(Channel->OnBackfilled);
+	TArray<TFunction<void(const FNakamaError& Error)>> OnBackfillError = MoveTemp(Channel->OnBackfillError);
+	Channel->OnBackfilled.Reset();
+	Channel->OnBackfillError.Reset();
+	Channel->bBackfilling = false;
+
+	// A failed backfill keeps the gap so the next load retries it.
+	if (Error)
+	{
+		for (const TFunction<void(const FNakamaError& Error)>& OnError : OnBackfillError)
+		{
+			OnError(*Error);
+		}
+		return;
+	}
+
+	Channel->bGap = false;
+	Channel->GapAnchor = FDateTime::MinValue();
+	for (const TFunction<void(int32 NumAdded)>& OnDone : OnBackfilled)
+	{
+		OnDone(NumAdded);
+	}
+}
+
+void UNakamaChatHistory::HandleChannelMessage(const FNakamaChannelMessage& Message)
+{
+	AddMessage(Message);
+}
+
+void UNakamaChatHistory::HandleDisconnected(const FNakamaDisconnectInfo& Info)
+{
+	// Messages sent while offline are only in the server history.
+	TArray<FString> ChannelIds;
+	Channels.GetKeys(ChannelIds);
+	for (const FString& ChannelId : ChannelIds)
+	{
+		MarkGap(ChannelId);
+	}
+}
+
+void UNakamaChatHistory::HandleConnected()
+{
+	if (!IsValid(BackfillSession))
+	{
+		return;
+	}
+
+	TArray<FString> ChannelIds;
+	for (const TPair<FString, FChannel>& Pair : Channels)
+	{
+		if (Pair.Value.bGap)
+		{
+			ChannelIds.Add(Pair.Key);
+		}
+	}
+
+	for (const FString& ChannelId : ChannelIds)
+	{
+		Backfill(BackfillSession, ChannelId, nullptr, nullptr);
+	}
+}
@@ -20,10 +20,14 @@
 #include "NakamaSession.h"
 #include "NakamaLogger.h"
 #include "NakamaRetryInvoker.h"
+#include "NakamaMemory.h"
+#include "NakamaTrace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 #include "GenericPlatform/GenericPlatformHttp.h"
 #include "Interfaces/IHttpResponse.h"
 #include "Misc/Optional.h"
 #include "Containers/Ticker.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
 
 void UNakamaClient::InitializeClient(const FString& InHostname, int32 InPort, const FString& InServerKey,
 	bool bInUseSSL)
@@ -2063,7 +2067,7 @@ void UNakamaClient::AuthenticateDevice(
         {
             if (SuccessCallback)
             {
-                SuccessCallback(UNakamaSession::SetupSession(ResponseBody));
+                FNakamaHttpMetrics::InvokeCallback(SuccessCallback, UNakamaSession::SetupSession(ResponseBody));
             }
         },
         ErrorCallback,
@@ -2122,7 +2126,7 @@ void UNakamaClient::AuthenticateEmail(
         {
             if (SuccessCallback)
             {
-                SuccessCallback(UNakamaSession::SetupSession(ResponseBody));
+                FNakamaHttpMetrics::InvokeCallback(SuccessCallback, UNakamaSession::SetupSession(ResponseBody));
             }
         },
         ErrorCallback,
@@ -2179,7 +2183,7 @@ void UNakamaClient::AuthenticateCustom(
         {
             if (SuccessCallback)
             {
-                SuccessCallback(UNakamaSession::SetupSession(ResponseBody));
+                FNakamaHttpMetrics::InvokeCallback(SuccessCallback, UNakamaSession::SetupSession(ResponseBody));
             }
         },
         ErrorCallback,
@@ -2236,7 +2240,7 @@ void UNakamaClient::AuthenticateApple(
         {
             if (SuccessCallback)
             {
-                SuccessCallback(UNakamaSession::SetupSession(ResponseBody));
+                FNakamaHttpMetrics::InvokeCallback(SuccessCallback, UNakamaSession::SetupSession(ResponseBody));
             }
         },
         ErrorCallback,
@@ -2295,7 +2299,7 @@ void UNakamaClient::AuthenticateFacebook(
         {
             if (SuccessCallback)
             {
-                SuccessCallback(UNakamaSession::SetupSession(ResponseBody));
+                FNakamaHttpMetrics::InvokeCallback(SuccessCallback, UNakamaSession::SetupSession(ResponseBody));
             }
         },
         ErrorCallback,
@@ -2352,7 +2356,7 @@ void UNakamaClient::AuthenticateGoogle(
         {
             if (SuccessCallback)
             {
-                SuccessCallback(UNakamaSession::SetupSession(ResponseBody));
+                FNakamaHttpMetrics::InvokeCallback(SuccessCallback, UNakamaSession::SetupSession(ResponseBody));
             }
         },
         ErrorCallback,
@@ -2419,7 +2423,7 @@ void UNakamaClient::AuthenticateGameCenter(
         {
             if (SuccessCallback)
             {
-                SuccessCallback(UNakamaSession::SetupSession(ResponseBody));
+                FNakamaHttpMetrics::InvokeCallback(SuccessCallback, UNakamaSession::SetupSession(ResponseBody));
             }
         },
         ErrorCallback,
@@ -2478,7 +2482,7 @@ void UNakamaClient::AuthenticateSteam(
         {
             if (SuccessCallback)
             {
-                SuccessCallback(UNakamaSession::SetupSession(ResponseBody));
+                FNakamaHttpMetrics::InvokeCallback(SuccessCallback, UNakamaSession::SetupSession(ResponseBody));
             }
         },
         ErrorCallback,
@@ -2525,7 +2529,7 @@ void UNakamaClient::AuthenticateRefresh(
         {
             if (SuccessCallback)
             {
-                SuccessCallback(UNakamaSession::SetupSession(ResponseBody));
+                FNakamaHttpMetrics::InvokeCallback(SuccessCallback, UNakamaSession::SetupSession(ResponseBody));
             }
         },
         ErrorCallback,
@@ -2576,14 +2580,18 @@ void UNakamaClient::EnsureValidSession(
 	Pending->OnError.Add(OnError);
 	InFlightRefreshes.Add(Key, Pending);
 
+	// Spans the wait every coalesced request spends behind this refresh.
+	const FNakamaTraceRegionPtr Region = NAKAMA_TRACE_REGION_BEGIN(NakamaHttpChannel, TEXT("Nakama::Session::Refresh"));
+
 	TWeakObjectPtr<UNakamaClient> WeakThis(this);
 
 	// Refresh first, then run all deferred requests with the refreshed token.
 	// Callbacks are driven from the captured Pending (not a map lookup) so they
 	// always fire exactly once, even if the client is torn down mid-refresh.
 	AuthenticateRefresh(Session,
-		[WeakThis, Key, Pending](UNakamaSession* Refreshed)
+		[WeakThis, Key, Pending, Region](UNakamaSession* Refreshed)
 		{
+			NAKAMA_TRACE_REGION_END(Region);
 			if (UNakamaClient* Self = WeakThis.Get())
 			{
 				Self->InFlightRefreshes.Remove(Key);
@@ -2609,8 +2617,9 @@ void UNakamaClient::EnsureValidSession(
 				}
 			}
 		},
-		[WeakThis, Key, Pending](const FNakamaError& Error)
+		[WeakThis, Key, Pending, Region](const FNakamaError& Error)
 		{
+			NAKAMA_TRACE_REGION_END(Region);
 			if (UNakamaClient* Self = WeakThis.Get())
 			{
 				Self->InFlightRefreshes.Remove(Key);
@@ -3550,7 +3559,7 @@ void UNakamaClient::GetAccount(
         Self->SendJsonRequest(Endpoint, TEXT(""), ENakamaRequestMethod::GET, TMultiMap<FString, FString>(), Session->GetAuthToken(),
             [SuccessCallback](const FString& ResponseBody)
             {
-                if (SuccessCallback) { const FNakamaAccount NakamaAccount = FNakamaAccount(ResponseBody); SuccessCallback(NakamaAccount); }
+                if (SuccessCallback) { const FNakamaAccount NakamaAccount = FNakamaAccount(ResponseBody); FNakamaHttpMetrics::InvokeCallback(SuccessCallback, NakamaAccount); }
             },
             ErrorCallback);
     },
@@ -3728,7 +3737,7 @@ void UNakamaClient::GetUsers(
         Self->SendJsonRequest(Endpoint, TEXT(""), ENakamaRequestMethod::GET, QueryParams, Session->GetAuthToken(),
             [SuccessCallback](const FString& ResponseBody)
             {
-                if (SuccessCallback) { const FNakamaUserList UserList = FNakamaUserList(ResponseBody); SuccessCallback(UserList); }
+                if (SuccessCallback) { const FNakamaUserList UserList = FNakamaUserList(ResponseBody); FNakamaHttpMetrics::InvokeCallback(SuccessCallback, UserList); }
             },
             ErrorCallback);
     },
@@ -3943,7 +3952,7 @@ void UNakamaClient::ListFriends(
         Self->SendJsonRequest(Endpoint, TEXT(""), ENakamaRequestMethod::GET, QueryParams, Session->GetAuthToken(),
             [SuccessCallback](const FString& ResponseBody)
             {
-                if (SuccessCallback) { const FNakamaFriendList FriendsList = FNakamaFriendList(ResponseBody); SuccessCallback(FriendsList); }
+                if (SuccessCallback) { const FNakamaFriendList FriendsList = FNakamaFriendList(ResponseBody); FNakamaHttpMetrics::InvokeCallback(SuccessCallback, FriendsList); }
             },
             ErrorCallback);
     },
@@ -4007,7 +4016,7 @@ void UNakamaClient::CreateGroup(
         Self->SendJsonRequest(Endpoint, Content, ENakamaRequestMethod::POST, TMultiMap<FString, FString>(), Session->GetAuthToken(),
             [SuccessCallback](const FString& ResponseBody)
             {
-                if (SuccessCallback) { const FNakamaGroup Group = FNakamaGroup(ResponseBody); SuccessCallback(Group); }
+                if (SuccessCallback) { const FNakamaGroup Group = FNakamaGroup(ResponseBody); FNakamaHttpMetrics::InvokeCallback(SuccessCallback, Group); }
             },
             ErrorCallback);
     },
@@ -4144,7 +4153,7 @@ void UNakamaClient::ListGroupUsers(
         Self->SendJsonRequest(Endpoint, TEXT(""), ENakamaRequestMethod::GET, QueryParams, Session->GetAuthToken(),
             [SuccessCallback](const FString& ResponseBody)
             {
-                if (SuccessCallback) { const FNakamaGroupUsersList GroupUsersList = FNakamaGroupUsersList(ResponseBody); SuccessCallback(GroupUsersList); }
+                if (SuccessCallback) { const FNakamaGroupUsersList GroupUsersList = FNakamaGroupUsersList(ResponseBody); FNakamaHttpMetrics::InvokeCallback(SuccessCallback, GroupUsersList); }
             },
             ErrorCallback);
     },
@@ -4357,7 +4366,7 @@ void UNakamaClient::ListGroups(
         Self->SendJsonRequest(Endpoint, TEXT(""), ENakamaRequestMethod::GET, QueryParams, Session->GetAuthToken(),
             [SuccessCallback](const FString& ResponseBody)
             {
-                if (SuccessCallback) { const FNakamaGroupList GroupList = FNakamaGroupList(ResponseBody); SuccessCallback(GroupList); }
+                if (SuccessCallback) { const FNakamaGroupList GroupList = FNakamaGroupList(ResponseBody); FNakamaHttpMetrics::InvokeCallback(SuccessCallback, GroupList); }
             },
             ErrorCallback);
     },
@@ -4440,7 +4449,7 @@ void UNakamaClient::ListUserGroups(
         Self->SendJsonRequest(Endpoint, TEXT(""), ENakamaRequestMethod::GET, QueryParams, Session->GetAuthToken(),
             [SuccessCallback](const FString& ResponseBody)
             {
-                if (SuccessCallback) { const FNakamaUserGroupList UserGroupList = FNakamaUserGroupList(ResponseBody); SuccessCallback(UserGroupList); }
+                if (SuccessCallback) { const FNakamaUserGroupList UserGroupList = FNakamaUserGroupList(ResponseBody); FNakamaHttpMetrics::InvokeCallback(SuccessCallback, UserGroupList); }
             },
             ErrorCallback);
     },
@@ -4663,7 +4672,7 @@ void UNakamaClient::ListLeaderboardRecords(
         Self->SendJsonRequest(Endpoint, TEXT(""), ENakamaRequestMethod::GET, QueryParams, Session->GetAuthToken(),
             [SuccessCallback](const FString& ResponseBody)
             {
-                if (SuccessCallback) { SuccessCallback(FNakamaLeaderboardRecordList(ResponseBody)); }
+                if (SuccessCallback) { FNakamaHttpMetrics::InvokeCallback(SuccessCallback, FNakamaLeaderboardRecordList(ResponseBody)); }
             },
             ErrorCallback);
     },
@@ -4710,7 +4719,7 @@ void UNakamaClient::ListLeaderboardRecordsAroundOwner(
         Self->SendJsonRequest(Endpoint, TEXT(""), ENakamaRequestMethod::GET, QueryParams, Session->GetAuthToken(),
             [SuccessCallback](const FString& ResponseBody)
             {
-                if (SuccessCallback) { SuccessCallback(FNakamaLeaderboardRecordList(ResponseBody)); }
+                if (SuccessCallback) { FNakamaHttpMetrics::InvokeCallback(SuccessCallback, FNakamaLeaderboardRecordList(ResponseBody)); }
             },
             ErrorCallback);
     },
@@ -4771,7 +4780,7 @@ void UNakamaClient::WriteLeaderboardRecord(
         Self->SendJsonRequest(Endpoint, Content, ENakamaRequestMethod::POST, TMultiMap<FString, FString>(), Session->GetAuthToken(),
             [SuccessCallback](const FString& ResponseBody)
             {
-                if (SuccessCallback) { SuccessCallback(FNakamaLeaderboardRecord(ResponseBody)); }
+                if (SuccessCallback) { FNakamaHttpMetrics::InvokeCallback(SuccessCallback, FNakamaLeaderboardRecord(ResponseBody)); }
             },
             ErrorCallback);
     },
@@ -4877,7 +4886,7 @@ void UNakamaClient::ListMatches(UNakamaSession* Session,
         Self->SendJsonRequest(Endpoint, TEXT(""), ENakamaRequestMethod::GET, QueryParams, Session->GetAuthToken(),
             [SuccessCallback](const FString& ResponseBody)
             {
-                if (SuccessCallback) { SuccessCallback(FNakamaMatchList(ResponseBody)); }
+                if (SuccessCallback) { FNakamaHttpMetrics::InvokeCallback(SuccessCallback, FNakamaMatchList(ResponseBody)); }
             },
             ErrorCallback);
     },
@@ -4926,7 +4935,7 @@ void UNakamaClient::ListNotifications(UNakamaSession* Session,
         Self->SendJsonRequest(Endpoint, TEXT(""), ENakamaRequestMethod::GET, QueryParams, Session->GetAuthToken(),
             [SuccessCallback](const FString& ResponseBody)
             {
-                if (SuccessCallback) { SuccessCallback(FNakamaNotificationList(ResponseBody)); }
+                if (SuccessCallback) { FNakamaHttpMetrics::InvokeCallback(SuccessCallback, FNakamaNotificationList(ResponseBody)); }
             },
             ErrorCallback);
     },
@@ -5028,7 +5037,7 @@ void UNakamaClient::ListChannelMessages(UNakamaSession* Session,
         Self->SendJsonRequest(Endpoint, TEXT(""), ENakamaRequestMethod::GET, QueryParams, Session->GetAuthToken(),
             [SuccessCallback](const FString& ResponseBody)
             {
-                if (SuccessCallback) { SuccessCallback(FNakamaChannelMessageList(ResponseBody)); }
+                if (SuccessCallback) { FNakamaHttpMetrics::InvokeCallback(SuccessCallback, FNakamaChannelMessageList(ResponseBody)); }
             },
             ErrorCallback);
     },
@@ -5097,7 +5106,7 @@ void UNakamaClient::ListTournaments(UNakamaSession* Session,
         Self->SendJsonRequest(Endpoint, TEXT(""), ENakamaRequestMethod::GET, QueryParams, Session->GetAuthToken(),
             [SuccessCallback](const FString& ResponseBody)
             {
-                if (SuccessCallback) { SuccessCallback(FNakamaTournamentList(ResponseBody)); }
+                if (SuccessCallback) { FNakamaHttpMetrics::InvokeCallback(SuccessCallback, FNakamaTournamentList(ResponseBody)); }
             },
             ErrorCallback);
     },
@@ -5155,7 +5164,7 @@ void UNakamaClient::ListTournamentRecords(UNakamaSession* Session,
         Self->SendJsonRequest(Endpoint, TEXT(""), ENakamaRequestMethod::GET, QueryParams, Session->GetAuthToken(),
             [SuccessCallback](const FString& ResponseBody)
             {
-                if (SuccessCallback) { SuccessCallback(FNakamaTournamentRecordList(ResponseBody)); }
+                if (SuccessCallback) { FNakamaHttpMetrics::InvokeCallback(SuccessCallback, FNakamaTournamentRecordList(ResponseBody)); }
             },
             ErrorCallback);
     },
@@ -5199,7 +5208,7 @@ void UNakamaClient::ListTournamentRecordsAroundOwner(
         Self->SendJsonRequest(Endpoint, TEXT(""), ENakamaRequestMethod::GET, QueryParams, Session->GetAuthToken(),
             [SuccessCallback](const FString& ResponseBody)
             {
-                if (SuccessCallback) { SuccessCallback(FNakamaTournamentRecordList(ResponseBody)); }
+                if (SuccessCallback) { FNakamaHttpMetrics::InvokeCallback(SuccessCallback, FNakamaTournamentRecordList(ResponseBody)); }
             },
             ErrorCallback);
     },
@@ -5258,7 +5267,7 @@ void UNakamaClient::WriteTournamentRecord(UNakamaSession* Session,
         Self->SendJsonRequest(Endpoint, Content, ENakamaRequestMethod::PUT, TMultiMap<FString, FString>(), Session->GetAuthToken(),
             [SuccessCallback](const FString& ResponseBody)
             {
-                if (SuccessCallback) { SuccessCallback(FNakamaLeaderboardRecord(ResponseBody)); }
+                if (SuccessCallback) { FNakamaHttpMetrics::InvokeCallback(SuccessCallback, FNakamaLeaderboardRecord(ResponseBody)); }
             },
             ErrorCallback);
     },
@@ -5347,7 +5356,7 @@ void UNakamaClient::ListStorageObjects(UNakamaSession* Session,
         Self->SendJsonRequest(Endpoint, TEXT(""), ENakamaRequestMethod::GET, QueryParams, Session->GetAuthToken(),
             [SuccessCallback](const FString& ResponseBody)
             {
-                if (SuccessCallback) { SuccessCallback(FNakamaStorageObjectList(ResponseBody)); }
+                if (SuccessCallback) { FNakamaHttpMetrics::InvokeCallback(SuccessCallback, FNakamaStorageObjectList(ResponseBody)); }
             },
             ErrorCallback);
     },
@@ -5399,7 +5408,7 @@ void UNakamaClient::ListUsersStorageObjects(UNakamaSession* Session,
         Self->SendJsonRequest(Endpoint, TEXT(""), ENakamaRequestMethod::GET, QueryParams, Session->GetAuthToken(),
             [SuccessCallback](const FString& ResponseBody)
             {
-                if (SuccessCallback) { SuccessCallback(FNakamaStorageObjectList(ResponseBody)); }
+                if (SuccessCallback) { FNakamaHttpMetrics::InvokeCallback(SuccessCallback, FNakamaStorageObjectList(ResponseBody)); }
             },
             ErrorCallback);
     },
@@ -5412,8 +5421,6 @@ void UNakamaClient::WriteStorageObjects(
     const TFunction<void(const FNakamaStoreObjectAcks& StoreObjectAcks)>& SuccessCallback,
     const TFunction<void(const FNakamaError& Error)>& ErrorCallback)
 {
-    TWeakObjectPtr<UNakamaClient> WeakThis(this);
-
     // Setup the endpoint
     const FString Endpoint = TEXT("/v2/storage");
 
@@ -5423,8 +5430,8 @@ void UNakamaClient::WriteStorageObjects(
         return;
     }
 
-    // Setup the request body
-    TArray<TSharedPtr<FJsonValue>> ObjectsJson;
+    // Setup the request objects
+    TArray<TSharedPtr<FJsonObject>> ObjectsJson;
     for (const FNakamaStoreObjectWrite& Object : Objects)
     {
         TSharedPtr<FJsonObject> ObjectJson = MakeShareable(new FJsonObject());
@@ -5440,39 +5447,37 @@ void UNakamaClient::WriteStorageObjects(
         const FString PermissionWrite = FNakamaUtils::GetEnumValueAsIntString(Object.PermissionWrite);
         ObjectJson->SetStringField(TEXT("permission_write"), PermissionWrite);
 
-        ObjectsJson.Add(MakeShareable(new FJsonValueObject(ObjectJson)));
+        ObjectsJson.Add(ObjectJson);
     }
 
-    TSharedPtr<FJsonObject> RequestBodyJson = MakeShareable(new FJsonObject());
-    RequestBodyJson->SetArrayField(TEXT("objects"), ObjectsJson);
-
-    // Serialize the request content
-    FString Content;
-    if (!FNakamaUtils::SerializeJsonObject(RequestBodyJson, Content))
+    // Serialize the request content, split to fit the storage batch limits
+    TArray<FString> Bodies;
+    if (!BuildStorageBatches(TEXT("objects"), ObjectsJson, Bodies))
     {
         // Handle JSON serialization failure
         FNakamaUtils::HandleJsonSerializationFailure(ErrorCallback);
         return;
     }
 
-    // Refresh the session token first if it is about to expire, then send.
-    EnsureValidSession(Session,
-        [WeakThis, Session, Endpoint, Content, SuccessCallback, ErrorCallback]()
-    {
-        UNakamaClient* Self = WeakThis.Get();
-        if (!Self)
-        {
-        	return;
-        }
+    // Acks of each request, joined in request order once all are written
+    TSharedRef<TArray<FNakamaStoreObjectAcks>> BatchAcks = MakeShared<TArray<FNakamaStoreObjectAcks>>();
+    BatchAcks->SetNum(Bodies.Num());
 
-        Self->SendJsonRequest(Endpoint, Content, ENakamaRequestMethod::PUT, TMultiMap<FString, FString>(), Session->GetAuthToken(),
-            [SuccessCallback](const FString& ResponseBody)
+    SendStorageBatches(Session, Endpoint, ENakamaRequestMethod::PUT, Bodies,
+        [BatchAcks](int32 BatchIndex, const FString& ResponseBody)
+        {
+            (*BatchAcks)[BatchIndex] = FNakamaStoreObjectAcks(ResponseBody);
+        },
+        [BatchAcks, SuccessCallback]()
+        {
+            FNakamaStoreObjectAcks Acks = MoveTemp((*BatchAcks)[0]);
+            for (int32 BatchIndex = 1; BatchIndex < BatchAcks->Num(); ++BatchIndex)
             {
-                if (SuccessCallback) { SuccessCallback(FNakamaStoreObjectAcks(ResponseBody)); }
-            },
-            ErrorCallback);
-    },
-    ErrorCallback);
+                Acks.StorageObjects.Append(MoveTemp((*BatchAcks)[BatchIndex].StorageObjects));
+            }
+            if (SuccessCallback) { SuccessCallback(Acks); }
+        },
+        ErrorCallback);
 }
 
 void UNakamaClient::ReadStorageObjects(
@@ -5481,9 +5486,7 @@ void UNakamaClient::ReadStorageObjects(
     const TFunction<void(const FNakamaStorageObjectList& StorageObjectList)>& SuccessCallback,
     const TFunction<void(const FNakamaError& Error)>& ErrorCallback)
 {
-     TWeakObjectPtr<UNakamaClient> WeakThis(this);
-
-     // Setup the endpoint
+    // Setup the endpoint
     const FString Endpoint = TEXT("/v2/storage");
 
     // Verify the session
@@ -5492,8 +5495,8 @@ void UNakamaClient::ReadStorageObjects(
         return;
     }
 
-    // Setup the request body
-    TArray<TSharedPtr<FJsonValue>> ObjectsJson;
+    // Setup the request objects
+    TArray<TSharedPtr<FJsonObject>> ObjectsJson;
     for (const FNakamaReadStorageObjectId& Object : ObjectIds)
     {
         TSharedPtr<FJsonObject> ObjectJson = MakeShareable(new FJsonObject());
@@ -5501,39 +5504,37 @@ void UNakamaClient::ReadStorageObjects(
         ObjectJson->SetStringField(TEXT("key"), Object.Key);
         ObjectJson->SetStringField(TEXT("user_id"), Object.UserId);
 
-        ObjectsJson.Add(MakeShareable(new FJsonValueObject(ObjectJson)));
+        ObjectsJson.Add(ObjectJson);
     }
 
-    TSharedPtr<FJsonObject> RequestBodyJson = MakeShareable(new FJsonObject());
-    RequestBodyJson->SetArrayField(TEXT("object_ids"), ObjectsJson);
-
-    // Serialize the request content
-    FString Content;
-    if (!FNakamaUtils::SerializeJsonObject(RequestBodyJson, Content))
+    // Serialize the request content, split to fit the storage batch limits
+    TArray<FString> Bodies;
+    if (!BuildStorageBatches(TEXT("object_ids"), ObjectsJson, Bodies))
     {
         // Handle JSON serialization failure
         FNakamaUtils::HandleJsonSerializationFailure(ErrorCallback);
         return;
     }
 
-    // Refresh the session token first if it is about to expire, then send.
-    EnsureValidSession(Session,
-        [WeakThis, Session, Endpoint, Content, SuccessCallback, ErrorCallback]()
-    {
-        UNakamaClient* Self = WeakThis.Get();
-        if (!Self)
-        {
-        	return;
-        }
+    // Objects of each request, joined in request order once all are read
+    TSharedRef<TArray<FNakamaStorageObjectList>> BatchLists = MakeShared<TArray<FNakamaStorageObjectList>>();
+    BatchLists->SetNum(Bodies.Num());
 
-        Self->SendJsonRequest(Endpoint, Content, ENakamaRequestMethod::POST, TMultiMap<FString, FString>(), Session->GetAuthToken(),
-            [SuccessCallback](const FString& ResponseBody)
+    SendStorageBatches(Session, Endpoint, ENakamaRequestMethod::POST, Bodies,
+        [BatchLists](int32 BatchIndex, const FString& ResponseBody)
+        {
+            (*BatchLists)[BatchIndex] = FNakamaStorageObjectList(ResponseBody);
+        },
+        [BatchLists, SuccessCallback]()
+        {
+            FNakamaStorageObjectList List = MoveTemp((*BatchLists)[0]);
+            for (int32 BatchIndex = 1; BatchIndex < BatchLists->Num(); ++BatchIndex)
             {
-                if (SuccessCallback) { SuccessCallback(FNakamaStorageObjectList(ResponseBody)); }
-            },
-            ErrorCallback);
-    },
-    ErrorCallback);
+                List.Objects.Append(MoveTemp((*BatchLists)[BatchIndex].Objects));
+            }
+            if (SuccessCallback) { SuccessCallback(List); }
+        },
+        ErrorCallback);
 }
 
 void UNakamaClient::DeleteStorageObjects(
@@ -5542,8 +5543,6 @@ void UNakamaClient::DeleteStorageObjects(
     const TFunction<void()>& SuccessCallback,
     const TFunction<void(const FNakamaError& Error)>& ErrorCallback)
 {
-    TWeakObjectPtr<UNakamaClient> WeakThis(this);
-
     // Setup the endpoint
     const FString Endpoint = TEXT("/v2/storage/delete");
 
@@ -5553,8 +5552,8 @@ void UNakamaClient::DeleteStorageObjects(
         return;
     }
 
-    // Setup the request body
-    TArray<TSharedPtr<FJsonValue>> ObjectsJson;
+    // Setup the request objects
+    TArray<TSharedPtr<FJsonObject>> ObjectsJson;
     for (const FNakamaDeleteStorageObjectId& Object : ObjectIds)
     {
         TSharedPtr<FJsonObject> ObjectJson = MakeShareable(new FJsonObject());
@@ -5562,39 +5561,25 @@ void UNakamaClient::DeleteStorageObjects(
         ObjectJson->SetStringField(TEXT("key"), Object.Key);
         ObjectJson->SetStringField(TEXT("version"), Object.Version);
 
-        ObjectsJson.Add(MakeShareable(new FJsonValueObject(ObjectJson)));
+        ObjectsJson.Add(ObjectJson);
     }
 
-    TSharedPtr<FJsonObject> RequestBodyJson = MakeShareable(new FJsonObject());
-    RequestBodyJson->SetArrayField(TEXT("object_ids"), ObjectsJson);
-
-    // Serialize the request content
-    FString Content;
-    if (!FNakamaUtils::SerializeJsonObject(RequestBodyJson, Content))
+    // Serialize the request content, split to fit the storage batch limits
+    TArray<FString> Bodies;
+    if (!BuildStorageBatches(TEXT("object_ids"), ObjectsJson, Bodies))
     {
         // Handle JSON serialization failure
         FNakamaUtils::HandleJsonSerializationFailure(ErrorCallback);
         return;
     }
 
-    // Refresh the session token first if it is about to expire, then send.
-    EnsureValidSession(Session,
-        [WeakThis, Session, Endpoint, Content, SuccessCallback, ErrorCallback]()
-    {
-        UNakamaClient* Self = WeakThis.Get();
-        if (!Self)
+    SendStorageBatches(Session, Endpoint, ENakamaRequestMethod::PUT, Bodies,
+        nullptr,
+        [SuccessCallback]()
         {
-        	return;
-        }
-
-        Self->SendJsonRequest(Endpoint, Content, ENakamaRequestMethod::PUT, TMultiMap<FString, FString>(), Session->GetAuthToken(),
-            [SuccessCallback](const FString& ResponseBody)
-            {
-                if (SuccessCallback) { SuccessCallback(); }
-            },
-            ErrorCallback);
-    },
-    ErrorCallback);
+            if (SuccessCallback) { SuccessCallback(); }
+        },
+        ErrorCallback);
 }
 
 void UNakamaClient::ListParties (
@@ -5652,7 +5637,7 @@ void UNakamaClient::ListParties (
         Self->SendJsonRequest(Endpoint, TEXT(""), ENakamaRequestMethod::GET, QueryParams, Session->GetAuthToken(),
             [SuccessCallback](const FString& ResponseBody)
             {
-                if (SuccessCallback) { SuccessCallback(FNakamaPartyList(ResponseBody)); }
+                if (SuccessCallback) { FNakamaHttpMetrics::InvokeCallback(SuccessCallback, FNakamaPartyList(ResponseBody)); }
             },
             ErrorCallback);
     },
@@ -5761,6 +5746,150 @@ FNakamaRetryConfiguration UNakamaClient::BuildRetryConfiguration() const
 	return Config;
 }
 
+bool UNakamaClient::BuildStorageBatches(const FString& ArrayField, const TArray<TSharedPtr<FJsonObject>>& Objects, TArray<FString>& OutBodies) const
+{
+	// Objects are serialized once and joined by hand, so every body's size is exact.
+	const FString Prefix = FString::Printf(TEXT("{\"%s\":["), *ArrayField);
+	const FString Suffix = TEXT("]}");
+	const int32 MaxObjects = FMath::Max(StorageBatchMaxObjects, 1);
+	const int32 MaxBytes = StorageBatchMaxBytes > 0 ? StorageBatchMaxBytes : MAX_int32;
+
+	FString Body;
+	int32 BodyObjects = 0;
+	int32 BodyBytes = Prefix.Len() + Suffix.Len();
+	for (const TSharedPtr<FJsonObject>& Object : Objects)
+	{
+		FString ObjectJson;
+		const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> JsonWriter = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&ObjectJson);
+		if (!Object.IsValid() || !FJsonSerializer::Serialize(Object.ToSharedRef(), JsonWriter))
+		{
+			return false;
+		}
+
+		// An object over the byte limit still goes out, alone, for the server to judge.
+		const int32 ObjectBytes = FTCHARToUTF8(*ObjectJson).Length() + 1;
+		if (BodyObjects > 0 && (BodyObjects == MaxObjects || BodyBytes + ObjectBytes > MaxBytes))
+		{
+			OutBodies.Add(Prefix + Body + Suffix);
+			Body.Reset();
+			BodyObjects = 0;
+			BodyBytes = Prefix.Len() + Suffix.Len();
+		}
+
+		if (BodyObjects > 0)
+		{
+			Body += TEXT(",");
+		}
+		Body += ObjectJson;
+		BodyObjects++;
+		BodyBytes += ObjectBytes;
+	}
+
+	// An empty call still sends one (empty) request, as before.
+	OutBodies.Add(Prefix + Body + Suffix);
+	return true;
+}
+
+struct UNakamaClient::FStorageBatchState
+{
+	UNakamaSession* Session = nullptr;
+	FString Endpoint;
+	ENakamaRequestMethod Method = ENakamaRequestMethod::PUT;
+	TArray<FString> Bodies;
+	TFunction<void(int32 BatchIndex, const FString& ResponseBody)> OnBatch;
+	TFunction<void()> OnComplete;
+	TFunction<void(const FNakamaError& Error)> ErrorCallback;
+
+	int32 NextBatch = 0;
+	int32 NumCompleted = 0;
+	bool bFailed = false;
+};
+
+void UNakamaClient::SendStorageBatches(
+	UNakamaSession* Session,
+	const FString& Endpoint,
+	ENakamaRequestMethod Method,
+	const TArray<FString>& Bodies,
+	const TFunction<void(int32 BatchIndex, const FString& ResponseBody)>& OnBatch,
+	const TFunction<void()>& OnComplete,
+	const TFunction<void(const FNakamaError& Error)>& ErrorCallback)
+{
+	const TSharedRef<FStorageBatchState> State = MakeShared<FStorageBatchState>();
+	State->Session = Session;
+	State->Endpoint = Endpoint;
+	State->Method = Method;
+	State->Bodies = Bodies;
+	State->OnBatch = OnBatch;
+	State->OnComplete = OnComplete;
+	State->ErrorCallback = ErrorCallback;
+
+	// Each completed request starts the next one, keeping this many in flight.
+	const int32 NumParallel = FMath::Clamp(StorageBatchMaxParallel, 1, Bodies.Num());
+	for (int32 Index = 0; Index < NumParallel; ++Index)
+	{
+		SendNextStorageBatch(State);
+	}
+}
+
+void UNakamaClient::SendNextStorageBatch(const TSharedRef<FStorageBatchState>& State)
+{
+	if (State->bFailed || State->NextBatch >= State->Bodies.Num())
+	{
+		return;
+	}
+
+	const int32 BatchIndex = State->NextBatch++;
+	TWeakObjectPtr<UNakamaClient> WeakThis(this);
+
+	auto errorCallback = [State, BatchIndex](const FNakamaError& Error)
+	{
+		if (State->bFailed)
+		{
+			return;
+		}
+
+		State->bFailed = true;
+		if (State->Bodies.Num() > 1)
+		{
+			NAKAMA_LOGF_WARN(TEXT("Storage request %d of %d to %s failed, %d completed before it."),
+				BatchIndex + 1, State->Bodies.Num(), *State->Endpoint, State->NumCompleted);
+		}
+		if (State->ErrorCallback) { State->ErrorCallback(Error); }
+	};
+
+	// Refresh the session token first if it is about to expire, then send.
+	EnsureValidSession(State->Session,
+		[WeakThis, State, BatchIndex, errorCallback]()
+	{
+		UNakamaClient* Self = WeakThis.Get();
+		if (!Self || State->bFailed)
+		{
+			return;
+		}
+
+		Self->SendJsonRequest(State->Endpoint, State->Bodies[BatchIndex], State->Method, TMultiMap<FString, FString>(), State->Session->GetAuthToken(),
+			[WeakThis, State, BatchIndex](const FString& ResponseBody)
+			{
+				if (State->bFailed)
+				{
+					return;
+				}
+
+				if (State->OnBatch) { State->OnBatch(BatchIndex, ResponseBody); }
+				if (++State->NumCompleted == State->Bodies.Num())
+				{
+					if (State->OnComplete) { State->OnComplete(); }
+				}
+				else if (UNakamaClient* Sender = WeakThis.Get())
+				{
+					Sender->SendNextStorageBatch(State);
+				}
+			},
+			errorCallback);
+	},
+	errorCallback);
+}
+
 void UNakamaClient::SendJsonRequest(
 	const FString& Endpoint,
 	const FString& Content,
@@ -5771,10 +5900,20 @@ void UNakamaClient::SendJsonRequest(
 	const TFunction<void(const FNakamaError& Error)>& OnError,
 	const TFunction<void(TSharedRef<IHttpRequest, ESPMode::ThreadSafe>&)>& PrepareRequest)
 {
+	NAKAMA_MEMORY_SCOPE(Nakama_Requests, Requests);
+
+	// Per-request metrics record, shared by all attempts (null while metrics are disabled).
+	const TSharedPtr<FNakamaHttpRequestTrace, ESPMode::ThreadSafe> Trace =
+		FNakamaHttpMetrics::Get().BeginRequest(TEXT("Nakama"), FNakamaUtils::ENakamaRequesMethodToFString(Method), Endpoint);
+
+	// Spans the whole request in Insights: attempts, retry delays, parse and callback.
+	const FNakamaTraceRegionPtr Region = NAKAMA_TRACE_REGION_BEGIN(NakamaHttpChannel,
+		FString::Printf(TEXT("Nakama %s %s"), *FNakamaUtils::ENakamaRequesMethodToFString(Method), *FNakamaHttpMetrics::NormalizeEndpoint(Endpoint)));
+
 	// One attempt: build a FRESH request (UE requests are single-use), bind, fire.
 	TWeakObjectPtr<UNakamaClient> WeakThis(this);
 	FNakamaSendFn Send =
-		[WeakThis, Endpoint, Content, Method, QueryParams, AuthToken, PrepareRequest]
+		[WeakThis, Endpoint, Content, Method, QueryParams, AuthToken, PrepareRequest, Trace]
 		(TFunction<void(ENakamaRequestOutcome, int32, const FString&)> OnComplete)
 	{
 		UNakamaClient* Self = WeakThis.Get();
@@ -5785,6 +5924,8 @@ void UNakamaClient::SendJsonRequest(
 			return;
 		}
 
+		NAKAMA_MEMORY_SCOPE(Nakama_Requests, Requests);
+
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest =
 			Self->MakeRequest(Endpoint, Content, Method, QueryParams, AuthToken);
 		if (PrepareRequest)
@@ -5792,74 +5933,30 @@ void UNakamaClient::SendJsonRequest(
 			PrepareRequest(HttpRequest);
 		}
 
-		{
-			FScopeLock Lock(&Self->ActiveRequestsMutex);
-			Self->ActiveRequests.Add(HttpRequest);
-		}
-
-		HttpRequest->OnProcessRequestComplete().BindLambda(
-			[WeakThis, OnComplete](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
-		{
-			// Always deliver exactly one terminal outcome to OnComplete so the retry
-			// chain (and the caller's success/error callback) can never be silently
-			// dropped. A response is only forwarded when the request was still active.
-			// A cancelled request (removed from ActiveRequests) or a dead client are
-			// expected outcomes, reported as ENakamaRequestOutcome::Cancelled so OnError
-			// does not log them as faults; a genuine transport failure is ConnectionFailure.
-			bool bDeliverResponse = bSuccess && Response.IsValid();
-			bool bCancelled = false;
-			if (UNakamaClient* Self = WeakThis.Get())
-			{
-				if (Self->IsValidLowLevel())
-				{
-					FScopeLock Lock(&Self->ActiveRequestsMutex);
-					if (Self->ActiveRequests.Contains(Request))
-					{
-						Self->ActiveRequests.Remove(Request);
-					}
-					else
-					{
-						bDeliverResponse = false; // cancelled or already reaped
-						bCancelled = true;
-					}
-				}
-				else
-				{
-					bDeliverResponse = false;
-					bCancelled = true; // client mid-destruction
-				}
-			}
-			else
-			{
-				bDeliverResponse = false;
-				bCancelled = true; // client gone
-			}
-
-			if (bDeliverResponse)
-			{
-				OnComplete(ENakamaRequestOutcome::Response, Response->GetResponseCode(), Response->GetContentAsString());
-			}
-			else
+		// Scheduling, cancellation and the terminal outcome are owned by the
+		// shared transport; OnComplete is always called exactly once.
+		// Body parsing happens in the completion, so it is attributed to responses.
+		Self->HttpRequests->Process(HttpRequest,
+			[OnComplete](ENakamaRequestOutcome Outcome, int32 HttpCode, const FString& Body)
 			{
-				OnComplete(bCancelled ? ENakamaRequestOutcome::Cancelled : ENakamaRequestOutcome::ConnectionFailure, 0, FString());
-			}
-		});
-
-		HttpRequest->ProcessRequest();
+				NAKAMA_MEMORY_SCOPE(Nakama_Responses, Responses);
+				OnComplete(Outcome, HttpCode, Body);
+			},
+			Trace);
 	};
 
-	// FTSTicker-based delay: schedule Work after Seconds, once. Work is run
-	// unconditionally (even if the client has since been destroyed) so the
-	// retry attempt always executes and self-terminates through the null-client
-	// path in Send, guaranteeing the caller's OnError fires instead of hanging.
-	FNakamaDelayFn Delay = [](float Seconds, TFunction<void()> Work)
+	// Shared one-shot ticker delay. Work runs even if the client has since been
+	// destroyed, so the retry attempt self-terminates through the null-client
+	// path in Send and the caller's OnError fires instead of hanging.
+	FNakamaDelayFn Delay = [Endpoint](float Seconds, TFunction<void()> Work)
 	{
-		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
-			[Work](float /*DeltaTime*/) -> bool
-			{
-				Work();
-				return false; // one-shot: unregister after firing
-			}), Seconds);
+		const FNakamaTraceRegionPtr DelayRegion = NAKAMA_TRACE_REGION_BEGIN(NakamaHttpChannel,
+			FString::Printf(TEXT("Nakama::Http::RetryDelay %s"), *FNakamaHttpMetrics::NormalizeEndpoint(Endpoint)));
+		FNakamaHttpPipeline::Delay(Seconds, [DelayRegion, Work = MoveTemp(Work)]()
+		{
+			NAKAMA_TRACE_REGION_END(DelayRegion);
+			Work();
+		});
 	};
 
 	// Seed the RNG from the auth token (or endpoint+content for auth calls).
@@ -5867,8 +5964,53 @@ void UNakamaClient::SendJsonRequest(
 		? static_cast<int32>(GetTypeHash(Endpoint + Content))
 		: static_cast<int32>(GetTypeHash(AuthToken));
 
+	if (!Trace.IsValid() && !Region.IsValid())
+	{
+		FNakamaRetryInvoker::InvokeWithRetry(
+			Send, BuildRetryConfiguration(), Seed, Delay, OnSuccess, OnError);
+		return;
+	}
+
+	// Time the completion handler, split at FNakamaHttpMetrics::InvokeCallback
+	// into body parsing and the caller's callback, then close the request
+	// record and trace region once it returns.
+	auto TracedSuccess = [Trace, Region, OnSuccess](const FString& Body)
+	{
+		const double HandlerStart = FPlatformTime::Seconds();
+		const double OuterCallbackStart = FNakamaHttpMetrics::ExchangeCallbackStart(0.0);
+		if (OnSuccess)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR("Nakama::Http::Callback", NakamaHttpChannel);
+			OnSuccess(Body);
+		}
+		const double HandlerEnd = FPlatformTime::Seconds();
+		// Handlers that parse nothing never mark the split; all their time is callback time.
+		const double CallbackStart = FNakamaHttpMetrics::ExchangeCallbackStart(OuterCallbackStart);
+		const double ParseEnd = CallbackStart > 0.0 ? CallbackStart : HandlerStart;
+		if (Trace.IsValid())
+		{
+			FNakamaHttpMetrics::Get().RecordRequest(*Trace, true, false, ParseEnd - HandlerStart, HandlerEnd - ParseEnd);
+		}
+		NAKAMA_TRACE_REGION_END(Region);
+	};
+	auto TracedError = [Trace, Region, OnError](const FNakamaError& Error)
+	{
+		const double HandlerStart = FPlatformTime::Seconds();
+		if (OnError)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR("Nakama::Http::Callback", NakamaHttpChannel);
+			OnError(Error);
+		}
+		if (Trace.IsValid())
+		{
+			// The error body was parsed by the retry invoker, so all of this is callback time.
+			FNakamaHttpMetrics::Get().RecordRequest(*Trace, false, Error.Code == ENakamaErrorCode::Cancelled, 0.0, FPlatformTime::Seconds() - HandlerStart);
+		}
+		NAKAMA_TRACE_REGION_END(Region);
+	};
+
 	FNakamaRetryInvoker::InvokeWithRetry(
-		Send, BuildRetryConfiguration(), Seed, Delay, OnSuccess, OnError);
+		Send, BuildRetryConfiguration(), Seed, Delay, TracedSuccess, TracedError);
 }
 
 bool UNakamaClient::IsClientValid() const
@@ -5909,7 +6051,7 @@ bool UNakamaClient::SendRPC(UNakamaSession* Session, const FString& Id, const TO
         Self->SendJsonRequest(Endpoint, EscapedPayload, ENakamaRequestMethod::POST, QueryParams, SessionToken,
             [SuccessCallback](const FString& ResponseBody)
             {
-                if (SuccessCallback) { SuccessCallback(FNakamaRPC(ResponseBody)); }
+                if (SuccessCallback) { FNakamaHttpMetrics::InvokeCallback(SuccessCallback, FNakamaRPC(ResponseBody)); }
             },
             ErrorCallback);
     }
@@ -5921,7 +6063,7 @@ bool UNakamaClient::SendRPC(UNakamaSession* Session, const FString& Id, const TO
         Self->SendJsonRequest(Endpoint, TEXT(""), ENakamaRequestMethod::GET, QueryParams, SessionToken,
             [SuccessCallback](const FString& ResponseBody)
             {
-                if (SuccessCallback) { SuccessCallback(FNakamaRPC(ResponseBody)); }
+                if (SuccessCallback) { FNakamaHttpMetrics::InvokeCallback(SuccessCallback, FNakamaRPC(ResponseBody)); }
             },
             ErrorCallback);
     }
@@ -5963,7 +6105,7 @@ bool UNakamaClient::SendRPCm(UNakamaSession* Session, const FString& Id, const T
         SendJsonRequest(Endpoint, EscapedPayload, ENakamaRequestMethod::POST, QueryParams, SessionToken,
             [SuccessCallback](const FString& ResponseBody)
             {
-                if (SuccessCallback) { SuccessCallback(FNakamaRPC(ResponseBody)); }
+                if (SuccessCallback) { FNakamaHttpMetrics::InvokeCallback(SuccessCallback, FNakamaRPC(ResponseBody)); }
             },
             ErrorCallback);
     }
@@ -5975,7 +6117,7 @@ bool UNakamaClient::SendRPCm(UNakamaSession* Session, const FString& Id, const T
         SendJsonRequest(Endpoint, TEXT(""), ENakamaRequestMethod::GET, QueryParams, SessionToken,
             [SuccessCallback](const FString& ResponseBody)
             {
-                if (SuccessCallback) { SuccessCallback(FNakamaRPC(ResponseBody)); }
+                if (SuccessCallback) { FNakamaHttpMetrics::InvokeCallback(SuccessCallback, FNakamaRPC(ResponseBody)); }
             },
             ErrorCallback);
     }
@@ -5989,23 +6131,8 @@ void UNakamaClient::CancelAllRequests()
 		return;
 	}
 
-	// Take ownership of the in-flight set under the lock, then release it before
-	// cancelling so a synchronous completion callback can re-enter the lock safely.
-	TArray<FHttpRequestPtr> ToCancel;
-	{
-		FScopeLock Lock(&ActiveRequestsMutex);
-		ToCancel = MoveTemp(ActiveRequests);
-		ActiveRequests.Empty();
-	}
-
-	// Cancel each request. We deliberately do NOT unbind the completion delegate:
-	// CancelRequest drives it with bSuccess=false, and since the request is no
-	// longer in ActiveRequests the completion handler resolves it as a transport
-	// failure, delivering a terminal OnError instead of silently dropping the
-	// caller's callback.
-	for (const FHttpRequestPtr& Request : ToCancel)
-	{
-		Request->CancelRequest();
-	}
+	// Queued and in-flight requests of this client resolve as Cancelled,
+	// delivering a terminal OnError instead of silently dropping callbacks.
+	HttpRequests->CancelAll();
 }
 
@@ -0,0 +1,651 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaFriendGraph.h"
+#include "NakamaClient.h"
+#include "NakamaRealtimeClient.h"
+#include "NakamaSession.h"
+#include "NakamaStatus.h"
+#include "NakamaUtils.h"
+#include "NakamaLoggingMacros.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	// Same shape as a ListFriends entry so the saved file parses as an FNakamaFriendList.
+	// Online is left out: it is stale by the next launch and comes back from status events.
+	TSharedPtr<FJsonObject> FriendToJson(const FNakamaFriend& Friend)
+	{
+		const FNakamaUser& User = Friend.NakamaUser;
+		TSharedPtr<FJsonObject> UserJson = MakeShared<FJsonObject>();
+		UserJson->SetStringField(TEXT("id"), User.Id);
+		UserJson->SetStringField(TEXT("username"), User.Username);
+		UserJson->SetStringField(TEXT("display_name"), User.DisplayName);
+		UserJson->SetStringField(TEXT("avatar_url"), User.AvatarUrl);
+		UserJson->SetStringField(TEXT("lang_tag"), User.Language);
+		UserJson->SetStringField(TEXT("location"), User.Location);
+		UserJson->SetStringField(TEXT("timezone"), User.TimeZone);
+		UserJson->SetStringField(TEXT("metadata"), User.MetaData);
+		UserJson->SetStringField(TEXT("facebook_id"), User.FacebookId);
+		UserJson->SetStringField(TEXT("google_id"), User.GoogleId);
+		UserJson->SetStringField(TEXT("gamecenter_id"), User.GameCenterId);
+		UserJson->SetStringField(TEXT("apple_id"), User.AppleId);
+		UserJson->SetStringField(TEXT("steam_id"), User.SteamId);
+		UserJson->SetNumberField(TEXT("edge_count"), User.EdgeCount);
+		UserJson->SetStringField(TEXT("create_time"), User.CreatedAt.ToIso8601());
+		UserJson->SetStringField(TEXT("update_time"), User.updatedAt.ToIso8601());
+
+		TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+		JsonObject->SetObjectField(TEXT("user"), UserJson);
+		JsonObject->SetNumberField(TEXT("state"), static_cast<int32>(Friend.UserState));
+		JsonObject->SetStringField(TEXT("update_time"), Friend.UpdateTime.ToIso8601());
+		return JsonObject;
+	}
+
+	FNakamaFriend MakeFriend(const FString& UserId, ENakamaFriendState State)
+	{
+		FNakamaFriend Friend;
+		Friend.NakamaUser.Id = UserId;
+		Friend.UserState = State;
+		return Friend;
+	}
+}
+
+UNakamaFriendGraph* UNakamaFriendGraph::CreateFriendGraph(UNakamaClient* Client)
+{
+	UNakamaFriendGraph* Graph = NewObject<UNakamaFriendGraph>();
+	Graph->Client = Client;
+	return Graph;
+}
+
+void UNakamaFriendGraph::BindRealtimeClient(UNakamaRealtimeClient* RealtimeClient)
+{
+	if (UNakamaRealtimeClient* Previous = BoundRealtimeClient.Get())
+	{
+		Previous->PresenceStatusReceivedNative.Remove(RealtimeHandles[0]);
+		Previous->ConnectedEventNative.Remove(RealtimeHandles[1]);
+		Previous->DisconnectedEventNative.Remove(RealtimeHandles[2]);
+	}
+	RealtimeHandles.Reset();
+	BoundRealtimeClient = RealtimeClient;
+	FollowedIds.Reset();
+	LivePresences.Reset();
+
+	if (RealtimeClient)
+	{
+		RealtimeHandles.Add(RealtimeClient->PresenceStatusReceivedNative.AddUObject(this, &UNakamaFriendGraph::HandleStatusPresence));
+		RealtimeHandles.Add(RealtimeClient->ConnectedEventNative.AddUObject(this, &UNakamaFriendGraph::HandleConnected));
+		RealtimeHandles.Add(RealtimeClient->DisconnectedEventNative.AddUObject(this, &UNakamaFriendGraph::HandleDisconnected));
+		FollowFriends();
+	}
+}
+
+void UNakamaFriendGraph::Refresh(
+	UNakamaSession* Session,
+	const TFunction<void(int32 NumFriends)>& SuccessCallback,
+	const TFunction<void(const FNakamaError& Error)>& ErrorCallback)
+{
+	if (!FNakamaUtils::IsClientActive(Client))
+	{
+		if (ErrorCallback) { ErrorCallback(FNakamaUtils::HandleInvalidClient()); }
+		return;
+	}
+
+	if (InFlightRefresh.IsValid())
+	{
+		InFlightRefresh->OnSuccess.Add(SuccessCallback);
+		InFlightRefresh->OnError.Add(ErrorCallback);
+		return;
+	}
+
+	InFlightRefresh = MakeShared<FPendingRefresh>();
+	InFlightRefresh->OnSuccess.Add(SuccessCallback);
+	InFlightRefresh->OnError.Add(ErrorCallback);
+
+	RefreshPage(Session, FString());
+}
+
+void UNakamaFriendGraph::RefreshPage(UNakamaSession* Session, const FString& Cursor)
+{
+	TWeakObjectPtr<UNakamaFriendGraph> WeakThis(this);
+	const int32 RequestGeneration = Generation;
+
+	// No state filter, so one walk covers friends, invites and blocks.
+	Client->ListFriends(Session, PageSize, {}, Cursor,
+		[WeakThis, Session, RequestGeneration](const FNakamaFriendList& Page)
+		{
+			UNakamaFriendGraph* Self = WeakThis.Get();
+			if (!Self || Self->Generation != RequestGeneration || !Self->InFlightRefresh.IsValid())
+			{
+				return;
+			}
+
+			FPendingRefresh& PendingRefresh = *Self->InFlightRefresh;
+			PendingRefresh.NumPages++;
+			for (const FNakamaFriend& Friend : Page.NakamaUsers)
+			{
+				PendingRefresh.Friends.Add(Friend.NakamaUser.Id, Friend);
+			}
+
+			if (!Page.Cursor.IsEmpty() && PendingRefresh.NumPages < FMath::Max(Self->MaxPages, 1))
+			{
+				Self->RefreshPage(Session, Page.Cursor);
+				return;
+			}
+
+			if (!Page.Cursor.IsEmpty())
+			{
+				NAKAMA_LOGF_WARN(TEXT("Friend graph: stopped after %d pages, later relationships are missing."), PendingRefresh.NumPages);
+			}
+			Self->FinishRefresh(nullptr);
+		},
+		[WeakThis, RequestGeneration](const FNakamaError& Error)
+		{
+			UNakamaFriendGraph* Self = WeakThis.Get();
+			if (Self && Self->Generation == RequestGeneration)
+			{
+				Self->FinishRefresh(&Error);
+			}
+		});
+}
+
+void UNakamaFriendGraph::FinishRefresh(const FNakamaError* Error)
+{
+	const TSharedPtr<FPendingRefresh> PendingRefresh = MoveTemp(InFlightRefresh);
+	if (!PendingRefresh.IsValid())
+	{
+		return;
+	}
+
+	if (Error)
+	{
+		for (const TFunction<void(const FNakamaError&)>& Cb : PendingRefresh->OnError)
+		{
+			if (Cb) { Cb(*Error); }
+		}
+		return;
+	}
+
+	Friends = MoveTemp(PendingRefresh->Friends);
+	for (TPair<FString, FNakamaFriend>& Pair : Friends)
+	{
+		ApplyLiveStatus(Pair.Value);
+	}
+	bLoaded = true;
+	NotifyChanged();
+	FollowFriends();
+
+	for (const TFunction<void(int32)>& Cb : PendingRefresh->OnSuccess)
+	{
+		if (Cb) { Cb(Friends.Num()); }
+	}
+}
+
+void UNakamaFriendGraph::AddFriends(
+	UNakamaSession* Session,
+	const TArray<FString>& UserIds,
+	const TArray<FString>& Usernames,
+	const TFunction<void()>& SuccessCallback,
+	const TFunction<void(const FNakamaError& Error)>& ErrorCallback)
+{
+	if (!FNakamaUtils::IsClientActive(Client))
+	{
+		if (ErrorCallback) { ErrorCallback(FNakamaUtils::HandleInvalidClient()); }
+		return;
+	}
+
+	TWeakObjectPtr<UNakamaFriendGraph> WeakThis(this);
+	const int32 RequestGeneration = Generation;
+	Client->AddFriends(Session, UserIds, Usernames, [WeakThis, Session, UserIds, Usernames, SuccessCallback, RequestGeneration]()
+	{
+		UNakamaFriendGraph* Self = WeakThis.Get();
+		if (Self && Self->Generation == RequestGeneration)
+		{
+			// Adding accepts a received invite, otherwise it sends one.
+			Self->Reconcile(Session, UserIds, Usernames, [Self](const FString& Id, FNakamaFriend* Existing)
+			{
+				if (!Existing)
+				{
+					Self->Friends.Add(Id, MakeFriend(Id, ENakamaFriendState::INVITE_SENT));
+				}
+				else if (Existing->UserState == ENakamaFriendState::INVITE_RECEIVED)
+				{
+					Existing->UserState = ENakamaFriendState::FRIEND;
+					Existing->UpdateTime = FDateTime::UtcNow();
+				}
+				else if (Existing->UserState == ENakamaFriendState::BLOCKED)
+				{
+					Existing->UserState = ENakamaFriendState::INVITE_SENT;
+					Existing->UpdateTime = FDateTime::UtcNow();
+				}
+			});
+			Self->FollowFriends();
+		}
+		if (SuccessCallback) { SuccessCallback(); }
+	}, ErrorCallback);
+}
+
+void UNakamaFriendGraph::DeleteFriends(
+	UNakamaSession* Session,
+	const TArray<FString>& UserIds,
+	const TArray<FString>& Usernames,
+	const TFunction<void()>& SuccessCallback,
+	const TFunction<void(const FNakamaError& Error)>& ErrorCallback)
+{
+	if (!FNakamaUtils::IsClientActive(Client))
+	{
+		if (ErrorCallback) { ErrorCallback(FNakamaUtils::HandleInvalidClient()); }
+		return;
+	}
+
+	TWeakObjectPtr<UNakamaFriendGraph> WeakThis(this);
+	const int32 RequestGeneration = Generation;
+	Client->DeleteFriends(Session, UserIds, Usernames, [WeakThis, Session, UserIds, Usernames, SuccessCallback, RequestGeneration]()
+	{
+		UNakamaFriendGraph* Self = WeakThis.Get();
+		if (Self && Self->Generation == RequestGeneration)
+		{
+			TArray<FString> Unfollow;
+			Self->Reconcile(Session, UserIds, Usernames, [Self, &Unfollow](const FString& Id, FNakamaFriend* Existing)
+			{
+				Self->Friends.Remove(Id);
+				Self->LivePresences.Remove(Id);
+				if (Self->FollowedIds.Remove(Id) > 0)
+				{
+					Unfollow.Add(Id);
+				}
+			});
+
+			UNakamaRealtimeClient* RealtimeClient = Self->BoundRealtimeClient.Get();
+			if (RealtimeClient && Unfollow.Num() > 0)
+			{
+				RealtimeClient->UnfollowUsers(Unfollow, nullptr, nullptr);
+			}
+		}
+		if (SuccessCallback) { SuccessCallback(); }
+	}, ErrorCallback);
+}
+
+void UNakamaFriendGraph::BlockFriends(
+	UNakamaSession* Session,
+	const TArray<FString>& UserIds,
+	const TArray<FString>& Usernames,
+	const TFunction<void()>& SuccessCallback,
+	const TFunction<void(const FNakamaError& Error)>& ErrorCallback)
+{
+	if (!FNakamaUtils::IsClientActive(Client))
+	{
+		if (ErrorCallback) { ErrorCallback(FNakamaUtils::HandleInvalidClient()); }
+		return;
+	}
+
+	TWeakObjectPtr<UNakamaFriendGraph> WeakThis(this);
+	const int32 RequestGeneration = Generation;
+	Client->BlockFriends(Session, UserIds, Usernames, [WeakThis, Session, UserIds, Usernames, SuccessCallback, RequestGeneration]()
+	{
+		UNakamaFriendGraph* Self = WeakThis.Get();
+		if (Self && Self->Generation == RequestGeneration)
+		{
+			Self->Reconcile(Session, UserIds, Usernames, [Self](const FString& Id, FNakamaFriend* Existing)
+			{
+				if (!Existing)
+				{
+					Self->Friends.Add(Id, MakeFriend(Id, ENakamaFriendState::BLOCKED));
+				}
+				else
+				{
+					Existing->UserState = ENakamaFriendState::BLOCKED;
+					Existing->UpdateTime = FDateTime::UtcNow();
+				}
+			});
+		}
+		if (SuccessCallback) { SuccessCallback(); }
+	}, ErrorCallback);
+}
+
+void UNakamaFriendGraph::Reconcile(
+	UNakamaSession* Session,
+	const TArray<FString>& UserIds,
+	const TArray<FString>& Usernames,
+	TFunctionRef<void(const FString& Id, FNakamaFriend* Existing)> Apply)
+{
+	TArray<FString> Ids = UserIds;
+	bool bMissingUsername = false;
+	for (const FString& Username : Usernames)
+	{
+		bool bFound = false;
+		for (const TPair<FString, FNakamaFriend>& Pair : Friends)
+		{
+			if (Pair.Value.NakamaUser.Username == Username)
+			{
+				Ids.AddUnique(Pair.Key);
+				bFound = true;
+				break;
+			}
+		}
+		bMissingUsername |= !bFound;
+	}
+
+	for (const FString& Id : Ids)
+	{
+		Apply(Id, Friends.Find(Id));
+	}
+	NotifyChanged();
+
+	// Only the server knows which user an unfamiliar username belongs to.
+	if (bMissingUsername)
+	{
+		Refresh(Session, nullptr, nullptr);
+	}
+}
+
+void UNakamaFriendGraph::FollowFriends()
+{
+	UNakamaRealtimeClient* RealtimeClient = BoundRealtimeClient.Get();
+	if (!RealtimeClient || !RealtimeClient->IsConnected())
+	{
+		return;
+	}
+
+	TArray<FString> Ids;
+	for (const TPair<FString, FNakamaFriend>& Pair : Friends)
+	{
+		if (Pair.Value.UserState == ENakamaFriendState::FRIEND && !FollowedIds.Contains(Pair.Key))
+		{
+			Ids.Add(Pair.Key);
+		}
+	}
+
+	const int32 BatchSize = FMath::Max(MaxFollowBatchSize, 1);
+	TWeakObjectPtr<UNakamaFriendGraph> WeakThis(this);
+	const int32 RequestGeneration = Generation;
+	for (int32 Start = 0; Start < Ids.Num(); Start += BatchSize)
+	{
+		TArray<FString> Batch(Ids.GetData() + Start, FMath::Min(BatchSize, Ids.Num() - Start));
+		FollowedIds.Append(Batch);
+
+		RealtimeClient->FollowUsers(Batch,
+			[WeakThis, RequestGeneration](const FNakamaStatus& Status)
+			{
+				UNakamaFriendGraph* Self = WeakThis.Get();
+				if (Self && Self->Generation == RequestGeneration)
+				{
+					Self->ApplyStatus(Status);
+				}
+			},
+			[WeakThis, Batch, RequestGeneration](const FNakamaRtError& Error)
+			{
+				NAKAMA_LOGF_WARN(TEXT("Friend graph: following %d friends failed: %s"), Batch.Num(), *Error.Message);
+				UNakamaFriendGraph* Self = WeakThis.Get();
+				if (Self && Self->Generation == RequestGeneration)
+				{
+					// Retried by the next FollowFriends.
+					for (const FString& Id : Batch)
+					{
+						Self->FollowedIds.Remove(Id);
+					}
+				}
+			});
+	}
+}
+
+TArray<FNakamaFriend> UNakamaFriendGraph::GetFriends(ENakamaFriendState State) const
+{
+	TArray<FNakamaFriend> Result;
+	Result.Reserve(Friends.Num());
+	for (const TPair<FString, FNakamaFriend>& Pair : Friends)
+	{
+		if (State == ENakamaFriendState::ALL || Pair.Value.UserState == State)
+		{
+			Result.Add(Pair.Value);
+		}
+	}
+
+	Result.Sort([](const FNakamaFriend& A, const FNakamaFriend& B)
+	{
+		const int32 Order = A.NakamaUser.Username.Compare(B.NakamaUser.Username, ESearchCase::IgnoreCase);
+		return Order != 0 ? Order < 0 : A.NakamaUser.Id < B.NakamaUser.Id;
+	});
+	return Result;
+}
+
+bool UNakamaFriendGraph::FindFriend(const FString& InUserId, FNakamaFriend& OutFriend) const
+{
+	if (const FNakamaFriend* Friend = Friends.Find(InUserId))
+	{
+		OutFriend = *Friend;
+		return true;
+	}
+	return false;
+}
+
+FString UNakamaFriendGraph::GetStatus(const FString& InUserId) const
+{
+	const TArray<FNakamaUserPresence>* Presences = LivePresences.Find(InUserId);
+	return Presences && Presences->Num() > 0 ? Presences->Last().Status : FString();
+}
+
+void UNakamaFriendGraph::ApplyLiveStatus(FNakamaFriend& Friend) const
+{
+	if (const TArray<FNakamaUserPresence>* Presences = LivePresences.Find(Friend.NakamaUser.Id))
+	{
+		Friend.NakamaUser.Online = Presences->Num() > 0;
+	}
+}
+
+void UNakamaFriendGraph::ApplyStatus(const FNakamaStatus& Status)
+{
+	FNakamaStatusPresenceEvent Event;
+	Event.Joins = Status.Presences;
+	HandleStatusPresence(Event);
+}
+
+void UNakamaFriendGraph::HandleStatusPresence(const FNakamaStatusPresenceEvent& Event)
+{
+	bool bChanged = false;
+
+	// Leaves first, so a status update (leave and join of the same session) ends up joined.
+	for (const FNakamaUserPresence& Presence : Event.Leaves)
+	{
+		if (TArray<FNakamaUserPresence>* Presences = LivePresences.Find(Presence.UserID))
+		{
+			bChanged |= Presences->RemoveAll([&Presence](const FNakamaUserPresence& Live)
+			{
+				return Live.SessionID == Presence.SessionID;
+			}) > 0;
+		}
+	}
+
+	for (const FNakamaUserPresence& Presence : Event.Joins)
+	{
+		TArray<FNakamaUserPresence>& Presences = LivePresences.FindOrAdd(Presence.UserID);
+		Presences.RemoveAll([&Presence](const FNakamaUserPresence& Live)
+		{
+			return Live.SessionID == Presence.SessionID;
+		});
+		Presences.Add(Presence);
+		bChanged = true;
+	}
+
+	if (!bChanged)
+	{
+		return;
+	}
+
+	for (const FNakamaUserPresence& Presence : Event.Leaves)
+	{
+		if (FNakamaFriend* Friend = Friends.Find(Presence.UserID))
+		{
+			ApplyLiveStatus(*Friend);
+		}
+	}
+	for (const FNakamaUserPresence& Presence : Event.Joins)
+	{
+		if (FNakamaFriend* Friend = Friends.Find(Presence.UserID))
+		{
+			ApplyLiveStatus(*Friend);
+		}
+	}
+
+	// Status is not persisted, so there is nothing to save.
+	ChangedEvent.Broadcast();
+}
+
+void UNakamaFriendGraph::HandleConnected()
+{
+	// Follows belong to the socket session, so a new connection starts over.
+	FollowedIds.Reset();
+	FollowFriends();
+}
+
+void UNakamaFriendGraph::HandleDisconnected(const FNakamaDisconnectInfo& Info)
+{
+	FollowedIds.Reset();
+	LivePresences.Reset();
+	for (TPair<FString, FNakamaFriend>& Pair : Friends)
+	{
+		Pair.Value.NakamaUser.Online = false;
+	}
+	ChangedEvent.Broadcast();
+}
+
+void UNakamaFriendGraph::NotifyChanged()
+{
+	if (bAutoSave)
+	{
+		Save();
+	}
+	ChangedEvent.Broadcast();
+}
+
+FString UNakamaFriendGraph::GetSaveFilePath() const
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Nakama"), FString::Printf(TEXT("Friends_%s.json"), *FPaths::MakeValidFileName(UserId)));
+}
+
+bool UNakamaFriendGraph::Load(const FString& InUserId)
+{
+	if (!UserId.IsEmpty() && InUserId != UserId)
+	{
+		ResetForUser();
+	}
+	UserId = InUserId;
+	if (UserId.IsEmpty())
+	{
+		return false;
+	}
+
+	FString Content;
+	if (!FFileHelper::LoadFileToString(Content, *GetSaveFilePath()))
+	{
+		return false;
+	}
+
+	if (!FNakamaUtils::DeserializeJsonObject(Content).IsValid())
+	{
+		NAKAMA_LOG_WARN(TEXT("Discarding unreadable saved friend graph."));
+		return false;
+	}
+
+	// A refresh that already finished is newer than the saved copy.
+	if (!bLoaded)
+	{
+		const FNakamaFriendList Saved(Content);
+		for (const FNakamaFriend& Friend : Saved.NakamaUsers)
+		{
+			FNakamaFriend& Added = Friends.Add(Friend.NakamaUser.Id, Friend);
+			ApplyLiveStatus(Added);
+		}
+		bLoaded = true;
+		FollowFriends();
+	}
+
+	ChangedEvent.Broadcast();
+	return true;
+}
+
+bool UNakamaFriendGraph::Save() const
+{
+	if (UserId.IsEmpty())
+	{
+		return false;
+	}
+
+	TArray<TSharedPtr<FJsonValue>> FriendsJson;
+	FriendsJson.Reserve(Friends.Num());
+	for (const TPair<FString, FNakamaFriend>& Pair : Friends)
+	{
+		FriendsJson.Add(MakeShared<FJsonValueObject>(FriendToJson(Pair.Value)));
+	}
+
+	const TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+	JsonObject->SetArrayField(TEXT("friends"), FriendsJson);
+
+	FString Content;
+	if (!FNakamaUtils::SerializeJsonObject(JsonObject, Content))
+	{
+		return false;
+	}
+	return FFileHelper::SaveStringToFile(Content, *GetSaveFilePath());
+}
+
+void UNakamaFriendGraph::ResetForUser()
+{
+	// The previous user's friends stay followed on the socket until told otherwise.
+	UNakamaRealtimeClient* RealtimeClient = BoundRealtimeClient.Get();
+	if (RealtimeClient && RealtimeClient->IsConnected() && FollowedIds.Num() > 0)
+	{
+		const TArray<FString> Ids = FollowedIds.Array();
+		const int32 BatchSize = FMath::Max(MaxFollowBatchSize, 1);
+		for (int32 Start = 0; Start < Ids.Num(); Start += BatchSize)
+		{
+			RealtimeClient->UnfollowUsers(TArray<FString>(Ids.GetData() + Start, FMath::Min(BatchSize, Ids.Num() - Start)), nullptr, nullptr);
+		}
+	}
+
+	// Start from nothing so the previous user's relationships can never be
+	// saved under the new user's file.
+	Generation++;
+	Friends.Empty();
+	LivePresences.Reset();
+	FollowedIds.Reset();
+	bLoaded = false;
+
+	const TSharedPtr<FPendingRefresh> PendingRefresh = MoveTemp(InFlightRefresh);
+	if (PendingRefresh.IsValid())
+	{
+		FNakamaError Error;
+		Error.Message = TEXT("The friend graph was loaded for another user.");
+		for (const TFunction<void(const FNakamaError&)>& Cb : PendingRefresh->OnError)
+		{
+			if (Cb) { Cb(Error); }
+		}
+	}
+}
+
+void UNakamaFriendGraph::Clear()
+{
+	Friends.Empty();
+	bLoaded = false;
+	NotifyChanged();
+}
+
+void UNakamaFriendGraph::BeginDestroy()
+{
+	BindRealtimeClient(nullptr);
+	Super::BeginDestroy();
+}
@@ -0,0 +1,164 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaJsonMergePatch.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+	bool ContainsNull(const TSharedPtr<FJsonValue>& Value)
+	{
+		if (!Value.IsValid() || Value->IsNull())
+		{
+			return true;
+		}
+
+		const TSharedPtr<FJsonObject>* Object = nullptr;
+		if (Value->TryGetObject(Object))
+		{
+			for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : (*Object)->Values)
+			{
+				if (ContainsNull(Field.Value))
+				{
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+	TSharedPtr<FJsonValue> ParseValue(const FString& Json)
+	{
+		TSharedPtr<FJsonValue> Value;
+		const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+		return FJsonSerializer::Deserialize(Reader, Value) ? Value : nullptr;
+	}
+
+	FString WriteValue(const TSharedPtr<FJsonValue>& Value)
+	{
+		FString Json;
+		const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Json);
+		FJsonSerializer::Serialize(Value, FString(), Writer);
+		return Json;
+	}
+}
+
+bool FNakamaJsonMergePatch::Create(const FString& Original, const FString& Modified, FString& OutPatch)
+{
+	const TSharedPtr<FJsonValue> OriginalValue = ParseValue(Original);
+	const TSharedPtr<FJsonValue> ModifiedValue = ParseValue(Modified);
+	const TSharedPtr<FJsonObject>* OriginalObject = nullptr;
+	const TSharedPtr<FJsonObject>* ModifiedObject = nullptr;
+	if (!OriginalValue.IsValid() || !OriginalValue->TryGetObject(OriginalObject) ||
+		!ModifiedValue.IsValid() || !ModifiedValue->TryGetObject(ModifiedObject))
+	{
+		return false;
+	}
+
+	bool bExpressible = true;
+	const TSharedPtr<FJsonObject> Patch = Create(**OriginalObject, **ModifiedObject, bExpressible);
+	if (!bExpressible)
+	{
+		return false;
+	}
+
+	OutPatch = WriteValue(MakeShared<FJsonValueObject>(Patch));
+	return true;
+}
+
+TSharedPtr<FJsonObject> FNakamaJsonMergePatch::Create(const FJsonObject& Original, const FJsonObject& Modified, bool& bOutExpressible)
+{
+	const TSharedPtr<FJsonObject> Patch = MakeShared<FJsonObject>();
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Original.Values)
+	{
+		if (!Modified.HasField(Field.Key))
+		{
+			Patch->SetField(Field.Key, MakeShared<FJsonValueNull>());
+		}
+	}
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Modified.Values)
+	{
+		const TSharedPtr<FJsonValue> Old = Original.TryGetField(Field.Key);
+		if (Old.IsValid() && Field.Value.IsValid() && FJsonValue::CompareEqual(*Old, *Field.Value))
+		{
+			continue;
+		}
+
+		const TSharedPtr<FJsonObject>* OldObject = nullptr;
+		const TSharedPtr<FJsonObject>* NewObject = nullptr;
+		if (Old.IsValid() && Old->TryGetObject(OldObject) && Field.Value.IsValid() && Field.Value->TryGetObject(NewObject))
+		{
+			Patch->SetObjectField(Field.Key, Create(**OldObject, **NewObject, bOutExpressible));
+			continue;
+		}
+
+		// Nulls in a patch delete members, so a value holding one cannot be sent as is.
+		bOutExpressible &= !ContainsNull(Field.Value);
+		Patch->SetField(Field.Key, Field.Value);
+	}
+
+	return Patch;
+}
+
+TSharedPtr<FJsonValue> FNakamaJsonMergePatch::Apply(const TSharedPtr<FJsonValue>& Target, const TSharedPtr<FJsonValue>& Patch)
+{
+	const TSharedPtr<FJsonObject>* PatchObject = nullptr;
+	if (!Patch.IsValid() || !Patch->TryGetObject(PatchObject))
+	{
+		return Patch;
+	}
+
+	const TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	const TSharedPtr<FJsonObject>* TargetObject = nullptr;
+	if (Target.IsValid() && Target->TryGetObject(TargetObject))
+	{
+		Result->Values = (*TargetObject)->Values;
+	}
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : (*PatchObject)->Values)
+	{
+		if (!Field.Value.IsValid() || Field.Value->IsNull())
+		{
+			Result->RemoveField(Field.Key);
+		}
+		else
+		{
+			Result->SetField(Field.Key, Apply(Result->TryGetField(Field.Key), Field.Value));
+		}
+	}
+
+	return MakeShared<FJsonValueObject>(Result);
+}
+
+bool FNakamaJsonMergePatch::Apply(const FString& Target, const FString& Patch, FString& OutResult)
+{
+	const TSharedPtr<FJsonValue> TargetValue = ParseValue(Target);
+	const TSharedPtr<FJsonValue> PatchValue = ParseValue(Patch);
+	if (!TargetValue.IsValid() || !PatchValue.IsValid())
+	{
+		return false;
+	}
+
+	OutResult = WriteValue(Apply(TargetValue, PatchValue));
+	return true;
+}
@@ -0,0 +1,399 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaLeaderboardView.h"
+#include "NakamaClient.h"
+#include "NakamaSession.h"
+#include "NakamaUtils.h"
+#include "NakamaHttpPipeline.h"
+
+UNakamaLeaderboardView* UNakamaLeaderboardView::CreateLeaderboardView(UNakamaClient* Client, const FString& LeaderboardId, int32 PageSize)
+{
+	UNakamaLeaderboardView* View = NewObject<UNakamaLeaderboardView>();
+	View->Client = Client;
+	View->LeaderboardId = LeaderboardId;
+	View->PageSize = FMath::Max(PageSize, 1);
+	return View;
+}
+
+void UNakamaLeaderboardView::ListPage(
+	UNakamaSession* Session,
+	const FString& Cursor,
+	const TFunction<void(const FNakamaLeaderboardRecordList& Page)>& SuccessCallback,
+	const TFunction<void(const FNakamaError& Error)>& ErrorCallback)
+{
+	const FString Key = PageKey(Cursor);
+
+	// Served from the rank store, so changes applied since the fetch show up.
+	TWeakObjectPtr<UNakamaLeaderboardView> WeakThis(this);
+	auto Respond = [WeakThis, Key, SuccessCallback]()
+	{
+		UNakamaLeaderboardView* Self = WeakThis.Get();
+		const FSlice* Slice = Self ? Self->Slices.Find(Key) : nullptr;
+		if (!Slice || !SuccessCallback)
+		{
+			return;
+		}
+
+		FNakamaLeaderboardRecordList Page;
+		Page.Records = Self->GetRecords(Slice->FirstRank, Slice->LastRank);
+		Page.NextCursor = Slice->NextCursor;
+		Page.PrevCursor = Slice->PrevCursor;
+		SuccessCallback(Page);
+	};
+
+	const FSlice* Cached = Slices.Find(Key);
+	if (Cached && IsFresh(*Cached))
+	{
+		Respond();
+		return;
+	}
+
+	FSlice Slice;
+	Slice.Cursor = Cursor;
+	FetchSlice(Session, Slice, Respond, ErrorCallback);
+}
+
+void UNakamaLeaderboardView::ListAroundOwner(
+	UNakamaSession* Session,
+	const FString& OwnerId,
+	const TFunction<void(const TArray<FNakamaLeaderboardRecord>& Records)>& SuccessCallback,
+	const TFunction<void(const FNakamaError& Error)>& ErrorCallback)
+{
+	const FString Key = OwnerKey(OwnerId);
+
+	TWeakObjectPtr<UNakamaLeaderboardView> WeakThis(this);
+	auto Respond = [WeakThis, Key, SuccessCallback]()
+	{
+		UNakamaLeaderboardView* Self = WeakThis.Get();
+		const FSlice* Slice = Self ? Self->Slices.Find(Key) : nullptr;
+		if (Slice && SuccessCallback)
+		{
+			SuccessCallback(Self->GetRecords(Slice->FirstRank, Slice->LastRank));
+		}
+	};
+
+	const FSlice* Cached = Slices.Find(Key);
+	if (Cached && IsFresh(*Cached))
+	{
+		Respond();
+		return;
+	}
+
+	FSlice Slice;
+	Slice.OwnerId = OwnerId;
+	FetchSlice(Session, Slice, Respond, ErrorCallback);
+}
+
+void UNakamaLeaderboardView::WriteRecord(
+	UNakamaSession* Session,
+	int64 Score,
+	const TOptional<int64>& SubScore,
+	const TOptional<FString>& Metadata,
+	const TFunction<void(const FNakamaLeaderboardRecord& Record)>& SuccessCallback,
+	const TFunction<void(const FNakamaError& Error)>& ErrorCallback)
+{
+	if (!FNakamaUtils::IsClientActive(Client))
+	{
+		if (ErrorCallback) { ErrorCallback(FNakamaUtils::HandleInvalidClient()); }
+		return;
+	}
+
+	TWeakObjectPtr<UNakamaLeaderboardView> WeakThis(this);
+	auto successCallback = [WeakThis, SuccessCallback](const FNakamaLeaderboardRecord& Record)
+	{
+		if (UNakamaLeaderboardView* Self = WeakThis.Get())
+		{
+			Self->ApplyOwnRecord(Record);
+		}
+		if (SuccessCallback) { SuccessCallback(Record); }
+	};
+
+	Client->WriteLeaderboardRecord(Session, LeaderboardId, Score, SubScore, Metadata, successCallback, ErrorCallback);
+}
+
+void UNakamaLeaderboardView::SetVisibleRange(UNakamaSession* Session, int64 FirstRank, int64 LastRank)
+{
+	RefreshSession = Session;
+	VisibleFirstRank = FirstRank;
+	VisibleLastRank = LastRank;
+	ScheduleRefresh();
+}
+
+void UNakamaLeaderboardView::RefreshVisibleRange()
+{
+	if (VisibleLastRank < VisibleFirstRank || !IsValid(RefreshSession))
+	{
+		return;
+	}
+
+	for (const TPair<FString, FSlice>& Pair : Slices)
+	{
+		const FSlice& Slice = Pair.Value;
+		if (Slice.LastRank >= VisibleFirstRank && Slice.FirstRank <= VisibleLastRank)
+		{
+			FetchSlice(RefreshSession, Slice, nullptr, nullptr);
+		}
+	}
+}
+
+TArray<FNakamaLeaderboardRecord> UNakamaLeaderboardView::GetRecords(int64 FirstRank, int64 LastRank) const
+{
+	TArray<FNakamaLeaderboardRecord> Records;
+	for (const TPair<int64, FNakamaLeaderboardRecord>& Pair : Ranks)
+	{
+		if (Pair.Key > LastRank)
+		{
+			break;
+		}
+		if (Pair.Key >= FirstRank)
+		{
+			Records.Add(Pair.Value);
+		}
+	}
+	return Records;
+}
+
+bool UNakamaLeaderboardView::FindRecord(const FString& OwnerId, FNakamaLeaderboardRecord& OutRecord) const
+{
+	const int64* Rank = OwnerRanks.Find(OwnerId);
+	const FNakamaLeaderboardRecord* Record = Rank ? Ranks.Find(*Rank) : nullptr;
+	if (!Record)
+	{
+		return false;
+	}
+	OutRecord = *Record;
+	return true;
+}
+
+void UNakamaLeaderboardView::Clear()
+{
+	Ranks.Empty();
+	OwnerRanks.Empty();
+	Slices.Empty();
+	ChangedEvent.Broadcast();
+}
+
+bool UNakamaLeaderboardView::IsFresh(const FSlice& Slice) const
+{
+	return FPlatformTime::Seconds() - Slice.FetchTime < PageTimeToLiveSeconds;
+}
+
+void UNakamaLeaderboardView::FetchSlice(
+	UNakamaSession* Session,
+	const FSlice& Slice,
+	const TFunction<void()>& OnDone,
+	const TFunction<void(const FNakamaError& Error)>& OnError)
+{
+	const FString Key = Slice.OwnerId.IsEmpty() ? PageKey(Slice.Cursor) : OwnerKey(Slice.OwnerId);
+
+	FPendingFetch* Pending = PendingFetches.Find(Key);
+	const bool bInFlight = Pending != nullptr;
+	if (!Pending)
+	{
+		Pending = &PendingFetches.Add(Key);
+	}
+	if (OnDone) { Pending->OnDone.Add(OnDone); }
+	if (OnError) { Pending->OnError.Add(OnError); }
+	if (bInFlight)
+	{
+		return;
+	}
+
+	TWeakObjectPtr<UNakamaLeaderboardView> WeakThis(this);
+	auto successCallback = [WeakThis, Key, Slice](const FNakamaLeaderboardRecordList& List)
+	{
+		UNakamaLeaderboardView* Self = WeakThis.Get();
+		if (!Self)
+		{
+			return;
+		}
+
+		FPendingFetch Waiters;
+		Self->PendingFetches.RemoveAndCopyValue(Key, Waiters);
+
+		FSlice Fetched = Slice;
+		Fetched.NextCursor = List.NextCursor;
+		Fetched.PrevCursor = List.PrevCursor;
+		Self->MergeSlice(Key, MoveTemp(Fetched), List.Records);
+
+		for (const TFunction<void()>& OnDone : Waiters.OnDone)
+		{
+			OnDone();
+		}
+	};
+
+	auto errorCallback = [WeakThis, Key](const FNakamaError& Error)
+	{
+		UNakamaLeaderboardView* Self = WeakThis.Get();
+		if (!Self)
+		{
+			return;
+		}
+
+		FPendingFetch Waiters;
+		Self->PendingFetches.RemoveAndCopyValue(Key, Waiters);
+		for (const TFunction<void(const FNakamaError&)>& OnError : Waiters.OnError)
+		{
+			OnError(Error);
+		}
+	};
+
+	if (!FNakamaUtils::IsClientActive(Client))
+	{
+		errorCallback(FNakamaUtils::HandleInvalidClient());
+		return;
+	}
+
+	NumRequests++;
+	if (Slice.OwnerId.IsEmpty())
+	{
+		const TOptional<FString> Cursor = Slice.Cursor.IsEmpty() ? TOptional<FString>() : TOptional<FString>(Slice.Cursor);
+		Client->ListLeaderboardRecords(Session, LeaderboardId, {}, PageSize, Cursor, successCallback, errorCallback);
+	}
+	else
+	{
+		Client->ListLeaderboardRecordsAroundOwner(Session, LeaderboardId, Slice.OwnerId, PageSize, successCallback, errorCallback);
+	}
+}
+
+void UNakamaLeaderboardView::MergeSlice(const FString& Key, FSlice Slice, const TArray<FNakamaLeaderboardRecord>& Records)
+{
+	Slice.FetchTime = FPlatformTime::Seconds();
+	Slice.FirstRank = 0;
+	Slice.LastRank = -1;
+	for (const FNakamaLeaderboardRecord& Record : Records)
+	{
+		if (Record.Rank > 0)
+		{
+			Slice.FirstRank = Slice.LastRank < Slice.FirstRank ? Record.Rank : FMath::Min(Slice.FirstRank, Record.Rank);
+			Slice.LastRank = FMath::Max(Slice.LastRank, Record.Rank);
+		}
+	}
+
+	// Rows in the covered ranks that the response did not return have moved or gone.
+	TArray<int64> Stale;
+	for (const TPair<int64, FNakamaLeaderboardRecord>& Pair : Ranks)
+	{
+		if (Pair.Key > Slice.LastRank)
+		{
+			break;
+		}
+		if (Pair.Key >= Slice.FirstRank)
+		{
+			Stale.Add(Pair.Key);
+		}
+	}
+	for (const int64 Rank : Stale)
+	{
+		FNakamaLeaderboardRecord Removed;
+		if (Ranks.RemoveAndCopyValue(Rank, Removed) && OwnerRanks.FindRef(Removed.OwnerId) == Rank)
+		{
+			OwnerRanks.Remove(Removed.OwnerId);
+		}
+	}
+
+	for (const FNakamaLeaderboardRecord& Record : Records)
+	{
+		if (Record.Rank <= 0)
+		{
+			continue;
+		}
+
+		// An owner seen at another rank in an older slice has moved since.
+		if (const int64* OldRank = OwnerRanks.Find(Record.OwnerId))
+		{
+			Ranks.Remove(*OldRank);
+		}
+		Ranks.Add(Record.Rank, Record);
+		OwnerRanks.Add(Record.OwnerId, Record.Rank);
+	}
+
+	Slices.Add(Key, MoveTemp(Slice));
+	ChangedEvent.Broadcast();
+}
+
+void UNakamaLeaderboardView::ApplyOwnRecord(const FNakamaLeaderboardRecord& Record)
+{
+	const int64* OldRankPtr = OwnerRanks.Find(Record.OwnerId);
+	const int64 OldRank = OldRankPtr ? *OldRankPtr : 0;
+	const int64 NewRank = Record.Rank > 0 ? Record.Rank : OldRank;
+	if (NewRank <= 0)
+	{
+		return; // not cached and no rank to place it at
+	}
+
+	if (NewRank != OldRank)
+	{
+		// Rows between the old and new rank move by one to make room.
+		TArray<FNakamaLeaderboardRecord> Rows;
+		Rows.Reserve(Ranks.Num());
+		for (const TPair<int64, FNakamaLeaderboardRecord>& Pair : Ranks)
+		{
+			if (Pair.Value.OwnerId == Record.OwnerId)
+			{
+				continue;
+			}
+
+			FNakamaLeaderboardRecord& Row = Rows.Add_GetRef(Pair.Value);
+			if (OldRank <= 0)
+			{
+				Row.Rank += Row.Rank >= NewRank ? 1 : 0;
+			}
+			else if (NewRank < OldRank)
+			{
+				Row.Rank += (Row.Rank >= NewRank && Row.Rank < OldRank) ? 1 : 0;
+			}
+			else
+			{
+				Row.Rank -= (Row.Rank > OldRank && Row.Rank <= NewRank) ? 1 : 0;
+			}
+		}
+
+		Ranks.Empty(Rows.Num() + 1);
+		OwnerRanks.Empty(Rows.Num() + 1);
+		for (FNakamaLeaderboardRecord& Row : Rows)
+		{
+			OwnerRanks.Add(Row.OwnerId, Row.Rank);
+			Ranks.Add(Row.Rank, MoveTemp(Row));
+		}
+	}
+
+	FNakamaLeaderboardRecord& Own = Ranks.Add(NewRank, Record);
+	Own.Rank = NewRank;
+	OwnerRanks.Add(Record.OwnerId, NewRank);
+	ChangedEvent.Broadcast();
+}
+
+void UNakamaLeaderboardView::ScheduleRefresh()
+{
+	if (bRefreshScheduled || RefreshIntervalSeconds <= 0.0f || VisibleLastRank < VisibleFirstRank)
+	{
+		return;
+	}
+
+	bRefreshScheduled = true;
+	TWeakObjectPtr<UNakamaLeaderboardView> WeakThis(this);
+	FNakamaHttpPipeline::Delay(RefreshIntervalSeconds, [WeakThis]()
+	{
+		if (UNakamaLeaderboardView* Self = WeakThis.Get())
+		{
+			Self->bRefreshScheduled = false;
+			Self->RefreshVisibleRange();
+			Self->ScheduleRefresh();
+		}
+	});
+}
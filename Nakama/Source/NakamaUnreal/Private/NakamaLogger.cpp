@@ -31,80 +31,6 @@ void UNakamaLogger::SetLogLevel(ENakamaLogLevel InLogLevel)
 	CurrentLogLevel = InLogLevel;
 }
 
-bool UNakamaLogger::IsLoggable(ENakamaLogLevel InLogLevel)
-{
-	// Logging Disabled check
-	if (!bLoggingEnabled)
-		return false;
-
-	// Debug
-	if(CurrentLogLevel == ENakamaLogLevel::Debug)
-	{
-		if(InLogLevel == ENakamaLogLevel::Debug)
-			return true;
-
-		if(InLogLevel == ENakamaLogLevel::Info)
-			return true;
-
-		if(InLogLevel == ENakamaLogLevel::Warn)
-			return true;
-
-		if(InLogLevel == ENakamaLogLevel::Error)
-			return true;
-
-		if(InLogLevel == ENakamaLogLevel::Fatal)
-			return true;
-	}
-
-	// Info
-	if(CurrentLogLevel == ENakamaLogLevel::Info)
-	{
-		if(InLogLevel == ENakamaLogLevel::Info)
-			return true;
-
-		if(InLogLevel == ENakamaLogLevel::Warn)
-			return true;
-
-		if(InLogLevel == ENakamaLogLevel::Error)
-			return true;
-
-		if(InLogLevel == ENakamaLogLevel::Fatal)
-			return true;
-	}
-
-	// Warn
-	if(CurrentLogLevel == ENakamaLogLevel::Warn)
-	{
-		if(InLogLevel == ENakamaLogLevel::Warn)
-			return true;
-
-		if(InLogLevel == ENakamaLogLevel::Error)
-			return true;
-
-		if(InLogLevel == ENakamaLogLevel::Fatal)
-			return true;
-	}
-
-	// Error
-	if(CurrentLogLevel == ENakamaLogLevel::Error)
-	{
-		if(InLogLevel == ENakamaLogLevel::Error)
-			return true;
-
-		if(InLogLevel == ENakamaLogLevel::Fatal)
-			return true;
-	}
-
-	// Fatal
-	if(CurrentLogLevel == ENakamaLogLevel::Fatal)
-	{
-		if(InLogLevel == ENakamaLogLevel::Fatal)
-			return true;
-	}
-
-	return false;
-}
-
 void UNakamaLogger::Log(ENakamaLogLevel InLogLevel, const FString& Message)
 {
 	if (IsLoggable(InLogLevel))
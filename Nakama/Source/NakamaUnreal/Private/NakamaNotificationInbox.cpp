@@ -0,0 +1,528 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaNotificationInbox.h"
+#include "NakamaClient.h"
+#include "NakamaRealtimeClient.h"
+#include "NakamaSession.h"
+#include "NakamaUtils.h"
+#include "NakamaLoggingMacros.h"
+#include "NakamaHttpPipeline.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	TSharedPtr<FJsonObject> NotificationToJson(const FNakamaNotification& Notification)
+	{
+		TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+		JsonObject->SetStringField(TEXT("id"), Notification.Id);
+		JsonObject->SetStringField(TEXT("subject"), Notification.Subject);
+		JsonObject->SetStringField(TEXT("content"), Notification.Content);
+		JsonObject->SetNumberField(TEXT("code"), Notification.Code);
+		JsonObject->SetStringField(TEXT("sender_id"), Notification.SenderId);
+		JsonObject->SetStringField(TEXT("create_time"), Notification.CreateTime.ToIso8601());
+		JsonObject->SetBoolField(TEXT("persistent"), Notification.Persistent);
+		return JsonObject;
+	}
+
+	bool IsNewer(const FNakamaNotification& A, const FNakamaNotification& B)
+	{
+		return A.CreateTime != B.CreateTime ? A.CreateTime > B.CreateTime : A.Id > B.Id;
+	}
+}
+
+UNakamaNotificationInbox* UNakamaNotificationInbox::CreateNotificationInbox(UNakamaClient* Client)
+{
+	UNakamaNotificationInbox* Inbox = NewObject<UNakamaNotificationInbox>();
+	Inbox->Client = Client;
+	return Inbox;
+}
+
+void UNakamaNotificationInbox::BindRealtimeClient(UNakamaRealtimeClient* RealtimeClient)
+{
+	if (UNakamaRealtimeClient* Previous = BoundRealtimeClient.Get())
+	{
+		Previous->NotificationReceivedNative.Remove(NotificationHandle);
+	}
+	NotificationHandle.Reset();
+	BoundRealtimeClient = RealtimeClient;
+
+	if (RealtimeClient)
+	{
+		NotificationHandle = RealtimeClient->NotificationReceivedNative.AddUObject(this, &UNakamaNotificationInbox::HandleNotifications);
+	}
+}
+
+void UNakamaNotificationInbox::Sync(
+	UNakamaSession* Session,
+	const TFunction<void(int32 NumAdded)>& SuccessCallback,
+	const TFunction<void(const FNakamaError& Error)>& ErrorCallback)
+{
+	if (!FNakamaUtils::IsClientActive(Client))
+	{
+		if (ErrorCallback) { ErrorCallback(FNakamaUtils::HandleInvalidClient()); }
+		return;
+	}
+
+	if (InFlightSync.IsValid())
+	{
+		InFlightSync->OnSuccess.Add(SuccessCallback);
+		InFlightSync->OnError.Add(ErrorCallback);
+		return;
+	}
+
+	InFlightSync = MakeShared<FPendingSync>();
+	InFlightSync->OnSuccess.Add(SuccessCallback);
+	InFlightSync->OnError.Add(ErrorCallback);
+
+	SyncPage(Session);
+}
+
+void UNakamaNotificationInbox::SyncPage(UNakamaSession* Session)
+{
+	TWeakObjectPtr<UNakamaNotificationInbox> WeakThis(this);
+	const FString Cursor = CacheableCursor;
+	const int32 RequestGeneration = Generation;
+
+	// The cacheable cursor lists forward from the newest notification already seen.
+	Client->ListNotifications(Session, PageSize, Cursor.IsEmpty() ? TOptional<FString>() : TOptional<FString>(Cursor),
+		[WeakThis, Session, Cursor, RequestGeneration](const FNakamaNotificationList& Page)
+		{
+			UNakamaNotificationInbox* Self = WeakThis.Get();
+			if (!Self || Self->Generation != RequestGeneration || !Self->InFlightSync.IsValid())
+			{
+				return;
+			}
+
+			FPendingSync& PendingSync = *Self->InFlightSync;
+			PendingSync.NumPages++;
+			PendingSync.NumAdded += Self->MergeNotifications(Page.Notifications, true);
+
+			// An empty page comes back without a cursor; keep the one we have.
+			if (!Page.CacheableCursor.IsEmpty())
+			{
+				Self->CacheableCursor = Page.CacheableCursor;
+			}
+
+			const bool bMore = Page.Notifications.Num() >= FMath::Max(Self->PageSize, 1) && Self->CacheableCursor != Cursor;
+			if (bMore && PendingSync.NumPages < FMath::Max(Self->MaxSyncPages, 1))
+			{
+				Self->SyncPage(Session);
+				return;
+			}
+
+			Self->FinishSync(nullptr);
+		},
+		[WeakThis, RequestGeneration](const FNakamaError& Error)
+		{
+			UNakamaNotificationInbox* Self = WeakThis.Get();
+			if (Self && Self->Generation == RequestGeneration)
+			{
+				Self->FinishSync(&Error);
+			}
+		});
+}
+
+void UNakamaNotificationInbox::FinishSync(const FNakamaError* Error)
+{
+	const TSharedPtr<FPendingSync> PendingSync = MoveTemp(InFlightSync);
+	if (!PendingSync.IsValid())
+	{
+		return;
+	}
+
+	if (PendingSync->NumAdded > 0)
+	{
+		NotifyChanged();
+	}
+	else if (bAutoSave)
+	{
+		// The cursor may have moved even if nothing new was kept.
+		Save();
+	}
+
+	if (Error)
+	{
+		for (const TFunction<void(const FNakamaError&)>& Cb : PendingSync->OnError)
+		{
+			if (Cb) { Cb(*Error); }
+		}
+		return;
+	}
+
+	for (const TFunction<void(int32)>& Cb : PendingSync->OnSuccess)
+	{
+		if (Cb) { Cb(PendingSync->NumAdded); }
+	}
+}
+
+void UNakamaNotificationInbox::DeleteNotifications(
+	UNakamaSession* Session,
+	const TArray<FString>& NotificationIds,
+	const TFunction<void()>& SuccessCallback,
+	const TFunction<void(const FNakamaError& Error)>& ErrorCallback)
+{
+	if (!FNakamaUtils::IsClientActive(Client))
+	{
+		if (ErrorCallback) { ErrorCallback(FNakamaUtils::HandleInvalidClient()); }
+		return;
+	}
+
+	FPendingDelete Pending;
+	Pending.OnSuccess = SuccessCallback;
+	Pending.OnError = ErrorCallback;
+	for (const FString& Id : NotificationIds)
+	{
+		if (DeletingIds.Contains(Id))
+		{
+			continue;
+		}
+
+		FNakamaNotification Removed;
+		if (Notifications.RemoveAndCopyValue(Id, Removed))
+		{
+			Pending.Removed.Add(MoveTemp(Removed));
+		}
+		DeletingIds.Add(Id);
+		Pending.Ids.Add(Id);
+	}
+
+	if (Pending.Removed.Num() > 0)
+	{
+		NotifyChanged();
+	}
+
+	DeleteSession = Session;
+	QueuedDeleteIds.Append(Pending.Ids);
+	QueuedDeletes.Add(MoveTemp(Pending));
+
+	if (QueuedDeleteIds.Num() >= MaxDeleteBatchSize || DeleteBatchWindowSeconds <= 0.0f)
+	{
+		FlushDeletes();
+		return;
+	}
+
+	if (!bDeleteFlushScheduled)
+	{
+		bDeleteFlushScheduled = true;
+		TWeakObjectPtr<UNakamaNotificationInbox> WeakThis(this);
+		FNakamaHttpPipeline::Delay(DeleteBatchWindowSeconds, [WeakThis]()
+		{
+			if (UNakamaNotificationInbox* Self = WeakThis.Get())
+			{
+				Self->FlushDeletes();
+			}
+		});
+	}
+}
+
+void UNakamaNotificationInbox::FlushDeletes()
+{
+	// A pending timer that fires after an early flush finds nothing queued.
+	bDeleteFlushScheduled = false;
+
+	TArray<FPendingDelete> Deletes = MoveTemp(QueuedDeletes);
+	TArray<FString> Ids = MoveTemp(QueuedDeleteIds);
+	QueuedDeletes.Reset();
+	QueuedDeleteIds.Reset();
+	if (Deletes.Num() == 0)
+	{
+		return;
+	}
+
+	// Calls finish together once every request of the flush has answered.
+	struct FFlush
+	{
+		TArray<FPendingDelete> Deletes;
+		TSet<FString> FailedIds;
+		FNakamaError Error;
+		int32 Remaining = 0;
+	};
+	const TSharedRef<FFlush> Flush = MakeShared<FFlush>();
+	Flush->Deletes = MoveTemp(Deletes);
+
+	TWeakObjectPtr<UNakamaNotificationInbox> WeakThis(this);
+	const int32 RequestGeneration = Generation;
+	auto Finish = [WeakThis, Flush, RequestGeneration]()
+	{
+		// Failed deletes of a previous user are not restored into the current one.
+		UNakamaNotificationInbox* Self = WeakThis.Get();
+		if (Self && Self->Generation != RequestGeneration)
+		{
+			Self = nullptr;
+		}
+		bool bRestored = false;
+		for (const FPendingDelete& Delete : Flush->Deletes)
+		{
+			bool bFailed = false;
+			for (const FString& Id : Delete.Ids)
+			{
+				bFailed |= Flush->FailedIds.Contains(Id);
+				if (Self)
+				{
+					Self->DeletingIds.Remove(Id);
+				}
+			}
+
+			if (!bFailed)
+			{
+				if (Delete.OnSuccess) { Delete.OnSuccess(); }
+				continue;
+			}
+
+			if (Self)
+			{
+				for (const FNakamaNotification& Notification : Delete.Removed)
+				{
+					if (Flush->FailedIds.Contains(Notification.Id))
+					{
+						Self->Notifications.Add(Notification.Id, Notification);
+						bRestored = true;
+					}
+				}
+			}
+			if (Delete.OnError) { Delete.OnError(Flush->Error); }
+		}
+
+		if (Self && bRestored)
+		{
+			Self->NotifyChanged();
+		}
+	};
+
+	if (Ids.Num() == 0)
+	{
+		Finish();
+		return;
+	}
+
+	const int32 BatchSize = FMath::Max(MaxDeleteBatchSize, 1);
+	Flush->Remaining = FMath::DivideAndRoundUp(Ids.Num(), BatchSize);
+	for (int32 Start = 0; Start < Ids.Num(); Start += BatchSize)
+	{
+		TArray<FString> Batch(Ids.GetData() + Start, FMath::Min(BatchSize, Ids.Num() - Start));
+
+		auto successCallback = [Flush, Finish]()
+		{
+			if (--Flush->Remaining == 0)
+			{
+				Finish();
+			}
+		};
+
+		auto errorCallback = [Flush, Finish, Batch](const FNakamaError& Error)
+		{
+			if (Flush->FailedIds.Num() == 0)
+			{
+				Flush->Error = Error;
+			}
+			Flush->FailedIds.Append(Batch);
+			if (--Flush->Remaining == 0)
+			{
+				Finish();
+			}
+		};
+
+		Client->DeleteNotifications(DeleteSession, Batch, successCallback, errorCallback);
+	}
+}
+
+void UNakamaNotificationInbox::AddNotifications(const TArray<FNakamaNotification>& Incoming)
+{
+	if (MergeNotifications(Incoming, true) > 0)
+	{
+		NotifyChanged();
+	}
+}
+
+TArray<FNakamaNotification> UNakamaNotificationInbox::GetNotifications() const
+{
+	TArray<FNakamaNotification> Result;
+	Notifications.GenerateValueArray(Result);
+	Result.Sort(&IsNewer);
+	return Result;
+}
+
+bool UNakamaNotificationInbox::FindNotification(const FString& NotificationId, FNakamaNotification& OutNotification) const
+{
+	if (const FNakamaNotification* Notification = Notifications.Find(NotificationId))
+	{
+		OutNotification = *Notification;
+		return true;
+	}
+	return false;
+}
+
+int32 UNakamaNotificationInbox::MergeNotifications(const TArray<FNakamaNotification>& Incoming, bool bReportNew)
+{
+	TArray<FNakamaNotification> Added;
+	for (const FNakamaNotification& Notification : Incoming)
+	{
+		if (Notification.Id.IsEmpty() || DeletingIds.Contains(Notification.Id) || Notifications.Contains(Notification.Id))
+		{
+			continue;
+		}
+		Notifications.Add(Notification.Id, Notification);
+		Added.Add(Notification);
+	}
+
+	if (Added.Num() == 0)
+	{
+		return 0;
+	}
+
+	TrimToCapacity();
+	if (bReportNew)
+	{
+		ReceivedEvent.Broadcast(Added);
+	}
+	return Added.Num();
+}
+
+void UNakamaNotificationInbox::TrimToCapacity()
+{
+	const int32 Capacity = FMath::Max(MaxNotifications, 1);
+	if (Notifications.Num() <= Capacity)
+	{
+		return;
+	}
+
+	TArray<FNakamaNotification> Sorted = GetNotifications();
+	for (int32 Index = Capacity; Index < Sorted.Num(); ++Index)
+	{
+		Notifications.Remove(Sorted[Index].Id);
+	}
+}
+
+void UNakamaNotificationInbox::HandleNotifications(const FNakamaNotificationList& List)
+{
+	AddNotifications(List.Notifications);
+}
+
+void UNakamaNotificationInbox::NotifyChanged()
+{
+	if (bAutoSave)
+	{
+		Save();
+	}
+	ChangedEvent.Broadcast();
+}
+
+FString UNakamaNotificationInbox::GetSaveFilePath() const
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Nakama"), FString::Printf(TEXT("Notifications_%s.json"), *FPaths::MakeValidFileName(UserId)));
+}
+
+bool UNakamaNotificationInbox::Load(const FString& InUserId)
+{
+	if (!UserId.IsEmpty() && InUserId != UserId)
+	{
+		ResetForUser();
+	}
+	UserId = InUserId;
+	if (UserId.IsEmpty())
+	{
+		return false;
+	}
+
+	FString Content;
+	if (!FFileHelper::LoadFileToString(Content, *GetSaveFilePath()))
+	{
+		return false;
+	}
+
+	if (!FNakamaUtils::DeserializeJsonObject(Content).IsValid())
+	{
+		NAKAMA_LOG_WARN(TEXT("Discarding unreadable saved notification inbox."));
+		return false;
+	}
+
+	// Saved notifications were already reported in an earlier run.
+	const FNakamaNotificationList Saved(Content);
+	MergeNotifications(Saved.Notifications, false);
+	if (CacheableCursor.IsEmpty())
+	{
+		CacheableCursor = Saved.CacheableCursor;
+	}
+
+	ChangedEvent.Broadcast();
+	return true;
+}
+
+bool UNakamaNotificationInbox::Save() const
+{
+	if (UserId.IsEmpty())
+	{
+		return false;
+	}
+
+	TArray<TSharedPtr<FJsonValue>> NotificationsJson;
+	NotificationsJson.Reserve(Notifications.Num());
+	for (const TPair<FString, FNakamaNotification>& Pair : Notifications)
+	{
+		NotificationsJson.Add(MakeShared<FJsonValueObject>(NotificationToJson(Pair.Value)));
+	}
+
+	// Same shape as a ListNotifications response, so Load can parse it as one.
+	const TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+	JsonObject->SetArrayField(TEXT("notifications"), NotificationsJson);
+	JsonObject->SetStringField(TEXT("cacheable_cursor"), CacheableCursor);
+
+	FString Content;
+	if (!FNakamaUtils::SerializeJsonObject(JsonObject, Content))
+	{
+		return false;
+	}
+	return FFileHelper::SaveStringToFile(Content, *GetSaveFilePath());
+}
+
+void UNakamaNotificationInbox::ResetForUser()
+{
+	// Queued deletes still go out with the previous user's session.
+	FlushDeletes();
+
+	// Start from nothing so the previous user's notifications and cursor can
+	// never be saved under the new user's file.
+	Generation++;
+	Notifications.Empty();
+	CacheableCursor.Reset();
+	DeletingIds.Empty();
+
+	const TSharedPtr<FPendingSync> PendingSync = MoveTemp(InFlightSync);
+	if (PendingSync.IsValid())
+	{
+		FNakamaError Error;
+		Error.Message = TEXT("The inbox was loaded for another user.");
+		for (const TFunction<void(const FNakamaError&)>& Cb : PendingSync->OnError)
+		{
+			if (Cb) { Cb(Error); }
+		}
+	}
+}
+
+void UNakamaNotificationInbox::Clear()
+{
+	Notifications.Empty();
+	CacheableCursor.Reset();
+	NotifyChanged();
+}
+
+void UNakamaNotificationInbox::BeginDestroy()
+{
+	BindRealtimeClient(nullptr);
+	Super::BeginDestroy();
+}
@@ -0,0 +1,185 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaPagers.h"
+#include "NakamaClient.h"
+#include "NakamaSession.h"
+#include "NakamaUtils.h"
+
+namespace
+{
+	// Wraps a client list request as a pager fetch. Request receives the live
+	// client, the live session and the page cursor; the client and session are
+	// held weakly.
+	template <typename ListType, typename RequestFn>
+	TSharedRef<TNakamaPager<ListType, FNakamaError>> MakePager(UNakamaClient* Client, UNakamaSession* Session, const FString& StartCursor, RequestFn Request)
+	{
+		using FPager = TNakamaPager<ListType, FNakamaError>;
+		TWeakObjectPtr<UNakamaClient> WeakClient(Client);
+		TWeakObjectPtr<UNakamaSession> WeakSession(Session);
+
+		return FPager::Create(
+			[WeakClient, WeakSession, Request](const FString& Cursor, const typename FPager::FPageCallback& OnPage, const typename FPager::FErrorCallback& OnError)
+			{
+				UNakamaClient* LiveClient = WeakClient.Get();
+				if (!FNakamaUtils::IsClientActive(LiveClient))
+				{
+					OnError(FNakamaUtils::HandleInvalidClient());
+					return;
+				}
+				UNakamaSession* LiveSession = WeakSession.Get();
+				if (!LiveSession)
+				{
+					OnError(FNakamaUtils::HandleInvalidSession());
+					return;
+				}
+				Request(LiveClient, LiveSession, Cursor, OnPage, OnError);
+			},
+			StartCursor);
+	}
+
+	TOptional<FString> OptionalCursor(const FString& Cursor)
+	{
+		return Cursor.IsEmpty() ? TOptional<FString>() : TOptional<FString>(Cursor);
+	}
+}
+
+TSharedRef<FNakamaFriendPager> FNakamaPagers::ListFriends(
+	UNakamaClient* Client,
+	UNakamaSession* Session,
+	const TOptional<int32>& Limit,
+	TOptional<ENakamaFriendState> State)
+{
+	return MakePager<FNakamaFriendList>(Client, Session, FString(), [Limit, State](UNakamaClient* LiveClient, UNakamaSession* LiveSession, const FString& Cursor, const auto& OnPage, const auto& OnError)
+	{
+		LiveClient->ListFriends(LiveSession, Limit, State, Cursor, OnPage, OnError);
+	});
+}
+
+TSharedRef<FNakamaGroupPager> FNakamaPagers::ListGroups(
+	UNakamaClient* Client,
+	UNakamaSession* Session,
+	const FString& Name,
+	int32 Limit)
+{
+	return MakePager<FNakamaGroupList>(Client, Session, FString(), [Name, Limit](UNakamaClient* LiveClient, UNakamaSession* LiveSession, const FString& Cursor, const auto& OnPage, const auto& OnError)
+	{
+		LiveClient->ListGroups(LiveSession, Name, Limit, Cursor, OnPage, OnError);
+	});
+}
+
+TSharedRef<FNakamaGroupUserPager> FNakamaPagers::ListGroupUsers(
+	UNakamaClient* Client,
+	UNakamaSession* Session,
+	const FString& GroupId,
+	const TOptional<int32>& Limit,
+	TOptional<ENakamaGroupState> State)
+{
+	return MakePager<FNakamaGroupUsersList>(Client, Session, FString(), [GroupId, Limit, State](UNakamaClient* LiveClient, UNakamaSession* LiveSession, const FString& Cursor, const auto& OnPage, const auto& OnError)
+	{
+		LiveClient->ListGroupUsers(LiveSession, GroupId, Limit, State, Cursor, OnPage, OnError);
+	});
+}
+
+TSharedRef<FNakamaUserGroupPager> FNakamaPagers::ListUserGroups(
+	UNakamaClient* Client,
+	UNakamaSession* Session,
+	const TOptional<int32>& Limit,
+	const TOptional<ENakamaGroupState>& State)
+{
+	return MakePager<FNakamaUserGroupList>(Client, Session, FString(), [Limit, State](UNakamaClient* LiveClient, UNakamaSession* LiveSession, const FString& Cursor, const auto& OnPage, const auto& OnError)
+	{
+		LiveClient->ListUserGroups(LiveSession, Limit, State, Cursor, OnPage, OnError);
+	});
+}
+
+TSharedRef<FNakamaNotificationPager> FNakamaPagers::ListNotifications(
+	UNakamaClient* Client,
+	UNakamaSession* Session,
+	const TOptional<int32>& Limit,
+	const FString& CacheableCursor)
+{
+	return MakePager<FNakamaNotificationList>(Client, Session, CacheableCursor, [Limit](UNakamaClient* LiveClient, UNakamaSession* LiveSession, const FString& Cursor, const auto& OnPage, const auto& OnError)
+	{
+		LiveClient->ListNotifications(LiveSession, Limit, OptionalCursor(Cursor), OnPage, OnError);
+	});
+}
+
+TSharedRef<FNakamaChannelMessagePager> FNakamaPagers::ListChannelMessages(
+	UNakamaClient* Client,
+	UNakamaSession* Session,
+	const FString& ChannelId,
+	const TOptional<int32>& Limit,
+	const TOptional<bool>& Forward)
+{
+	return MakePager<FNakamaChannelMessageList>(Client, Session, FString(), [ChannelId, Limit, Forward](UNakamaClient* LiveClient, UNakamaSession* LiveSession, const FString& Cursor, const auto& OnPage, const auto& OnError)
+	{
+		LiveClient->ListChannelMessages(LiveSession, ChannelId, Limit, OptionalCursor(Cursor), Forward, OnPage, OnError);
+	});
+}
+
+TSharedRef<FNakamaStorageObjectPager> FNakamaPagers::ListStorageObjects(
+	UNakamaClient* Client,
+	UNakamaSession* Session,
+	const FString& Collection,
+	const TOptional<int32>& Limit)
+{
+	return MakePager<FNakamaStorageObjectList>(Client, Session, FString(), [Collection, Limit](UNakamaClient* LiveClient, UNakamaSession* LiveSession, const FString& Cursor, const auto& OnPage, const auto& OnError)
+	{
+		LiveClient->ListStorageObjects(LiveSession, Collection, Limit, OptionalCursor(Cursor), OnPage, OnError);
+	});
+}
+
+TSharedRef<FNakamaLeaderboardRecordPager> FNakamaPagers::ListLeaderboardRecords(
+	UNakamaClient* Client,
+	UNakamaSession* Session,
+	const FString& LeaderboardId,
+	const TArray<FString>& OwnerIds,
+	const TOptional<int32>& Limit)
+{
+	return MakePager<FNakamaLeaderboardRecordList>(Client, Session, FString(), [LeaderboardId, OwnerIds, Limit](UNakamaClient* LiveClient, UNakamaSession* LiveSession, const FString& Cursor, const auto& OnPage, const auto& OnError)
+	{
+		LiveClient->ListLeaderboardRecords(LiveSession, LeaderboardId, OwnerIds, Limit, OptionalCursor(Cursor), OnPage, OnError);
+	});
+}
+
+TSharedRef<FNakamaTournamentPager> FNakamaPagers::ListTournaments(
+	UNakamaClient* Client,
+	UNakamaSession* Session,
+	const TOptional<int32>& CategoryStart,
+	const TOptional<int32>& CategoryEnd,
+	const TOptional<int32>& StartTime,
+	const TOptional<int32>& EndTime,
+	const TOptional<int32>& Limit)
+{
+	return MakePager<FNakamaTournamentList>(Client, Session, FString(), [CategoryStart, CategoryEnd, StartTime, EndTime, Limit](UNakamaClient* LiveClient, UNakamaSession* LiveSession, const FString& Cursor, const auto& OnPage, const auto& OnError)
+	{
+		LiveClient->ListTournaments(LiveSession, CategoryStart, CategoryEnd, StartTime, EndTime, Limit, OptionalCursor(Cursor), OnPage, OnError);
+	});
+}
+
+TSharedRef<FNakamaTournamentRecordPager> FNakamaPagers::ListTournamentRecords(
+	UNakamaClient* Client,
+	UNakamaSession* Session,
+	const FString& TournamentId,
+	const TOptional<int32>& Limit,
+	const TArray<FString>& OwnerIds)
+{
+	return MakePager<FNakamaTournamentRecordList>(Client, Session, FString(), [TournamentId, Limit, OwnerIds](UNakamaClient* LiveClient, UNakamaSession* LiveSession, const FString& Cursor, const auto& OnPage, const auto& OnError)
+	{
+		LiveClient->ListTournamentRecords(LiveSession, TournamentId, Limit, OptionalCursor(Cursor), OwnerIds, OnPage, OnError);
+	});
+}
@@ -0,0 +1,241 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaPresenceRoster.h"
+#include "NakamaRealtimeClient.h"
+#include "NakamaMatchTypes.h"
+#include "NakamaChannelTypes.h"
+
+FNakamaPresenceRosterDelta FNakamaPresenceRoster::Apply(const TArray<FNakamaUserPresence>& Joins, const TArray<FNakamaUserPresence>& Leaves)
+{
+	FNakamaPresenceRosterDelta Delta;
+
+	for (const FNakamaUserPresence& Presence : Leaves)
+	{
+		if (Remove(Presence.SessionID))
+		{
+			Delta.Left.Add(Presence);
+		}
+	}
+
+	for (const FNakamaUserPresence& Presence : Joins)
+	{
+		if (Add(Presence))
+		{
+			Delta.Joined.Add(Presence);
+		}
+	}
+
+	return Delta;
+}
+
+bool FNakamaPresenceRoster::Add(const FNakamaUserPresence& Presence)
+{
+	if (const int32* Existing = BySession.Find(Presence.SessionID))
+	{
+		Nodes[*Existing].Presence = Presence;
+		return false;
+	}
+
+	FNode Node;
+	Node.Presence = Presence;
+	Node.Prev = Tail;
+	const int32 Index = Nodes.Add(MoveTemp(Node));
+
+	if (Tail != INDEX_NONE)
+	{
+		Nodes[Tail].Next = Index;
+	}
+	else
+	{
+		Head = Index;
+	}
+	Tail = Index;
+
+	BySession.Add(Presence.SessionID, Index);
+	++SessionsPerUser.FindOrAdd(Presence.UserID);
+	return true;
+}
+
+bool FNakamaPresenceRoster::Remove(const FString& SessionId)
+{
+	int32 Index;
+	if (!BySession.RemoveAndCopyValue(SessionId, Index))
+	{
+		return false;
+	}
+
+	const FNode& Node = Nodes[Index];
+	if (Node.Prev != INDEX_NONE) { Nodes[Node.Prev].Next = Node.Next; } else { Head = Node.Next; }
+	if (Node.Next != INDEX_NONE) { Nodes[Node.Next].Prev = Node.Prev; } else { Tail = Node.Prev; }
+
+	int32& Sessions = SessionsPerUser.FindChecked(Node.Presence.UserID);
+	if (--Sessions == 0)
+	{
+		SessionsPerUser.Remove(Node.Presence.UserID);
+	}
+
+	Nodes.RemoveAt(Index);
+	return true;
+}
+
+const FNakamaUserPresence* FNakamaPresenceRoster::Find(const FString& SessionId) const
+{
+	const int32* Index = BySession.Find(SessionId);
+	return Index ? &Nodes[*Index].Presence : nullptr;
+}
+
+TArray<FNakamaUserPresence> FNakamaPresenceRoster::ToArray() const
+{
+	TArray<FNakamaUserPresence> Presences;
+	Presences.Reserve(Num());
+	for (const FNakamaUserPresence& Presence : *this)
+	{
+		Presences.Add(Presence);
+	}
+	return Presences;
+}
+
+void FNakamaPresenceRoster::Reset()
+{
+	Nodes.Empty();
+	BySession.Empty();
+	SessionsPerUser.Empty();
+	Head = INDEX_NONE;
+	Tail = INDEX_NONE;
+}
+
+UNakamaPresenceRosters* UNakamaPresenceRosters::CreatePresenceRosters()
+{
+	return NewObject<UNakamaPresenceRosters>();
+}
+
+void UNakamaPresenceRosters::BindRealtimeClient(UNakamaRealtimeClient* RealtimeClient)
+{
+	if (UNakamaRealtimeClient* Previous = BoundRealtimeClient.Get())
+	{
+		Previous->MatchmakerPresenceCallbackNative.Remove(PresenceHandles[0]);
+		Previous->ChannelPresenceEventReceivedNative.Remove(PresenceHandles[1]);
+		Previous->PartyPresenceReceivedNative.Remove(PresenceHandles[2]);
+		Previous->StreamPresenceEventReceivedNative.Remove(PresenceHandles[3]);
+	}
+	PresenceHandles.Reset();
+	BoundRealtimeClient = RealtimeClient;
+
+	if (RealtimeClient)
+	{
+		PresenceHandles.Add(RealtimeClient->MatchmakerPresenceCallbackNative.AddUObject(this, &UNakamaPresenceRosters::HandleMatchPresence));
+		PresenceHandles.Add(RealtimeClient->ChannelPresenceEventReceivedNative.AddUObject(this, &UNakamaPresenceRosters::HandleChannelPresence));
+		PresenceHandles.Add(RealtimeClient->PartyPresenceReceivedNative.AddUObject(this, &UNakamaPresenceRosters::HandlePartyPresence));
+		PresenceHandles.Add(RealtimeClient->StreamPresenceEventReceivedNative.AddUObject(this, &UNakamaPresenceRosters::HandleStreamPresence));
+	}
+}
+
+void UNakamaPresenceRosters::TrackMatch(const FNakamaMatch& Match)
+{
+	Track(Match.MatchId, Match.Me, Match.Pressences);
+}
+
+void UNakamaPresenceRosters::TrackChannel(const FNakamaChannel& Channel)
+{
+	Track(Channel.Id, Channel.Me, Channel.Presences);
+}
+
+void UNakamaPresenceRosters::TrackParty(const FNakamaParty& Party)
+{
+	Track(Party.PartyId, Party.Me, Party.Presences);
+}
+
+FNakamaPresenceRosterDelta UNakamaPresenceRosters::Apply(const FString& RosterId, const TArray<FNakamaUserPresence>& Joins, const TArray<FNakamaUserPresence>& Leaves)
+{
+	FNakamaPresenceRosterDelta Delta = Rosters.FindOrAdd(RosterId).Apply(Joins, Leaves);
+	if (!Delta.IsEmpty())
+	{
+		ChangedEvent.Broadcast(RosterId, Delta);
+	}
+	return Delta;
+}
+
+const FNakamaPresenceRoster* UNakamaPresenceRosters::FindRoster(const FString& RosterId) const
+{
+	return Rosters.Find(RosterId);
+}
+
+TArray<FNakamaUserPresence> UNakamaPresenceRosters::GetPresences(const FString& RosterId) const
+{
+	const FNakamaPresenceRoster* Roster = Rosters.Find(RosterId);
+	return Roster ? Roster->ToArray() : TArray<FNakamaUserPresence>();
+}
+
+bool UNakamaPresenceRosters::IsPresent(const FString& RosterId, const FString& SessionId) const
+{
+	const FNakamaPresenceRoster* Roster = Rosters.Find(RosterId);
+	return Roster && Roster->Contains(SessionId);
+}
+
+FString UNakamaPresenceRosters::GetStreamRosterId(const FNakamaStream& Stream)
+{
+	return FString::Printf(TEXT("stream:%d:%s:%s:%s"), Stream.Mode, *Stream.Subject, *Stream.SubContext, *Stream.Label);
+}
+
+void UNakamaPresenceRosters::RemoveRoster(const FString& RosterId)
+{
+	Rosters.Remove(RosterId);
+}
+
+void UNakamaPresenceRosters::Clear()
+{
+	Rosters.Empty();
+}
+
+void UNakamaPresenceRosters::BeginDestroy()
+{
+	BindRealtimeClient(nullptr);
+	Super::BeginDestroy();
+}
+
+void UNakamaPresenceRosters::Track(const FString& RosterId, const FNakamaUserPresence& Me, const TArray<FNakamaUserPresence>& Presences)
+{
+	// Added rather than replaced, so joins that arrived before the join result are kept.
+	TArray<FNakamaUserPresence> Joins;
+	Joins.Reserve(Presences.Num() + 1);
+	if (!Me.SessionID.IsEmpty())
+	{
+		Joins.Add(Me);
+	}
+	Joins.Append(Presences);
+	Apply(RosterId, Joins, {});
+}
+
+void UNakamaPresenceRosters::HandleMatchPresence(const FNakamaMatchPresenceEvent& Event)
+{
+	Apply(Event.MatchId, Event.Joins, Event.Leaves);
+}
+
+void UNakamaPresenceRosters::HandleChannelPresence(const FNakamaChannelPresenceEvent& Event)
+{
+	Apply(Event.ChannelId, Event.Joins, Event.Leaves);
+}
+
+void UNakamaPresenceRosters::HandlePartyPresence(const FNakamaPartyPresenceEvent& Event)
+{
+	Apply(Event.PartyId, Event.Joins, Event.Leaves);
+}
+
+void UNakamaPresenceRosters::HandleStreamPresence(const FNakamaStreamPresenceEvent& Event)
+{
+	Apply(GetStreamRosterId(Event.Stream), Event.Joins, Event.Leaves);
+}
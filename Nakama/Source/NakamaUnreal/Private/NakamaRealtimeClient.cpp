@@ -17,6 +17,7 @@
 #include "NakamaRealtimeClient.h"
 
 #include "NakamaUtils.h"
+#include "NakamaMemory.h"
 #include "NakamaChannelTypes.h"
 #include "NakamaRtError.h"
 #include "NakamaMatch.h"
@@ -27,6 +28,13 @@
 #include "NakamaStreams.h"
 #include "WebSocketsModule.h"
 #include "GenericPlatform/GenericPlatformHttp.h"
+#include "Misc/ScopeExit.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+TRACE_DECLARE_INT_COUNTER(NakamaRealtimeFramesReceived, TEXT("Nakama/Realtime/FramesReceived"));
+TRACE_DECLARE_INT_COUNTER(NakamaRealtimeFramesSent, TEXT("Nakama/Realtime/FramesSent"));
+TRACE_DECLARE_INT_COUNTER(NakamaRealtimePendingRequests, TEXT("Nakama/Realtime/PendingRequests"));
 
 void UNakamaRealtimeClient::Initialize(const FString& InHost, int32 InPort, bool InSSL)
 {
@@ -34,7 +42,7 @@ void UNakamaRealtimeClient::Initialize(const FString& InHost, int32 InPort, bool
 	Port = InPort;
 	bUseSSL = InSSL;
 
-	NAKAMA_LOG_INFO(FString::Printf(TEXT("Nakama Realtime Client Created on Port: %d"), InPort));
+	NAKAMA_LOGF_INFO(TEXT("Nakama Realtime Client Created on Port: %d"), InPort);
 }
 
 void UNakamaRealtimeClient::UseCustomWebsocket(TSharedPtr<IWebSocket> CustomWebSocket)
@@ -135,9 +143,19 @@ void UNakamaRealtimeClient::Connect(
 	if (WebSocket)
 	{
 		CancelAllRequests(ENakamaRtErrorCode::DISCONNECTED);
+
+		// CleanupWebSocket resets the pointer, but a socket handed over through
+		// UseCustomWebsocket is the one to connect: keep it, minus stale handlers.
+		const TSharedPtr<IWebSocket> CustomWebSocket = bIsCustomWebsocketSet ? WebSocket : nullptr;
+		const bool bWasConnected = WebSocket->IsConnected();
 		CleanupWebSocket();
+		WebSocket = CustomWebSocket;
+		if (!bWasConnected)
+		{
+			bLocalDisconnectInitiated = false; // nothing was closed
+		}
 	}
-	
+
 	if (!bIsCustomWebsocketSet)
 	{
 		FString Url;
@@ -192,7 +210,7 @@ void UNakamaRealtimeClient::Connect(
 
 	WebSocket->OnConnectionError().AddLambda([WeakThis, ConnectionError](const FString& Error)
 	{
-		NAKAMA_LOG_ERROR(FString::Printf(TEXT("Realtime Client Connection Error: %s"), *Error));
+		NAKAMA_LOGF_ERROR(TEXT("Realtime Client Connection Error: %s"), *Error);
 		// Call connection error callback if listener is set and OnConnectionError is bound
 		// Checking validity is important here
 
@@ -229,7 +247,7 @@ void UNakamaRealtimeClient::Connect(
 
 	WebSocket->OnClosed().AddLambda([WeakThis](int32 StatusCode, const FString& Reason, bool bWasClean)
 	{
-		NAKAMA_LOG_INFO(FString::Printf(TEXT("Realtime Client Connection closed with status code: %d, reason: %s, was clean: %d"), StatusCode, *Reason, bWasClean));
+		NAKAMA_LOGF_INFO(TEXT("Realtime Client Connection closed with status code: %d, reason: %s, was clean: %d"), StatusCode, *Reason, bWasClean);
 
 		// Call disconnect callback if OnDisconnect is bound and DisconnectedEvent is bound
 		// This validity check is important: the client may have been GC'd.
@@ -283,6 +301,12 @@ void UNakamaRealtimeClient::Connect(
 			return;
 		}
 
+		// Recorded here rather than in HandleReceivedMessage so replays are not re-recorded
+		if (Self->Recorder)
+		{
+			Self->Recorder->Record(ENakamaFrameDirection::Inbound, MessageString);
+		}
+
 		// Parse the message
 		Self->HandleReceivedMessage(MessageString);
 
@@ -290,8 +314,24 @@ void UNakamaRealtimeClient::Connect(
 		Self->LastMessageTimestamp = FPlatformTime::Seconds();
 	});
 
-	WebSocket->OnMessageSent().AddLambda([](const FString& MessageString)
+	// A new socket starts with an empty outgoing queue
+	SocketCounters.ResetSendQueue();
+
+	WebSocket->OnMessageSent().AddLambda([WeakThis](const FString& MessageString)
 	{
+		// Fired once the socket has written the frame, so this drains the send queue gauge
+		if (UNakamaRealtimeClient* Self = WeakThis.Get())
+		{
+			Self->SocketCounters.RecordWritten();
+		}
+
+		// Parsing the message only decides whether to log it; skip it entirely
+		// when debug logging is off.
+		if (!UNakamaLogger::IsLoggable(ENakamaLogLevel::Debug))
+		{
+			return;
+		}
+
 		// Only print message if not ping
 		TSharedPtr<FJsonObject> JsonObject;
 		const TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(MessageString);
@@ -300,7 +340,7 @@ void UNakamaRealtimeClient::Connect(
 			if (!JsonObject->HasField(TEXT("ping")))
 			{
 				//NAKAMA_LOG_INFO(TEXT("..."));
-				NAKAMA_LOG_DEBUG(FString::Printf(TEXT("Realtime Client: Sent Message: %s"), *MessageString));
+				NAKAMA_LOGF_DEBUG(TEXT("Realtime Client: Sent Message: %s"), *MessageString);
 			}
 		}
 	});
@@ -886,7 +926,7 @@ void UNakamaRealtimeClient::SendMatchData(
 	}
 
 	// This does not have callbacks
-	SendMessageWithEnvelope(TEXT("match_data_send"), MatchDataSend, {}, {});
+	SendDataWithEnvelope(TEXT("match_data_send"), MatchDataSend);
 }
 
 void UNakamaRealtimeClient::LeaveMatch(
@@ -2036,10 +2076,122 @@ void UNakamaRealtimeClient::SendPartyData(
 	PartySendData->SetStringField(TEXT("data"), EncodeData);
 
 	// This does not have callbacks
-	SendMessageWithEnvelope(TEXT("party_data_send"), PartySendData, {}, {});
+	SendDataWithEnvelope(TEXT("party_data_send"), PartySendData);
 }
 
 
+FNakamaRealtimeStats UNakamaRealtimeClient::GetStats() const
+{
+	FNakamaRealtimeStats Stats;
+	SocketCounters.GetSnapshot(Stats);
+
+	const double Now = FPlatformTime::Seconds();
+	double OldestCreatedTime = Now;
+
+	{
+		FScopeLock Lock(&ReqContextsLock);
+		Stats.PendingRequests = ReqContexts.Num();
+		for (const auto& Pair : ReqContexts)
+		{
+			if (Pair.Value)
+			{
+				OldestCreatedTime = FMath::Min(OldestCreatedTime, Pair.Value->CreatedTime);
+			}
+		}
+	}
+
+	Stats.OldestPendingRequestAgeSeconds = Now - OldestCreatedTime;
+	Stats.RejectedRequests = NumRejectedRequests.load(std::memory_order_relaxed);
+	Stats.DroppedRequests = NumDroppedRequests.load(std::memory_order_relaxed);
+	return Stats;
+}
+
+void UNakamaRealtimeClient::ResetStats()
+{
+	SocketCounters.Reset();
+	NumRejectedRequests = 0;
+	NumDroppedRequests = 0;
+}
+
+void UNakamaRealtimeClient::SetMaxPendingRequests(int32 MaxRequests, ENakamaOverflowPolicy Policy)
+{
+	FScopeLock Lock(&ReqContextsLock);
+	MaxPendingRequests = FMath::Max(0, MaxRequests);
+	PendingOverflowPolicy = Policy;
+}
+
+int32 UNakamaRealtimeClient::GetMaxPendingRequests() const
+{
+	FScopeLock Lock(&ReqContextsLock);
+	return MaxPendingRequests;
+}
+
+bool UNakamaRealtimeClient::ReservePendingRequest(const TFunction<void(const FNakamaRtError& Error)>& ErrorCallback)
+{
+	FNakamaRealtimeErrorCallback EvictedErrorCallback;
+	{
+		FScopeLock Lock(&ReqContextsLock);
+		if (MaxPendingRequests <= 0 || ReqContexts.Num() < MaxPendingRequests)
+		{
+			return true;
+		}
+
+		if (PendingOverflowPolicy == ENakamaOverflowPolicy::DropOldest)
+		{
+			// CIDs wrap and are reused, so the first entry still mapped to the same
+			// context is the oldest pending request.
+			int32 OldestCid = INDEX_NONE;
+			while (PendingOrderHead < PendingOrder.Num())
+			{
+				const FPendingOrderEntry& Entry = PendingOrder[PendingOrderHead++];
+				const UNakamaRealtimeRequestContext* Context = Entry.Context.Get();
+				if (Context && ReqContexts.FindRef(Entry.Cid) == Context)
+				{
+					OldestCid = Entry.Cid;
+					break;
+				}
+			}
+
+			TObjectPtr<UNakamaRealtimeRequestContext> Evicted;
+			ReqContexts.RemoveAndCopyValue(OldestCid, Evicted);
+			TRACE_COUNTER_DECREMENT(NakamaRealtimePendingRequests);
+			++NumDroppedRequests;
+			if (Evicted)
+			{
+				NAKAMA_TRACE_REGION_END(Evicted->TraceRegion);
+				EvictedErrorCallback = Evicted->ErrorCallback;
+			}
+		}
+		else
+		{
+			++NumRejectedRequests;
+		}
+	}
+
+	FNakamaRtError Error;
+	Error.Code = ENakamaRtErrorCode::REQUEST_LIMIT;
+
+	if (PendingOverflowPolicy == ENakamaOverflowPolicy::DropOldest)
+	{
+		// A late response to the evicted CID is logged as unknown and ignored.
+		Error.Message = TEXT("Pending request dropped to make room for a newer request.");
+		NAKAMA_LOG_WARN(Error.Message);
+		if (EvictedErrorCallback.IsBound())
+		{
+			EvictedErrorCallback.Execute(Error);
+		}
+		return true;
+	}
+
+	Error.Message = TEXT("Request rejected: too many requests waiting for a response.");
+	NAKAMA_LOG_WARN(Error.Message);
+	if (ErrorCallback)
+	{
+		ErrorCallback(Error);
+	}
+	return false;
+}
+
 bool UNakamaRealtimeClient::IsConnected() const
 {
 	if(!WebSocket)
@@ -2083,12 +2235,45 @@ TObjectPtr<UNakamaRealtimeRequestContext> UNakamaRealtimeClient::CreateReqContex
 		Inserted = (ReqContexts.Add(Cid, ReqContext) != nullptr);
 		if (!Inserted)
 		{
-			NAKAMA_LOG_ERROR(FString::Printf(TEXT("Creating request with already assigned CID=%d"), Cid));
+			NAKAMA_LOGF_ERROR(TEXT("Creating request with already assigned CID=%d"), Cid);
 		}
 	}
 
 	envelope.CID = Cid;
 	ReqContext->CID = Cid;
+	ReqContext->CreatedTime = FPlatformTime::Seconds();
+
+	if (Inserted)
+	{
+		TRACE_COUNTER_INCREMENT(NakamaRealtimePendingRequests);
+
+		// Drop entries of completed requests once they outnumber the pending ones,
+		// so the order list stays proportional to ReqContexts.
+		if (PendingOrder.Num() - PendingOrderHead > 2 * ReqContexts.Num() + 64)
+		{
+			TArray<FPendingOrderEntry> Live;
+			Live.Reserve(ReqContexts.Num());
+			for (int32 Index = PendingOrderHead; Index < PendingOrder.Num(); ++Index)
+			{
+				const UNakamaRealtimeRequestContext* Context = PendingOrder[Index].Context.Get();
+				if (Context && ReqContexts.FindRef(PendingOrder[Index].Cid) == Context)
+				{
+					Live.Add(PendingOrder[Index]);
+				}
+			}
+			PendingOrder = MoveTemp(Live);
+			PendingOrderHead = 0;
+		}
+		else if (PendingOrderHead > 0 && PendingOrderHead * 2 >= PendingOrder.Num())
+		{
+			PendingOrder.RemoveAt(0, PendingOrderHead);
+			PendingOrderHead = 0;
+		}
+
+		FPendingOrderEntry& Entry = PendingOrder.AddDefaulted_GetRef();
+		Entry.Cid = Cid;
+		Entry.Context = ReqContext;
+	}
 
 	return ReqContext;
 }
@@ -2098,6 +2283,8 @@ void UNakamaRealtimeClient::SendMessageWithEnvelope(const FString& FieldName,
 	const TFunction<void(const FNakamaRealtimeEnvelope& Envelope)>& SuccessCallback,
 	const TFunction<void(const FNakamaRtError& Error)>& ErrorCallback)
 {
+	NAKAMA_MEMORY_SCOPE(Nakama_Realtime, RealtimeSend);
+
 	// Check WebSocket before sending Data
 	if (!WebSocket || !WebSocket->IsConnected())
 	{
@@ -2114,6 +2301,11 @@ void UNakamaRealtimeClient::SendMessageWithEnvelope(const FString& FieldName,
 		return;
 	}
 
+	if (!ReservePendingRequest(ErrorCallback))
+	{
+		return;
+	}
+
 	// Create the Envelope with the object field
 	const TSharedPtr<FJsonObject> Envelope = MakeShareable(new FJsonObject());
 	//Envelope->SetObjectField(FieldName, ObjectField);
@@ -2125,6 +2317,8 @@ void UNakamaRealtimeClient::SendMessageWithEnvelope(const FString& FieldName,
 	// Create Context from the Envelope
 	TObjectPtr<UNakamaRealtimeRequestContext> ReqContext = CreateReqContext(NakamaEnvelope);
 	Envelope->SetStringField(TEXT("cid"), FString::FromInt(ReqContext->CID));
+	ReqContext->TraceRegion = NAKAMA_TRACE_REGION_BEGIN(NakamaRealtimeChannel,
+		FString::Printf(TEXT("Nakama::Realtime %s"), *FieldName), ReqContext->CID);
 
 	// Envelope is basically just holding a reference to the Payload in the SuccessCallback (makes it generic)
 	// It is being set in the HandleMessage function
@@ -2151,15 +2345,17 @@ void UNakamaRealtimeClient::SendMessageWithEnvelope(const FString& FieldName,
 
 	// Send Message
 	const FString Message = NakamaEnvelope.Payload;
-	WebSocket->Send(Message);
+	SendFrame(FieldName, Message);
 
-	NAKAMA_LOG_INFO(FString::Printf(TEXT("Realtime Client - Request %s sent with CID: %d"), *FieldName, ReqContext->CID));
+	NAKAMA_LOGF_INFO(TEXT("Realtime Client - Request %s sent with CID: %d"), *FieldName, ReqContext->CID);
 }
 
 void UNakamaRealtimeClient::SendMessageWithEnvelopeMove(const FString& FieldName,
 	const TSharedPtr<FJsonObject>& ObjectField, const TFunction<void(FNakamaRealtimeEnvelope&& Envelope)>& SuccessCallback,
 	const TFunction<void(const FNakamaRtError& Error)>& ErrorCallback)
 {
+	NAKAMA_MEMORY_SCOPE(Nakama_Realtime, RealtimeSend);
+
 	// Check WebSocket before sending Data
 	if (!WebSocket || !WebSocket->IsConnected())
 	{
@@ -2176,6 +2372,11 @@ void UNakamaRealtimeClient::SendMessageWithEnvelopeMove(const FString& FieldName
 		return;
 	}
 
+	if (!ReservePendingRequest(ErrorCallback))
+	{
+		return;
+	}
+
 	// Create the Envelope with the object field
 	const TSharedPtr<FJsonObject> Envelope = MakeShareable(new FJsonObject());
 	//Envelope->SetObjectField(FieldName, ObjectField);
@@ -2187,6 +2388,8 @@ void UNakamaRealtimeClient::SendMessageWithEnvelopeMove(const FString& FieldName
 	// Create Context from the Envelope
 	TObjectPtr<UNakamaRealtimeRequestContext> ReqContext = CreateReqContext(NakamaEnvelope);
 	Envelope->SetStringField(TEXT("cid"), FString::FromInt(ReqContext->CID));
+	ReqContext->TraceRegion = NAKAMA_TRACE_REGION_BEGIN(NakamaRealtimeChannel,
+		FString::Printf(TEXT("Nakama::Realtime %s"), *FieldName), ReqContext->CID);
 
 	// Envelope is basically just holding a reference to the Payload in the SuccessCallback (makes it generic)
 	// It is being set in the HandleMessage function
@@ -2213,13 +2416,15 @@ void UNakamaRealtimeClient::SendMessageWithEnvelopeMove(const FString& FieldName
 
 	// Send Message
 	const FString Message = NakamaEnvelope.Payload;
-	WebSocket->Send(Message);
+	SendFrame(FieldName, Message);
 
-	NAKAMA_LOG_INFO(FString::Printf(TEXT("Realtime Client - Request %s sent with CID: %d"), *FieldName, ReqContext->CID));
+	NAKAMA_LOGF_INFO(TEXT("Realtime Client - Request %s sent with CID: %d"), *FieldName, ReqContext->CID);
 }
 
 void UNakamaRealtimeClient::SendDataWithEnvelope(const FString& FieldName, const TSharedPtr<FJsonObject>& ObjectField)
 {
+	NAKAMA_MEMORY_SCOPE(Nakama_Realtime, RealtimeSend);
+
 	// Check WebSocket before sending Data
 	if (!WebSocket || !WebSocket->IsConnected())
 	{
@@ -2232,24 +2437,11 @@ void UNakamaRealtimeClient::SendDataWithEnvelope(const FString& FieldName, const
 	//Envelope->SetObjectField(FieldName, ObjectField);
 	Envelope->SetObjectField(FieldName, ObjectField != nullptr ? ObjectField : MakeShareable(new FJsonObject()));
 
-	// Make the Envelope
-	FNakamaRealtimeEnvelope NakamaEnvelope;
-
-	// Create Context from the Envelope
-	const TObjectPtr<UNakamaRealtimeRequestContext> ReqContext = CreateReqContext(NakamaEnvelope);
-	Envelope->SetStringField(TEXT("cid"), FString::FromInt(ReqContext->CID));
-
-	// Set the payload
-	FString JsonPayload = FNakamaUtils::EncodeJson(Envelope);
-
-	const FString EncodeData = FBase64::Encode(JsonPayload);
-	NakamaEnvelope.Payload = EncodeData;
+	// No CID: the server does not answer these, so a request context would
+	// never be resolved and would stay in ReqContexts for the whole session.
+	SendFrame(FieldName, FNakamaUtils::EncodeJson(Envelope));
 
-	// Send Message
-	const FString Message = NakamaEnvelope.Payload;
-	WebSocket->Send(Message);
-
-	NAKAMA_LOG_DEBUG(FString::Printf(TEXT("%s request sent with CID=%d"), *FieldName, ReqContext->CID));
+	NAKAMA_LOGF_DEBUG(TEXT("%s sent"), *FieldName);
 }
 
 void UNakamaRealtimeClient::CleanupWebSocket()
@@ -2293,19 +2485,43 @@ void UNakamaRealtimeClient::Heartbeat()
 
 void UNakamaRealtimeClient::HandleReceivedMessage(const FString& Data)
 {
+	TRACE_COUNTER_INCREMENT(NakamaRealtimeFramesReceived);
+
 	// Start by parsing the Json!
     TSharedPtr<FJsonObject> JsonObject;
-    TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(Data);
-    if (!FJsonSerializer::Deserialize(JsonReader, JsonObject))
+	bool bParsed;
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR("Nakama::Realtime::Decode", NakamaRealtimeChannel);
+		NAKAMA_MEMORY_SCOPE(Nakama_Realtime, RealtimeReceive);
+		const uint64 DecodeStart = FPlatformTime::Cycles64();
+		TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(Data);
+		bParsed = FJsonSerializer::Deserialize(JsonReader, JsonObject);
+		SocketCounters.RecordDecode(FPlatformTime::Cycles64() - DecodeStart, bParsed);
+	}
+
+    if (!bParsed)
     {
+    	SocketCounters.RecordReceived(0, Data);
     	OnTransportError(FString::Printf(TEXT("Unable to parse message as JSON: %s"), *Data));
         return;
     }
 
+	// Everything below, up to and including the user callbacks, counts as dispatch time.
+	const int32 EnvelopeType = FNakamaRealtimeSocketCounters::GetEnvelopeTypeIndex(*JsonObject);
+	SocketCounters.RecordReceived(EnvelopeType, Data);
+
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR("Nakama::Realtime::Dispatch", NakamaRealtimeChannel);
+	NAKAMA_MEMORY_SCOPE(Nakama_Realtime, RealtimeDispatch);
+	const uint64 DispatchStart = FPlatformTime::Cycles64();
+	ON_SCOPE_EXIT
+	{
+		SocketCounters.RecordDispatch(EnvelopeType, FPlatformTime::Cycles64() - DispatchStart);
+	};
+
 	// Only log if it is not a pong
 	if (!JsonObject->HasField(TEXT("pong")))
 	{
-		NAKAMA_LOG_DEBUG(FString::Printf(TEXT("Realtime Client - Received message: %s"), *Data));
+		NAKAMA_LOGF_DEBUG(TEXT("Realtime Client - Received message: %s"), *Data);
 	}
 
 	FNakamaRtError Error;
@@ -2326,7 +2542,7 @@ void UNakamaRealtimeClient::HandleReceivedMessage(const FString& Data)
     FString CidStr;
     if (!JsonObject->TryGetStringField(TEXT("cid"), CidStr))
     {
-    	NAKAMA_LOG_DEBUG(FString::Printf(TEXT("Received message with no CID: %s"), *Data));
+    	NAKAMA_LOGF_DEBUG(TEXT("Received message with no CID: %s"), *Data);
 
     	// Handle Events here
     	if(FNakamaUtils::IsRealtimeClientActive(this))
@@ -2740,11 +2956,18 @@ void UNakamaRealtimeClient::HandleReceivedMessage(const FString& Data)
 	            SuccessCallback = ReqContext->SuccessCallback;
 	            SuccessCallbackMove = ReqContext->SuccessCallbackMove;
 	            ErrorCallback = ReqContext->ErrorCallback;
+	            NAKAMA_TRACE_REGION_END(ReqContext->TraceRegion);
 	            ReqContexts.Remove(Cid);
+	            TRACE_COUNTER_DECREMENT(NakamaRealtimePendingRequests);
 	        }
 	        else
 	        {
-	        	NAKAMA_LOG_ERROR(FString::Printf(TEXT("Received response for unknown CID=%d"), Cid));
+	        	// Also expected for requests evicted by the pending request cap,
+	        	// and for every response while replaying a recording.
+	        	if (!bReplaying)
+	        	{
+	        		NAKAMA_LOGF_WARN(TEXT("Received response for unknown CID=%d"), Cid);
+	        	}
 	            return;
 	        }
 	    }
@@ -2804,6 +3027,8 @@ void UNakamaRealtimeClient::HandleReceivedMessage(const FString& Data)
 
 void UNakamaRealtimeClient::SendMessage(const FString& FieldName, const TSharedPtr<FJsonObject>& Object)
 {
+	NAKAMA_MEMORY_SCOPE(Nakama_Realtime, RealtimeSend);
+
 	// Check WebSocket before sending Data
 	if (!WebSocket || !WebSocket->IsConnected())
 	{
@@ -2826,7 +3051,51 @@ void UNakamaRealtimeClient::SendMessage(const FString& FieldName, const TSharedP
 
 	// Send Message
 	FString Message = NakamaEnvelope.Payload;
-	WebSocket->Send(Message);
+	SendFrame(FieldName, Message);
+}
+
+void UNakamaRealtimeClient::SendFrame(const FString& FieldName, const FString& Frame)
+{
+	SocketCounters.RecordSent(FNakamaRealtimeSocketCounters::GetEnvelopeTypeIndex(FieldName), Frame);
+	TRACE_COUNTER_INCREMENT(NakamaRealtimeFramesSent);
+
+	if (Recorder)
+	{
+		Recorder->Record(ENakamaFrameDirection::Outbound, Frame);
+	}
+
+	SocketCounters.RecordQueued();
+	WebSocket->Send(Frame);
+}
+
+TSharedRef<FNakamaRealtimeRecorder, ESPMode::ThreadSafe> UNakamaRealtimeClient::StartRecording(const FNakamaRealtimeRecorderSettings& Settings)
+{
+	TSharedRef<FNakamaRealtimeRecorder, ESPMode::ThreadSafe> NewRecorder = FNakamaRealtimeRecorder::Create(Settings);
+	Recorder = NewRecorder;
+	return NewRecorder;
+}
+
+void UNakamaRealtimeClient::StopRecording()
+{
+	Recorder.Reset();
+}
+
+int32 UNakamaRealtimeClient::ReplayFrames(const TArray<FNakamaRecordedFrame>& Frames)
+{
+	// Events are only dispatched by an active client; a replay target usually never connected.
+	TGuardValue<bool> ReplayGuard(bReplaying, true);
+	TGuardValue<bool> ActiveGuard(bIsActive, true);
+
+	int32 NumReplayed = 0;
+	for (const FNakamaRecordedFrame& Frame : Frames)
+	{
+		if (Frame.Direction == ENakamaFrameDirection::Inbound)
+		{
+			HandleReceivedMessage(Frame.Frame);
+			NumReplayed++;
+		}
+	}
+	return NumReplayed;
 }
 
 void UNakamaRealtimeClient::Tick(float DeltaTime)
@@ -2888,6 +3157,7 @@ void UNakamaRealtimeClient::CancelAllRequests(const ENakamaRtErrorCode& ErrorCod
 
 		if (Context)
 		{
+			NAKAMA_TRACE_REGION_END(Context->TraceRegion);
 			if(Context->ErrorCallback.IsBound())
 			{
 				Context->ErrorCallback.Execute(Error);
@@ -2896,7 +3166,10 @@ void UNakamaRealtimeClient::CancelAllRequests(const ENakamaRtErrorCode& ErrorCod
 	}
 
 	// Clear the Array
+	TRACE_COUNTER_SUBTRACT(NakamaRealtimePendingRequests, ReqContexts.Num());
 	ReqContexts.Empty();
+	PendingOrder.Reset();
+	PendingOrderHead = 0;
 }
 
 void UNakamaRealtimeClient::OnTransportError(const FString& Description)
@@ -2905,8 +3178,8 @@ void UNakamaRealtimeClient::OnTransportError(const FString& Description)
 	Error.Message = Description;
 	Error.Code = WebSocket->IsConnected() ? ENakamaRtErrorCode::TRANSPORT_ERROR : ENakamaRtErrorCode::CONNECT_ERROR;
 
-	NAKAMA_LOG_ERROR(FString::Printf(TEXT("Realtime Client Transport Error (Code: %s): %s"),
-		WebSocket->IsConnected() ? TEXT("TRANSPORT_ERROR") : TEXT("CONNECT_ERROR"), *Description));
+	NAKAMA_LOGF_ERROR(TEXT("Realtime Client Transport Error (Code: %s): %s"),
+		WebSocket->IsConnected() ? TEXT("TRANSPORT_ERROR") : TEXT("CONNECT_ERROR"), *Description);
 
 	// Handle Callbacks
 	if(FNakamaUtils::IsRealtimeClientActive(this))
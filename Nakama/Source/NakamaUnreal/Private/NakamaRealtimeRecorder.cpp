@@ -0,0 +1,297 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaRealtimeRecorder.h"
+#include "NakamaLogger.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	// In-buffer record header: payload size, direction, microseconds since start.
+	struct FRecordHeader
+	{
+		uint32 Size;
+		uint32 Direction;
+		uint64 TimeMicros;
+	};
+	constexpr int32 HeaderSize = sizeof(FRecordHeader);
+
+	// File layout: magic, version, frame count, then per frame direction,
+	// microseconds since start, UTF-8 size and bytes.
+	constexpr uint32 FileMagic = 0x52524B4E; // "NKRR"
+	constexpr uint32 FileVersion = 1;
+
+	FCriticalSection RecordersMutex;
+	TArray<TWeakPtr<FNakamaRealtimeRecorder, ESPMode::ThreadSafe>> Recorders;
+
+	FAutoConsoleCommand DumpRecordingsCommand(
+		TEXT("Nakama.Realtime.DumpRecordings"),
+		TEXT("Save every live realtime frame recorder. Optional argument: output directory (default Saved/Nakama/Recordings)."),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			const FString Directory = Args.Num() > 0 ? Args[0] : FPaths::ProjectSavedDir() / TEXT("Nakama") / TEXT("Recordings");
+			const int32 NumWritten = FNakamaRealtimeRecorder::DumpAll(Directory);
+			UE_LOG(LogNakamaUnreal, Display, TEXT("Nakama: wrote %d realtime recording(s) to %s"), NumWritten, *Directory);
+		}));
+}
+
+TSharedRef<FNakamaRealtimeRecorder, ESPMode::ThreadSafe> FNakamaRealtimeRecorder::Create(const FNakamaRealtimeRecorderSettings& Settings)
+{
+	TSharedRef<FNakamaRealtimeRecorder, ESPMode::ThreadSafe> Recorder = MakeShareable(new FNakamaRealtimeRecorder(Settings));
+
+	FScopeLock Lock(&RecordersMutex);
+	Recorders.RemoveAll([](const TWeakPtr<FNakamaRealtimeRecorder, ESPMode::ThreadSafe>& Weak) { return !Weak.IsValid(); });
+	Recorders.Add(Recorder);
+	return Recorder;
+}
+
+FNakamaRealtimeRecorder::FNakamaRealtimeRecorder(const FNakamaRealtimeRecorderSettings& InSettings)
+	: Settings(InSettings)
+	, StartTime(FPlatformTime::Seconds())
+	, Sampler(FPlatformTime::Cycles())
+{
+	Buffer.SetNumUninitialized(FMath::Max(Settings.CapacityBytes, HeaderSize));
+}
+
+FNakamaRealtimeRecorder::~FNakamaRealtimeRecorder()
+{
+	FScopeLock Lock(&RecordersMutex);
+	Recorders.RemoveAll([this](const TWeakPtr<FNakamaRealtimeRecorder, ESPMode::ThreadSafe>& Weak)
+	{
+		return !Weak.IsValid() || Weak.HasSameObject(this);
+	});
+}
+
+void FNakamaRealtimeRecorder::Record(ENakamaFrameDirection Direction, const FString& Frame)
+{
+	if (Direction == ENakamaFrameDirection::Outbound && !Settings.bRecordOutbound)
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	FScopeLock Lock(&Mutex);
+
+	if (Settings.SampleRate < 1.0f && Sampler.GetFraction() >= Settings.SampleRate)
+	{
+		NumSkipped++;
+		return;
+	}
+
+	const FTCHARToUTF8 Utf8(*Frame, Frame.Len());
+	const int32 RecordSize = HeaderSize + Utf8.Length();
+	if (RecordSize > Buffer.Num())
+	{
+		NumSkipped++;
+		return;
+	}
+
+	while (Buffer.Num() - BytesUsed < RecordSize)
+	{
+		EvictOldest();
+	}
+
+	FRecordHeader Header;
+	Header.Size = static_cast<uint32>(Utf8.Length());
+	Header.Direction = static_cast<uint32>(Direction);
+	Header.TimeMicros = static_cast<uint64>((Now - StartTime) * 1000000.0);
+
+	const int32 Tail = (Head + BytesUsed) % Buffer.Num();
+	Write(Tail, &Header, HeaderSize);
+	Write((Tail + HeaderSize) % Buffer.Num(), Utf8.Get(), Utf8.Length());
+	BytesUsed += RecordSize;
+	NumFrames++;
+}
+
+TArray<FNakamaRecordedFrame> FNakamaRealtimeRecorder::GetFrames() const
+{
+	TArray<FNakamaRecordedFrame> Frames;
+	TArray<uint8> Utf8;
+
+	FScopeLock Lock(&Mutex);
+	Frames.Reserve(NumFrames);
+
+	int32 Offset = Head;
+	for (int32 Index = 0; Index < NumFrames; ++Index)
+	{
+		FRecordHeader Header;
+		Read(Offset, &Header, HeaderSize);
+		Utf8.SetNumUninitialized(Header.Size);
+		Read((Offset + HeaderSize) % Buffer.Num(), Utf8.GetData(), Header.Size);
+
+		FNakamaRecordedFrame& Frame = Frames.AddDefaulted_GetRef();
+		Frame.Direction = static_cast<ENakamaFrameDirection>(Header.Direction);
+		Frame.TimeSeconds = Header.TimeMicros / 1000000.0;
+		Frame.Frame = FString(FUTF8ToTCHAR(reinterpret_cast<const ANSICHAR*>(Utf8.GetData()), Utf8.Num()));
+
+		Offset = (Offset + HeaderSize + static_cast<int32>(Header.Size)) % Buffer.Num();
+	}
+	return Frames;
+}
+
+void FNakamaRealtimeRecorder::Clear()
+{
+	FScopeLock Lock(&Mutex);
+	Head = 0;
+	BytesUsed = 0;
+	NumFrames = 0;
+}
+
+int32 FNakamaRealtimeRecorder::GetNumFrames() const
+{
+	FScopeLock Lock(&Mutex);
+	return NumFrames;
+}
+
+int32 FNakamaRealtimeRecorder::GetBytesUsed() const
+{
+	FScopeLock Lock(&Mutex);
+	return BytesUsed;
+}
+
+int64 FNakamaRealtimeRecorder::GetNumSkipped() const
+{
+	FScopeLock Lock(&Mutex);
+	return NumSkipped;
+}
+
+int64 FNakamaRealtimeRecorder::GetNumOverwritten() const
+{
+	FScopeLock Lock(&Mutex);
+	return NumOverwritten;
+}
+
+bool FNakamaRealtimeRecorder::SaveToFile(const FString& Path) const
+{
+	const TArray<FNakamaRecordedFrame> Frames = GetFrames();
+
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	uint32 Magic = FileMagic;
+	uint32 Version = FileVersion;
+	uint32 NumFramesToWrite = Frames.Num();
+	Writer << Magic << Version << NumFramesToWrite;
+
+	for (const FNakamaRecordedFrame& Frame : Frames)
+	{
+		uint8 Direction = static_cast<uint8>(Frame.Direction);
+		uint64 TimeMicros = static_cast<uint64>(Frame.TimeSeconds * 1000000.0);
+		FTCHARToUTF8 Utf8(*Frame.Frame, Frame.Frame.Len());
+		uint32 Size = Utf8.Length();
+		Writer << Direction << TimeMicros << Size;
+		Writer.Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Size);
+	}
+
+	return FFileHelper::SaveArrayToFile(Bytes, *Path);
+}
+
+bool FNakamaRealtimeRecorder::LoadFromFile(const FString& Path, TArray<FNakamaRecordedFrame>& OutFrames)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *Path))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	uint32 NumFramesToRead = 0;
+	Reader << Magic << Version << NumFramesToRead;
+	if (Reader.IsError() || Magic != FileMagic || Version != FileVersion)
+	{
+		return false;
+	}
+
+	OutFrames.Reset();
+	TArray<uint8> Utf8;
+	for (uint32 Index = 0; Index < NumFramesToRead; ++Index)
+	{
+		uint8 Direction = 0;
+		uint64 TimeMicros = 0;
+		uint32 Size = 0;
+		Reader << Direction << TimeMicros << Size;
+		if (Reader.IsError() || Size > static_cast<uint32>(Reader.TotalSize() - Reader.Tell()))
+		{
+			return false;
+		}
+
+		Utf8.SetNumUninitialized(Size);
+		Reader.Serialize(Utf8.GetData(), Size);
+
+		FNakamaRecordedFrame& Frame = OutFrames.AddDefaulted_GetRef();
+		Frame.Direction = Direction == static_cast<uint8>(ENakamaFrameDirection::Outbound) ? ENakamaFrameDirection::Outbound : ENakamaFrameDirection::Inbound;
+		Frame.TimeSeconds = TimeMicros / 1000000.0;
+		Frame.Frame = FString(FUTF8ToTCHAR(reinterpret_cast<const ANSICHAR*>(Utf8.GetData()), Utf8.Num()));
+	}
+	return !Reader.IsError();
+}
+
+int32 FNakamaRealtimeRecorder::DumpAll(const FString& Directory)
+{
+	TArray<TSharedPtr<FNakamaRealtimeRecorder, ESPMode::ThreadSafe>> Live;
+	{
+		FScopeLock Lock(&RecordersMutex);
+		for (const TWeakPtr<FNakamaRealtimeRecorder, ESPMode::ThreadSafe>& Weak : Recorders)
+		{
+			if (TSharedPtr<FNakamaRealtimeRecorder, ESPMode::ThreadSafe> Pinned = Weak.Pin())
+			{
+				Live.Add(Pinned);
+			}
+		}
+	}
+
+	const FString Stamp = FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S"));
+	int32 NumWritten = 0;
+	for (int32 Index = 0; Index < Live.Num(); ++Index)
+	{
+		const FString Path = Directory / FString::Printf(TEXT("Realtime-%s-%d.nkrec"), *Stamp, Index);
+		if (Live[Index]->SaveToFile(Path))
+		{
+			NumWritten++;
+		}
+	}
+	return NumWritten;
+}
+
+void FNakamaRealtimeRecorder::Write(int32 Offset, const void* Data, int32 Num)
+{
+	const int32 First = FMath::Min(Num, Buffer.Num() - Offset);
+	FMemory::Memcpy(Buffer.GetData() + Offset, Data, First);
+	FMemory::Memcpy(Buffer.GetData(), static_cast<const uint8*>(Data) + First, Num - First);
+}
+
+void FNakamaRealtimeRecorder::Read(int32 Offset, void* Data, int32 Num) const
+{
+	const int32 First = FMath::Min(Num, Buffer.Num() - Offset);
+	FMemory::Memcpy(Data, Buffer.GetData() + Offset, First);
+	FMemory::Memcpy(static_cast<uint8*>(Data) + First, Buffer.GetData(), Num - First);
+}
+
+void FNakamaRealtimeRecorder::EvictOldest()
+{
+	FRecordHeader Header;
+	Read(Head, &Header, HeaderSize);
+	const int32 RecordSize = HeaderSize + static_cast<int32>(Header.Size);
+	Head = (Head + RecordSize) % Buffer.Num();
+	BytesUsed -= RecordSize;
+	NumFrames--;
+	NumOverwritten++;
+}
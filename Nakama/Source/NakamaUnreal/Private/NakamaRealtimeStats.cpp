@@ -0,0 +1,202 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaRealtimeStats.h"
+#include "Dom/JsonObject.h"
+
+UE_TRACE_CHANNEL_DEFINE(NakamaRealtimeChannel);
+
+namespace
+{
+	// Slot 0 collects envelopes not listed here.
+	const TCHAR* const EnvelopeTypeNames[] =
+	{
+		TEXT("other"),
+		TEXT("error"), TEXT("ping"), TEXT("pong"), TEXT("rpc"),
+		TEXT("channel"), TEXT("channel_join"), TEXT("channel_leave"), TEXT("channel_message"), TEXT("channel_message_ack"),
+		TEXT("channel_message_send"), TEXT("channel_message_update"), TEXT("channel_message_remove"), TEXT("channel_presence_event"),
+		TEXT("match"), TEXT("match_create"), TEXT("match_data"), TEXT("match_data_send"), TEXT("match_join"),
+		TEXT("match_leave"), TEXT("match_presence_event"),
+		TEXT("matchmaker_add"), TEXT("matchmaker_matched"), TEXT("matchmaker_remove"), TEXT("matchmaker_ticket"),
+		TEXT("notifications"),
+		TEXT("status"), TEXT("status_follow"), TEXT("status_presence_event"), TEXT("status_unfollow"), TEXT("status_update"),
+		TEXT("stream_data"), TEXT("stream_presence_event"),
+		TEXT("party"), TEXT("party_accept"), TEXT("party_close"), TEXT("party_create"), TEXT("party_data"),
+		TEXT("party_data_send"), TEXT("party_join"), TEXT("party_join_request"), TEXT("party_join_request_list"),
+		TEXT("party_leader"), TEXT("party_leave"), TEXT("party_matchmaker_add"), TEXT("party_matchmaker_remove"),
+		TEXT("party_matchmaker_ticket"), TEXT("party_presence_event"), TEXT("party_promote"), TEXT("party_remove"),
+	};
+	static_assert(UE_ARRAY_COUNT(EnvelopeTypeNames) == FNakamaRealtimeSocketCounters::NumEnvelopeTypes, "Envelope type table out of sync");
+
+	int64 Utf8Length(const FString& Frame)
+	{
+		return FPlatformString::ConvertedLength<UTF8CHAR>(*Frame, Frame.Len());
+	}
+
+	void UpdateMax(std::atomic<uint64>& Max, uint64 Value)
+	{
+		uint64 Current = Max.load(std::memory_order_relaxed);
+		while (Value > Current && !Max.compare_exchange_weak(Current, Value, std::memory_order_relaxed))
+		{
+		}
+	}
+}
+
+FNakamaRealtimeSocketCounters::FNakamaRealtimeSocketCounters()
+{
+	ResetTime.store(FPlatformTime::Seconds(), std::memory_order_relaxed);
+}
+
+int32 FNakamaRealtimeSocketCounters::GetEnvelopeTypeIndex(const FString& FieldName)
+{
+	static const TMap<FString, int32> Indices = []()
+	{
+		TMap<FString, int32> Result;
+		for (int32 Index = 1; Index < NumEnvelopeTypes; ++Index)
+		{
+			Result.Add(EnvelopeTypeNames[Index], Index);
+		}
+		return Result;
+	}();
+
+	const int32* Index = Indices.Find(FieldName);
+	return Index ? *Index : 0;
+}
+
+int32 FNakamaRealtimeSocketCounters::GetEnvelopeTypeIndex(const FJsonObject& Envelope)
+{
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Envelope.Values)
+	{
+		if (Field.Key != TEXT("cid"))
+		{
+			return GetEnvelopeTypeIndex(Field.Key);
+		}
+	}
+	return 0;
+}
+
+const TCHAR* FNakamaRealtimeSocketCounters::GetEnvelopeTypeName(int32 TypeIndex)
+{
+	return EnvelopeTypeNames[FMath::Clamp(TypeIndex, 0, NumEnvelopeTypes - 1)];
+}
+
+void FNakamaRealtimeSocketCounters::RecordSent(int32 TypeIndex, const FString& Frame)
+{
+	FEnvelopeCounters& Counters = Envelopes[TypeIndex];
+	Counters.FramesSent.fetch_add(1, std::memory_order_relaxed);
+	Counters.BytesSent.fetch_add(Utf8Length(Frame), std::memory_order_relaxed);
+}
+
+void FNakamaRealtimeSocketCounters::RecordReceived(int32 TypeIndex, const FString& Frame)
+{
+	FEnvelopeCounters& Counters = Envelopes[TypeIndex];
+	Counters.FramesReceived.fetch_add(1, std::memory_order_relaxed);
+	Counters.BytesReceived.fetch_add(Utf8Length(Frame), std::memory_order_relaxed);
+}
+
+void FNakamaRealtimeSocketCounters::RecordDecode(uint64 Cycles, bool bSucceeded)
+{
+	DecodeCycles.fetch_add(Cycles, std::memory_order_relaxed);
+	UpdateMax(MaxDecodeCycles, Cycles);
+	if (!bSucceeded)
+	{
+		DecodeErrors.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+void FNakamaRealtimeSocketCounters::RecordDispatch(int32 TypeIndex, uint64 Cycles)
+{
+	Envelopes[TypeIndex].DispatchCycles.fetch_add(Cycles, std::memory_order_relaxed);
+	UpdateMax(MaxDispatchCycles, Cycles);
+}
+
+void FNakamaRealtimeSocketCounters::RecordQueued()
+{
+	const int64 Depth = SendQueueDepth.fetch_add(1, std::memory_order_relaxed) + 1;
+	UpdateMax(MaxSendQueueDepth, static_cast<uint64>(FMath::Max<int64>(Depth, 0)));
+}
+
+void FNakamaRealtimeSocketCounters::RecordWritten()
+{
+	SendQueueDepth.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void FNakamaRealtimeSocketCounters::ResetSendQueue()
+{
+	SendQueueDepth.store(0, std::memory_order_relaxed);
+}
+
+void FNakamaRealtimeSocketCounters::GetSnapshot(FNakamaRealtimeStats& OutStats) const
+{
+	OutStats.ElapsedSeconds = FPlatformTime::Seconds() - ResetTime.load(std::memory_order_relaxed);
+	OutStats.DecodeErrors = DecodeErrors.load(std::memory_order_relaxed);
+	OutStats.DecodeTimeMs = FPlatformTime::ToMilliseconds64(DecodeCycles.load(std::memory_order_relaxed));
+	OutStats.MaxDecodeTimeMs = FPlatformTime::ToMilliseconds64(MaxDecodeCycles.load(std::memory_order_relaxed));
+	OutStats.MaxDispatchTimeMs = FPlatformTime::ToMilliseconds64(MaxDispatchCycles.load(std::memory_order_relaxed));
+	// Can dip below zero briefly if a write is reported before its queued count lands
+	OutStats.SendQueueDepth = static_cast<int32>(FMath::Max<int64>(SendQueueDepth.load(std::memory_order_relaxed), 0));
+	OutStats.MaxSendQueueDepth = static_cast<int32>(MaxSendQueueDepth.load(std::memory_order_relaxed));
+
+	OutStats.FramesReceived = OutStats.BytesReceived = OutStats.FramesSent = OutStats.BytesSent = 0;
+	OutStats.DispatchTimeMs = 0.0;
+	OutStats.Envelopes.Reset();
+
+	for (int32 Index = 0; Index < NumEnvelopeTypes; ++Index)
+	{
+		const FEnvelopeCounters& Counters = Envelopes[Index];
+
+		FNakamaRealtimeEnvelopeStats Envelope;
+		Envelope.FramesReceived = Counters.FramesReceived.load(std::memory_order_relaxed);
+		Envelope.FramesSent = Counters.FramesSent.load(std::memory_order_relaxed);
+		if (Envelope.FramesReceived == 0 && Envelope.FramesSent == 0)
+		{
+			continue;
+		}
+
+		Envelope.Type = EnvelopeTypeNames[Index];
+		Envelope.BytesReceived = Counters.BytesReceived.load(std::memory_order_relaxed);
+		Envelope.BytesSent = Counters.BytesSent.load(std::memory_order_relaxed);
+		Envelope.DispatchTimeMs = FPlatformTime::ToMilliseconds64(Counters.DispatchCycles.load(std::memory_order_relaxed));
+
+		OutStats.FramesReceived += Envelope.FramesReceived;
+		OutStats.BytesReceived += Envelope.BytesReceived;
+		OutStats.FramesSent += Envelope.FramesSent;
+		OutStats.BytesSent += Envelope.BytesSent;
+		OutStats.DispatchTimeMs += Envelope.DispatchTimeMs;
+
+		OutStats.Envelopes.Add(MoveTemp(Envelope));
+	}
+}
+
+void FNakamaRealtimeSocketCounters::Reset()
+{
+	for (FEnvelopeCounters& Counters : Envelopes)
+	{
+		Counters.FramesReceived.store(0, std::memory_order_relaxed);
+		Counters.BytesReceived.store(0, std::memory_order_relaxed);
+		Counters.FramesSent.store(0, std::memory_order_relaxed);
+		Counters.BytesSent.store(0, std::memory_order_relaxed);
+		Counters.DispatchCycles.store(0, std::memory_order_relaxed);
+	}
+
+	DecodeErrors.store(0, std::memory_order_relaxed);
+	DecodeCycles.store(0, std::memory_order_relaxed);
+	MaxDecodeCycles.store(0, std::memory_order_relaxed);
+	MaxDispatchCycles.store(0, std::memory_order_relaxed);
+	// The depth is live state; only its peak restarts
+	MaxSendQueueDepth.store(FMath::Max<int64>(SendQueueDepth.load(std::memory_order_relaxed), 0), std::memory_order_relaxed);
+	ResetTime.store(FPlatformTime::Seconds(), std::memory_order_relaxed);
+}
@@ -22,6 +22,9 @@ FNakamaError FNakamaRetryInvoker::MakeTerminalError(ENakamaRequestOutcome Outcom
 	case ENakamaRequestOutcome::Cancelled:
 		// Expected outcome, not a transport fault; must not log at Error level.
 		return FNakamaUtils::CreateRequestCancelledError();
+	case ENakamaRequestOutcome::Rejected:
+		// Bounded queue overflow: retrying would only add to the backlog.
+		return FNakamaUtils::CreateRequestRejectedError();
 	default:
 		return FNakamaUtils::CreateRequestFailureError();
 	}
@@ -0,0 +1,644 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaStorageMirror.h"
+#include "NakamaClient.h"
+#include "NakamaSession.h"
+#include "NakamaUtils.h"
+#include "NakamaLoggingMacros.h"
+#include "NakamaHttpPipeline.h"
+#include "NakamaJsonMergePatch.h"
+#include "Dom/JsonObject.h"
+
+UNakamaStorageMirror* UNakamaStorageMirror::CreateStorageMirror(UNakamaClient* Client)
+{
+	UNakamaStorageMirror* Mirror = NewObject<UNakamaStorageMirror>();
+	Mirror->Client = Client;
+	return Mirror;
+}
+
+void UNakamaStorageMirror::ReadObjects(
+	UNakamaSession* Session,
+	const TArray<FNakamaReadStorageObjectId>& ObjectIds,
+	const TFunction<void(const TArray<FNakamaStoreObjectData>& Objects)>& SuccessCallback,
+	const TFunction<void(const FNakamaError& Error)>& ErrorCallback)
+{
+	TArray<FNakamaReadStorageObjectId> Missing;
+	for (const FNakamaReadStorageObjectId& ObjectId : ObjectIds)
+	{
+		const FEntry* Entry = Entries.Find(FObjectId{ ObjectId.Collection, ObjectId.Key, ObjectId.UserId });
+		if (!Entry || (Entry->ServerState == EServerState::Unknown && !Entry->IsDirty()))
+		{
+			Missing.Add(ObjectId);
+		}
+	}
+
+	// Collects the requested objects from the mirror once everything is in it.
+	TWeakObjectPtr<UNakamaStorageMirror> WeakThis(this);
+	auto Respond = [WeakThis, ObjectIds, SuccessCallback]()
+	{
+		UNakamaStorageMirror* Self = WeakThis.Get();
+		if (!Self)
+		{
+			return;
+		}
+
+		TArray<FNakamaStoreObjectData> Objects;
+		Objects.Reserve(ObjectIds.Num());
+		for (const FNakamaReadStorageObjectId& ObjectId : ObjectIds)
+		{
+			FNakamaStoreObjectData Object;
+			if (Self->GetObject(ObjectId.Collection, ObjectId.Key, ObjectId.UserId, Object))
+			{
+				Objects.Add(MoveTemp(Object));
+			}
+		}
+		if (SuccessCallback) { SuccessCallback(Objects); }
+	};
+
+	if (Missing.Num() == 0)
+	{
+		Respond();
+		return;
+	}
+
+	if (!FNakamaUtils::IsClientActive(Client))
+	{
+		if (ErrorCallback) { ErrorCallback(FNakamaUtils::HandleInvalidClient()); }
+		return;
+	}
+
+	auto successCallback = [WeakThis, Missing, Respond](const FNakamaStorageObjectList& List)
+	{
+		UNakamaStorageMirror* Self = WeakThis.Get();
+		if (!Self)
+		{
+			return;
+		}
+
+		for (const FNakamaStoreObjectData& Object : List.Objects)
+		{
+			Self->MergeServerObject(Object);
+		}
+
+		// Requested objects the server did not return do not exist.
+		for (const FNakamaReadStorageObjectId& ObjectId : Missing)
+		{
+			FEntry& Entry = Self->Entries.FindOrAdd(FObjectId{ ObjectId.Collection, ObjectId.Key, ObjectId.UserId });
+			if (Entry.ServerState == EServerState::Unknown)
+			{
+				Entry.ServerState = EServerState::Missing;
+				Entry.Object.Collection = ObjectId.Collection;
+				Entry.Object.Key = ObjectId.Key;
+				Entry.Object.UserId = ObjectId.UserId;
+			}
+		}
+		Respond();
+	};
+
+	Client->ReadStorageObjects(Session, Missing, successCallback, ErrorCallback);
+}
+
+void UNakamaStorageMirror::WriteObject(UNakamaSession* Session, const FNakamaStoreObjectWrite& Object)
+{
+	if (!IsValid(Session))
+	{
+		NAKAMA_LOG_ERROR(TEXT("Storage mirror: write ignored, the session is not valid."));
+		return;
+	}
+
+	WriteSession = Session;
+	const FObjectId Id{ Object.Collection, Object.Key, Session->GetUserId() };
+
+	FEntry& Entry = Entries.FindOrAdd(Id);
+	Entry.Object.Collection = Id.Collection;
+	Entry.Object.Key = Id.Key;
+	Entry.Object.UserId = Id.UserId;
+	Entry.Object.Value = Object.Value;
+	Entry.Object.PermissionRead = Object.PermissionRead;
+	Entry.Object.PermissionWrite = Object.PermissionWrite;
+	Entry.Revision++;
+
+	// A conflicted object keeps collecting local changes until it is resolved.
+	if (Entry.Conflict.IsSet())
+	{
+		Entry.Conflict->Local = MakeWrite(Entry);
+		return;
+	}
+
+	ScheduleFlush();
+}
+
+void UNakamaStorageMirror::Flush(
+	const TFunction<void(const FNakamaStoreObjectAcks& Acks)>& SuccessCallback,
+	const TFunction<void(const FNakamaError& Error)>& ErrorCallback)
+{
+	FirstPendingWriteTime = 0.0;
+
+	TArray<FObjectId> Batch;
+	TArray<FNakamaStoreObjectWrite> Writes;
+	for (TPair<FObjectId, FEntry>& Pair : Entries)
+	{
+		FEntry& Entry = Pair.Value;
+		if (Entry.IsDirty() && !Entry.Conflict.IsSet() && Entry.InFlightRevision == 0)
+		{
+			Entry.InFlightRevision = Entry.Revision;
+			Entry.InFlightValue = Entry.Object.Value;
+			Batch.Add(Pair.Key);
+			Writes.Add(MakeWrite(Entry));
+		}
+	}
+
+	if (Writes.Num() == 0)
+	{
+		if (SuccessCallback) { SuccessCallback(FNakamaStoreObjectAcks()); }
+		return;
+	}
+
+	TWeakObjectPtr<UNakamaStorageMirror> WeakThis(this);
+
+	auto successCallback = [WeakThis, Batch, SuccessCallback](const FNakamaStoreObjectAcks& Acks)
+	{
+		if (UNakamaStorageMirror* Self = WeakThis.Get())
+		{
+			bool bStillDirty = false;
+			for (const FObjectId& Id : Batch)
+			{
+				FEntry* Entry = Self->Entries.Find(Id);
+				if (!Entry)
+				{
+					continue; // cleared while in flight
+				}
+
+				const FNakamaStoreObjectAck* Ack = Acks.StorageObjects.FindByPredicate([&Id](const FNakamaStoreObjectAck& Candidate)
+				{
+					return Candidate.Collection == Id.Collection && Candidate.Key == Id.Key;
+				});
+				if (Ack)
+				{
+					Entry->ServerState = EServerState::Known;
+					Entry->ServerVersion = Ack->Version;
+					Entry->ServerValue = Entry->InFlightValue;
+					Entry->Object.Version = Ack->Version;
+				}
+				Entry->AckedRevision = Entry->InFlightRevision;
+				Entry->InFlightRevision = 0;
+				bStillDirty |= Entry->IsDirty();
+			}
+
+			// Changes made while the batch was in flight go out with the next one.
+			if (bStillDirty)
+			{
+				Self->ScheduleFlush();
+			}
+		}
+		if (SuccessCallback) { SuccessCallback(Acks); }
+	};
+
+	auto errorCallback = [WeakThis, Batch, ErrorCallback](const FNakamaError& Error)
+	{
+		if (UNakamaStorageMirror* Self = WeakThis.Get())
+		{
+			Self->HandleWriteError(Batch, Error, ErrorCallback);
+		}
+		else if (ErrorCallback)
+		{
+			ErrorCallback(Error);
+		}
+	};
+
+	if (!FNakamaUtils::IsClientActive(Client))
+	{
+		errorCallback(FNakamaUtils::HandleInvalidClient());
+		return;
+	}
+
+	FString PatchPayload;
+	int32 NumPatched = 0;
+	if (!MakePatchPayload(Batch, PatchPayload, NumPatched))
+	{
+		Client->WriteStorageObjects(WriteSession, Writes, successCallback, errorCallback);
+		return;
+	}
+
+	// Falls back to whole values when the server does not provide the RPC.
+	UNakamaSession* Session = WriteSession;
+	auto writeWhole = [WeakThis, Session, Writes, successCallback, errorCallback]()
+	{
+		UNakamaStorageMirror* Self = WeakThis.Get();
+		if (Self && FNakamaUtils::IsClientActive(Self->Client))
+		{
+			NAKAMA_LOGF_WARN(TEXT("Storage mirror: patch RPC '%s' is not available, writing whole values."), *Self->PatchRpcId);
+			Self->bPatchRpcMissing = true;
+			Self->Client->WriteStorageObjects(Session, Writes, successCallback, errorCallback);
+		}
+		else
+		{
+			errorCallback(FNakamaUtils::HandleInvalidClient());
+		}
+	};
+
+	auto rpcSuccessCallback = [WeakThis, NumPatched, Batch, successCallback, writeWhole](const FNakamaRPC& Rpc)
+	{
+		// Anything but one ack per object means the RPC is not a patch writer.
+		const FNakamaStoreObjectAcks Acks(Rpc.Payload);
+		if (Acks.StorageObjects.Num() != Batch.Num())
+		{
+			writeWhole();
+			return;
+		}
+
+		if (UNakamaStorageMirror* Self = WeakThis.Get())
+		{
+			Self->NumPatchedWrites += NumPatched;
+		}
+		successCallback(Acks);
+	};
+
+	auto rpcErrorCallback = [errorCallback, writeWhole](const FNakamaError& Error)
+	{
+		if (Error.Code == ENakamaErrorCode::NotFound || Error.Code == ENakamaErrorCode::Unimplemented)
+		{
+			writeWhole();
+			return;
+		}
+		errorCallback(Error);
+	};
+
+	Client->RPC(WriteSession, PatchRpcId, PatchPayload, rpcSuccessCallback, rpcErrorCallback);
+}
+
+bool UNakamaStorageMirror::MakePatchPayload(const TArray<FObjectId>& Batch, FString& OutPayload, int32& OutNumPatched) const
+{
+	if (PatchRpcId.IsEmpty() || bPatchRpcMissing)
+	{
+		return false;
+	}
+
+	OutNumPatched = 0;
+	TArray<TSharedPtr<FJsonValue>> Objects;
+	for (const FObjectId& Id : Batch)
+	{
+		const FEntry& Entry = Entries.FindChecked(Id);
+		const FNakamaStoreObjectWrite Write = MakeWrite(Entry);
+
+		const TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+		Object->SetStringField(TEXT("collection"), Write.Collection);
+		Object->SetStringField(TEXT("key"), Write.Key);
+		Object->SetStringField(TEXT("version"), Write.Version);
+		Object->SetNumberField(TEXT("permission_read"), static_cast<int32>(Write.PermissionRead));
+		Object->SetNumberField(TEXT("permission_write"), static_cast<int32>(Write.PermissionWrite));
+
+		// Patches only apply on top of a known server value, and only pay off when smaller.
+		FString Patch;
+		TSharedPtr<FJsonObject> PatchObject;
+		if (Entry.ServerState == EServerState::Known &&
+			FNakamaJsonMergePatch::Create(Entry.ServerValue, Write.Value, Patch) &&
+			Patch.Len() < Write.Value.Len())
+		{
+			PatchObject = FNakamaUtils::DeserializeJsonObject(Patch);
+		}
+
+		if (PatchObject.IsValid())
+		{
+			Object->SetObjectField(TEXT("patch"), PatchObject);
+			OutNumPatched++;
+		}
+		else
+		{
+			Object->SetStringField(TEXT("value"), Write.Value);
+		}
+		Objects.Add(MakeShared<FJsonValueObject>(Object));
+	}
+
+	if (OutNumPatched == 0)
+	{
+		return false;
+	}
+
+	const TSharedRef<FJsonObject> Payload = MakeShared<FJsonObject>();
+	Payload->SetArrayField(TEXT("objects"), Objects);
+	OutPayload = FNakamaUtils::EncodeJson(Payload);
+	return true;
+}
+
+void UNakamaStorageMirror::ResolveConflict(const FString& Collection, const FString& Key, const FString& UserId, bool bKeepLocal)
+{
+	const FObjectId Id{ Collection, Key, UserId };
+	FEntry* Entry = Entries.Find(Id);
+	if (!Entry || !Entry->Conflict.IsSet())
+	{
+		return;
+	}
+
+	const FNakamaStorageConflict Conflict = Entry->Conflict.GetValue();
+	Entry->Conflict.Reset();
+	Entry->ServerState = Conflict.bServerDeleted ? EServerState::Missing : EServerState::Known;
+	Entry->ServerVersion = Conflict.Server.Version;
+	Entry->ServerValue = Conflict.Server.Value;
+
+	if (bKeepLocal)
+	{
+		// Rebased on the server copy, so the next write replaces it.
+		Entry->Object.Version = Conflict.Server.Version;
+		ScheduleFlush();
+	}
+	else if (Conflict.bServerDeleted)
+	{
+		Entries.Remove(Id);
+	}
+	else
+	{
+		Entry->Object = Conflict.Server;
+		Entry->AckedRevision = Entry->Revision;
+	}
+}
+
+bool UNakamaStorageMirror::GetObject(const FString& Collection, const FString& Key, const FString& UserId, FNakamaStoreObjectData& OutObject) const
+{
+	const FEntry* Entry = Entries.Find(FObjectId{ Collection, Key, UserId });
+	if (!Entry || (Entry->ServerState != EServerState::Known && !Entry->IsDirty()))
+	{
+		return false;
+	}
+	OutObject = Entry->Object;
+	return true;
+}
+
+int32 UNakamaStorageMirror::GetNumPendingWrites() const
+{
+	int32 NumPending = 0;
+	for (const TPair<FObjectId, FEntry>& Pair : Entries)
+	{
+		NumPending += Pair.Value.IsDirty() ? 1 : 0;
+	}
+	return NumPending;
+}
+
+int32 UNakamaStorageMirror::GetNumConflicts() const
+{
+	int32 NumConflicts = 0;
+	for (const TPair<FObjectId, FEntry>& Pair : Entries)
+	{
+		NumConflicts += Pair.Value.Conflict.IsSet() ? 1 : 0;
+	}
+	return NumConflicts;
+}
+
+void UNakamaStorageMirror::Clear()
+{
+	Entries.Empty();
+	FirstPendingWriteTime = 0.0;
+}
+
+void UNakamaStorageMirror::ScheduleFlush()
+{
+	const double Now = FPlatformTime::Seconds();
+	LastWriteTime = Now;
+	if (FirstPendingWriteTime == 0.0)
+	{
+		FirstPendingWriteTime = Now;
+	}
+
+	if (!bFlushScheduled)
+	{
+		bFlushScheduled = true;
+		TWeakObjectPtr<UNakamaStorageMirror> WeakThis(this);
+		FNakamaHttpPipeline::Delay(FlushDelaySeconds, [WeakThis]()
+		{
+			if (UNakamaStorageMirror* Self = WeakThis.Get())
+			{
+				Self->HandleFlushTimer();
+			}
+		});
+	}
+}
+
+void UNakamaStorageMirror::HandleFlushTimer()
+{
+	bFlushScheduled = false;
+	if (FirstPendingWriteTime == 0.0)
+	{
+		return; // flushed explicitly in the meantime
+	}
+
+	// Debounce: wait for a quiet period, but never longer than the max delay.
+	const double Now = FPlatformTime::Seconds();
+	const double Due = FMath::Min(LastWriteTime + FlushDelaySeconds, FirstPendingWriteTime + MaxFlushDelaySeconds);
+	if (Now < Due)
+	{
+		bFlushScheduled = true;
+		TWeakObjectPtr<UNakamaStorageMirror> WeakThis(this);
+		FNakamaHttpPipeline::Delay(static_cast<float>(Due - Now), [WeakThis]()
+		{
+			if (UNakamaStorageMirror* Self = WeakThis.Get())
+			{
+				Self->HandleFlushTimer();
+			}
+		});
+		return;
+	}
+
+	// Without an error callback, failures go to FlushFailedEvent.
+	Flush(nullptr, nullptr);
+}
+
+void UNakamaStorageMirror::HandleWriteError(
+	const TArray<FObjectId>& Batch,
+	const FNakamaError& Error,
+	const TFunction<void(const FNakamaError& Error)>& ErrorCallback)
+{
+	for (const FObjectId& Id : Batch)
+	{
+		if (FEntry* Entry = Entries.Find(Id))
+		{
+			Entry->InFlightRevision = 0;
+		}
+	}
+
+	// The server refuses the whole batch when any version check fails.
+	const bool bMaybeConflict =
+		Error.Code == ENakamaErrorCode::InvalidArgument ||
+		Error.Code == ENakamaErrorCode::FailedPrecondition ||
+		Error.Code == ENakamaErrorCode::AlreadyExists;
+	if (bMaybeConflict && FNakamaUtils::IsClientActive(Client))
+	{
+		DetectConflicts(Batch, Error, ErrorCallback);
+		return;
+	}
+
+	// Other failures keep the changes pending for the next write or Flush.
+	ReportFlushError(Error, ErrorCallback);
+}
+
+void UNakamaStorageMirror::DetectConflicts(
+	const TArray<FObjectId>& Batch,
+	const FNakamaError& Error,
+	const TFunction<void(const FNakamaError& Error)>& ErrorCallback)
+{
+	TArray<FNakamaReadStorageObjectId> ObjectIds;
+	for (const FObjectId& Id : Batch)
+	{
+		FNakamaReadStorageObjectId& ObjectId = ObjectIds.AddDefaulted_GetRef();
+		ObjectId.Collection = Id.Collection;
+		ObjectId.Key = Id.Key;
+		ObjectId.UserId = Id.UserId;
+	}
+
+	TWeakObjectPtr<UNakamaStorageMirror> WeakThis(this);
+	auto successCallback = [WeakThis, Batch, Error, ErrorCallback](const FNakamaStorageObjectList& List)
+	{
+		UNakamaStorageMirror* Self = WeakThis.Get();
+		if (!Self)
+		{
+			return;
+		}
+
+		TArray<FNakamaStorageConflict> Conflicts;
+		for (const FObjectId& Id : Batch)
+		{
+			FEntry* Entry = Self->Entries.Find(Id);
+			if (!Entry || !Entry->IsDirty())
+			{
+				continue;
+			}
+
+			const FNakamaStoreObjectData* Server = List.Objects.FindByPredicate([&Id](const FNakamaStoreObjectData& Candidate)
+			{
+				return Candidate.Collection == Id.Collection && Candidate.Key == Id.Key;
+			});
+
+			// Already holds the local value, e.g. written by an earlier request of a split batch.
+			if (Server && Server->Value == Entry->Object.Value)
+			{
+				Entry->ServerState = EServerState::Known;
+				Entry->ServerVersion = Server->Version;
+				Entry->ServerValue = Server->Value;
+				Entry->Object.Version = Server->Version;
+				Entry->AckedRevision = Entry->Revision;
+				continue;
+			}
+
+			const bool bChanged =
+				(Entry->ServerState == EServerState::Known && (!Server || Server->Version != Entry->ServerVersion)) ||
+				(Entry->ServerState == EServerState::Missing && Server);
+			if (!bChanged)
+			{
+				continue;
+			}
+
+			FNakamaStorageConflict& Conflict = Conflicts.AddDefaulted_GetRef();
+			Conflict.Local = MakeWrite(*Entry);
+			Conflict.bServerDeleted = Server == nullptr;
+			if (Server)
+			{
+				Conflict.Server = *Server;
+			}
+			else
+			{
+				Conflict.Server.Collection = Id.Collection;
+				Conflict.Server.Key = Id.Key;
+				Conflict.Server.UserId = Id.UserId;
+			}
+			Entry->Conflict = Conflict;
+		}
+
+		// Nothing changed on the server, so the write was refused for another reason.
+		if (Conflicts.Num() == 0)
+		{
+			Self->ReportFlushError(Error, ErrorCallback);
+			return;
+		}
+
+		NAKAMA_LOGF_WARN(TEXT("Storage mirror: %d object(s) changed on the server, holding local changes until resolved."), Conflicts.Num());
+		for (const FNakamaStorageConflict& Conflict : Conflicts)
+		{
+			Self->ConflictEvent.Broadcast(Conflict);
+		}
+
+		// The rest of the refused batch can go out again.
+		if (Self->GetNumPendingWrites() > Self->GetNumConflicts())
+		{
+			Self->ScheduleFlush();
+		}
+		if (ErrorCallback) { ErrorCallback(Error); }
+	};
+
+	auto errorCallback = [WeakThis, Error, ErrorCallback](const FNakamaError&)
+	{
+		if (UNakamaStorageMirror* Self = WeakThis.Get())
+		{
+			Self->ReportFlushError(Error, ErrorCallback);
+		}
+	};
+
+	Client->ReadStorageObjects(WriteSession, ObjectIds, successCallback, errorCallback);
+}
+
+void UNakamaStorageMirror::ReportFlushError(const FNakamaError& Error, const TFunction<void(const FNakamaError& Error)>& ErrorCallback)
+{
+	if (ErrorCallback)
+	{
+		ErrorCallback(Error);
+	}
+	else
+	{
+		FlushFailedEvent.Broadcast(Error);
+	}
+}
+
+void UNakamaStorageMirror::MergeServerObject(const FNakamaStoreObjectData& Object)
+{
+	FEntry& Entry = Entries.FindOrAdd(FObjectId{ Object.Collection, Object.Key, Object.UserId });
+	Entry.ServerState = EServerState::Known;
+	Entry.ServerVersion = Object.Version;
+	Entry.ServerValue = Object.Value;
+
+	if (Entry.IsDirty())
+	{
+		// Keep the unsent value; the write is checked against this version.
+		Entry.Object.Version = Object.Version;
+		Entry.Object.CreateTime = Object.CreateTime;
+		Entry.Object.UpdateTime = Object.UpdateTime;
+	}
+	else
+	{
+		Entry.Object = Object;
+	}
+}
+
+FNakamaStoreObjectWrite UNakamaStorageMirror::MakeWrite(const FEntry& Entry)
+{
+	FNakamaStoreObjectWrite Write;
+	Write.Collection = Entry.Object.Collection;
+	Write.Key = Entry.Object.Key;
+	Write.Value = Entry.Object.Value;
+	Write.PermissionRead = Entry.Object.PermissionRead;
+	Write.PermissionWrite = Entry.Object.PermissionWrite;
+
+	switch (Entry.ServerState)
+	{
+	case EServerState::Known:
+		Write.Version = Entry.ServerVersion;
+		break;
+	case EServerState::Missing:
+		Write.Version = TEXT("*"); // create only
+		break;
+	default:
+		break; // never read: no check
+	}
+	return Write;
+}
@@ -0,0 +1,334 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NakamaUserDirectory.h"
+#include "NakamaClient.h"
+#include "NakamaRealtimeClient.h"
+#include "NakamaSession.h"
+#include "NakamaUtils.h"
+#include "NakamaHttpPipeline.h"
+
+UNakamaUserDirectory* UNakamaUserDirectory::CreateUserDirectory(UNakamaClient* Client, int32 MaxEntries)
+{
+	UNakamaUserDirectory* Directory = NewObject<UNakamaUserDirectory>();
+	Directory->Client = Client;
+	Directory->Entries.Empty(MaxEntries > 0 ? MaxEntries : static_cast<int32>(DefaultMaxEntries));
+	return Directory;
+}
+
+void UNakamaUserDirectory::GetUsers(
+	UNakamaSession* Session,
+	const TArray<FString>& UserIds,
+	const TFunction<void(const TArray<FNakamaUser>& Users)>& SuccessCallback,
+	const TFunction<void(const FNakamaError& Error)>& ErrorCallback)
+{
+	if (!FNakamaUtils::IsClientActive(Client))
+	{
+		if (ErrorCallback) { ErrorCallback(FNakamaUtils::HandleInvalidClient()); }
+		return;
+	}
+
+	const TSharedRef<FLookup> Lookup = MakeShared<FLookup>();
+	Lookup->UserIds = UserIds;
+	Lookup->OnSuccess = SuccessCallback;
+	Lookup->OnError = ErrorCallback;
+
+	const double Now = FPlatformTime::Seconds();
+	TSet<FString> Missing;
+	for (const FString& UserId : UserIds)
+	{
+		const FEntry* Entry = Entries.FindAndTouch(UserId);
+		if (Entry && Entry->ExpiresAt > Now)
+		{
+			Lookup->Found.Add(UserId, Entry->User);
+		}
+		else if (!UserId.IsEmpty())
+		{
+			Missing.Add(UserId);
+		}
+	}
+
+	if (Missing.Num() == 0)
+	{
+		Complete(*Lookup);
+		return;
+	}
+
+	BatchSession = Session;
+	Lookup->NumOutstanding = Missing.Num();
+	for (const FString& UserId : Missing)
+	{
+		TArray<TSharedRef<FLookup>>* Pending = Waiters.Find(UserId);
+		if (!Pending)
+		{
+			// Not queued or in flight yet.
+			Pending = &Waiters.Add(UserId);
+			QueuedIds.Add(UserId);
+		}
+		Pending->Add(Lookup);
+	}
+
+	ScheduleFlush();
+}
+
+bool UNakamaUserDirectory::FindUser(const FString& UserId, FNakamaUser& OutUser) const
+{
+	const FEntry* Entry = Entries.Find(UserId);
+	if (!Entry || Entry->ExpiresAt <= FPlatformTime::Seconds())
+	{
+		return false;
+	}
+	OutUser = Entry->User;
+	return true;
+}
+
+void UNakamaUserDirectory::BindRealtimeClient(UNakamaRealtimeClient* RealtimeClient)
+{
+	if (UNakamaRealtimeClient* Previous = BoundRealtimeClient.Get())
+	{
+		Previous->PresenceStatusReceivedNative.Remove(PresenceHandles[0]);
+		Previous->ChannelPresenceEventReceivedNative.Remove(PresenceHandles[1]);
+		Previous->MatchmakerPresenceCallbackNative.Remove(PresenceHandles[2]);
+	}
+	PresenceHandles.Reset();
+	BoundRealtimeClient = RealtimeClient;
+
+	if (RealtimeClient)
+	{
+		PresenceHandles.Add(RealtimeClient->PresenceStatusReceivedNative.AddUObject(this, &UNakamaUserDirectory::HandleStatusPresence));
+		PresenceHandles.Add(RealtimeClient->ChannelPresenceEventReceivedNative.AddUObject(this, &UNakamaUserDirectory::HandleChannelPresence));
+		PresenceHandles.Add(RealtimeClient->MatchmakerPresenceCallbackNative.AddUObject(this, &UNakamaUserDirectory::HandleMatchPresence));
+	}
+}
+
+void UNakamaUserDirectory::Invalidate(const FString& UserId)
+{
+	Entries.Remove(UserId);
+}
+
+void UNakamaUserDirectory::Clear()
+{
+	Entries.Empty(Entries.Max());
+}
+
+int32 UNakamaUserDirectory::Num() const
+{
+	return Entries.Num();
+}
+
+void UNakamaUserDirectory::BeginDestroy()
+{
+	BindRealtimeClient(nullptr);
+	Super::BeginDestroy();
+}
+
+void UNakamaUserDirectory::ScheduleFlush()
+{
+	if (QueuedIds.Num() >= MaxBatchSize || BatchWindowSeconds <= 0.0f)
+	{
+		Flush();
+		return;
+	}
+
+	if (!bFlushScheduled)
+	{
+		bFlushScheduled = true;
+		TWeakObjectPtr<UNakamaUserDirectory> WeakThis(this);
+		FNakamaHttpPipeline::Delay(BatchWindowSeconds, [WeakThis]()
+		{
+			if (UNakamaUserDirectory* Self = WeakThis.Get())
+			{
+				Self->Flush();
+			}
+		});
+	}
+}
+
+void UNakamaUserDirectory::Flush()
+{
+	// A pending timer that fires after an early flush finds nothing queued.
+	bFlushScheduled = false;
+	const int32 BatchSize = FMath::Max(MaxBatchSize, 1);
+
+	TArray<FString> Ids = MoveTemp(QueuedIds);
+	QueuedIds.Reset();
+	for (int32 Start = 0; Start < Ids.Num(); Start += BatchSize)
+	{
+		SendBatch(TArray<FString>(Ids.GetData() + Start, FMath::Min(BatchSize, Ids.Num() - Start)));
+	}
+}
+
+void UNakamaUserDirectory::SendBatch(const TArray<FString>& UserIds)
+{
+	NumRequests++;
+	TWeakObjectPtr<UNakamaUserDirectory> WeakThis(this);
+
+	auto successCallback = [WeakThis, UserIds](const FNakamaUserList& UserList)
+	{
+		UNakamaUserDirectory* Self = WeakThis.Get();
+		if (!Self)
+		{
+			return;
+		}
+
+		const double ExpiresAt = FPlatformTime::Seconds() + Self->TimeToLiveSeconds;
+		for (const FNakamaUser& User : UserList.Users)
+		{
+			Self->Entries.Add(User.Id, FEntry{ User, ExpiresAt });
+			Self->Resolve(User.Id, &User);
+		}
+
+		// IDs the server does not know resolve without a user.
+		for (const FString& UserId : UserIds)
+		{
+			Self->Resolve(UserId, nullptr);
+		}
+	};
+
+	auto errorCallback = [WeakThis, UserIds](const FNakamaError& Error)
+	{
+		if (UNakamaUserDirectory* Self = WeakThis.Get())
+		{
+			for (const FString& UserId : UserIds)
+			{
+				Self->Fail(UserId, Error);
+			}
+		}
+	};
+
+	if (!FNakamaUtils::IsClientActive(Client))
+	{
+		errorCallback(FNakamaUtils::HandleInvalidClient());
+		return;
+	}
+
+	Client->GetUsers(BatchSession, UserIds, {}, {}, successCallback, errorCallback);
+}
+
+void UNakamaUserDirectory::Resolve(const FString& UserId, const FNakamaUser* User)
+{
+	TArray<TSharedRef<FLookup>> Pending;
+	if (!Waiters.RemoveAndCopyValue(UserId, Pending))
+	{
+		return;
+	}
+
+	for (const TSharedRef<FLookup>& Lookup : Pending)
+	{
+		if (User)
+		{
+			Lookup->Found.Add(UserId, *User);
+		}
+		if (--Lookup->NumOutstanding == 0)
+		{
+			Complete(*Lookup);
+		}
+	}
+}
+
+void UNakamaUserDirectory::Fail(const FString& UserId, const FNakamaError& Error)
+{
+	TArray<TSharedRef<FLookup>> Pending;
+	if (!Waiters.RemoveAndCopyValue(UserId, Pending))
+	{
+		return;
+	}
+
+	// A lookup spanning several batches reports only the first failure.
+	for (const TSharedRef<FLookup>& Lookup : Pending)
+	{
+		if (!Lookup->bFinished)
+		{
+			Lookup->bFinished = true;
+			if (Lookup->OnError)
+			{
+				Lookup->OnError(Error);
+			}
+		}
+	}
+}
+
+void UNakamaUserDirectory::Complete(FLookup& Lookup)
+{
+	if (Lookup.bFinished)
+	{
+		return;
+	}
+	Lookup.bFinished = true;
+
+	TArray<FNakamaUser> Users;
+	Users.Reserve(Lookup.UserIds.Num());
+	for (const FString& UserId : Lookup.UserIds)
+	{
+		if (const FNakamaUser* User = Lookup.Found.Find(UserId))
+		{
+			Users.Add(*User);
+		}
+	}
+
+	if (Lookup.OnSuccess)
+	{
+		Lookup.OnSuccess(Users);
+	}
+}
+
+void UNakamaUserDirectory::RefreshPresence(const FNakamaUserPresence& Presence, bool bOnline)
+{
+	// Only users already cached are refreshed; presences carry too little to create entries.
+	const FEntry* Entry = Entries.Find(Presence.UserID);
+	if (!Entry)
+	{
+		return;
+	}
+
+	FEntry Updated = *Entry;
+	Updated.User.Online = bOnline;
+	if (!Presence.Username.IsEmpty())
+	{
+		Updated.User.Username = Presence.Username;
+	}
+	Entries.Add(Presence.UserID, MoveTemp(Updated));
+}
+
+void UNakamaUserDirectory::HandleStatusPresence(const FNakamaStatusPresenceEvent& Event)
+{
+	for (const FNakamaUserPresence& Presence : Event.Joins)
+	{
+		RefreshPresence(Presence, true);
+	}
+
+	// Status leaves are the only events that mean the user went offline.
+	for (const FNakamaUserPresence& Presence : Event.Leaves)
+	{
+		RefreshPresence(Presence, false);
+	}
+}
+
+void UNakamaUserDirectory::HandleChannelPresence(const FNakamaChannelPresenceEvent& Event)
+{
+	for (const FNakamaUserPresence& Presence : Event.Joins)
+	{
+		RefreshPresence(Presence, true);
+	}
+}
+
+void UNakamaUserDirectory::HandleMatchPresence(const FNakamaMatchPresenceEvent& Event)
+{
+	for (const FNakamaUserPresence& Presence : Event.Joins)
+	{
+		RefreshPresence(Presence, true);
+	}
+}
@@ -71,6 +71,15 @@ void FNakamaUtils::HandleJsonSerializationFailure(const TFunction<void(const FNa
 		Error.Message = TEXT("Request cancelled or client released before completion.");
 		return Error;
 	}
+
+	FNakamaError FNakamaUtils::CreateRequestRejectedError()
+	{
+		NAKAMA_LOG_WARN(TEXT("Request rejected: the request queue is full."));
+		FNakamaError Error;
+		Error.Code = ENakamaErrorCode::ResourceExhausted;
+		Error.Message = TEXT("Request rejected: the request queue is full.");
+		return Error;
+	}
 	
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> FNakamaUtils::MakeRequest(const FString& URL, const FString& Content, ENakamaRequestMethod RequestMethod, const FString& SessionToken, float Timeout)
 	{
@@ -108,6 +117,6 @@ void FNakamaUtils::HandleJsonSerializationFailure(const TFunction<void(const FNa
 
 		//NAKAMA_LOG_INFO(TEXT("..."));
 		//NAKAMA_LOG_INFO(FString::Printf(TEXT("Making Request to %s"), *Endpoint));
-		NAKAMA_LOG_INFO(FString::Printf(TEXT("Making %s request to %s with content: %s"), *VerbString, *URL, *Content));
+		NAKAMA_LOGF_INFO(TEXT("Making %s request to %s with content: %s"), *VerbString, *URL, *Content);
 		return HttpRequest;
 	}
@@ -0,0 +1,201 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NakamaError.h"
+#include "NakamaChannelTypes.h"
+#include "NakamaChatHistory.generated.h"
+
+class UNakamaClient;
+class UNakamaRealtimeClient;
+class UNakamaSession;
+struct FNakamaDisconnectInfo;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnNakamaChatHistoryChanged, const FString&, ChannelId);
+
+/**
+ * Per-channel store of chat messages that merges history pages with live
+ * messages from the socket.
+ *
+ * Each channel keeps its newest messages (up to the capacity given on
+ * creation) ordered by CreateTime, with MessageId used to drop duplicates and
+ * apply updates and removals. When bound to a realtime client, a disconnect
+ * marks loaded channels as having a gap; after reconnecting, only the missing
+ * range is fetched by paging back from the newest message until a known one
+ * is reached.
+ *
+ * All methods must be called on the game thread.
+ */
+UCLASS(BlueprintType)
+class NAKAMAUNREAL_API UNakamaChatHistory : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	 * Creates a history store bound to a client.
+	 *
+	 * @param Client The client used for ListChannelMessages requests.
+	 * @param MaxMessagesPerChannel Messages kept per channel before the oldest are dropped.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Chat")
+	static UNakamaChatHistory* CreateChatHistory(UNakamaClient* Client, int32 MaxMessagesPerChannel = 200);
+
+	/** Messages per ListChannelMessages request. */
+	UPROPERTY(BlueprintReadWrite, Category = "Nakama|Chat")
+	int32 PageSize = 50;
+
+	/** Most pages fetched to close one gap; anything older stays missing. */
+	UPROPERTY(BlueprintReadWrite, Category = "Nakama|Chat")
+	int32 MaxBackfillPages = 10;
+
+	/** Fired when the messages of a channel change. */
+	UPROPERTY(BlueprintAssignable, Category = "Nakama|Chat")
+	FOnNakamaChatHistoryChanged ChangedEvent;
+
+	/**
+	 * Merge live messages from a realtime client and backfill gaps after it
+	 * reconnects. Pass null to unbind.
+	 */
+	void BindRealtimeClient(UNakamaRealtimeClient* RealtimeClient);
+
+	/**
+	 * Get the messages of a channel, fetching the newest page the first time
+	 * and the missing range if there is a gap.
+	 *
+	 * @param Session The session of the user, also used for backfills after reconnecting.
+	 * @param ChannelId The channel, as returned by JoinChat.
+	 * @param SuccessCallback Called with the cached messages, oldest first.
+	 * @param ErrorCallback Called if a request fails.
+	 */
+	void LoadHistory(
+		UNakamaSession* Session,
+		const FString& ChannelId,
+		const TFunction<void(const TArray<FNakamaChannelMessage>& Messages)>& SuccessCallback,
+		const TFunction<void(const FNakamaError& Error)>& ErrorCallback
+	);
+
+	/**
+	 * Fetch the page before the oldest one loaded. Messages past the capacity
+	 * are passed to the callback but not kept.
+	 *
+	 * @param SuccessCallback Called with the page, oldest first, and whether older messages remain.
+	 */
+	void LoadOlder(
+		UNakamaSession* Session,
+		const FString& ChannelId,
+		const TFunction<void(const TArray<FNakamaChannelMessage>& Messages, bool bHasMore)>& SuccessCallback,
+		const TFunction<void(const FNakamaError& Error)>& ErrorCallback
+	);
+
+	/**
+	 * Fetch messages newer than the newest known one, paging back from the
+	 * newest until a known message is reached.
+	 *
+	 * @param SuccessCallback Called with the number of messages added.
+	 */
+	void Backfill(
+		UNakamaSession* Session,
+		const FString& ChannelId,
+		const TFunction<void(int32 NumAdded)>& SuccessCallback,
+		const TFunction<void(const FNakamaError& Error)>& ErrorCallback
+	);
+
+	/** Merge one message, e.g. from a realtime event not routed through BindRealtimeClient. */
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Chat")
+	void AddMessage(const FNakamaChannelMessage& Message);
+
+	/** @return The cached messages of a channel, oldest first. */
+	UFUNCTION(BlueprintPure, Category = "Nakama|Chat")
+	TArray<FNakamaChannelMessage> GetMessages(const FString& ChannelId) const;
+
+	/** @return True if messages may be missing after the newest cached one. */
+	UFUNCTION(BlueprintPure, Category = "Nakama|Chat")
+	bool HasGap(const FString& ChannelId) const;
+
+	/** Mark a channel as possibly missing messages, e.g. after leaving and rejoining it. */
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Chat")
+	void MarkGap(const FString& ChannelId);
+
+	/** @return Number of ListChannelMessages requests sent, for profiling. */
+	UFUNCTION(BlueprintPure, Category = "Nakama|Chat")
+	int32 GetNumRequests() const { return NumRequests; }
+
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Chat")
+	void RemoveChannel(const FString& ChannelId);
+
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Chat")
+	void Clear();
+
+	virtual void BeginDestroy() override;
+
+private:
+
+	UPROPERTY()
+	UNakamaClient* Client;
+
+	// Session of the latest load, used for backfills after reconnecting.
+	UPROPERTY()
+	UNakamaSession* BackfillSession;
+
+	int32 MaxMessagesPerChannel = 200;
+
+	struct FChannel
+	{
+		// Oldest first.
+		TArray<FNakamaChannelMessage> Messages;
+		TSet<FString> MessageIds;
+
+		// Where LoadOlder continues; empty once the start of the channel was reached.
+		FString OlderCursor;
+		bool bLoaded = false;
+		bool bGap = false;
+		bool bBackfilling = false;
+
+		// CreateTime of the newest message when the gap was marked; a backfill stops once it reaches it.
+		FDateTime GapAnchor = FDateTime::MinValue();
+
+		// Callers waiting on the backfill in progress.
+		TArray<TFunction<void(int32 NumAdded)>> OnBackfilled;
+		TArray<TFunction<void(const FNakamaError& Error)>> OnBackfillError;
+	};
+
+	TMap<FString, FChannel> Channels;
+	int32 NumRequests = 0;
+
+	TWeakObjectPtr<UNakamaRealtimeClient> BoundRealtimeClient;
+	TArray<FDelegateHandle> RealtimeHandles;
+
+	// Merge a message into a channel; false if nothing changed.
+	bool InsertMessage(FChannel& Channel, const FNakamaChannelMessage& Message);
+
+	void FetchPage(
+		UNakamaSession* Session,
+		const FString& ChannelId,
+		const FString& Cursor,
+		const TFunction<void(const FNakamaChannelMessageList& Page)>& OnPage,
+		const TFunction<void(const FNakamaError& Error)>& OnError);
+
+	void ContinueBackfill(UNakamaSession* Session, const FString& ChannelId, const FString& Cursor, int32 PagesLeft, int32 NumAdded);
+	void FinishBackfill(const FString& ChannelId, int32 NumAdded, const FNakamaError* Error);
+
+	void HandleChannelMessage(const FNakamaChannelMessage& Message);
+	void HandleDisconnected(const FNakamaDisconnectInfo& Info);
+	void HandleConnected();
+};
@@ -33,6 +33,7 @@
 #include "NakamaSession.h"
 #include "Interfaces/IHttpRequest.h"
 #include "HttpModule.h"
+#include "NakamaHttpPipeline.h"
 
 #include "NakamaClient.generated.h"
 
@@ -148,6 +149,18 @@ public:
 	UPROPERTY(BlueprintReadWrite, Category = "Nakama|Retry")
 	int32 RetryMaxAttempts = 4;
 
+	/** Most objects sent in one storage write, read or delete request; larger calls are split into several requests. */
+	UPROPERTY(BlueprintReadWrite, Category = "Nakama|Storage")
+	int32 StorageBatchMaxObjects = 100;
+
+	/** Largest storage request body in bytes; keep below the server's socket.max_request_size_bytes (256 KiB by default). */
+	UPROPERTY(BlueprintReadWrite, Category = "Nakama|Storage")
+	int32 StorageBatchMaxBytes = 240 * 1024;
+
+	/** Split storage requests in flight at once. */
+	UPROPERTY(BlueprintReadWrite, Category = "Nakama|Storage")
+	int32 StorageBatchMaxParallel = 2;
+
 	UPROPERTY(BlueprintAssignable, Category = "Nakama|Events")
 	FOnDisconnected DisconnectedEvent;
 
@@ -2883,6 +2896,10 @@ public:
 	/**
 	 * Write objects to the storage engine.
 	 *
+	 * Calls over StorageBatchMaxObjects or StorageBatchMaxBytes are split into
+	 * several requests. Each request is applied atomically, but not the call as
+	 * a whole: on failure, earlier requests may already be written.
+	 *
 	 * @param Objects The objects to write.
 	 * @param Session The session of the user.
 	 * @param SuccessCallback Callback invoked upon successfully writing storage objects.
@@ -3058,6 +3075,31 @@ private:
 	// Build the retry configuration from current client settings.
 	FNakamaRetryConfiguration BuildRetryConfiguration() const;
 
+	// Join serialized storage objects into request bodies within the StorageBatch* limits.
+	bool BuildStorageBatches(const FString& ArrayField, const TArray<TSharedPtr<FJsonObject>>& Objects, TArray<FString>& OutBodies) const;
+
+	// Progress of one storage call split into several requests.
+	struct FStorageBatchState;
+
+	/**
+	 * Send storage request bodies, at most StorageBatchMaxParallel at a time.
+	 * Each request retries transient failures on its own. OnBatch receives every
+	 * response with the index of its body and OnComplete runs once all succeeded.
+	 * The first failure is reported and stops further sends; requests already
+	 * sent are not rolled back.
+	 */
+	void SendStorageBatches(
+		UNakamaSession* Session,
+		const FString& Endpoint,
+		ENakamaRequestMethod Method,
+		const TArray<FString>& Bodies,
+		const TFunction<void(int32 BatchIndex, const FString& ResponseBody)>& OnBatch,
+		const TFunction<void()>& OnComplete,
+		const TFunction<void(const FNakamaError& Error)>& ErrorCallback
+	);
+
+	void SendNextStorageBatch(const TSharedRef<FStorageBatchState>& State);
+
 	/**
 	 * Centralized JSON request send with transient-failure retry (exponential
 	 * backoff + jitter). Builds a fresh request per attempt and retries
@@ -3106,9 +3148,8 @@ private:
 		const TFunction<void(const FNakamaError& Error)>& ErrorCallback
 	);
 
-	// Requests
-	TArray<FHttpRequestPtr> ActiveRequests;
-	FCriticalSection ActiveRequestsMutex;
+	// Requests of this client on the shared transport (see FNakamaHttpPipeline).
+	TSharedRef<FNakamaHttpRequestGroup, ESPMode::ThreadSafe> HttpRequests = MakeShared<FNakamaHttpRequestGroup, ESPMode::ThreadSafe>();
 
 };
 
@@ -0,0 +1,220 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NakamaError.h"
+#include "NakamaFriend.h"
+#include "NakamaPresence.h"
+#include "NakamaFriendGraph.generated.h"
+
+class UNakamaClient;
+class UNakamaRealtimeClient;
+class UNakamaSession;
+struct FNakamaStatus;
+struct FNakamaStatusPresenceEvent;
+struct FNakamaDisconnectInfo;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnNakamaFriendGraphChanged);
+
+/**
+ * Local copy of the user's friends, invites and blocked users, with live
+ * status from the realtime client laid over it.
+ *
+ * Refresh walks every ListFriends page once; the result can be persisted per
+ * user so the social UI has its list before any request returns. Add, delete
+ * and block calls update the local copy from their result instead of listing
+ * again. When bound to a realtime client, friends are followed in batches
+ * (again after every reconnect) and status events update who is online.
+ *
+ * All methods must be called on the game thread.
+ */
+UCLASS(BlueprintType)
+class NAKAMAUNREAL_API UNakamaFriendGraph : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	 * Creates a friend graph bound to a client.
+	 *
+	 * @param Client The client used for friend requests.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Friends")
+	static UNakamaFriendGraph* CreateFriendGraph(UNakamaClient* Client);
+
+	/** Friends requested per ListFriends page. */
+	UPROPERTY(BlueprintReadWrite, Category = "Nakama|Friends")
+	int32 PageSize = 100;
+
+	/** Upper bound on pages fetched by one Refresh. */
+	UPROPERTY(BlueprintReadWrite, Category = "Nakama|Friends")
+	int32 MaxPages = 50;
+
+	/** Most user IDs per FollowUsers message. */
+	UPROPERTY(BlueprintReadWrite, Category = "Nakama|Friends")
+	int32 MaxFollowBatchSize = 100;
+
+	/** When true (default), the graph is saved after every change once Load has been called. */
+	UPROPERTY(BlueprintReadWrite, Category = "Nakama|Friends")
+	bool bAutoSave = true;
+
+	/** Fired whenever a relationship or a friend's status changes. */
+	UPROPERTY(BlueprintAssignable, Category = "Nakama|Friends")
+	FOnNakamaFriendGraphChanged ChangedEvent;
+
+	/** Follow friends on a realtime client and apply its status events. Pass null to unbind. */
+	void BindRealtimeClient(UNakamaRealtimeClient* RealtimeClient);
+
+	/**
+	 * List all friends, invites and blocked users and replace the local copy.
+	 * Concurrent calls share one refresh.
+	 *
+	 * @param Session The session of the user.
+	 * @param SuccessCallback Called with the number of relationships held.
+	 * @param ErrorCallback Called if a page request fails; the previous copy is kept.
+	 */
+	void Refresh(
+		UNakamaSession* Session,
+		const TFunction<void(int32 NumFriends)>& SuccessCallback,
+		const TFunction<void(const FNakamaError& Error)>& ErrorCallback
+	);
+
+	/** Send friend requests or accept invites, then update the local copy. */
+	void AddFriends(
+		UNakamaSession* Session,
+		const TArray<FString>& UserIds,
+		const TArray<FString>& Usernames,
+		const TFunction<void()>& SuccessCallback,
+		const TFunction<void(const FNakamaError& Error)>& ErrorCallback
+	);
+
+	/** Remove friends, invites or blocks, then update the local copy. */
+	void DeleteFriends(
+		UNakamaSession* Session,
+		const TArray<FString>& UserIds,
+		const TArray<FString>& Usernames,
+		const TFunction<void()>& SuccessCallback,
+		const TFunction<void(const FNakamaError& Error)>& ErrorCallback
+	);
+
+	/** Block users, then update the local copy. */
+	void BlockFriends(
+		UNakamaSession* Session,
+		const TArray<FString>& UserIds,
+		const TArray<FString>& Usernames,
+		const TFunction<void()>& SuccessCallback,
+		const TFunction<void(const FNakamaError& Error)>& ErrorCallback
+	);
+
+	/** Follow every friend not yet followed on the bound realtime client, in batches. */
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Friends")
+	void FollowFriends();
+
+	/**
+	 * @return Relationships in the given state (ALL for every state), ordered by username.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Nakama|Friends")
+	TArray<FNakamaFriend> GetFriends(ENakamaFriendState State = ENakamaFriendState::ALL) const;
+
+	UFUNCTION(BlueprintPure, Category = "Nakama|Friends")
+	bool FindFriend(const FString& UserId, FNakamaFriend& OutFriend) const;
+
+	/** @return The live status of a followed user, empty if offline or not followed. */
+	UFUNCTION(BlueprintPure, Category = "Nakama|Friends")
+	FString GetStatus(const FString& UserId) const;
+
+	/** @return True once Load or Refresh filled the graph. */
+	UFUNCTION(BlueprintPure, Category = "Nakama|Friends")
+	bool IsLoaded() const { return bLoaded; }
+
+	/**
+	 * Load a previously saved graph for a user and use that user for
+	 * subsequent saves. Returns false if nothing was saved for it yet.
+	 * Loading a different user than before drops the previous user's
+	 * relationships and live status, unfollows their friends and fails any
+	 * refresh in progress.
+	 *
+	 * @param UserId The user the graph belongs to (see UNakamaSession::GetUserId).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Friends")
+	bool Load(const FString& UserId);
+
+	/** Save the graph for the user passed to Load. */
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Friends")
+	bool Save() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Friends")
+	void Clear();
+
+	virtual void BeginDestroy() override;
+
+private:
+
+	UPROPERTY()
+	UNakamaClient* Client;
+
+	// Relationships keyed by user ID.
+	TMap<FString, FNakamaFriend> Friends;
+	bool bLoaded = false;
+
+	// User used to name the save file; empty until Load is called.
+	FString UserId;
+
+	// Bumped when Load switches user so replies sent for the previous one are ignored.
+	int32 Generation = 0;
+
+	// Online sessions of followed users, from follow replies and status events.
+	TMap<FString, TArray<FNakamaUserPresence>> LivePresences;
+
+	// Users followed on the current socket connection.
+	TSet<FString> FollowedIds;
+
+	struct FPendingRefresh
+	{
+		TArray<TFunction<void(int32)>> OnSuccess;
+		TArray<TFunction<void(const FNakamaError&)>> OnError;
+		TMap<FString, FNakamaFriend> Friends;
+		int32 NumPages = 0;
+	};
+	TSharedPtr<FPendingRefresh> InFlightRefresh;
+
+	TWeakObjectPtr<UNakamaRealtimeClient> BoundRealtimeClient;
+	TArray<FDelegateHandle> RealtimeHandles;
+
+	void RefreshPage(UNakamaSession* Session, const FString& Cursor);
+	void FinishRefresh(const FNakamaError* Error);
+
+	// Apply a successful add, delete or block; lists again if a username is not held locally.
+	void Reconcile(
+		UNakamaSession* Session,
+		const TArray<FString>& UserIds,
+		const TArray<FString>& Usernames,
+		TFunctionRef<void(const FString& Id, FNakamaFriend* Existing)> Apply);
+
+	void ApplyLiveStatus(FNakamaFriend& Friend) const;
+	void ApplyStatus(const FNakamaStatus& Status);
+
+	void HandleStatusPresence(const FNakamaStatusPresenceEvent& Event);
+	void HandleConnected();
+	void HandleDisconnected(const FNakamaDisconnectInfo& Info);
+
+	void NotifyChanged();
+	void ResetForUser();
+	FString GetSaveFilePath() const;
+};
@@ -0,0 +1,58 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonObject;
+class FJsonValue;
+
+/**
+ * JSON merge patches (RFC 7396) between storage values.
+ *
+ * A patch is an object holding the members that changed: new values replace
+ * old ones, nested objects are patched recursively and null removes a member.
+ * Arrays are always replaced whole.
+ */
+struct NAKAMAUNREAL_API FNakamaJsonMergePatch
+{
+	/**
+	 * Compute the patch that turns Original into Modified.
+	 *
+	 * Fails if either value is not a JSON object, or if Modified sets a changed
+	 * member to null, which a merge patch cannot express; write the full value then.
+	 *
+	 * @param Original The value the receiver already has.
+	 * @param Modified The value the receiver should end up with.
+	 * @param OutPatch The serialized patch, "{}" if nothing changed.
+	 */
+	static bool Create(const FString& Original, const FString& Modified, FString& OutPatch);
+
+	static TSharedPtr<FJsonObject> Create(const FJsonObject& Original, const FJsonObject& Modified, bool& bOutExpressible);
+
+	/**
+	 * Apply a patch to a value.
+	 *
+	 * @param Target The value to patch, may be null.
+	 * @param Patch The patch; anything other than an object replaces Target.
+	 * @return The patched value. Target is not modified.
+	 */
+	static TSharedPtr<FJsonValue> Apply(const TSharedPtr<FJsonValue>& Target, const TSharedPtr<FJsonValue>& Patch);
+
+	/** Apply a serialized patch to a serialized value; false if either is not valid JSON. */
+	static bool Apply(const FString& Target, const FString& Patch, FString& OutResult);
+};
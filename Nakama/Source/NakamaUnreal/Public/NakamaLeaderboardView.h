@@ -0,0 +1,205 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/SortedMap.h"
+#include "NakamaError.h"
+#include "NakamaLeaderboard.h"
+#include "NakamaLeaderboardView.generated.h"
+
+class UNakamaClient;
+class UNakamaSession;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnNakamaLeaderboardViewChanged);
+
+/**
+ * Cached view of one leaderboard for screens that scroll through it and poll
+ * for score changes.
+ *
+ * Pages fetched by cursor and windows fetched around an owner are merged into
+ * one store ordered by rank, so overlapping windows share records and
+ * scrolling back needs no request while a page is younger than
+ * PageTimeToLiveSeconds. While a visible rank range is set, only the fetched
+ * pages and windows covering it are refreshed, every RefreshIntervalSeconds.
+ * The record returned by WriteRecord is applied to the player's row right
+ * away, shifting the rows in between, instead of waiting for a refresh.
+ *
+ * All methods must be called on the game thread.
+ */
+UCLASS(BlueprintType)
+class NAKAMAUNREAL_API UNakamaLeaderboardView : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	 * Creates a view of a leaderboard.
+	 *
+	 * @param Client The client used for leaderboard requests.
+	 * @param LeaderboardId The leaderboard to view.
+	 * @param PageSize Records per page and per around-owner window.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Leaderboards")
+	static UNakamaLeaderboardView* CreateLeaderboardView(UNakamaClient* Client, const FString& LeaderboardId, int32 PageSize = 25);
+
+	/** How long a fetched page or window is served without a request. */
+	UPROPERTY(BlueprintReadWrite, Category = "Nakama|Leaderboards")
+	float PageTimeToLiveSeconds = 30.0f;
+
+	/** How often the visible range is refreshed; 0 to disable. */
+	UPROPERTY(BlueprintReadWrite, Category = "Nakama|Leaderboards")
+	float RefreshIntervalSeconds = 10.0f;
+
+	/** Fired whenever cached records change. */
+	UPROPERTY(BlueprintAssignable, Category = "Nakama|Leaderboards")
+	FOnNakamaLeaderboardViewChanged ChangedEvent;
+
+	/**
+	 * List a page of records, from the cache while it is fresh.
+	 *
+	 * @param Session The session of the user.
+	 * @param Cursor The cursor of the page, empty for the first one.
+	 * @param SuccessCallback Called with the page's records, including changes applied since it was fetched, and its cursors.
+	 * @param ErrorCallback Called if fetching the page fails.
+	 */
+	void ListPage(
+		UNakamaSession* Session,
+		const FString& Cursor,
+		const TFunction<void(const FNakamaLeaderboardRecordList& Page)>& SuccessCallback,
+		const TFunction<void(const FNakamaError& Error)>& ErrorCallback
+	);
+
+	/**
+	 * List the records around an owner, from the cache while fresh.
+	 *
+	 * @param Session The session of the user.
+	 * @param OwnerId The owner to center on, usually the session user.
+	 * @param SuccessCallback Called with the window's records by rank.
+	 * @param ErrorCallback Called if fetching the window fails.
+	 */
+	void ListAroundOwner(
+		UNakamaSession* Session,
+		const FString& OwnerId,
+		const TFunction<void(const TArray<FNakamaLeaderboardRecord>& Records)>& SuccessCallback,
+		const TFunction<void(const FNakamaError& Error)>& ErrorCallback
+	);
+
+	/**
+	 * Write a record for the session user and apply the result to the cached rows.
+	 *
+	 * @param SuccessCallback Called with the record as stored by the server.
+	 * @param ErrorCallback Called if the write fails; the cache is left unchanged.
+	 */
+	void WriteRecord(
+		UNakamaSession* Session,
+		int64 Score,
+		const TOptional<int64>& SubScore,
+		const TOptional<FString>& Metadata,
+		const TFunction<void(const FNakamaLeaderboardRecord& Record)>& SuccessCallback,
+		const TFunction<void(const FNakamaError& Error)>& ErrorCallback
+	);
+
+	/**
+	 * Set the ranks currently on screen, which are refreshed every
+	 * RefreshIntervalSeconds. Pass a LastRank below FirstRank to stop refreshing.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Leaderboards")
+	void SetVisibleRange(UNakamaSession* Session, int64 FirstRank, int64 LastRank);
+
+	/** Refresh the pages and windows covering the visible range now. */
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Leaderboards")
+	void RefreshVisibleRange();
+
+	/** @return Cached records with ranks in [FirstRank, LastRank], by rank; ranks not fetched yet are missing. */
+	UFUNCTION(BlueprintPure, Category = "Nakama|Leaderboards")
+	TArray<FNakamaLeaderboardRecord> GetRecords(int64 FirstRank, int64 LastRank) const;
+
+	/** Look up the cached record of an owner without a request. */
+	UFUNCTION(BlueprintPure, Category = "Nakama|Leaderboards")
+	bool FindRecord(const FString& OwnerId, FNakamaLeaderboardRecord& OutRecord) const;
+
+	/** @return Number of list requests sent, for profiling. */
+	UFUNCTION(BlueprintPure, Category = "Nakama|Leaderboards")
+	int32 GetNumRequests() const { return NumRequests; }
+
+	/** Drop all cached records and pages. */
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Leaderboards")
+	void Clear();
+
+private:
+
+	UPROPERTY()
+	UNakamaClient* Client;
+
+	// Session used for refreshes, from SetVisibleRange.
+	UPROPERTY()
+	UNakamaSession* RefreshSession;
+
+	FString LeaderboardId;
+	int32 PageSize = 25;
+
+	// A fetched page ("page:<cursor>") or around-owner window ("owner:<id>").
+	struct FSlice
+	{
+		FString Cursor;
+		FString OwnerId;
+		int64 FirstRank = 0;
+		int64 LastRank = -1;
+		FString NextCursor;
+		FString PrevCursor;
+		double FetchTime = 0.0;
+	};
+
+	// Callers waiting on a slice that is being fetched.
+	struct FPendingFetch
+	{
+		TArray<TFunction<void()>> OnDone;
+		TArray<TFunction<void(const FNakamaError& Error)>> OnError;
+	};
+
+	TSortedMap<int64, FNakamaLeaderboardRecord> Ranks;
+	TMap<FString, int64> OwnerRanks;
+	TMap<FString, FSlice> Slices;
+	TMap<FString, FPendingFetch> PendingFetches;
+
+	int64 VisibleFirstRank = 0;
+	int64 VisibleLastRank = -1;
+	bool bRefreshScheduled = false;
+	int32 NumRequests = 0;
+
+	static FString PageKey(const FString& Cursor) { return TEXT("page:") + Cursor; }
+	static FString OwnerKey(const FString& OwnerId) { return TEXT("owner:") + OwnerId; }
+
+	bool IsFresh(const FSlice& Slice) const;
+
+	// Fetch a slice, sharing the request with callers already waiting on it.
+	void FetchSlice(
+		UNakamaSession* Session,
+		const FSlice& Slice,
+		const TFunction<void()>& OnDone,
+		const TFunction<void(const FNakamaError& Error)>& OnError);
+
+	// The ranks a slice covers now hold exactly its records.
+	void MergeSlice(const FString& Key, FSlice Slice, const TArray<FNakamaLeaderboardRecord>& Records);
+
+	// Place an owner's record at its rank, shifting the rows between its old and new rank.
+	void ApplyOwnRecord(const FNakamaLeaderboardRecord& Record);
+
+	void ScheduleRefresh();
+};
@@ -53,8 +53,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Nakama")
 	static void EnableLogging(bool bEnable);
 
+	// True if a message at InLogLevel would be written. Cheap enough to call
+	// before building a message (see NakamaLoggingMacros.h).
+	static bool IsLoggable(ENakamaLogLevel InLogLevel)
+	{
+		return bLoggingEnabled && InLogLevel >= CurrentLogLevel;
+	}
+
 private:
 	static ENakamaLogLevel CurrentLogLevel;
 	static bool bLoggingEnabled;
-	static bool IsLoggable(ENakamaLogLevel InLogLevel);
 };
@@ -16,33 +16,68 @@
 
 #pragma once
 
+#include "NakamaLogger.h"
+
 // Toggle logging on/off by defining NAKAMA_LOGS_ENABLED
 #define NAKAMA_LOGS_ENABLED
 
+// Build-time minimum level (0 Debug, 1 Info, 2 Warn, 3 Error, 4 Fatal). Call
+// sites below it compile to nothing, e.g. add "NAKAMA_LOG_MIN_LEVEL=2" to
+// PublicDefinitions to strip debug and info logging from a build.
+#ifndef NAKAMA_LOG_MIN_LEVEL
+	#define NAKAMA_LOG_MIN_LEVEL 0
+#endif
+
 #ifdef NAKAMA_LOGS_ENABLED
 
-	#define NAKAMA_LOG_DEBUG(Message) \
-	UNakamaLogger::Log(ENakamaLogLevel::Debug, Message)
+	// The level is checked before the message expression is evaluated, so a
+	// disabled level never pays for building the message.
+	#define NAKAMA_LOG_AT(Level, Message) \
+	do { if (UNakamaLogger::IsLoggable(Level)) { UNakamaLogger::Log(Level, Message); } } while (0)
+
+	// Format-style variant: NAKAMA_LOGF_INFO(TEXT("Sent %d bytes"), Num)
+	#define NAKAMA_LOGF_AT(Level, Format, ...) \
+	do { if (UNakamaLogger::IsLoggable(Level)) { UNakamaLogger::Log(Level, FString::Printf(Format, ##__VA_ARGS__)); } } while (0)
+
+#else
 
-	#define NAKAMA_LOG_INFO(Message) \
-	UNakamaLogger::Log(ENakamaLogLevel::Info, Message)
+	#define NAKAMA_LOG_AT(Level, Message) do { } while (0)
+	#define NAKAMA_LOGF_AT(Level, Format, ...) do { } while (0)
 
-	#define NAKAMA_LOG_WARN(Message) \
-	UNakamaLogger::Log(ENakamaLogLevel::Warn, Message)
+#endif // NAKAMA_LOGS_ENABLED
 
-	#define NAKAMA_LOG_ERROR(Message) \
-	UNakamaLogger::Log(ENakamaLogLevel::Error, Message)
+#if NAKAMA_LOG_MIN_LEVEL <= 0
+	#define NAKAMA_LOG_DEBUG(Message) NAKAMA_LOG_AT(ENakamaLogLevel::Debug, Message)
+	#define NAKAMA_LOGF_DEBUG(Format, ...) NAKAMA_LOGF_AT(ENakamaLogLevel::Debug, Format, ##__VA_ARGS__)
+#else
+	#define NAKAMA_LOG_DEBUG(Message) do { } while (0)
+	#define NAKAMA_LOGF_DEBUG(Format, ...) do { } while (0)
+#endif
 
-	#define NAKAMA_LOG_FATAL(Message) \
-	UNakamaLogger::Log(ENakamaLogLevel::Fatal, Message)
+#if NAKAMA_LOG_MIN_LEVEL <= 1
+	#define NAKAMA_LOG_INFO(Message) NAKAMA_LOG_AT(ENakamaLogLevel::Info, Message)
+	#define NAKAMA_LOGF_INFO(Format, ...) NAKAMA_LOGF_AT(ENakamaLogLevel::Info, Format, ##__VA_ARGS__)
+#else
+	#define NAKAMA_LOG_INFO(Message) do { } while (0)
+	#define NAKAMA_LOGF_INFO(Format, ...) do { } while (0)
+#endif
 
+#if NAKAMA_LOG_MIN_LEVEL <= 2
+	#define NAKAMA_LOG_WARN(Message) NAKAMA_LOG_AT(ENakamaLogLevel::Warn, Message)
+	#define NAKAMA_LOGF_WARN(Format, ...) NAKAMA_LOGF_AT(ENakamaLogLevel::Warn, Format, ##__VA_ARGS__)
 #else
+	#define NAKAMA_LOG_WARN(Message) do { } while (0)
+	#define NAKAMA_LOGF_WARN(Format, ...) do { } while (0)
+#endif
 
-	// Define empty macros if logging is disabled
-	#define NAKAMA_LOG_DEBUG(Message)
-	#define NAKAMA_LOG_INFO(Message)
-	#define NAKAMA_LOG_WARN(Message)
-	#define NAKAMA_LOG_ERROR(Message)
-	#define NAKAMA_LOG_FATAL(Message)
+#if NAKAMA_LOG_MIN_LEVEL <= 3
+	#define NAKAMA_LOG_ERROR(Message) NAKAMA_LOG_AT(ENakamaLogLevel::Error, Message)
+	#define NAKAMA_LOGF_ERROR(Format, ...) NAKAMA_LOGF_AT(ENakamaLogLevel::Error, Format, ##__VA_ARGS__)
+#else
+	#define NAKAMA_LOG_ERROR(Message) do { } while (0)
+	#define NAKAMA_LOGF_ERROR(Format, ...) do { } while (0)
+#endif
 
-#endif // NAKAMA_LOGS_ENABLED
\ No newline at end of file
+// Fatal is never compiled out.
+#define NAKAMA_LOG_FATAL(Message) NAKAMA_LOG_AT(ENakamaLogLevel::Fatal, Message)
+#define NAKAMA_LOGF_FATAL(Format, ...) NAKAMA_LOGF_AT(ENakamaLogLevel::Fatal, Format, ##__VA_ARGS__)
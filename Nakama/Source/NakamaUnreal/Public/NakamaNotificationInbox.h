@@ -0,0 +1,224 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NakamaError.h"
+#include "NakamaNotification.h"
+#include "NakamaNotificationInbox.generated.h"
+
+class UNakamaClient;
+class UNakamaRealtimeClient;
+class UNakamaSession;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnNakamaNotificationInboxChanged);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnNakamaNotificationsReceived, const TArray<FNakamaNotification>&, Notifications);
+
+/**
+ * Local model of the user's notifications, fed by ListNotifications and by
+ * realtime deliveries.
+ *
+ * Notifications are stored by ID, so one delivered on the socket and listed
+ * again later is only reported once. Sync lists from the cacheable cursor,
+ * which is persisted with the notifications, so a launch only downloads what
+ * arrived since the last one. Deletes are applied locally at once and sent in
+ * batches, restoring the notifications if the server rejects them.
+ *
+ * All methods must be called on the game thread.
+ */
+UCLASS(BlueprintType)
+class NAKAMAUNREAL_API UNakamaNotificationInbox : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	 * Creates an inbox bound to a client.
+	 *
+	 * @param Client The client used for notification requests.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Notifications")
+	static UNakamaNotificationInbox* CreateNotificationInbox(UNakamaClient* Client);
+
+	/** Number of notifications requested per page. */
+	UPROPERTY(BlueprintReadWrite, Category = "Nakama|Notifications")
+	int32 PageSize = 100;
+
+	/** Upper bound on pages fetched by a single Sync; the cursor continues from there next time. */
+	UPROPERTY(BlueprintReadWrite, Category = "Nakama|Notifications")
+	int32 MaxSyncPages = 10;
+
+	/** Notifications kept locally; the oldest are dropped past this. */
+	UPROPERTY(BlueprintReadWrite, Category = "Nakama|Notifications")
+	int32 MaxNotifications = 500;
+
+	/** Deletes requested within this window are sent in one request. 0 sends each call at once. */
+	UPROPERTY(BlueprintReadWrite, Category = "Nakama|Notifications")
+	float DeleteBatchWindowSeconds = 0.5f;
+
+	/** Most IDs per DeleteNotifications request. */
+	UPROPERTY(BlueprintReadWrite, Category = "Nakama|Notifications")
+	int32 MaxDeleteBatchSize = 100;
+
+	/** When true (default), the inbox is saved after every change once Load has been called. */
+	UPROPERTY(BlueprintReadWrite, Category = "Nakama|Notifications")
+	bool bAutoSave = true;
+
+	/** Fired whenever the local contents change. */
+	UPROPERTY(BlueprintAssignable, Category = "Nakama|Notifications")
+	FOnNakamaNotificationInboxChanged ChangedEvent;
+
+	/** Fired with notifications seen for the first time, from either source. */
+	UPROPERTY(BlueprintAssignable, Category = "Nakama|Notifications")
+	FOnNakamaNotificationsReceived ReceivedEvent;
+
+	/** Merge notifications delivered by a realtime client. Pass null to unbind. */
+	void BindRealtimeClient(UNakamaRealtimeClient* RealtimeClient);
+
+	/**
+	 * Fetch notifications newer than the cacheable cursor. Concurrent calls share one sync.
+	 *
+	 * @param Session The session of the user.
+	 * @param SuccessCallback Called with the number of notifications added.
+	 * @param ErrorCallback Called if a page request fails; already-merged pages are kept.
+	 */
+	void Sync(
+		UNakamaSession* Session,
+		const TFunction<void(int32 NumAdded)>& SuccessCallback,
+		const TFunction<void(const FNakamaError& Error)>& ErrorCallback
+	);
+
+	/**
+	 * Remove notifications locally and queue them for deletion on the server.
+	 *
+	 * @param Session The session of the user.
+	 * @param NotificationIds The notifications to delete.
+	 * @param SuccessCallback Called once the batch holding these IDs is deleted.
+	 * @param ErrorCallback Called if the batch fails; the notifications are restored.
+	 */
+	void DeleteNotifications(
+		UNakamaSession* Session,
+		const TArray<FString>& NotificationIds,
+		const TFunction<void()>& SuccessCallback,
+		const TFunction<void(const FNakamaError& Error)>& ErrorCallback
+	);
+
+	/** Send queued deletes now instead of at the end of the batch window. */
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Notifications")
+	void FlushDeletes();
+
+	/** Merge notifications, e.g. from a realtime event not routed through BindRealtimeClient. */
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Notifications")
+	void AddNotifications(const TArray<FNakamaNotification>& Notifications);
+
+	/** @return All locally held notifications, newest first. */
+	UFUNCTION(BlueprintPure, Category = "Nakama|Notifications")
+	TArray<FNakamaNotification> GetNotifications() const;
+
+	UFUNCTION(BlueprintPure, Category = "Nakama|Notifications")
+	bool FindNotification(const FString& NotificationId, FNakamaNotification& OutNotification) const;
+
+	UFUNCTION(BlueprintPure, Category = "Nakama|Notifications")
+	int32 Num() const { return Notifications.Num(); }
+
+	/** @return The cursor the next Sync continues from. */
+	UFUNCTION(BlueprintPure, Category = "Nakama|Notifications")
+	const FString& GetCacheableCursor() const { return CacheableCursor; }
+
+	/**
+	 * Load a previously saved inbox for a user and use that user for
+	 * subsequent saves. Returns false if nothing was saved for it yet.
+	 * Loading a different user than before drops the previous user's
+	 * notifications and cursor first and fails any sync in progress.
+	 *
+	 * @param UserId The user the inbox belongs to (see UNakamaSession::GetUserId).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Notifications")
+	bool Load(const FString& UserId);
+
+	/** Save the inbox for the user passed to Load. */
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Notifications")
+	bool Save() const;
+
+	/** Drop all local notifications and the cursor, so the next Sync lists from the start. */
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Notifications")
+	void Clear();
+
+	virtual void BeginDestroy() override;
+
+private:
+
+	UPROPERTY()
+	UNakamaClient* Client;
+
+	// Notifications keyed by ID.
+	TMap<FString, FNakamaNotification> Notifications;
+
+	// Continues after the newest listed notification. Persisted.
+	FString CacheableCursor;
+
+	// User used to name the save file; empty until Load is called.
+	FString UserId;
+
+	// Bumped when Load switches user so replies sent for the previous one are ignored.
+	int32 Generation = 0;
+
+	// Callbacks of callers waiting on the sync in progress.
+	struct FPendingSync
+	{
+		TArray<TFunction<void(int32)>> OnSuccess;
+		TArray<TFunction<void(const FNakamaError&)>> OnError;
+		int32 NumAdded = 0;
+		int32 NumPages = 0;
+	};
+	TSharedPtr<FPendingSync> InFlightSync;
+
+	// Deletes waiting for the batch window, with the removed notifications to restore on failure.
+	struct FPendingDelete
+	{
+		TArray<FString> Ids;
+		TArray<FNakamaNotification> Removed;
+		TFunction<void()> OnSuccess;
+		TFunction<void(const FNakamaError&)> OnError;
+	};
+	TArray<FString> QueuedDeleteIds;
+	TArray<FPendingDelete> QueuedDeletes;
+	bool bDeleteFlushScheduled = false;
+
+	UPROPERTY()
+	UNakamaSession* DeleteSession;
+
+	// Deleted locally but not yet confirmed; deliveries of these are ignored.
+	TSet<FString> DeletingIds;
+
+	TWeakObjectPtr<UNakamaRealtimeClient> BoundRealtimeClient;
+	FDelegateHandle NotificationHandle;
+
+	void SyncPage(UNakamaSession* Session);
+	void FinishSync(const FNakamaError* Error);
+
+	// Merge notifications, optionally reporting new ones through ReceivedEvent; returns the number added.
+	int32 MergeNotifications(const TArray<FNakamaNotification>& Incoming, bool bReportNew);
+	void TrimToCapacity();
+
+	void HandleNotifications(const FNakamaNotificationList& List);
+
+	void NotifyChanged();
+	void ResetForUser();
+	FString GetSaveFilePath() const;
+};
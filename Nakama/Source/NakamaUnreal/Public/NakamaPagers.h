@@ -0,0 +1,143 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NakamaPager.h"
+#include "NakamaError.h"
+#include "NakamaChat.h"
+#include "NakamaFriend.h"
+#include "NakamaGroup.h"
+#include "NakamaLeaderboard.h"
+#include "NakamaNotification.h"
+#include "NakamaStorageObject.h"
+#include "NakamaTournament.h"
+
+class UNakamaClient;
+class UNakamaSession;
+
+#define NAKAMA_PAGE_TRAITS(ListType, ItemsField, CursorField) \
+	template <> \
+	struct TNakamaPageTraits<ListType> \
+	{ \
+		static const FString& GetCursor(const ListType& Page) { return Page.CursorField; } \
+		static auto& GetItems(ListType& Page) { return Page.ItemsField; } \
+	};
+
+NAKAMA_PAGE_TRAITS(FNakamaFriendList, NakamaUsers, Cursor)
+NAKAMA_PAGE_TRAITS(FNakamaGroupList, Groups, Cursor)
+NAKAMA_PAGE_TRAITS(FNakamaGroupUsersList, GroupUsers, Cursor)
+NAKAMA_PAGE_TRAITS(FNakamaUserGroupList, UserGroups, Cursor)
+NAKAMA_PAGE_TRAITS(FNakamaNotificationList, Notifications, CacheableCursor)
+NAKAMA_PAGE_TRAITS(FNakamaChannelMessageList, Messages, NextCursor)
+NAKAMA_PAGE_TRAITS(FNakamaStorageObjectList, Objects, Cursor)
+NAKAMA_PAGE_TRAITS(FNakamaLeaderboardRecordList, Records, NextCursor)
+NAKAMA_PAGE_TRAITS(FNakamaTournamentList, Tournaments, Cursor)
+NAKAMA_PAGE_TRAITS(FNakamaTournamentRecordList, Records, NextCursor)
+
+#undef NAKAMA_PAGE_TRAITS
+
+using FNakamaFriendPager = TNakamaPager<FNakamaFriendList, FNakamaError>;
+using FNakamaGroupPager = TNakamaPager<FNakamaGroupList, FNakamaError>;
+using FNakamaGroupUserPager = TNakamaPager<FNakamaGroupUsersList, FNakamaError>;
+using FNakamaUserGroupPager = TNakamaPager<FNakamaUserGroupList, FNakamaError>;
+using FNakamaNotificationPager = TNakamaPager<FNakamaNotificationList, FNakamaError>;
+using FNakamaChannelMessagePager = TNakamaPager<FNakamaChannelMessageList, FNakamaError>;
+using FNakamaStorageObjectPager = TNakamaPager<FNakamaStorageObjectList, FNakamaError>;
+using FNakamaLeaderboardRecordPager = TNakamaPager<FNakamaLeaderboardRecordList, FNakamaError>;
+using FNakamaTournamentPager = TNakamaPager<FNakamaTournamentList, FNakamaError>;
+using FNakamaTournamentRecordPager = TNakamaPager<FNakamaTournamentRecordList, FNakamaError>;
+
+/**
+ * Pagers over the cursor-based list requests of UNakamaClient (see TNakamaPager).
+ * Arguments match the corresponding client request without its cursor; a
+ * pager fails its pages with an invalid client error once the client is gone.
+ *
+ *   TSharedRef<FNakamaFriendPager> Pager = FNakamaPagers::ListFriends(Client, Session, 100, {});
+ *   Pager->MaxItems = 500;
+ *   Pager->ForEachPage([](const FNakamaFriendList& Page) { ...; return true; }, [] {}, [](const FNakamaError&) {});
+ */
+struct NAKAMAUNREAL_API FNakamaPagers
+{
+	static TSharedRef<FNakamaFriendPager> ListFriends(
+		UNakamaClient* Client,
+		UNakamaSession* Session,
+		const TOptional<int32>& Limit,
+		TOptional<ENakamaFriendState> State);
+
+	static TSharedRef<FNakamaGroupPager> ListGroups(
+		UNakamaClient* Client,
+		UNakamaSession* Session,
+		const FString& Name,
+		int32 Limit);
+
+	static TSharedRef<FNakamaGroupUserPager> ListGroupUsers(
+		UNakamaClient* Client,
+		UNakamaSession* Session,
+		const FString& GroupId,
+		const TOptional<int32>& Limit,
+		TOptional<ENakamaGroupState> State);
+
+	static TSharedRef<FNakamaUserGroupPager> ListUserGroups(
+		UNakamaClient* Client,
+		UNakamaSession* Session,
+		const TOptional<int32>& Limit,
+		const TOptional<ENakamaGroupState>& State);
+
+	// Starts after CacheableCursor when given, e.g. one saved from an earlier session.
+	static TSharedRef<FNakamaNotificationPager> ListNotifications(
+		UNakamaClient* Client,
+		UNakamaSession* Session,
+		const TOptional<int32>& Limit,
+		const FString& CacheableCursor = FString());
+
+	static TSharedRef<FNakamaChannelMessagePager> ListChannelMessages(
+		UNakamaClient* Client,
+		UNakamaSession* Session,
+		const FString& ChannelId,
+		const TOptional<int32>& Limit,
+		const TOptional<bool>& Forward);
+
+	static TSharedRef<FNakamaStorageObjectPager> ListStorageObjects(
+		UNakamaClient* Client,
+		UNakamaSession* Session,
+		const FString& Collection,
+		const TOptional<int32>& Limit);
+
+	static TSharedRef<FNakamaLeaderboardRecordPager> ListLeaderboardRecords(
+		UNakamaClient* Client,
+		UNakamaSession* Session,
+		const FString& LeaderboardId,
+		const TArray<FString>& OwnerIds,
+		const TOptional<int32>& Limit);
+
+	static TSharedRef<FNakamaTournamentPager> ListTournaments(
+		UNakamaClient* Client,
+		UNakamaSession* Session,
+		const TOptional<int32>& CategoryStart,
+		const TOptional<int32>& CategoryEnd,
+		const TOptional<int32>& StartTime,
+		const TOptional<int32>& EndTime,
+		const TOptional<int32>& Limit);
+
+	static TSharedRef<FNakamaTournamentRecordPager> ListTournamentRecords(
+		UNakamaClient* Client,
+		UNakamaSession* Session,
+		const FString& TournamentId,
+		const TOptional<int32>& Limit,
+		const TArray<FString>& OwnerIds);
+};
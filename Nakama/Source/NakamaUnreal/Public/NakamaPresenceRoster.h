@@ -0,0 +1,197 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NakamaPresence.h"
+#include "NakamaMatch.h"
+#include "NakamaChat.h"
+#include "NakamaParty.h"
+#include "NakamaStreams.h"
+#include "NakamaPresenceRoster.generated.h"
+
+class UNakamaRealtimeClient;
+struct FNakamaMatchPresenceEvent;
+struct FNakamaChannelPresenceEvent;
+
+// Presences that actually joined or left when an event was applied to a roster.
+USTRUCT(BlueprintType)
+struct NAKAMAUNREAL_API FNakamaPresenceRosterDelta
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Nakama|Presence")
+	TArray<FNakamaUserPresence> Joined;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Nakama|Presence")
+	TArray<FNakamaUserPresence> Left;
+
+	bool IsEmpty() const { return Joined.Num() == 0 && Left.Num() == 0; }
+};
+
+/**
+ * Set of presences keyed by session ID, for the users in one match, channel,
+ * party or stream.
+ *
+ * Joins and leaves are O(1) and iteration follows join order, which is kept
+ * when others leave. A session that joins again while present is updated in
+ * place and not reported as a join.
+ */
+class NAKAMAUNREAL_API FNakamaPresenceRoster
+{
+public:
+
+	/**
+	 * Apply the leaves then the joins of a presence event.
+	 *
+	 * @return The presences that left or joined; duplicates and unknown leaves are left out.
+	 */
+	FNakamaPresenceRosterDelta Apply(const TArray<FNakamaUserPresence>& Joins, const TArray<FNakamaUserPresence>& Leaves);
+
+	// @return True if the session was not in the roster yet.
+	bool Add(const FNakamaUserPresence& Presence);
+
+	// @return True if the session was in the roster.
+	bool Remove(const FString& SessionId);
+
+	const FNakamaUserPresence* Find(const FString& SessionId) const;
+
+	bool Contains(const FString& SessionId) const { return BySession.Contains(SessionId); }
+
+	// True if any session of the user is present.
+	bool ContainsUser(const FString& UserId) const { return SessionsPerUser.Contains(UserId); }
+
+	int32 Num() const { return BySession.Num(); }
+
+	// Presences in join order.
+	TArray<FNakamaUserPresence> ToArray() const;
+
+	void Reset();
+
+	// Iterates presences in join order.
+	class FConstIterator
+	{
+	public:
+		FConstIterator(const FNakamaPresenceRoster& InRoster, int32 InIndex) : Roster(InRoster), Index(InIndex) {}
+
+		const FNakamaUserPresence& operator*() const { return Roster.Nodes[Index].Presence; }
+		const FNakamaUserPresence* operator->() const { return &Roster.Nodes[Index].Presence; }
+		FConstIterator& operator++() { Index = Roster.Nodes[Index].Next; return *this; }
+		bool operator!=(const FConstIterator& Other) const { return Index != Other.Index; }
+
+	private:
+		const FNakamaPresenceRoster& Roster;
+		int32 Index;
+	};
+
+	FConstIterator begin() const { return FConstIterator(*this, Head); }
+	FConstIterator end() const { return FConstIterator(*this, INDEX_NONE); }
+
+private:
+
+	// Doubly linked through a sparse array, so removal keeps the order without shifting.
+	struct FNode
+	{
+		FNakamaUserPresence Presence;
+		int32 Prev = INDEX_NONE;
+		int32 Next = INDEX_NONE;
+	};
+
+	TSparseArray<FNode> Nodes;
+	TMap<FString, int32> BySession;
+	TMap<FString, int32> SessionsPerUser;
+	int32 Head = INDEX_NONE;
+	int32 Tail = INDEX_NONE;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnNakamaPresenceRosterChanged, const FString&, RosterId, const FNakamaPresenceRosterDelta&, Delta);
+
+/**
+ * Presence rosters for every match, channel, party and stream the realtime
+ * client receives presence events for, keyed by match, channel or party ID
+ * (see GetStreamRosterId for streams).
+ *
+ * Events only carry changes, so call the Track functions with the result of
+ * joining to include the presences that were there before. All methods must
+ * be called on the game thread.
+ */
+UCLASS(BlueprintType)
+class NAKAMAUNREAL_API UNakamaPresenceRosters : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Presence")
+	static UNakamaPresenceRosters* CreatePresenceRosters();
+
+	/** Fired after a roster changes, with what joined and left. */
+	UPROPERTY(BlueprintAssignable, Category = "Nakama|Presence")
+	FOnNakamaPresenceRosterChanged ChangedEvent;
+
+	/** Apply match, channel, party and stream presence events from a realtime client. Pass null to unbind. */
+	void BindRealtimeClient(UNakamaRealtimeClient* RealtimeClient);
+
+	/** Add the presences of a joined match, including the local user. */
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Presence")
+	void TrackMatch(const FNakamaMatch& Match);
+
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Presence")
+	void TrackChannel(const FNakamaChannel& Channel);
+
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Presence")
+	void TrackParty(const FNakamaParty& Party);
+
+	/** Apply joins and leaves to a roster, creating it if needed, and broadcast the change. */
+	FNakamaPresenceRosterDelta Apply(const FString& RosterId, const TArray<FNakamaUserPresence>& Joins, const TArray<FNakamaUserPresence>& Leaves);
+
+	/** @return The roster, or null if no presences were seen for it. */
+	const FNakamaPresenceRoster* FindRoster(const FString& RosterId) const;
+
+	/** @return The presences of a roster in join order. */
+	UFUNCTION(BlueprintPure, Category = "Nakama|Presence")
+	TArray<FNakamaUserPresence> GetPresences(const FString& RosterId) const;
+
+	UFUNCTION(BlueprintPure, Category = "Nakama|Presence")
+	bool IsPresent(const FString& RosterId, const FString& SessionId) const;
+
+	UFUNCTION(BlueprintPure, Category = "Nakama|Presence")
+	static FString GetStreamRosterId(const FNakamaStream& Stream);
+
+	/** Forget a roster, e.g. after leaving the match. */
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Presence")
+	void RemoveRoster(const FString& RosterId);
+
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Presence")
+	void Clear();
+
+	virtual void BeginDestroy() override;
+
+private:
+
+	TMap<FString, FNakamaPresenceRoster> Rosters;
+
+	TWeakObjectPtr<UNakamaRealtimeClient> BoundRealtimeClient;
+	TArray<FDelegateHandle> PresenceHandles;
+
+	void Track(const FString& RosterId, const FNakamaUserPresence& Me, const TArray<FNakamaUserPresence>& Presences);
+
+	void HandleMatchPresence(const FNakamaMatchPresenceEvent& Event);
+	void HandleChannelPresence(const FNakamaChannelPresenceEvent& Event);
+	void HandlePartyPresence(const FNakamaPartyPresenceEvent& Event);
+	void HandleStreamPresence(const FNakamaStreamPresenceEvent& Event);
+};
@@ -30,7 +30,10 @@
 #include "Tickable.h"
 #include "IWebSocket.h"
 #include "NakamaRealtimeRequestContext.h"
+#include "NakamaRealtimeStats.h"
+#include "NakamaRealtimeRecorder.h"
 #include "NakamaRPC.h"
+#include "NakamaHttpPipeline.h"
 #include "Engine/TimerHandle.h"
 
 #include "NakamaRealtimeClient.generated.h"
@@ -1307,6 +1310,53 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Nakama|Realtime")
 	void SetHeartbeatIntervalMs(int32 IntervalMs);
 
+	/**
+	 * Snapshot of this socket's traffic: frames and bytes per envelope type,
+	 * decode and dispatch time, and requests still waiting for a response.
+	 * Safe to call from any thread.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Nakama|Realtime|Stats")
+	FNakamaRealtimeStats GetStats() const;
+
+	/**
+	 * Zero the traffic counters and restart the stats interval. Pending
+	 * request figures are live and unaffected.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Realtime|Stats")
+	void ResetStats();
+
+	/**
+	 * Cap on requests waiting for a response, for a fixed memory ceiling on
+	 * long-running sessions. Once the cap is reached, Policy either fails the
+	 * new request or fails the oldest pending one to make room; both report
+	 * ENakamaRtErrorCode::REQUEST_LIMIT through the request's error callback.
+	 * 0 (default) means unlimited.
+	 */
+	void SetMaxPendingRequests(int32 MaxRequests, ENakamaOverflowPolicy Policy = ENakamaOverflowPolicy::Reject);
+	int32 GetMaxPendingRequests() const;
+
+	/**
+	 * Start keeping raw frames in a bounded, sampled ring buffer (see
+	 * FNakamaRealtimeRecorder). Call before Connect to capture the whole
+	 * session. Replaces any recorder already attached.
+	 */
+	TSharedRef<FNakamaRealtimeRecorder, ESPMode::ThreadSafe> StartRecording(const FNakamaRealtimeRecorderSettings& Settings = FNakamaRealtimeRecorderSettings());
+
+	/** Detach the recorder; frames already held remain available through it. */
+	void StopRecording();
+
+	TSharedPtr<FNakamaRealtimeRecorder, ESPMode::ThreadSafe> GetRecorder() const { return Recorder; }
+
+	/**
+	 * Feed recorded inbound frames through the same decode and dispatch path as
+	 * live traffic, for offline profiling and regression tests. Outbound frames
+	 * are ignored and responses to requests this client never sent are
+	 * silently skipped. Must be called on the game thread.
+	 *
+	 * @return Number of frames replayed.
+	 */
+	int32 ReplayFrames(const TArray<FNakamaRecordedFrame>& Frames);
+
 	// Creates a request context and assigns a CID to the outgoing message.
 	TObjectPtr<UNakamaRealtimeRequestContext> CreateReqContext(FNakamaRealtimeEnvelope& envelope);
 
@@ -1402,6 +1452,16 @@ private:
 	// Used for "ping"
 	void SendMessage(const FString& FieldName, const TSharedPtr<FJsonObject>& Object);
 
+	// Counts and records a frame before handing it to the socket.
+	void SendFrame(const FString& FieldName, const FString& Frame);
+
+	FNakamaRealtimeSocketCounters SocketCounters;
+
+	TSharedPtr<FNakamaRealtimeRecorder, ESPMode::ThreadSafe> Recorder;
+
+	// Set while ReplayFrames runs.
+	bool bReplaying = false;
+
 	// Heartbeat and Ticking
 	float AccumulatedDeltaTime = 0.0f;
 
@@ -1431,5 +1491,26 @@ protected:
 	UPROPERTY()
 	TMap<int32, TObjectPtr<UNakamaRealtimeRequestContext>> ReqContexts;
 	int32 NextCid = 0;
-	FCriticalSection ReqContextsLock;
+	mutable FCriticalSection ReqContextsLock;
+
+	// Bounded-memory mode, see SetMaxPendingRequests (guarded by ReqContextsLock)
+	int32 MaxPendingRequests = 0;
+	ENakamaOverflowPolicy PendingOverflowPolicy = ENakamaOverflowPolicy::Reject;
+	std::atomic<int64> NumRejectedRequests{0};
+	std::atomic<int64> NumDroppedRequests{0};
+
+	// Pending requests in creation order, so DropOldest finds the oldest without
+	// scanning ReqContexts. Entries of requests that have since completed are
+	// skipped when reached (guarded by ReqContextsLock).
+	struct FPendingOrderEntry
+	{
+		int32 Cid = 0;
+		TWeakObjectPtr<UNakamaRealtimeRequestContext> Context;
+	};
+	TArray<FPendingOrderEntry> PendingOrder;
+	int32 PendingOrderHead = 0;
+
+	// Makes room for one more pending request under the cap. Returns false,
+	// after failing ErrorCallback, if the new request must not be sent.
+	bool ReservePendingRequest(const TFunction<void(const FNakamaRtError& Error)>& ErrorCallback);
 };
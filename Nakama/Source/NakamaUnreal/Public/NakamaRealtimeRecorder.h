@@ -0,0 +1,112 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Direction of a recorded realtime frame.
+enum class ENakamaFrameDirection : uint8
+{
+	Inbound,
+	Outbound,
+};
+
+// One raw realtime frame as it crossed the socket.
+struct NAKAMAUNREAL_API FNakamaRecordedFrame
+{
+	ENakamaFrameDirection Direction = ENakamaFrameDirection::Inbound;
+
+	// Seconds since the recorder was created.
+	double TimeSeconds = 0.0;
+
+	FString Frame;
+};
+
+// Tunables for FNakamaRealtimeRecorder.
+struct NAKAMAUNREAL_API FNakamaRealtimeRecorderSettings
+{
+	// Size of the ring buffer. Once full, the oldest frames are overwritten.
+	int32 CapacityBytes = 4 * 1024 * 1024;
+
+	// Fraction of frames kept, from 0 to 1.
+	float SampleRate = 1.0f;
+
+	// Also keep frames sent by the client; replay only uses inbound frames.
+	bool bRecordOutbound = true;
+};
+
+/**
+ * Bounded recorder of raw realtime frames for diagnosing production issues
+ * without debug logging.
+ *
+ * Frames are copied as UTF-8 into a fixed-size binary ring buffer together
+ * with their direction and timestamp, so recording costs one copy per kept
+ * frame and never grows past CapacityBytes. Recordings can be saved on demand
+ * (SaveToFile, or the Nakama.Realtime.DumpRecordings console command for every
+ * live recorder) and loaded back for UNakamaRealtimeClient::ReplayFrames.
+ *
+ * Record may be called from any thread.
+ */
+class NAKAMAUNREAL_API FNakamaRealtimeRecorder : public TSharedFromThis<FNakamaRealtimeRecorder, ESPMode::ThreadSafe>
+{
+public:
+
+	static TSharedRef<FNakamaRealtimeRecorder, ESPMode::ThreadSafe> Create(const FNakamaRealtimeRecorderSettings& Settings = FNakamaRealtimeRecorderSettings());
+	~FNakamaRealtimeRecorder();
+
+	void Record(ENakamaFrameDirection Direction, const FString& Frame);
+
+	// Frames currently held, oldest first.
+	TArray<FNakamaRecordedFrame> GetFrames() const;
+
+	void Clear();
+
+	int32 GetNumFrames() const;
+	int32 GetBytesUsed() const;
+	int64 GetNumSkipped() const;   // not sampled, or larger than the buffer
+	int64 GetNumOverwritten() const;
+
+	const FNakamaRealtimeRecorderSettings& GetSettings() const { return Settings; }
+
+	// Write the held frames to a compact binary file.
+	bool SaveToFile(const FString& Path) const;
+
+	static bool LoadFromFile(const FString& Path, TArray<FNakamaRecordedFrame>& OutFrames);
+
+	// Save every live recorder into Directory; returns the number of files written.
+	static int32 DumpAll(const FString& Directory);
+
+private:
+
+	explicit FNakamaRealtimeRecorder(const FNakamaRealtimeRecorderSettings& InSettings);
+
+	void Write(int32 Offset, const void* Data, int32 Num);
+	void Read(int32 Offset, void* Data, int32 Num) const;
+	void EvictOldest();
+
+	const FNakamaRealtimeRecorderSettings Settings;
+	const double StartTime;
+
+	mutable FCriticalSection Mutex;
+	TArray<uint8> Buffer;
+	int32 Head = 0;      // offset of the oldest record
+	int32 BytesUsed = 0;
+	int32 NumFrames = 0;
+	int64 NumSkipped = 0;
+	int64 NumOverwritten = 0;
+	FRandomStream Sampler;
+};
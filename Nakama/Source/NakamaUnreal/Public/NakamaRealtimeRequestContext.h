@@ -17,6 +17,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "NakamaTrace.h"
 #include "NakamaRtError.h"
 //#include "NakamaUtils.h"
 #include "Serialization/JsonSerializer.h"
@@ -80,6 +81,12 @@ public:
 
 	// The CID for the request
 	int32 CID = -1;
+
+	// FPlatformTime::Seconds() when the request was created
+	double CreatedTime = 0.0;
+
+	// Insights region from CID issue to response (null while tracing is off)
+	FNakamaTraceRegionPtr TraceRegion;
 	
 	UNakamaRealtimeRequestContext() { }
 };
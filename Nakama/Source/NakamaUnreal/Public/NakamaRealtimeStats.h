@@ -0,0 +1,183 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Trace.h"
+#include <atomic>
+#include "NakamaRealtimeStats.generated.h"
+
+class FJsonObject;
+
+// Insights channel for realtime socket activity (enable with -trace=cpu,NakamaRealtime).
+UE_TRACE_CHANNEL_EXTERN(NakamaRealtimeChannel, NAKAMAUNREAL_API);
+
+// Traffic and handling cost of one realtime envelope type (e.g. "match_data").
+USTRUCT(BlueprintType)
+struct NAKAMAUNREAL_API FNakamaRealtimeEnvelopeStats
+{
+	GENERATED_BODY()
+
+	// Envelope field name; "other" for envelopes this client does not know.
+	UPROPERTY(BlueprintReadOnly, Category = "Nakama|Realtime|Stats")
+	FString Type;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Nakama|Realtime|Stats")
+	int64 FramesReceived = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Nakama|Realtime|Stats")
+	int64 BytesReceived = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Nakama|Realtime|Stats")
+	int64 FramesSent = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Nakama|Realtime|Stats")
+	int64 BytesSent = 0;
+
+	// Time spent dispatching received envelopes of this type (typed decode and callbacks).
+	UPROPERTY(BlueprintReadOnly, Category = "Nakama|Realtime|Stats")
+	double DispatchTimeMs = 0.0;
+};
+
+// Snapshot of a realtime client's socket statistics, see UNakamaRealtimeClient::GetStats.
+USTRUCT(BlueprintType)
+struct NAKAMAUNREAL_API FNakamaRealtimeStats
+{
+	GENERATED_BODY()
+
+	// Seconds since the client was created or the stats were last reset; divide counts by this for rates.
+	UPROPERTY(BlueprintReadOnly, Category = "Nakama|Realtime|Stats")
+	double ElapsedSeconds = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Nakama|Realtime|Stats")
+	int64 FramesReceived = 0;
+
+	// UTF-8 payload bytes, excluding websocket framing.
+	UPROPERTY(BlueprintReadOnly, Category = "Nakama|Realtime|Stats")
+	int64 BytesReceived = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Nakama|Realtime|Stats")
+	int64 FramesSent = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Nakama|Realtime|Stats")
+	int64 BytesSent = 0;
+
+	// Received frames that were not valid JSON.
+	UPROPERTY(BlueprintReadOnly, Category = "Nakama|Realtime|Stats")
+	int64 DecodeErrors = 0;
+
+	// Total and worst time parsing received frames into JSON.
+	UPROPERTY(BlueprintReadOnly, Category = "Nakama|Realtime|Stats")
+	double DecodeTimeMs = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Nakama|Realtime|Stats")
+	double MaxDecodeTimeMs = 0.0;
+
+	// Total and worst time dispatching parsed envelopes to typed structs and callbacks.
+	UPROPERTY(BlueprintReadOnly, Category = "Nakama|Realtime|Stats")
+	double DispatchTimeMs = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Nakama|Realtime|Stats")
+	double MaxDispatchTimeMs = 0.0;
+
+	// Requests sent and still waiting for their response.
+	UPROPERTY(BlueprintReadOnly, Category = "Nakama|Realtime|Stats")
+	int32 PendingRequests = 0;
+
+	// Age of the oldest pending request, 0 when none are pending.
+	UPROPERTY(BlueprintReadOnly, Category = "Nakama|Realtime|Stats")
+	double OldestPendingRequestAgeSeconds = 0.0;
+
+	// Requests refused or evicted by the pending request cap (see UNakamaRealtimeClient::SetMaxPendingRequests).
+	UPROPERTY(BlueprintReadOnly, Category = "Nakama|Realtime|Stats")
+	int64 RejectedRequests = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Nakama|Realtime|Stats")
+	int64 DroppedRequests = 0;
+
+	// Frames handed to the socket that it has not yet reported as written (OnMessageSent),
+	// and the highest such depth since the last reset. Custom sockets that never fire
+	// OnMessageSent report every sent frame as queued.
+	UPROPERTY(BlueprintReadOnly, Category = "Nakama|Realtime|Stats")
+	int32 SendQueueDepth = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Nakama|Realtime|Stats")
+	int32 MaxSendQueueDepth = 0;
+
+	// Per envelope type, only types that have seen traffic.
+	UPROPERTY(BlueprintReadOnly, Category = "Nakama|Realtime|Stats")
+	TArray<FNakamaRealtimeEnvelopeStats> Envelopes;
+};
+
+/**
+ * Lock-free socket counters owned by a realtime client. Updates are relaxed
+ * atomic adds so the socket path stays cheap, and snapshots can be taken from
+ * any thread (e.g. a dedicated server's stats reporter).
+ */
+class NAKAMAUNREAL_API FNakamaRealtimeSocketCounters
+{
+public:
+
+	FNakamaRealtimeSocketCounters();
+
+	// Index of an envelope field name; unknown names share the "other" slot.
+	static int32 GetEnvelopeTypeIndex(const FString& FieldName);
+
+	// Index of a received envelope, from its first field other than "cid".
+	static int32 GetEnvelopeTypeIndex(const FJsonObject& Envelope);
+
+	static const TCHAR* GetEnvelopeTypeName(int32 TypeIndex);
+
+	void RecordSent(int32 TypeIndex, const FString& Frame);
+	void RecordReceived(int32 TypeIndex, const FString& Frame);
+	void RecordDecode(uint64 Cycles, bool bSucceeded);
+	void RecordDispatch(int32 TypeIndex, uint64 Cycles);
+
+	// Send queue depth: a frame is queued when handed to the socket and written when the
+	// socket reports it sent. ResetSendQueue drops frames a replaced socket never wrote.
+	void RecordQueued();
+	void RecordWritten();
+	void ResetSendQueue();
+
+	// Fills everything but the pending request fields, which the client owns.
+	void GetSnapshot(FNakamaRealtimeStats& OutStats) const;
+
+	void Reset();
+
+	static constexpr int32 NumEnvelopeTypes = 50;
+
+private:
+
+	struct FEnvelopeCounters
+	{
+		std::atomic<uint64> FramesReceived{0};
+		std::atomic<uint64> BytesReceived{0};
+		std::atomic<uint64> FramesSent{0};
+		std::atomic<uint64> BytesSent{0};
+		std::atomic<uint64> DispatchCycles{0};
+	};
+
+	FEnvelopeCounters Envelopes[NumEnvelopeTypes];
+
+	std::atomic<uint64> DecodeErrors{0};
+	std::atomic<uint64> DecodeCycles{0};
+	std::atomic<uint64> MaxDecodeCycles{0};
+	std::atomic<uint64> MaxDispatchCycles{0};
+	std::atomic<int64> SendQueueDepth{0};
+	std::atomic<uint64> MaxSendQueueDepth{0};
+	std::atomic<double> ResetTime{0.0};
+};
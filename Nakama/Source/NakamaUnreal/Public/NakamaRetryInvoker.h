@@ -2,21 +2,17 @@
 
 #include "CoreMinimal.h"
 #include "Containers/Ticker.h"
+#include "NakamaHttpPipeline.h"
 #include "NakamaRetry.h"
 #include "NakamaRetryConfiguration.h"
 #include "NakamaError.h"
 
 /**
  * Terminal classification of one HTTP attempt, reported through OnComplete.
- * Replaces the old (bSuccess, magic HttpCode) pair so a cancelled/released
- * request is a first-class outcome rather than a sentinel status code.
+ * The attempt itself runs on the shared transport (NakamaHttp), so this is
+ * the transport's outcome type.
  */
-enum class ENakamaRequestOutcome : uint8
-{
-	Response,          // a response was received; HttpCode/Body are meaningful
-	ConnectionFailure, // transport-level failure, no response (retry-terminal)
-	Cancelled,         // request cancelled or owning client released (not a fault)
-};
+using ENakamaRequestOutcome = ENakamaHttpOutcome;
 
 /**
  * One HTTP attempt. Reports its outcome through OnComplete:
@@ -41,6 +41,9 @@ enum class ENakamaRtErrorCode : uint8
 	RUNTIME_FUNCTION_NOT_FOUND = 6 UMETA(DisplayName = "RUNTIME_FUNCTION_NOT_FOUND"),
 	RUNTIME_FUNCTION_EXCEPTION = 7 UMETA(DisplayName = "RUNTIME_FUNCTION_EXCEPTION"),
 
+	// Unreal Client Errors (no counterpart in the base enum below)
+	REQUEST_LIMIT = 13 UMETA(DisplayName = "REQUEST_LIMIT"), // Request turned away or dropped by the pending request cap
+
 	/*
 	 * Base Nakama Enums (Changed since we can't have negatives)
 	UNKNOWN                       = -100,
@@ -0,0 +1,254 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NakamaError.h"
+#include "NakamaStorageObject.h"
+#include "NakamaStorageMirror.generated.h"
+
+class UNakamaClient;
+class UNakamaSession;
+
+// A local change the server refused because the object changed there since it was last read or written.
+USTRUCT(BlueprintType)
+struct NAKAMAUNREAL_API FNakamaStorageConflict
+{
+	GENERATED_BODY()
+
+	// The local change that was not written.
+	UPROPERTY(BlueprintReadOnly, Category = "Nakama|Storage")
+	FNakamaStoreObjectWrite Local;
+
+	// The object as currently stored on the server.
+	UPROPERTY(BlueprintReadOnly, Category = "Nakama|Storage")
+	FNakamaStoreObjectData Server;
+
+	// True if the object no longer exists on the server; Server only holds its IDs.
+	UPROPERTY(BlueprintReadOnly, Category = "Nakama|Storage")
+	bool bServerDeleted = false;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnNakamaStorageConflict, const FNakamaStorageConflict&, Conflict);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnNakamaStorageFlushFailed, const FNakamaError&, Error);
+
+/**
+ * In-memory mirror of storage objects, keyed by collection, key and owner.
+ *
+ * Reads are answered from memory once an object has been read or written.
+ * Writes only change the mirror; changed objects are written together in one
+ * WriteStorageObjects call once no write has happened for FlushDelaySeconds
+ * (and at least every MaxFlushDelaySeconds while writes keep coming).
+ *
+ * Every write carries the version last seen for the object ("*" if the object
+ * is known not to exist), so a change made elsewhere in the meantime is
+ * refused by the server instead of being overwritten. The mirror then reads
+ * the batch back, reports each changed object through ConflictEvent and holds
+ * it until ResolveConflict is called; the rest of the batch is written again.
+ *
+ * All methods must be called on the game thread.
+ */
+UCLASS(BlueprintType)
+class NAKAMAUNREAL_API UNakamaStorageMirror : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	 * Creates a mirror bound to a client.
+	 *
+	 * @param Client The client used for storage requests.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Storage")
+	static UNakamaStorageMirror* CreateStorageMirror(UNakamaClient* Client);
+
+	/** Quiet time after the last write before changes are sent. */
+	UPROPERTY(BlueprintReadWrite, Category = "Nakama|Storage")
+	float FlushDelaySeconds = 1.0f;
+
+	/** Longest a change waits while writes keep coming. */
+	UPROPERTY(BlueprintReadWrite, Category = "Nakama|Storage")
+	float MaxFlushDelaySeconds = 5.0f;
+
+	/**
+	 * Server RPC that writes merge patches, see README "Storage Mirror". When
+	 * set, changed objects whose server value is known are sent as a JSON merge
+	 * patch against it instead of whole. Empty (default) always writes whole
+	 * values, as does a server without the RPC.
+	 */
+	UPROPERTY(BlueprintReadWrite, Category = "Nakama|Storage")
+	FString PatchRpcId;
+
+	/** Fired for each object whose write was refused because it changed on the server. */
+	UPROPERTY(BlueprintAssignable, Category = "Nakama|Storage")
+	FOnNakamaStorageConflict ConflictEvent;
+
+	/** Fired when a background flush fails for a reason other than a conflict; the changes stay pending. */
+	UPROPERTY(BlueprintAssignable, Category = "Nakama|Storage")
+	FOnNakamaStorageFlushFailed FlushFailedEvent;
+
+	/**
+	 * Read objects, from memory where possible.
+	 *
+	 * @param Session The session of the user.
+	 * @param ObjectIds The objects to read.
+	 * @param SuccessCallback Called with the objects that exist, in the order requested, including unsent local changes.
+	 * @param ErrorCallback Called if fetching objects not yet mirrored fails.
+	 */
+	void ReadObjects(
+		UNakamaSession* Session,
+		const TArray<FNakamaReadStorageObjectId>& ObjectIds,
+		const TFunction<void(const TArray<FNakamaStoreObjectData>& Objects)>& SuccessCallback,
+		const TFunction<void(const FNakamaError& Error)>& ErrorCallback
+	);
+
+	/**
+	 * Change an object owned by the session user. The change is visible to
+	 * reads immediately and written on the next flush. Object.Version is
+	 * ignored; the mirror tracks versions itself.
+	 */
+	void WriteObject(UNakamaSession* Session, const FNakamaStoreObjectWrite& Object);
+
+	/**
+	 * Send pending changes now instead of waiting for the debounce.
+	 *
+	 * @param SuccessCallback Called with the acknowledgements of the objects written.
+	 * @param ErrorCallback Called if the write fails, including for conflicts.
+	 */
+	void Flush(
+		const TFunction<void(const FNakamaStoreObjectAcks& Acks)>& SuccessCallback,
+		const TFunction<void(const FNakamaError& Error)>& ErrorCallback
+	);
+
+	/**
+	 * Settle a conflict reported through ConflictEvent.
+	 *
+	 * @param bKeepLocal True to write the local change over the server copy, false to take the server copy.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Storage")
+	void ResolveConflict(const FString& Collection, const FString& Key, const FString& UserId, bool bKeepLocal);
+
+	/**
+	 * Look up a mirrored object, including unsent local changes, without a request.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Nakama|Storage")
+	bool GetObject(const FString& Collection, const FString& Key, const FString& UserId, FNakamaStoreObjectData& OutObject) const;
+
+	/** @return Number of objects with local changes not yet acknowledged, including conflicts. */
+	UFUNCTION(BlueprintPure, Category = "Nakama|Storage")
+	int32 GetNumPendingWrites() const;
+
+	/** @return Number of object changes sent as a patch rather than a whole value. */
+	UFUNCTION(BlueprintPure, Category = "Nakama|Storage")
+	int32 GetNumPatchedWrites() const { return NumPatchedWrites; }
+
+	/** @return Number of objects held back by an unresolved conflict. */
+	UFUNCTION(BlueprintPure, Category = "Nakama|Storage")
+	int32 GetNumConflicts() const;
+
+	/** Drop everything, including unsent changes. */
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Storage")
+	void Clear();
+
+private:
+
+	UPROPERTY()
+	UNakamaClient* Client;
+
+	// Session of the most recent write, used for flushes.
+	UPROPERTY()
+	UNakamaSession* WriteSession;
+
+	struct FObjectId
+	{
+		FString Collection;
+		FString Key;
+		FString UserId;
+
+		bool operator==(const FObjectId& Other) const
+		{
+			return Collection == Other.Collection && Key == Other.Key && UserId == Other.UserId;
+		}
+
+		friend uint32 GetTypeHash(const FObjectId& Id)
+		{
+			return HashCombine(HashCombine(GetTypeHash(Id.Collection), GetTypeHash(Id.Key)), GetTypeHash(Id.UserId));
+		}
+	};
+
+	// What the mirror knows about the server copy of an object.
+	enum class EServerState : uint8
+	{
+		Unknown, // never read; written without a version check
+		Missing, // known not to exist
+		Known,   // ServerVersion is current as far as we know
+	};
+
+	struct FEntry
+	{
+		// Local view of the object; Value includes unsent changes.
+		FNakamaStoreObjectData Object;
+		EServerState ServerState = EServerState::Unknown;
+		FString ServerVersion;
+
+		// Value of the server copy when Known, the base for patches.
+		FString ServerValue;
+		FString InFlightValue;
+
+		// Bumped on every local change; a write acknowledges the revision it sent.
+		uint32 Revision = 0;
+		uint32 AckedRevision = 0;
+		uint32 InFlightRevision = 0;
+
+		TOptional<FNakamaStorageConflict> Conflict;
+
+		bool IsDirty() const { return Revision != AckedRevision; }
+	};
+
+	TMap<FObjectId, FEntry> Entries;
+
+	bool bFlushScheduled = false;
+	bool bPatchRpcMissing = false;
+	int32 NumPatchedWrites = 0;
+	double FirstPendingWriteTime = 0.0;
+	double LastWriteTime = 0.0;
+
+	void ScheduleFlush();
+	void HandleFlushTimer();
+
+	void HandleWriteError(
+		const TArray<FObjectId>& Batch,
+		const FNakamaError& Error,
+		const TFunction<void(const FNakamaError& Error)>& ErrorCallback);
+
+	void DetectConflicts(
+		const TArray<FObjectId>& Batch,
+		const FNakamaError& Error,
+		const TFunction<void(const FNakamaError& Error)>& ErrorCallback);
+
+	// Build the PatchRpcId payload; false if no object in the batch is worth patching.
+	bool MakePatchPayload(const TArray<FObjectId>& Batch, FString& OutPayload, int32& OutNumPatched) const;
+
+	// Errors of background flushes, which have no callback, go to FlushFailedEvent.
+	void ReportFlushError(const FNakamaError& Error, const TFunction<void(const FNakamaError& Error)>& ErrorCallback);
+
+	// Record a server copy; keeps local changes and only moves the version on.
+	void MergeServerObject(const FNakamaStoreObjectData& Object);
+
+	static FNakamaStoreObjectWrite MakeWrite(const FEntry& Entry);
+};
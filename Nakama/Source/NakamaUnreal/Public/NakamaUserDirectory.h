@@ -0,0 +1,173 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/LruCache.h"
+#include "NakamaError.h"
+#include "NakamaUser.h"
+#include "NakamaUserDirectory.generated.h"
+
+class UNakamaClient;
+class UNakamaRealtimeClient;
+class UNakamaSession;
+struct FNakamaChannelPresenceEvent;
+struct FNakamaMatchPresenceEvent;
+struct FNakamaStatusPresenceEvent;
+struct FNakamaUserPresence;
+
+/**
+ * Shared cache of user profiles for UIs that show the same users in several
+ * places (chat, leaderboards, friends, parties).
+ *
+ * Lookups made within BatchWindowSeconds of each other are merged into one
+ * GetUsers request per MaxBatchSize IDs, and IDs already being fetched are
+ * never requested twice. Results are kept for TimeToLiveSeconds in an LRU
+ * bounded by the capacity passed on creation (DefaultMaxEntries if none).
+ * When bound to a realtime client, presence joins refresh the username and
+ * online flag of cached users.
+ *
+ * All methods must be called on the game thread.
+ */
+UCLASS(BlueprintType)
+class NAKAMAUNREAL_API UNakamaUserDirectory : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Capacity used when none is given on creation. */
+	static constexpr int32 DefaultMaxEntries = 1000;
+
+	/**
+	 * Creates a directory bound to a client.
+	 *
+	 * @param Client The client used for GetUsers requests.
+	 * @param MaxEntries Number of users kept before the least recently used are evicted; 0 or less uses DefaultMaxEntries.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Users")
+	static UNakamaUserDirectory* CreateUserDirectory(UNakamaClient* Client, int32 MaxEntries = 0);
+
+	/** How long lookups are accumulated before a batch is sent. */
+	UPROPERTY(BlueprintReadWrite, Category = "Nakama|Users")
+	float BatchWindowSeconds = 0.05f;
+
+	/** Most IDs sent in one GetUsers request. */
+	UPROPERTY(BlueprintReadWrite, Category = "Nakama|Users")
+	int32 MaxBatchSize = 100;
+
+	/** How long a fetched profile is served from the cache. */
+	UPROPERTY(BlueprintReadWrite, Category = "Nakama|Users")
+	float TimeToLiveSeconds = 300.0f;
+
+	/**
+	 * Resolve users by ID, from the cache where possible.
+	 *
+	 * @param Session The session of the user.
+	 * @param UserIds IDs of the users to resolve.
+	 * @param SuccessCallback Called with the users found, in the order requested; unknown IDs are left out.
+	 * @param ErrorCallback Called if a batch holding one of the IDs fails.
+	 */
+	void GetUsers(
+		UNakamaSession* Session,
+		const TArray<FString>& UserIds,
+		const TFunction<void(const TArray<FNakamaUser>& Users)>& SuccessCallback,
+		const TFunction<void(const FNakamaError& Error)>& ErrorCallback
+	);
+
+	/**
+	 * Look up a user that is cached and not expired, without a request.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Nakama|Users")
+	bool FindUser(const FString& UserId, FNakamaUser& OutUser) const;
+
+	/**
+	 * Refresh cached users from presence events received by a realtime client.
+	 * Pass nullptr to unbind.
+	 */
+	void BindRealtimeClient(UNakamaRealtimeClient* RealtimeClient);
+
+	/** Forget one user so the next lookup fetches it again. */
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Users")
+	void Invalidate(const FString& UserId);
+
+	/** Forget all cached users. Lookups in flight are unaffected. */
+	UFUNCTION(BlueprintCallable, Category = "Nakama|Users")
+	void Clear();
+
+	/** @return Number of cached users, including expired ones not yet evicted. */
+	UFUNCTION(BlueprintPure, Category = "Nakama|Users")
+	int32 Num() const;
+
+	/** @return Number of GetUsers requests sent so far. */
+	UFUNCTION(BlueprintPure, Category = "Nakama|Users")
+	int32 GetNumRequests() const { return NumRequests; }
+
+	virtual void BeginDestroy() override;
+
+private:
+
+	UPROPERTY()
+	UNakamaClient* Client;
+
+	// Session of the most recent lookup, used for the next batch.
+	UPROPERTY()
+	UNakamaSession* BatchSession;
+
+	TWeakObjectPtr<UNakamaRealtimeClient> BoundRealtimeClient;
+	TArray<FDelegateHandle> PresenceHandles;
+
+	struct FEntry
+	{
+		FNakamaUser User;
+		double ExpiresAt = 0.0;
+	};
+	// Sized here too so directories made with NewObject or in Blueprints can cache before any resize.
+	TLruCache<FString, FEntry> Entries { DefaultMaxEntries };
+
+	// One GetUsers call from a caller, waiting on the IDs not in the cache.
+	struct FLookup
+	{
+		TArray<FString> UserIds;
+		TMap<FString, FNakamaUser> Found;
+		int32 NumOutstanding = 0;
+		bool bFinished = false;
+		TFunction<void(const TArray<FNakamaUser>&)> OnSuccess;
+		TFunction<void(const FNakamaError&)> OnError;
+	};
+
+	// Lookups waiting on each ID, queued or in flight.
+	TMap<FString, TArray<TSharedRef<FLookup>>> Waiters;
+
+	// IDs to send with the next batch.
+	TArray<FString> QueuedIds;
+	bool bFlushScheduled = false;
+	int32 NumRequests = 0;
+
+	void ScheduleFlush();
+	void Flush();
+	void SendBatch(const TArray<FString>& UserIds);
+
+	void Resolve(const FString& UserId, const FNakamaUser* User);
+	void Fail(const FString& UserId, const FNakamaError& Error);
+	static void Complete(FLookup& Lookup);
+
+	void RefreshPresence(const FNakamaUserPresence& Presence, bool bOnline);
+	void HandleStatusPresence(const FNakamaStatusPresenceEvent& Event);
+	void HandleChannelPresence(const FNakamaChannelPresenceEvent& Event);
+	void HandleMatchPresence(const FNakamaMatchPresenceEvent& Event);
+};
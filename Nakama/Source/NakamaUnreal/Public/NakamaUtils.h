@@ -22,6 +22,7 @@
 #include "Templates/SharedPointer.h"
 #include "NakamaLogger.h"
 #include "Misc/Base64.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 #include "NakamaLoggingMacros.h"
 
 class FJsonObject;
@@ -171,6 +172,7 @@ public:
 	}
 
 	static TSharedPtr<FJsonObject> DeserializeJsonObject(const FString& JsonString) {
+		TRACE_CPUPROFILER_EVENT_SCOPE(Nakama::Json::Parse);
 		TSharedPtr<FJsonObject> JsonObject;
 		const TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(JsonString);
 		if (!FJsonSerializer::Deserialize(JsonReader, JsonObject))
@@ -305,6 +307,10 @@ public:
 	// rather than Error and never trips automation log-error capture.
 	static FNakamaError CreateRequestCancelledError();
 
+	// Terminal error for a request turned away by a full request queue
+	// (see FNakamaHttpPipeline::SetMaxQueuedRequests).
+	static FNakamaError CreateRequestRejectedError();
+
 	// Make HTTP request
 	static TSharedRef<IHttpRequest, ESPMode::ThreadSafe> MakeRequest(
 		const FString& URL,
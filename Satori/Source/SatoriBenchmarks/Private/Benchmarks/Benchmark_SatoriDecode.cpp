@@ -0,0 +1,68 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Decode benchmarks for every Satori type with a JSON string constructor.
+// Fixtures are responses recorded from a Satori server, trimmed to two or
+// three entries; the medium and huge runs replicate those entries.
+
+#include "NakamaDecodeBenchmark.h"
+#include "SatoriError.h"
+#include "SatoriEvent.h"
+#include "SatoriExperiment.h"
+#include "SatoriFlag.h"
+#include "SatoriLiveEvent.h"
+#include "SatoriMessage.h"
+#include "SatoriProperties.h"
+
+#define SATORI_DECODE_GROUP "Satori.Benchmark.Decode"
+
+// Flags
+
+NAKAMA_DECODE_BENCHMARK(SATORI_DECODE_GROUP, FSatoriFlagValueChangeReason, TEXT(R"json({"name":"holiday_pricing","variant_name":"discount_20","type":2})json"))
+
+NAKAMA_DECODE_BENCHMARK(SATORI_DECODE_GROUP, FSatoriFlag, TEXT(R"json({"name":"store_layout","value":"{\"tabs\":[\"featured\",\"bundles\",\"currency\"],\"hero\":\"autumn_bundle\"}","condition_changed":true,"change_reason":{"name":"holiday_pricing","variant_name":"discount_20","type":2}})json"))
+
+NAKAMA_DECODE_BENCHMARK(SATORI_DECODE_GROUP, FSatoriFlagList, TEXT(R"json({"flags":[{"name":"store_layout","value":"{\"tabs\":[\"featured\",\"bundles\",\"currency\"],\"hero\":\"autumn_bundle\"}","condition_changed":true,"change_reason":{"name":"holiday_pricing","variant_name":"discount_20","type":2}},{"name":"max_party_size","value":"4","condition_changed":false},{"name":"tutorial_enabled","value":"true","condition_changed":false}]})json"))
+
+NAKAMA_DECODE_BENCHMARK(SATORI_DECODE_GROUP, FSatoriFlagOverrideValue, TEXT(R"json({"name":"holiday_pricing","variant_name":"discount_20","value":"{\"discount\":0.2}","create_time_sec":"1760000000","type":2})json"))
+
+NAKAMA_DECODE_BENCHMARK(SATORI_DECODE_GROUP, FSatoriFlagOverride, TEXT(R"json({"flag_name":"store_layout","overrides":[{"name":"holiday_pricing","variant_name":"discount_20","value":"{\"hero\":\"autumn_bundle\"}","create_time_sec":"1760000000","type":2},{"name":"new_players","variant_name":"starter","value":"{\"hero\":\"starter_pack\"}","create_time_sec":"1750000000","type":1}]})json"))
+
+NAKAMA_DECODE_BENCHMARK(SATORI_DECODE_GROUP, FSatoriFlagOverrideList, TEXT(R"json({"flags":[{"flag_name":"store_layout","overrides":[{"name":"holiday_pricing","variant_name":"discount_20","value":"{\"hero\":\"autumn_bundle\"}","create_time_sec":"1760000000","type":2}]},{"flag_name":"max_party_size","overrides":[{"name":"weekend_event","variant_name":"large","value":"6","create_time_sec":"1759000000","type":1}]}]})json"))
+
+// Experiments, live events and properties
+
+NAKAMA_DECODE_BENCHMARK(SATORI_DECODE_GROUP, FSatoriExperiment, TEXT(R"json({"name":"onboarding_flow","value":"{\"steps\":3,\"skip_allowed\":true}"})json"))
+
+NAKAMA_DECODE_BENCHMARK(SATORI_DECODE_GROUP, FSatoriExperimentList, TEXT(R"json({"experiments":[{"name":"onboarding_flow","value":"{\"steps\":3,\"skip_allowed\":true}"},{"name":"store_price_test","value":"{\"bundle_price\":499}"},{"name":"daily_reward_curve","value":"{\"curve\":\"steep\"}"}]})json"))
+
+NAKAMA_DECODE_BENCHMARK(SATORI_DECODE_GROUP, FSatoriLiveEvent, TEXT(R"json({"name":"autumn_festival","description":"Double XP and themed rewards","value":"{\"xp_multiplier\":2,\"reward_table\":\"autumn\"}","active_start_time_sec":"1760000000","active_end_time_sec":"1760604800","id":"4c5d6e7f-8a9b-4c0d-9e1f-2a3b4c5d6e7f","start_time_sec":"1759000000","end_time_sec":"1762000000","duration_sec":"604800","reset_cron":"0 0 * * 1"})json"))
+
+NAKAMA_DECODE_BENCHMARK(SATORI_DECODE_GROUP, FSatoriLiveEventList, TEXT(R"json({"live_events":[{"name":"autumn_festival","description":"Double XP and themed rewards","value":"{\"xp_multiplier\":2}","active_start_time_sec":"1760000000","active_end_time_sec":"1760604800","id":"4c5d6e7f-8a9b-4c0d-9e1f-2a3b4c5d6e7f","start_time_sec":"1759000000","end_time_sec":"1762000000","duration_sec":"604800","reset_cron":"0 0 * * 1"},{"name":"happy_hour","description":"Shop discount","value":"{\"discount\":0.1}","active_start_time_sec":"1760893200","active_end_time_sec":"1760896800","id":"5d6e7f8a-9b0c-4d1e-8f2a-3b4c5d6e7f80","start_time_sec":"1750000000","end_time_sec":"0","duration_sec":"3600","reset_cron":"0 18 * * *"}]})json"))
+
+NAKAMA_DECODE_BENCHMARK(SATORI_DECODE_GROUP, FSatoriProperties, TEXT(R"json({"default":{"country":"DE","platform":"android","app_version":"2.11.5"},"computed":{"sessionCount":"142","purchaseCount":"3","lastSeen":"1760880000"},"custom":{"favorite_mode":"duel","clan":"northern_lights"}})json"))
+
+// Messages, events and errors
+
+NAKAMA_DECODE_BENCHMARK(SATORI_DECODE_GROUP, FSatoriMessage, TEXT(R"json({"schedule_id":"6e7f8a9b-0c1d-4e2f-9a3b-4c5d6e7f8a9b","send_time":"1760860000","create_time":"1760860000","update_time":"1760860000","read_time":"0","consume_time":"0","text":"Your autumn reward is waiting","id":"7f8a9b0c-1d2e-4f3a-8b4c-5d6e7f8a9b0c","title":"Autumn Festival","image_url":"https://cdn.example.com/messages/autumn.png","metadata":{"reward":"banner_autumn","deeplink":"store/autumn"}})json"))
+
+NAKAMA_DECODE_BENCHMARK(SATORI_DECODE_GROUP, FSatoriMessageList, TEXT(R"json({"messages":[{"schedule_id":"6e7f8a9b-0c1d-4e2f-9a3b-4c5d6e7f8a9b","send_time":"1760860000","create_time":"1760860000","update_time":"1760860000","read_time":"0","consume_time":"0","text":"Your autumn reward is waiting","id":"7f8a9b0c-1d2e-4f3a-8b4c-5d6e7f8a9b0c","title":"Autumn Festival","image_url":"https://cdn.example.com/messages/autumn.png","metadata":{"reward":"banner_autumn"}},{"schedule_id":"8a9b0c1d-2e3f-4a4b-9c5d-6e7f8a9b0c1d","send_time":"1760700000","create_time":"1760700000","update_time":"1760750000","read_time":"1760750000","consume_time":"0","text":"Maintenance tonight at 02:00 UTC","id":"9b0c1d2e-3f4a-4b5c-8d6e-7f8a9b0c1d2e","title":"Maintenance","metadata":{}}],"next_cursor":"CiQ5YjBjMWQyZQ==","prev_cursor":"","cacheable_cursor":"CiQ3ZjhhOWIwYw=="})json"))
+
+NAKAMA_DECODE_BENCHMARK(SATORI_DECODE_GROUP, FSatoriEvent, TEXT(R"json({"name":"level_complete","id":"0c1d2e3f-4a5b-4c6d-9e7f-8a9b0c1d2e3f","value":"12","timestamp":"2026-10-18T17:55:00Z","metadata":{"level":"12","duration_sec":"214","stars":"3"},"identity_id":"8f4d52c7-bcf6-4d7b-9c5a-7d7b1c2e0a11","session_id":"a1b2c3d4-e5f6-4a7b-8c9d-0e1f2a3b4c5d","session_issued_at":"1760870000","session_expires_at":"1760873600"})json"))
+
+NAKAMA_DECODE_BENCHMARK(SATORI_DECODE_GROUP, FSatoriError, TEXT(R"json({"code":16,"message":"Auth token invalid"})json"))
+
+#undef SATORI_DECODE_GROUP
@@ -0,0 +1,122 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SatoriTestBase.h"
+#include "NakamaHttpPipeline.h"
+#include "NakamaMockServer.h"
+#include "SatoriExperimentCache.h"
+#include "UObject/StrongObjectPtr.h"
+
+namespace
+{
+	struct FMockExperiments
+	{
+		FCriticalSection Mutex;
+		TArray<double> Times;
+	};
+	using FMockExperimentsRef = TSharedRef<FMockExperiments, ESPMode::ThreadSafe>;
+
+	void SetMockExperimentRoutes(FNakamaMockServer& Server, const FMockExperimentsRef& Mock)
+	{
+		Server.SetRoute(TEXT("GET"), TEXT("/v1/experiment"), [Mock](const FNakamaMockRequest& Request)
+		{
+			FScopeLock Lock(&Mock->Mutex);
+			Mock->Times.Add(FPlatformTime::Seconds());
+			return FNakamaMockResponse(200, TEXT("{\"experiments\":[{\"name\":\"store_layout\",\"value\":\"B\"}]}"));
+		});
+	}
+}
+
+// Auto refresh fetches once per interval, not every other interval, and stops when asked.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(SatoriExperimentCacheAutoRefresh, FSatoriTestBase, "Satori.Base.ExperimentCache.AutoRefresh", NAKAMA_MODULE_TEST_MASK)
+inline bool SatoriExperimentCacheAutoRefresh::RunTest(const FString& Parameters)
+{
+	InitiateSatoriTest();
+
+	FMockExperimentsRef Mock = MakeShared<FMockExperiments, ESPMode::ThreadSafe>();
+	TSharedRef<FNakamaMockServer, ESPMode::ThreadSafe> Server = FNakamaMockServer::Create();
+	Server->Settings.MinLatencySeconds = 0.05f;
+	Server->Settings.MaxLatencySeconds = 0.05f;
+	SetMockExperimentRoutes(*Server, Mock);
+	Server->Start();
+
+	TSharedRef<TStrongObjectPtr<USatoriSession>> Session = MakeShared<TStrongObjectPtr<USatoriSession>>(CreateSession(FGuid::NewGuid().ToString()));
+	TSharedRef<TStrongObjectPtr<USatoriExperimentCache>> Cache = MakeShared<TStrongObjectPtr<USatoriExperimentCache>>(USatoriExperimentCache::CreateExperimentCache(SatoriClient));
+	(*Cache)->StartAutoRefresh(Session->Get(), 1.0f);
+
+	// One refresh at start, then one per tick at 1s, 2s and 3s.
+	FNakamaHttpPipeline::Delay(3.5f, [this, Server, Mock, Session, Cache]()
+	{
+		(*Cache)->StopAutoRefresh();
+
+		TestTrue("One refresh per interval", Mock->Times.Num() >= 3);
+		for (int32 Index = 1; Index < Mock->Times.Num(); ++Index)
+		{
+			const double Period = Mock->Times[Index] - Mock->Times[Index - 1];
+			TestTrue(FString::Printf(TEXT("Period %d is one interval (%.2fs)"), Index, Period), Period > 0.5 && Period < 1.5);
+		}
+		TestEqual("Assignment cached", (*Cache)->GetExperimentValue(TEXT("store_layout"), TEXT("A")), FString(TEXT("B")));
+
+		const int32 NumRefreshes = Mock->Times.Num();
+		FNakamaHttpPipeline::Delay(1.5f, [this, Server, Mock, Session, Cache, NumRefreshes]()
+		{
+			TestEqual("Stopped", Mock->Times.Num(), NumRefreshes);
+			Server->Stop();
+			StopTest();
+		});
+	});
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForAsyncQueries(this));
+	return true;
+}
+
+// Loading another identity drops the assignments fetched for the previous one, even freshly refreshed ones.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(SatoriExperimentCacheSwitchIdentity, FSatoriTestBase, "Satori.Base.ExperimentCache.SwitchIdentity", NAKAMA_MODULE_TEST_MASK)
+inline bool SatoriExperimentCacheSwitchIdentity::RunTest(const FString& Parameters)
+{
+	InitiateSatoriTest();
+
+	FMockExperimentsRef Mock = MakeShared<FMockExperiments, ESPMode::ThreadSafe>();
+	TSharedRef<FNakamaMockServer, ESPMode::ThreadSafe> Server = FNakamaMockServer::Create();
+	SetMockExperimentRoutes(*Server, Mock);
+	Server->Start();
+
+	const FString IdentityA = FGuid::NewGuid().ToString();
+	const FString IdentityB = TEXT("b/") + FGuid::NewGuid().ToString();
+	TSharedRef<TStrongObjectPtr<USatoriSession>> Session = MakeShared<TStrongObjectPtr<USatoriSession>>(CreateSession(IdentityA));
+	TSharedRef<TStrongObjectPtr<USatoriExperimentCache>> Cache = MakeShared<TStrongObjectPtr<USatoriExperimentCache>>(USatoriExperimentCache::CreateExperimentCache(SatoriClient));
+	(*Cache)->bAutoSave = false;
+	(*Cache)->Load(IdentityA);
+
+	(*Cache)->Refresh(Session->Get(), [this, Server, Session, Cache, IdentityB](bool bChanged)
+	{
+		TestEqual("A's assignment", (*Cache)->GetExperimentValue(TEXT("store_layout"), TEXT("A")), FString(TEXT("B")));
+
+		TestFalse("Nothing saved for B", (*Cache)->Load(IdentityB));
+		TestEqual("B has no assignments", (*Cache)->GetExperiments().Num(), 0);
+		TestFalse("B is not fresh", (*Cache)->IsFresh(60.0f));
+		Server->Stop();
+		StopTest();
+	}, [this, Server](const FSatoriError& Error)
+	{
+		TestFalse(FString::Printf(TEXT("Refresh failed: %s"), *Error.Message), true);
+		Server->Stop();
+		StopTest();
+	});
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForAsyncQueries(this));
+	return true;
+}
@@ -0,0 +1,198 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SatoriTestBase.h"
+#include "NakamaMockServer.h"
+#include "NakamaUtils.h"
+#include "SatoriMessageInbox.h"
+#include "UObject/StrongObjectPtr.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+
+namespace
+{
+	struct FMockMessages
+	{
+		FCriticalSection Mutex;
+		int32 NumMessages = 0;
+		TArray<FString> ListCursors;
+		TArray<FString> UpdateBodies;
+	};
+	using FMockMessagesRef = TSharedRef<FMockMessages, ESPMode::ThreadSafe>;
+
+	// Messages m1, m2, ... listed newest first, with the next cursor as the offset from the newest.
+	void SetMockMessageRoutes(FNakamaMockServer& Server, const FMockMessagesRef& Mock)
+	{
+		Server.SetRoute(TEXT("GET"), TEXT("/v1/message"), [Mock](const FNakamaMockRequest& Request)
+		{
+			FScopeLock Lock(&Mock->Mutex);
+			const FString Cursor = Request.GetQueryParam(TEXT("cursor"));
+			Mock->ListCursors.Add(Cursor);
+
+			const int32 Offset = FCString::Atoi(*Cursor);
+			const int32 Limit = FCString::Atoi(*Request.GetQueryParam(TEXT("limit")));
+			const int32 End = FMath::Min(Offset + Limit, Mock->NumMessages);
+
+			TArray<TSharedPtr<FJsonValue>> Messages;
+			for (int32 Index = Mock->NumMessages - Offset; Index > Mock->NumMessages - End; --Index)
+			{
+				const TSharedRef<FJsonObject> Message = MakeShared<FJsonObject>();
+				Message->SetStringField(TEXT("id"), FString::Printf(TEXT("m%d"), Index));
+				Message->SetStringField(TEXT("title"), TEXT("reward"));
+				Message->SetNumberField(TEXT("create_time"), 1760000000 + Index);
+				Message->SetNumberField(TEXT("update_time"), 1760000000 + Index);
+				Messages.Add(MakeShared<FJsonValueObject>(Message));
+			}
+
+			const TSharedRef<FJsonObject> Body = MakeShared<FJsonObject>();
+			Body->SetArrayField(TEXT("messages"), Messages);
+			if (End < Mock->NumMessages)
+			{
+				Body->SetStringField(TEXT("next_cursor"), FString::FromInt(End));
+			}
+			return FNakamaMockResponse(200, FNakamaUtils::EncodeJson(Body));
+		});
+
+		Server.SetRoute(TEXT("PUT"), TEXT("/v1/message/*"), [Mock](const FNakamaMockRequest& Request)
+		{
+			FScopeLock Lock(&Mock->Mutex);
+			Mock->UpdateBodies.Add(Request.Body);
+			return FNakamaMockResponse(200, TEXT("{}"));
+		});
+	}
+}
+
+// A fresh sync takes one page, state changes are optimistic with rollback, and a reloaded inbox resumes from the saved cursor.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(SatoriMessageInboxSync, FSatoriTestBase, "Satori.Base.MessageInbox.Sync", NAKAMA_MODULE_TEST_MASK)
+inline bool SatoriMessageInboxSync::RunTest(const FString& Parameters)
+{
+	InitiateSatoriTest();
+
+	FMockMessagesRef Mock = MakeShared<FMockMessages, ESPMode::ThreadSafe>();
+	Mock->NumMessages = 5;
+
+	TSharedRef<FNakamaMockServer, ESPMode::ThreadSafe> Server = FNakamaMockServer::Create();
+	SetMockMessageRoutes(*Server, Mock);
+	Server->Start();
+
+	const FString IdentityId = FGuid::NewGuid().ToString();
+	TSharedRef<TStrongObjectPtr<USatoriSession>> SessionPtr = MakeShared<TStrongObjectPtr<USatoriSession>>(CreateSession(IdentityId));
+	USatoriSession* Session = SessionPtr->Get();
+
+	TSharedRef<TStrongObjectPtr<USatoriMessageInbox>> Inbox = MakeShared<TStrongObjectPtr<USatoriMessageInbox>>(USatoriMessageInbox::CreateMessageInbox(SatoriClient));
+	(*Inbox)->PageSize = 2;
+	TestFalse("Nothing saved yet", (*Inbox)->Load(IdentityId));
+
+	auto Fail = [this, Server](const FString& What, const FSatoriError& Error)
+	{
+		TestFalse(FString::Printf(TEXT("%s failed: %s"), *What, *Error.Message), true);
+		Server->Stop();
+		StopTest();
+	};
+
+	auto Finish = [this, Server, IdentityId]()
+	{
+		IFileManager::Get().Delete(*FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Satori"), FString::Printf(TEXT("Inbox_%s.json"), *IdentityId)));
+		Server->Stop();
+		StopTest();
+	};
+
+	(*Inbox)->Sync(Session, [this, Server, Inbox, Mock, SessionPtr, Session, IdentityId, Fail, Finish](int32 NumChanged)
+	{
+		TestEqual("First page only", NumChanged, 2);
+		TestEqual("Newest first", (*Inbox)->GetMessages()[0].ID, FString(TEXT("m5")));
+		TestTrue("Older messages", (*Inbox)->HasOlderMessages());
+
+		(*Inbox)->MarkRead(Session, TEXT("m5"), [this, Server, Inbox, Mock, SessionPtr, Session, IdentityId, Fail, Finish]()
+		{
+			TestEqual("One update", Mock->UpdateBodies.Num(), 1);
+			TestFalse("Read time sent", Mock->UpdateBodies[0].Contains(TEXT("\"read_time\":0")));
+
+			Server->SetCannedResponse(TEXT("PUT"), TEXT("/v1/message/m4"), 400, TEXT("{\"code\":3,\"message\":\"invalid\"}"));
+			(*Inbox)->MarkConsumed(Session, TEXT("m4"), [Fail]()
+			{
+				Fail(TEXT("Rejected consume"), FSatoriError());
+			}, [this, Inbox, Mock, SessionPtr, Session, IdentityId, Fail, Finish](const FSatoriError& Error)
+			{
+				FSatoriMessage Message;
+				TestTrue("Still held", (*Inbox)->FindMessage(TEXT("m4"), Message));
+				TestEqual("Consume rolled back", Message.ConsumeTime, static_cast<int64>(0));
+				TestEqual("Read rolled back", Message.ReadTime, static_cast<int64>(0));
+
+				// A new inbox for the same identity starts from the saved state and cursor.
+				TSharedRef<TStrongObjectPtr<USatoriMessageInbox>> Reloaded = MakeShared<TStrongObjectPtr<USatoriMessageInbox>>(USatoriMessageInbox::CreateMessageInbox(SatoriClient));
+				(*Reloaded)->PageSize = 2;
+				TestTrue("Saved", (*Reloaded)->Load(IdentityId));
+				TestEqual("Reloaded messages", (*Reloaded)->GetMessages().Num(), 2);
+				TestEqual("Reloaded unread", (*Reloaded)->GetUnreadCount(), 1);
+				TestTrue("Reloaded cursor", (*Reloaded)->HasOlderMessages());
+
+				(*Reloaded)->LoadOlder(Session, [this, Reloaded, Mock, SessionPtr, Finish](int32 NumAdded)
+				{
+					TestEqual("Older page", NumAdded, 2);
+					TestEqual("Resumed from the saved cursor", Mock->ListCursors.Last(), FString(TEXT("2")));
+					TestEqual("Oldest held", (*Reloaded)->GetMessages().Last().ID, FString(TEXT("m2")));
+					Finish();
+				}, [Fail](const FSatoriError& Error) { Fail(TEXT("LoadOlder"), Error); });
+			});
+
+			FSatoriMessage Message;
+			TestTrue("Consumed before the answer", (*Inbox)->FindMessage(TEXT("m4"), Message) && Message.ConsumeTime != 0);
+		}, [Fail](const FSatoriError& Error) { Fail(TEXT("MarkRead"), Error); });
+
+		FSatoriMessage Message;
+		TestTrue("Read before the answer", (*Inbox)->FindMessage(TEXT("m5"), Message) && Message.ReadTime != 0);
+		TestEqual("Unread", (*Inbox)->GetUnreadCount(), 1);
+	}, [Fail](const FSatoriError& Error) { Fail(TEXT("Sync"), Error); });
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForAsyncQueries(this));
+	return true;
+}
+
+// Loading another identity starts from an empty inbox instead of merging into the previous one.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(SatoriMessageInboxSwitchIdentity, FSatoriTestBase, "Satori.Base.MessageInbox.SwitchIdentity", NAKAMA_MODULE_TEST_MASK)
+inline bool SatoriMessageInboxSwitchIdentity::RunTest(const FString& Parameters)
+{
+	// Identities end up in file names, so include characters a path cannot hold.
+	const FString IdentityA = TEXT("a/") + FGuid::NewGuid().ToString();
+	const FString IdentityB = TEXT("b:") + FGuid::NewGuid().ToString();
+	auto SaveFile = [](const FString& IdentityId)
+	{
+		return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Satori"), FString::Printf(TEXT("Inbox_%s.json"), *FPaths::MakeValidFileName(IdentityId)));
+	};
+
+	FFileHelper::SaveStringToFile(TEXT("{\"messages\":[{\"id\":\"m1\",\"title\":\"reward\",\"create_time\":1760000001,\"update_time\":1760000001}],\"older_cursor\":\"5\"}"), *SaveFile(IdentityA));
+
+	TStrongObjectPtr<USatoriMessageInbox> Inbox(USatoriMessageInbox::CreateMessageInbox(nullptr));
+	TestTrue("Loaded A", Inbox->Load(IdentityA));
+	TestEqual("A's messages", Inbox->GetMessages().Num(), 1);
+	TestTrue("A's cursor", Inbox->HasOlderMessages());
+
+	TestFalse("Nothing saved for B", Inbox->Load(IdentityB));
+	TestEqual("B starts empty", Inbox->GetMessages().Num(), 0);
+	TestFalse("B has no cursor", Inbox->HasOlderMessages());
+
+	TestTrue("Saved B", Inbox->Save());
+	FString SavedB;
+	TestTrue("B's file is in the saved directory", FFileHelper::LoadFileToString(SavedB, *SaveFile(IdentityB)));
+	TestFalse("B's file holds none of A's messages", SavedB.Contains(TEXT("m1")));
+
+	IFileManager::Get().Delete(*SaveFile(IdentityA));
+	IFileManager::Get().Delete(*SaveFile(IdentityB));
+	return true;
+}
@@ -0,0 +1,151 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SatoriTestBase.h"
+#include "NakamaHttpPipeline.h"
+#include "NakamaMockServer.h"
+#include "NakamaUtils.h"
+#include "SatoriPropertyUpdater.h"
+#include "UObject/StrongObjectPtr.h"
+#include "Containers/Ticker.h"
+#include "Dom/JsonObject.h"
+
+namespace
+{
+	struct FMockProperties
+	{
+		FCriticalSection Mutex;
+		TArray<FString> Bodies;
+		TArray<double> Times;
+	};
+	using FMockPropertiesRef = TSharedRef<FMockProperties, ESPMode::ThreadSafe>;
+
+	void SetMockPropertyRoutes(FNakamaMockServer& Server, const FMockPropertiesRef& Mock)
+	{
+		Server.SetRoute(TEXT("PUT"), TEXT("/v1/properties"), [Mock](const FNakamaMockRequest& Request)
+		{
+			FScopeLock Lock(&Mock->Mutex);
+			Mock->Bodies.Add(Request.Body);
+			Mock->Times.Add(FPlatformTime::Seconds());
+			return FNakamaMockResponse(200, TEXT("{}"));
+		});
+	}
+
+	FString GetSentProperty(const FString& Body, const FString& Group, const FString& Key)
+	{
+		FString Value;
+		const TSharedPtr<FJsonObject> JsonObject = FNakamaUtils::DeserializeJsonObject(Body);
+		const TSharedPtr<FJsonObject>* GroupObject = nullptr;
+		if (JsonObject.IsValid() && JsonObject->TryGetObjectField(Group, GroupObject))
+		{
+			(*GroupObject)->TryGetStringField(Key, Value);
+		}
+		return Value;
+	}
+}
+
+// Changes within the debounce window go out in one request, last write wins and acknowledged values are skipped.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(SatoriPropertyUpdaterCoalesce, FSatoriTestBase, "Satori.Base.PropertyUpdater.Coalesce", NAKAMA_MODULE_TEST_MASK)
+inline bool SatoriPropertyUpdaterCoalesce::RunTest(const FString& Parameters)
+{
+	InitiateSatoriTest();
+
+	FMockPropertiesRef Mock = MakeShared<FMockProperties, ESPMode::ThreadSafe>();
+	TSharedRef<FNakamaMockServer, ESPMode::ThreadSafe> Server = FNakamaMockServer::Create();
+	SetMockPropertyRoutes(*Server, Mock);
+	Server->Start();
+
+	TSharedRef<TStrongObjectPtr<USatoriSession>> Session = MakeShared<TStrongObjectPtr<USatoriSession>>(CreateSession(FGuid::NewGuid().ToString()));
+	TSharedRef<TStrongObjectPtr<USatoriPropertyUpdater>> Updater = MakeShared<TStrongObjectPtr<USatoriPropertyUpdater>>(USatoriPropertyUpdater::CreatePropertyUpdater(SatoriClient, Session->Get()));
+	(*Updater)->DebounceSeconds = 0.2f;
+
+	FSatoriProperties Acked;
+	Acked.DefaultProperties.Add(TEXT("level"), TEXT("3"));
+	(*Updater)->SetAcknowledgedProperties(Acked);
+
+	(*Updater)->SetDefaultProperty(TEXT("level"), TEXT("3"));
+	(*Updater)->SetDefaultProperty(TEXT("name"), TEXT("a"));
+	(*Updater)->SetDefaultProperty(TEXT("name"), TEXT("b"));
+	(*Updater)->SetCustomProperty(TEXT("color"), TEXT("red"));
+	TestTrue("Pending", (*Updater)->HasPendingChanges());
+
+	FNakamaHttpPipeline::Delay(1.0f, [this, Server, Mock, Session, Updater]()
+	{
+		TestEqual("One request", Mock->Bodies.Num(), 1);
+		if (Mock->Bodies.Num() == 1)
+		{
+			TestEqual("Last write wins", GetSentProperty(Mock->Bodies[0], TEXT("default"), TEXT("name")), FString(TEXT("b")));
+			TestEqual("Custom sent", GetSentProperty(Mock->Bodies[0], TEXT("custom"), TEXT("color")), FString(TEXT("red")));
+			TestTrue("Acknowledged value skipped", GetSentProperty(Mock->Bodies[0], TEXT("default"), TEXT("level")).IsEmpty());
+		}
+		TestFalse("Nothing pending", (*Updater)->HasPendingChanges());
+
+		// Now acknowledged, so setting it again sends nothing.
+		(*Updater)->SetDefaultProperty(TEXT("name"), TEXT("b"));
+		FNakamaHttpPipeline::Delay(0.5f, [this, Server, Mock, Session, Updater]()
+		{
+			TestEqual("No request for an unchanged value", Mock->Bodies.Num(), 1);
+			TestFalse("Still nothing pending", (*Updater)->HasPendingChanges());
+			Server->Stop();
+			StopTest();
+		});
+	});
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForAsyncQueries(this));
+	return true;
+}
+
+// A stream of changes faster than the debounce is still flushed every MaxWaitSeconds.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(SatoriPropertyUpdaterMaxWait, FSatoriTestBase, "Satori.Base.PropertyUpdater.MaxWait", NAKAMA_MODULE_TEST_MASK)
+inline bool SatoriPropertyUpdaterMaxWait::RunTest(const FString& Parameters)
+{
+	InitiateSatoriTest();
+
+	FMockPropertiesRef Mock = MakeShared<FMockProperties, ESPMode::ThreadSafe>();
+	TSharedRef<FNakamaMockServer, ESPMode::ThreadSafe> Server = FNakamaMockServer::Create();
+	SetMockPropertyRoutes(*Server, Mock);
+	Server->Start();
+
+	TSharedRef<TStrongObjectPtr<USatoriSession>> Session = MakeShared<TStrongObjectPtr<USatoriSession>>(CreateSession(FGuid::NewGuid().ToString()));
+	TSharedRef<TStrongObjectPtr<USatoriPropertyUpdater>> Updater = MakeShared<TStrongObjectPtr<USatoriPropertyUpdater>>(USatoriPropertyUpdater::CreatePropertyUpdater(SatoriClient, Session->Get()));
+	(*Updater)->DebounceSeconds = 0.4f;
+	(*Updater)->MaxWaitSeconds = 0.5f;
+
+	// One change every 0.1s for 1.5s: the debounce alone would hold all of them until the stream stops.
+	const double StartTime = FPlatformTime::Seconds();
+	TSharedRef<int32> NumChanges = MakeShared<int32>(0);
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([Updater, NumChanges](float) -> bool
+	{
+		(*Updater)->SetCustomProperty(TEXT("tick"), FString::FromInt(++(*NumChanges)));
+		return *NumChanges < 15;
+	}), 0.1f);
+
+	FNakamaHttpPipeline::Delay(2.5f, [this, Server, Mock, Session, Updater, StartTime]()
+	{
+		TestTrue("Flushed during the stream", Mock->Bodies.Num() >= 2);
+		if (Mock->Bodies.Num() > 0)
+		{
+			TestTrue("First flush within the cap", Mock->Times[0] - StartTime < 0.9);
+			TestEqual("Last change sent", GetSentProperty(Mock->Bodies.Last(), TEXT("custom"), TEXT("tick")), FString(TEXT("15")));
+		}
+		TestFalse("Nothing pending", (*Updater)->HasPendingChanges());
+		Server->Stop();
+		StopTest();
+	});
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForAsyncQueries(this));
+	return true;
+}
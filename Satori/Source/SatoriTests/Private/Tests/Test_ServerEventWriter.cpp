@@ -0,0 +1,202 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SatoriTestBase.h"
+#include "NakamaHttpPipeline.h"
+#include "NakamaMockServer.h"
+#include "NakamaUtils.h"
+#include "SatoriServerEventWriter.h"
+#include "Dom/JsonObject.h"
+
+namespace
+{
+	struct FMockServerEvents
+	{
+		FCriticalSection Mutex;
+		TArray<FString> Bodies;
+	};
+	using FMockServerEventsRef = TSharedRef<FMockServerEvents, ESPMode::ThreadSafe>;
+
+	void SetMockServerEventRoutes(FNakamaMockServer& Server, const FMockServerEventsRef& Mock)
+	{
+		Server.SetRoute(TEXT("POST"), TEXT("/v1/server-event"), [Mock](const FNakamaMockRequest& Request)
+		{
+			FScopeLock Lock(&Mock->Mutex);
+			Mock->Bodies.Add(Request.Body);
+			return FNakamaMockResponse(200, TEXT("{}"));
+		});
+	}
+
+	TArray<TSharedPtr<FJsonValue>> GetSentEvents(const FString& Body)
+	{
+		const TArray<TSharedPtr<FJsonValue>>* Events = nullptr;
+		const TSharedPtr<FJsonObject> JsonObject = FNakamaUtils::DeserializeJsonObject(Body);
+		if (JsonObject.IsValid() && JsonObject->TryGetArrayField(TEXT("events"), Events))
+		{
+			return *Events;
+		}
+		return {};
+	}
+
+	FSatoriEvent MakeEvent(int32 Index)
+	{
+		FSatoriEvent Event;
+		Event.Name = FString::Printf(TEXT("e%d"), Index);
+		Event.Timestamp = FDateTime(2026, 1, 1);
+		return Event;
+	}
+}
+
+// The hand-written serializer produces the same JSON the client would, escapes included.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(SatoriServerEventWriterSerialize, FSatoriTestBase, "Satori.Base.ServerEventWriter.Serialize", NAKAMA_MODULE_TEST_MASK)
+inline bool SatoriServerEventWriterSerialize::RunTest(const FString& Parameters)
+{
+	FSatoriEvent Event;
+	Event.Name = TEXT("quote\" slash\\ newline\n control\x01");
+	Event.ID = TEXT("id-1");
+	Event.Value = TEXT("caf\u00E9 \U0001F600");
+	Event.Metadata.Add(TEXT("map"), TEXT("forest"));
+	Event.Metadata.Add(TEXT("empty"), TEXT(""));
+	Event.IdentityId = TEXT("identity");
+	Event.SessionIssuedAt = 1760000000;
+	Event.Timestamp = FDateTime(2026, 1, 2, 3, 4, 5);
+
+	TArray<uint8> Buffer;
+	FSatoriServerEventWriter::AppendEventJson(Buffer, Event);
+	const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Buffer.GetData()), Buffer.Num());
+	const FString Json(Converted.Length(), Converted.Get());
+
+	const TSharedPtr<FJsonObject> JsonObject = FNakamaUtils::DeserializeJsonObject(Json);
+	if (!TestTrue("Valid JSON", JsonObject.IsValid()))
+	{
+		return true;
+	}
+
+	TestEqual("Name", JsonObject->GetStringField(TEXT("name")), Event.Name);
+	TestEqual("Id", JsonObject->GetStringField(TEXT("id")), Event.ID);
+	TestEqual("Value", JsonObject->GetStringField(TEXT("value")), Event.Value);
+	TestEqual("Timestamp", JsonObject->GetStringField(TEXT("timestamp")), Event.Timestamp.ToIso8601());
+	TestEqual("Identity", JsonObject->GetStringField(TEXT("identity_id")), Event.IdentityId);
+	TestEqual("Issued at", static_cast<int64>(JsonObject->GetNumberField(TEXT("session_issued_at"))), Event.SessionIssuedAt);
+	TestFalse("No session id", JsonObject->HasField(TEXT("session_id")));
+
+	const TSharedPtr<FJsonObject>* Metadata = nullptr;
+	if (TestTrue("Metadata", JsonObject->TryGetObjectField(TEXT("metadata"), Metadata)))
+	{
+		TestEqual("Metadata value", (*Metadata)->GetStringField(TEXT("map")), FString(TEXT("forest")));
+		TestFalse("Empty values skipped", (*Metadata)->HasField(TEXT("empty")));
+	}
+	return true;
+}
+
+// Events are cut into batches by count, the remainder goes out after the flush interval, in order.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(SatoriServerEventWriterBatching, FSatoriTestBase, "Satori.Base.ServerEventWriter.Batching", NAKAMA_MODULE_TEST_MASK)
+inline bool SatoriServerEventWriterBatching::RunTest(const FString& Parameters)
+{
+	InitiateSatoriTest();
+
+	FMockServerEventsRef Mock = MakeShared<FMockServerEvents, ESPMode::ThreadSafe>();
+	TSharedRef<FNakamaMockServer, ESPMode::ThreadSafe> Server = FNakamaMockServer::Create();
+	SetMockServerEventRoutes(*Server, Mock);
+	Server->Start();
+
+	FSatoriServerEventWriterSettings Settings;
+	Settings.MaxBatchEvents = 10;
+	Settings.FlushIntervalSeconds = 0.2f;
+	TSharedRef<FSatoriServerEventWriter, ESPMode::ThreadSafe> Writer = MakeShared<FSatoriServerEventWriter, ESPMode::ThreadSafe>(SatoriClient, Settings);
+
+	for (int32 Index = 0; Index < 25; ++Index)
+	{
+		TestTrue("Accepted", Writer->Enqueue(MakeEvent(Index)) == ESatoriEnqueueResult::Accepted);
+	}
+
+	FNakamaHttpPipeline::Delay(1.5f, [this, Server, Mock, Writer]()
+	{
+		const FSatoriServerEventWriterStats Stats = Writer->GetStats();
+		TestEqual("Batches", Stats.NumBatchesSent, static_cast<int64>(3));
+		TestEqual("Events", Stats.NumEventsSent, static_cast<int64>(25));
+		TestEqual("Nothing queued", Stats.NumQueued, 0);
+
+		TArray<FString> Names;
+		TArray<int32> BatchSizes;
+		for (const FString& Body : Mock->Bodies)
+		{
+			const TArray<TSharedPtr<FJsonValue>> Events = GetSentEvents(Body);
+			BatchSizes.Add(Events.Num());
+			for (const TSharedPtr<FJsonValue>& Event : Events)
+			{
+				Names.Add(Event->AsObject()->GetStringField(TEXT("name")));
+			}
+		}
+		TestTrue("Batch sizes", BatchSizes == TArray<int32>({ 10, 10, 5 }));
+		TestEqual("All events", Names.Num(), 25);
+		TestTrue("In order", Names.Num() == 25 && Names[0] == TEXT("e0") && Names[24] == TEXT("e24"));
+
+		Server->Stop();
+		StopTest();
+	});
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForAsyncQueries(this));
+	return true;
+}
+
+// With every batch slot taken the queue fills and Enqueue rejects; accepted events are all sent once slots free up.
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(SatoriServerEventWriterBackpressure, FSatoriTestBase, "Satori.Base.ServerEventWriter.Backpressure", NAKAMA_MODULE_TEST_MASK)
+inline bool SatoriServerEventWriterBackpressure::RunTest(const FString& Parameters)
+{
+	InitiateSatoriTest();
+
+	FMockServerEventsRef Mock = MakeShared<FMockServerEvents, ESPMode::ThreadSafe>();
+	TSharedRef<FNakamaMockServer, ESPMode::ThreadSafe> Server = FNakamaMockServer::Create();
+	Server->Settings.MinLatencySeconds = 0.2f;
+	Server->Settings.MaxLatencySeconds = 0.2f;
+	SetMockServerEventRoutes(*Server, Mock);
+	Server->Start();
+
+	FSatoriServerEventWriterSettings Settings;
+	Settings.MaxBatchEvents = 1;
+	Settings.MaxInFlightBatches = 1;
+	Settings.MaxQueuedEvents = 4;
+	TSharedRef<FSatoriServerEventWriter, ESPMode::ThreadSafe> Writer = MakeShared<FSatoriServerEventWriter, ESPMode::ThreadSafe>(SatoriClient, Settings);
+
+	// Responses complete on the game thread, so at most one batch leaves while this loop runs.
+	int32 NumAccepted = 0;
+	int32 NumRejected = 0;
+	for (int32 Index = 0; Index < 20; ++Index)
+	{
+		const ESatoriEnqueueResult Result = Writer->Enqueue(MakeEvent(Index));
+		NumAccepted += Result == ESatoriEnqueueResult::Accepted ? 1 : 0;
+		NumRejected += Result == ESatoriEnqueueResult::QueueFull ? 1 : 0;
+	}
+	TestTrue("Rejected once full", NumRejected >= 15);
+	TestEqual("Every event answered", NumAccepted + NumRejected, 20);
+	TestTrue("Under pressure", Writer->IsUnderPressure());
+
+	FNakamaHttpPipeline::Delay(2.5f, [this, Server, Mock, Writer, NumAccepted, NumRejected]()
+	{
+		const FSatoriServerEventWriterStats Stats = Writer->GetStats();
+		TestEqual("Accepted events sent", Stats.NumEventsSent, static_cast<int64>(NumAccepted));
+		TestEqual("Rejections counted", Stats.NumRejected, static_cast<int64>(NumRejected));
+		TestEqual("One event per batch", Mock->Bodies.Num(), NumAccepted);
+		TestFalse("Pressure relieved", Writer->IsUnderPressure());
+
+		Server->Stop();
+		StopTest();
+	});
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForAsyncQueries(this));
+	return true;
+}
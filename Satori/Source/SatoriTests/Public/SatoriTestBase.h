@@ -0,0 +1,64 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NakamaTestBase.h"
+#include "SatoriClient.h"
+#include "SatoriSession.h"
+#include "Misc/Base64.h"
+
+// The base class for the Satori tests. They run against FNakamaMockServer,
+// which answers the Satori client's requests like any other sent through the
+// shared HTTP pipeline.
+class FSatoriTestBase : public FNakamaTestBase
+{
+public:
+	FSatoriTestBase(const FString& InName, const bool bInComplexTask) : FNakamaTestBase(InName, bInComplexTask), SatoriClient(nullptr)
+	{
+	}
+
+	void InitiateSatoriTest()
+	{
+		InitiateTest();
+		SatoriClient = USatoriClient::CreateDefaultClient();
+	}
+
+	// A session for IdentityId with an unexpired token, so no authentication round trip is needed.
+	static USatoriSession* CreateSession(const FString& IdentityId)
+	{
+		const int64 Expires = FDateTime::UtcNow().ToUnixTimestamp() + 3600;
+		const FString Claims = FString::Printf(TEXT("{\"iid\":\"%s\",\"exp\":%lld}"), *IdentityId, Expires);
+		const FString Token = Base64UrlEncode(TEXT("{\"alg\":\"HS256\",\"typ\":\"JWT\"}"))
+			+ TEXT(".") + Base64UrlEncode(Claims)
+			+ TEXT(".") + Base64UrlEncode(TEXT("mock"));
+		return USatoriSession::RestoreSession(Token, Token);
+	}
+
+	UPROPERTY()
+	USatoriClient* SatoriClient;
+
+private:
+	static FString Base64UrlEncode(const FString& Text)
+	{
+		FString Encoded = FBase64::Encode(Text);
+		Encoded.ReplaceInline(TEXT("+"), TEXT("-"));
+		Encoded.ReplaceInline(TEXT("/"), TEXT("_"));
+		Encoded.ReplaceInline(TEXT("="), TEXT(""));
+		return Encoded;
+	}
+};
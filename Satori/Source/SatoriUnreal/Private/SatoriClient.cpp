@@ -17,6 +17,9 @@
 #include "SatoriClient.h"
 #include "SatoriUtils.h"
 #include "SatoriRetryInvoker.h"
+#include "NakamaMemory.h"
+#include "NakamaTrace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 #include "Containers/Ticker.h"
 #include "GenericPlatform/GenericPlatformHttp.h"
 #include "Interfaces/IHttpResponse.h"
@@ -61,24 +64,9 @@ void USatoriClient::CancelAllRequests()
 		return;
 	}
 
-	// Take ownership of the in-flight set under the lock, then release it before
-	// cancelling so a synchronous completion callback can re-enter the lock safely.
-	TArray<FHttpRequestPtr> ToCancel;
-	{
-		FScopeLock Lock(&ActiveRequestsMutex);
-		ToCancel = MoveTemp(ActiveRequests);
-		ActiveRequests.Empty();
-	}
-
-	// Cancel each request. We deliberately do NOT unbind the completion delegate:
-	// CancelRequest drives it with bSuccess=false, and since the request is no
-	// longer in ActiveRequests the completion handler resolves it as a transport
-	// failure, delivering a terminal OnError instead of silently dropping the
-	// caller's callback.
-	for (const FHttpRequestPtr& Request : ToCancel)
-	{
-		Request->CancelRequest();
-	}
+	// Queued and in-flight requests of this client resolve as Cancelled,
+	// delivering a terminal OnError instead of silently dropping callbacks.
+	HttpRequests->CancelAll();
 }
 
 void USatoriClient::Destroy()
@@ -205,7 +193,7 @@ void USatoriClient::Authenticate(
 		{
 			if (SuccessCallback)
 			{
-				SuccessCallback(USatoriSession::SetupSession(ResponseBody));
+				FNakamaHttpMetrics::InvokeCallback(SuccessCallback, USatoriSession::SetupSession(ResponseBody));
 			}
 		},
 		ErrorCallback,
@@ -275,14 +263,18 @@ void USatoriClient::EnsureValidSession(
 	Pending->OnError.Add(OnError);
 	InFlightRefreshes.Add(Key, Pending);
 
+	// Spans the wait every coalesced request spends behind this refresh.
+	const FNakamaTraceRegionPtr Region = NAKAMA_TRACE_REGION_BEGIN(NakamaHttpChannel, TEXT("Satori::Session::Refresh"));
+
 	TWeakObjectPtr<USatoriClient> WeakThis(this);
 
 	// Refresh first, then run all deferred requests with the refreshed token.
 	// Callbacks are driven from the captured Pending (not a map lookup) so they
 	// always fire exactly once, even if the client is torn down mid-refresh.
 	AuthenticateRefresh(Session,
-		[WeakThis, Key, Pending](USatoriSession* Refreshed)
+		[WeakThis, Key, Pending, Region](USatoriSession* Refreshed)
 		{
+			NAKAMA_TRACE_REGION_END(Region);
 			if (USatoriClient* Self = WeakThis.Get())
 			{
 				Self->InFlightRefreshes.Remove(Key);
@@ -308,8 +300,9 @@ void USatoriClient::EnsureValidSession(
 				}
 			}
 		},
-		[WeakThis, Key, Pending](const FSatoriError& Error)
+		[WeakThis, Key, Pending, Region](const FSatoriError& Error)
 		{
+			NAKAMA_TRACE_REGION_END(Region);
 			if (USatoriClient* Self = WeakThis.Get())
 			{
 				Self->InFlightRefreshes.Remove(Key);
@@ -356,7 +349,7 @@ void USatoriClient::AuthenticateRefresh(
 		{
 			if (SuccessCallback)
 			{
-				SuccessCallback(USatoriSession::SetupSession(ResponseBody));
+				FNakamaHttpMetrics::InvokeCallback(SuccessCallback, USatoriSession::SetupSession(ResponseBody));
 			}
 		},
 		ErrorCallback,
@@ -518,7 +511,7 @@ void USatoriClient::Identify(
 		{
 			if (SuccessCallback)
 			{
-				SuccessCallback(USatoriSession::SetupSession(ResponseBody));
+				FNakamaHttpMetrics::InvokeCallback(SuccessCallback, USatoriSession::SetupSession(ResponseBody));
 			}
 		},
 		ErrorCallback);
@@ -580,7 +573,7 @@ void USatoriClient::ListIdentityProperties(
 			if (SuccessCallback)
 			{
 				const FSatoriProperties Properties = FSatoriProperties(ResponseBody);
-						SuccessCallback(Properties);
+						FNakamaHttpMetrics::InvokeCallback(SuccessCallback, Properties);
 			}
 		},
 		ErrorCallback);
@@ -847,6 +840,38 @@ void USatoriClient::PostServerEvent(
 		});
 }
 
+void USatoriClient::PostServerEventPayload(
+	const TSharedRef<const TArray<uint8>, ESPMode::ThreadSafe>& Utf8Body,
+	const TFunction<void()>& SuccessCallback,
+	const TFunction<void(const FSatoriError& Error)>& ErrorCallback)
+{
+	TWeakObjectPtr<USatoriClient> WeakThis(this);
+
+	// Setup the endpoint
+	const FString Endpoint = TEXT("/v1/server-event");
+
+	// The body is set as raw bytes on each attempt, so no string content is passed.
+	SendJsonRequest(Endpoint, FString(), ESatoriRequestMethod::POST, TMultiMap<FString, FString>(), "",
+		[SuccessCallback](const FString& ResponseBody)
+		{
+			if (SuccessCallback)
+			{
+				SuccessCallback();
+			}
+		},
+		ErrorCallback,
+		[WeakThis, Utf8Body](TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Req)
+		{
+			USatoriClient* Self = WeakThis.Get();
+			if (!Self)
+			{
+				return;
+			}
+			FSatoriUtils::SetBasicAuthorizationHeader(Req, Self->ServerKey);
+			Req->SetContent(TArray<uint8>(*Utf8Body));
+		});
+}
+
 void USatoriClient::PostEvent(
 	USatoriSession* Session,
 	const TArray<FSatoriEvent>& Events,
@@ -1007,7 +1032,7 @@ void USatoriClient::GetExperiments(
 			if (SuccessCallback)
 			{
 				const FSatoriExperimentList Experiments = FSatoriExperimentList(ResponseBody);
-						SuccessCallback(Experiments);
+						FNakamaHttpMetrics::InvokeCallback(SuccessCallback, Experiments);
 			}
 		},
 		ErrorCallback);
@@ -1078,7 +1103,7 @@ void USatoriClient::GetFlags(
 			if (SuccessCallback)
 			{
 				const FSatoriFlagList Flags = FSatoriFlagList(ResponseBody);
-						SuccessCallback(Flags);
+						FNakamaHttpMetrics::InvokeCallback(SuccessCallback, Flags);
 			}
 		},
 		ErrorCallback);
@@ -1149,7 +1174,7 @@ void USatoriClient::GetFlagOverrides(
 			if (SuccessCallback)
 			{
 				const FSatoriFlagOverrideList FlagOverrides = FSatoriFlagOverrideList(ResponseBody);
-						SuccessCallback(FlagOverrides);
+						FNakamaHttpMetrics::InvokeCallback(SuccessCallback, FlagOverrides);
 			}
 		},
 		ErrorCallback);
@@ -1220,7 +1245,7 @@ void USatoriClient::GetLiveEvents(
 			if (SuccessCallback)
 			{
 				const FSatoriLiveEventList LiveEvents = FSatoriLiveEventList(ResponseBody);
-						SuccessCallback(LiveEvents);
+						FNakamaHttpMetrics::InvokeCallback(SuccessCallback, LiveEvents);
 			}
 		},
 		ErrorCallback);
@@ -1294,7 +1319,7 @@ void USatoriClient::GetMessages(
 			if (SuccessCallback)
 			{
 				const FSatoriMessageList Messages = FSatoriMessageList(ResponseBody);
-						SuccessCallback(Messages);
+						FNakamaHttpMetrics::InvokeCallback(SuccessCallback, Messages);
 			}
 		},
 		ErrorCallback);
@@ -1495,10 +1520,20 @@ void USatoriClient::SendJsonRequest(
 	const TFunction<void(const FSatoriError& Error)>& OnError,
 	const TFunction<void(TSharedRef<IHttpRequest, ESPMode::ThreadSafe>&)>& PrepareRequest)
 {
+	NAKAMA_MEMORY_SCOPE(Satori, SatoriRequests);
+
+	// Per-request metrics record, shared by all attempts (null while metrics are disabled).
+	const TSharedPtr<FNakamaHttpRequestTrace, ESPMode::ThreadSafe> Trace =
+		FNakamaHttpMetrics::Get().BeginRequest(TEXT("Satori"), FSatoriUtils::ESatoriRequesMethodToFString(Method), Endpoint);
+
+	// Spans the whole request in Insights: attempts, retry delays, parse and callback.
+	const FNakamaTraceRegionPtr Region = NAKAMA_TRACE_REGION_BEGIN(NakamaHttpChannel,
+		FString::Printf(TEXT("Satori %s %s"), *FSatoriUtils::ESatoriRequesMethodToFString(Method), *FNakamaHttpMetrics::NormalizeEndpoint(Endpoint)));
+
 	// One attempt: build a FRESH request (UE requests are single-use), bind, fire.
 	TWeakObjectPtr<USatoriClient> WeakThis(this);
 	FSatoriSendFn Send =
-		[WeakThis, Endpoint, Content, Method, QueryParams, SessionToken, PrepareRequest]
+		[WeakThis, Endpoint, Content, Method, QueryParams, SessionToken, PrepareRequest, Trace]
 		(TFunction<void(ESatoriRequestOutcome, int32, const FString&)> OnComplete)
 	{
 		USatoriClient* Self = WeakThis.Get();
@@ -1509,6 +1544,8 @@ void USatoriClient::SendJsonRequest(
 			return;
 		}
 
+		NAKAMA_MEMORY_SCOPE(Satori, SatoriRequests);
+
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest =
 			Self->MakeRequest(Endpoint, Content, Method, QueryParams, SessionToken);
 		if (PrepareRequest)
@@ -1516,81 +1553,87 @@ void USatoriClient::SendJsonRequest(
 			PrepareRequest(HttpRequest);
 		}
 
-		{
-			FScopeLock Lock(&Self->ActiveRequestsMutex);
-			Self->ActiveRequests.Add(HttpRequest);
-		}
-
-		HttpRequest->OnProcessRequestComplete().BindLambda(
-			[WeakThis, OnComplete](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
-		{
-			// Always deliver exactly one terminal outcome to OnComplete so the retry
-			// chain (and the caller's success/error callback) can never be silently
-			// dropped. A response is only forwarded when the request was still active.
-			// A cancelled request (removed from ActiveRequests) or a dead client are
-			// expected outcomes, reported as ESatoriRequestOutcome::Cancelled so OnError
-			// does not log them as faults; a genuine transport failure is ConnectionFailure.
-			bool bDeliverResponse = bSuccess && Response.IsValid();
-			bool bCancelled = false;
-			if (USatoriClient* Self = WeakThis.Get())
-			{
-				if (Self->IsValidLowLevel())
-				{
-					FScopeLock Lock(&Self->ActiveRequestsMutex);
-					if (Self->ActiveRequests.Contains(Request))
-					{
-						Self->ActiveRequests.Remove(Request);
-					}
-					else
-					{
-						bDeliverResponse = false; // cancelled or already reaped
-						bCancelled = true;
-					}
-				}
-				else
-				{
-					bDeliverResponse = false;
-					bCancelled = true; // client mid-destruction
-				}
-			}
-			else
+		// Scheduling, cancellation and the terminal outcome are owned by the
+		// shared transport; OnComplete is always called exactly once.
+		// Body parsing happens in the completion, so it is attributed to responses.
+		Self->HttpRequests->Process(HttpRequest,
+			[OnComplete](ESatoriRequestOutcome Outcome, int32 HttpCode, const FString& Body)
 			{
-				bDeliverResponse = false;
-				bCancelled = true; // client gone
-			}
-
-			if (bDeliverResponse)
-			{
-				OnComplete(ESatoriRequestOutcome::Response, Response->GetResponseCode(), Response->GetContentAsString());
-			}
-			else
-			{
-				OnComplete(bCancelled ? ESatoriRequestOutcome::Cancelled : ESatoriRequestOutcome::ConnectionFailure, 0, FString());
-			}
-		});
-
-		HttpRequest->ProcessRequest();
+				NAKAMA_MEMORY_SCOPE(Satori, SatoriResponses);
+				OnComplete(Outcome, HttpCode, Body);
+			},
+			Trace);
 	};
 
-	// FTSTicker-based delay: schedule Work after Seconds, once. Work is run
-	// unconditionally (even if the client has since been destroyed) so the
-	// retry attempt always executes and self-terminates through the null-client
-	// path in Send, guaranteeing the caller's OnError fires instead of hanging.
-	FSatoriDelayFn Delay = [](float Seconds, TFunction<void()> Work)
+	// Shared one-shot ticker delay. Work runs even if the client has since been
+	// destroyed, so the retry attempt self-terminates through the null-client
+	// path in Send and the caller's OnError fires instead of hanging.
+	FSatoriDelayFn Delay = [Endpoint](float Seconds, TFunction<void()> Work)
 	{
-		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
-			[Work](float /*DeltaTime*/) -> bool
-			{
-				Work();
-				return false; // one-shot: unregister after firing
-			}), Seconds);
+		const FNakamaTraceRegionPtr DelayRegion = NAKAMA_TRACE_REGION_BEGIN(NakamaHttpChannel,
+			FString::Printf(TEXT("Satori::Http::RetryDelay %s"), *FNakamaHttpMetrics::NormalizeEndpoint(Endpoint)));
+		FNakamaHttpPipeline::Delay(Seconds, [DelayRegion, Work = MoveTemp(Work)]()
+		{
+			NAKAMA_TRACE_REGION_END(DelayRegion);
+			Work();
+		});
 	};
 
 	// Seed the RNG from the auth token (or endpoint+content for auth calls).
-	const int32 Seed = SessionToken.IsEmpty()
-		? static_cast<int32>(GetTypeHash(Endpoint + Content))
-		: static_cast<int32>(GetTypeHash(SessionToken));
+	// Requests whose body is set per attempt (server event batches) have no
+	// content to hash, so they get a random seed; otherwise every batch would
+	// back off in lockstep.
+	const int32 Seed = !SessionToken.IsEmpty()
+		? static_cast<int32>(GetTypeHash(SessionToken))
+		: Content.IsEmpty()
+			? FMath::Rand()
+			: static_cast<int32>(GetTypeHash(Endpoint + Content));
+
+	if (!Trace.IsValid() && !Region.IsValid())
+	{
+		FSatoriRetryInvoker::InvokeWithRetry(
+			Send, BuildRetryConfiguration(), Seed, Delay, OnSuccess, OnError);
+		return;
+	}
+
+	// Time the completion handler, split at FNakamaHttpMetrics::InvokeCallback
+	// into body parsing and the caller's callback, then close the request
+	// record and trace region once it returns.
+	auto TracedSuccess = [Trace, Region, OnSuccess](const FString& Body)
+	{
+		const double HandlerStart = FPlatformTime::Seconds();
+		const double OuterCallbackStart = FNakamaHttpMetrics::ExchangeCallbackStart(0.0);
+		if (OnSuccess)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR("Satori::Http::Callback", NakamaHttpChannel);
+			OnSuccess(Body);
+		}
+		const double HandlerEnd = FPlatformTime::Seconds();
+		// Handlers that parse nothing never mark the split; all their time is callback time.
+		const double CallbackStart = FNakamaHttpMetrics::ExchangeCallbackStart(OuterCallbackStart);
+		const double ParseEnd = CallbackStart > 0.0 ? CallbackStart : HandlerStart;
+		if (Trace.IsValid())
+		{
+			FNakamaHttpMetrics::Get().RecordRequest(*Trace, true, false, ParseEnd - HandlerStart, HandlerEnd - ParseEnd);
+		}
+		NAKAMA_TRACE_REGION_END(Region);
+	};
+	auto TracedError = [Trace, Region, OnError](const FSatoriError& Error)
+	{
+		const double HandlerStart = FPlatformTime::Seconds();
+		if (OnError)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR("Satori::Http::Callback", NakamaHttpChannel);
+			OnError(Error);
+		}
+		if (Trace.IsValid())
+		{
+			// The error body was parsed by the retry invoker, so all of this is callback time.
+			FNakamaHttpMetrics::Get().RecordRequest(*Trace, false, Error.Code == ESatoriErrorCode::Cancelled, 0.0, FPlatformTime::Seconds() - HandlerStart);
+		}
+		NAKAMA_TRACE_REGION_END(Region);
+	};
 
 	FSatoriRetryInvoker::InvokeWithRetry(
-		Send, BuildRetryConfiguration(), Seed, Delay, OnSuccess, OnError);
+		Send, BuildRetryConfiguration(), Seed, Delay, TracedSuccess, TracedError);
 }
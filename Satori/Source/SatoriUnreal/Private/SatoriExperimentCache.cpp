@@ -0,0 +1,324 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SatoriExperimentCache.h"
+#include "SatoriClient.h"
+#include "SatoriSession.h"
+#include "SatoriUtils.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+USatoriExperimentCache* USatoriExperimentCache::CreateExperimentCache(USatoriClient* Client)
+{
+	USatoriExperimentCache* Cache = NewObject<USatoriExperimentCache>();
+	Cache->Client = Client;
+	return Cache;
+}
+
+void USatoriExperimentCache::Refresh(
+	USatoriSession* Session,
+	const TFunction<void(bool bChanged)>& SuccessCallback,
+	const TFunction<void(const FSatoriError& Error)>& ErrorCallback)
+{
+	if (!USatoriClient::IsClientActive(Client))
+	{
+		if (ErrorCallback) { ErrorCallback(FSatoriUtils::HandleInvalidClient()); }
+		return;
+	}
+
+	if (InFlightRefresh.IsValid())
+	{
+		InFlightRefresh->OnSuccess.Add(SuccessCallback);
+		InFlightRefresh->OnError.Add(ErrorCallback);
+		return;
+	}
+
+	InFlightRefresh = MakeShared<FPendingRefresh>();
+	InFlightRefresh->OnSuccess.Add(SuccessCallback);
+	InFlightRefresh->OnError.Add(ErrorCallback);
+
+	TWeakObjectPtr<USatoriExperimentCache> WeakThis(this);
+	const int32 RequestGeneration = Generation;
+
+	// No names: the server returns every experiment the identity is in.
+	Client->GetExperiments(Session, TArray<FString>(),
+		[WeakThis, RequestGeneration](const FSatoriExperimentList& List)
+		{
+			USatoriExperimentCache* Self = WeakThis.Get();
+			if (!Self || Self->Generation != RequestGeneration)
+			{
+				return;
+			}
+
+			const TSharedPtr<FPendingRefresh> Pending = MoveTemp(Self->InFlightRefresh);
+			Self->LastRefreshTime = FDateTime::UtcNow();
+			const bool bChanged = Self->SetExperiments(List.Experiments);
+			if (Self->bAutoSave)
+			{
+				// Saved even when unchanged, to persist the new freshness timestamp.
+				Self->Save();
+			}
+			if (bChanged)
+			{
+				Self->ExperimentsChangedEvent.Broadcast();
+			}
+
+			if (Pending.IsValid())
+			{
+				for (const TFunction<void(bool)>& Cb : Pending->OnSuccess)
+				{
+					if (Cb) { Cb(bChanged); }
+				}
+			}
+		},
+		[WeakThis, RequestGeneration](const FSatoriError& Error)
+		{
+			USatoriExperimentCache* Self = WeakThis.Get();
+			if (!Self || Self->Generation != RequestGeneration)
+			{
+				return;
+			}
+
+			const TSharedPtr<FPendingRefresh> Pending = MoveTemp(Self->InFlightRefresh);
+			if (Pending.IsValid())
+			{
+				for (const TFunction<void(const FSatoriError&)>& Cb : Pending->OnError)
+				{
+					if (Cb) { Cb(Error); }
+				}
+			}
+		});
+}
+
+void USatoriExperimentCache::RefreshIfStale(USatoriSession* Session, float MaxAgeSeconds)
+{
+	if (IsFresh(MaxAgeSeconds))
+	{
+		return;
+	}
+
+	Refresh(Session, nullptr, [](const FSatoriError& Error)
+	{
+		SATORI_LOGF_WARN(TEXT("Experiment refresh failed, serving cached assignments: %s"), *Error.Message);
+	});
+}
+
+void USatoriExperimentCache::StartAutoRefresh(USatoriSession* Session, float IntervalSeconds)
+{
+	StopAutoRefresh();
+	AutoRefreshSession = Session;
+
+	TWeakObjectPtr<USatoriExperimentCache> WeakThis(this);
+	const float Interval = FMath::Max(1.0f, IntervalSeconds);
+	AutoRefreshHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+		[WeakThis, Interval](float /*DeltaTime*/) -> bool
+		{
+			USatoriExperimentCache* Self = WeakThis.Get();
+			if (!Self)
+			{
+				return false;
+			}
+			// Not RefreshIfStale: the freshness timestamp is taken when the previous
+			// response arrived, so the cache is always slightly younger than one
+			// interval here and every other tick would be skipped.
+			Self->Refresh(Self->AutoRefreshSession, nullptr, [](const FSatoriError& Error)
+			{
+				SATORI_LOGF_WARN(TEXT("Experiment refresh failed, serving cached assignments: %s"), *Error.Message);
+			});
+			return true;
+		}), Interval);
+
+	// Assignments loaded from a recent save are served until the first tick.
+	RefreshIfStale(Session, Interval);
+}
+
+void USatoriExperimentCache::StopAutoRefresh()
+{
+	if (AutoRefreshHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(AutoRefreshHandle);
+		AutoRefreshHandle.Reset();
+	}
+	AutoRefreshSession = nullptr;
+}
+
+bool USatoriExperimentCache::GetExperiment(const FString& Name, FSatoriExperiment& OutExperiment) const
+{
+	if (const FSatoriExperiment* Experiment = Experiments.Find(Name))
+	{
+		OutExperiment = *Experiment;
+		return true;
+	}
+	return false;
+}
+
+FString USatoriExperimentCache::GetExperimentValue(const FString& Name, const FString& DefaultValue) const
+{
+	const FSatoriExperiment* Experiment = Experiments.Find(Name);
+	return Experiment ? Experiment->Value : DefaultValue;
+}
+
+TArray<FSatoriExperiment> USatoriExperimentCache::GetExperiments() const
+{
+	TArray<FSatoriExperiment> Result;
+	Experiments.GenerateValueArray(Result);
+	return Result;
+}
+
+FDateTime USatoriExperimentCache::GetLastRefreshTime() const
+{
+	return LastRefreshTime;
+}
+
+bool USatoriExperimentCache::IsFresh(float MaxAgeSeconds) const
+{
+	if (LastRefreshTime == FDateTime::MinValue())
+	{
+		return false;
+	}
+	return (FDateTime::UtcNow() - LastRefreshTime).GetTotalSeconds() < MaxAgeSeconds;
+}
+
+bool USatoriExperimentCache::SetExperiments(const TArray<FSatoriExperiment>& NewExperiments)
+{
+	bool bChanged = NewExperiments.Num() != Experiments.Num();
+
+	TMap<FString, FSatoriExperiment> NewMap;
+	NewMap.Reserve(NewExperiments.Num());
+	for (const FSatoriExperiment& Experiment : NewExperiments)
+	{
+		const FSatoriExperiment* Existing = Experiments.Find(Experiment.Name);
+		if (!Existing || !Existing->Value.Equals(Experiment.Value, ESearchCase::CaseSensitive))
+		{
+			bChanged = true;
+		}
+		NewMap.Add(Experiment.Name, Experiment);
+	}
+
+	Experiments = MoveTemp(NewMap);
+	return bChanged;
+}
+
+FString USatoriExperimentCache::GetSaveFilePath() const
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Satori"), FString::Printf(TEXT("Experiments_%s.json"), *FPaths::MakeValidFileName(IdentityId)));
+}
+
+bool USatoriExperimentCache::Load(const FString& InIdentityId)
+{
+	if (!IdentityId.IsEmpty() && InIdentityId != IdentityId)
+	{
+		ResetForIdentity();
+	}
+	IdentityId = InIdentityId;
+	if (IdentityId.IsEmpty())
+	{
+		return false;
+	}
+
+	FString Content;
+	if (!FFileHelper::LoadFileToString(Content, *GetSaveFilePath()))
+	{
+		return false;
+	}
+
+	const TSharedPtr<FJsonObject> JsonObject = FSatoriUtils::DeserializeJsonObject(Content);
+	if (!JsonObject.IsValid())
+	{
+		SATORI_LOG_WARN(TEXT("Discarding unreadable saved experiment assignments."));
+		return false;
+	}
+
+	int64 FetchedAt = 0;
+	JsonObject->TryGetNumberField(TEXT("fetched_at"), FetchedAt);
+	const FDateTime SavedTime = FDateTime::FromUnixTimestamp(FetchedAt);
+
+	// Keep assignments already refreshed during this run if they are newer.
+	if (SavedTime > LastRefreshTime)
+	{
+		LastRefreshTime = SavedTime;
+		if (SetExperiments(FSatoriExperimentList(Content).Experiments))
+		{
+			ExperimentsChangedEvent.Broadcast();
+		}
+	}
+	return true;
+}
+
+bool USatoriExperimentCache::Save() const
+{
+	if (IdentityId.IsEmpty())
+	{
+		return false;
+	}
+
+	TArray<TSharedPtr<FJsonValue>> ExperimentsJson;
+	ExperimentsJson.Reserve(Experiments.Num());
+	for (const TPair<FString, FSatoriExperiment>& Pair : Experiments)
+	{
+		TSharedPtr<FJsonObject> ExperimentJson = MakeShared<FJsonObject>();
+		ExperimentJson->SetStringField(TEXT("name"), Pair.Value.Name);
+		ExperimentJson->SetStringField(TEXT("value"), Pair.Value.Value);
+		ExperimentsJson.Add(MakeShared<FJsonValueObject>(ExperimentJson));
+	}
+
+	const TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+	JsonObject->SetArrayField(TEXT("experiments"), ExperimentsJson);
+	JsonObject->SetNumberField(TEXT("fetched_at"), LastRefreshTime == FDateTime::MinValue() ? 0 : LastRefreshTime.ToUnixTimestamp());
+
+	FString Content;
+	if (!FSatoriUtils::SerializeJsonObject(JsonObject, Content))
+	{
+		return false;
+	}
+	return FFileHelper::SaveStringToFile(Content, *GetSaveFilePath());
+}
+
+void USatoriExperimentCache::Clear()
+{
+	const bool bHadExperiments = Experiments.Num() > 0;
+	Experiments.Empty();
+	LastRefreshTime = FDateTime::MinValue();
+	if (bHadExperiments)
+	{
+		ExperimentsChangedEvent.Broadcast();
+	}
+}
+
+void USatoriExperimentCache::ResetForIdentity()
+{
+	// The previous identity's assignments must never be served to, or saved
+	// for, the new one, however recently they were fetched.
+	Generation++;
+	const TSharedPtr<FPendingRefresh> Pending = MoveTemp(InFlightRefresh);
+	Clear();
+
+	if (Pending.IsValid())
+	{
+		FSatoriError Error;
+		Error.Message = TEXT("The experiment cache was loaded for another identity.");
+		for (const TFunction<void(const FSatoriError&)>& Cb : Pending->OnError)
+		{
+			if (Cb) { Cb(Error); }
+		}
+	}
+}
+
+void USatoriExperimentCache::BeginDestroy()
+{
+	StopAutoRefresh();
+	Super::BeginDestroy();
+}
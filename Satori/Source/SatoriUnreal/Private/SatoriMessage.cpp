@@ -69,6 +69,9 @@ FSatoriMessageList::FSatoriMessageList(const FString& JsonString)
 				}
 			}
 		}
+
+		JsonObject->TryGetStringField(TEXT("next_cursor"), NextCursor);
+		JsonObject->TryGetStringField(TEXT("prev_cursor"), PrevCursor);
 	}
 }
 
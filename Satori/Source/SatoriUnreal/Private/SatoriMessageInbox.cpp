@@ -0,0 +1,566 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SatoriMessageInbox.h"
+#include "SatoriClient.h"
+#include "SatoriSession.h"
+#include "SatoriUtils.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	TSharedPtr<FJsonObject> MessageToJson(const FSatoriMessage& Message)
+	{
+		TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+		JsonObject->SetStringField(TEXT("id"), Message.ID);
+		JsonObject->SetStringField(TEXT("schedule_id"), Message.ScheduleID);
+		JsonObject->SetStringField(TEXT("text"), Message.Text);
+		JsonObject->SetStringField(TEXT("title"), Message.Title);
+		JsonObject->SetStringField(TEXT("image_url"), Message.ImageURL);
+		JsonObject->SetNumberField(TEXT("send_time"), Message.SendTime);
+		JsonObject->SetNumberField(TEXT("create_time"), Message.CreateTime);
+		JsonObject->SetNumberField(TEXT("update_time"), Message.UpdateTime);
+		JsonObject->SetNumberField(TEXT("read_time"), Message.ReadTime);
+		JsonObject->SetNumberField(TEXT("consume_time"), Message.ConsumeTime);
+		FSatoriUtils::AddVarsToJson(JsonObject, Message.Metadata, TEXT("metadata"));
+		return JsonObject;
+	}
+
+	FSatoriError MakeMessageNotFoundError(const FString& MessageId)
+	{
+		FSatoriError Error;
+		Error.Code = ESatoriErrorCode::NotFound;
+		Error.Message = FString::Printf(TEXT("Message %s is not in the inbox."), *MessageId);
+		return Error;
+	}
+}
+
+USatoriMessageInbox* USatoriMessageInbox::CreateMessageInbox(USatoriClient* Client)
+{
+	USatoriMessageInbox* Inbox = NewObject<USatoriMessageInbox>();
+	Inbox->Client = Client;
+	return Inbox;
+}
+
+void USatoriMessageInbox::Sync(
+	USatoriSession* Session,
+	const TFunction<void(int32 NumChanged)>& SuccessCallback,
+	const TFunction<void(const FSatoriError& Error)>& ErrorCallback)
+{
+	if (!USatoriClient::IsClientActive(Client))
+	{
+		if (ErrorCallback) { ErrorCallback(FSatoriUtils::HandleInvalidClient()); }
+		return;
+	}
+
+	// Coalesce: opening the inbox from several widgets at once costs one walk.
+	if (InFlightSync.IsValid())
+	{
+		InFlightSync->OnSuccess.Add(SuccessCallback);
+		InFlightSync->OnError.Add(ErrorCallback);
+		return;
+	}
+
+	InFlightSync = MakeShared<FPendingSync>();
+	InFlightSync->OnSuccess.Add(SuccessCallback);
+	InFlightSync->OnError.Add(ErrorCallback);
+	InFlightSync->bStartedEmpty = Messages.Num() == 0;
+
+	SyncPage(Session, FString());
+}
+
+void USatoriMessageInbox::SyncPage(USatoriSession* Session, const FString& Cursor)
+{
+	TWeakObjectPtr<USatoriMessageInbox> WeakThis(this);
+	const int32 RequestGeneration = Generation;
+
+	// Newest first (Forward = false) so the walk can stop at the first known message.
+	Client->GetMessages(Session, PageSize, false, Cursor,
+		[WeakThis, Session, RequestGeneration](const FSatoriMessageList& Page)
+		{
+			USatoriMessageInbox* Self = WeakThis.Get();
+			if (!Self || Self->Generation != RequestGeneration || !Self->InFlightSync.IsValid())
+			{
+				return;
+			}
+
+			FPendingSync& Sync = *Self->InFlightSync;
+			Sync.NumPages++;
+
+			bool bReachedKnown = false;
+			for (const FSatoriMessage& Message : Page.Messages)
+			{
+				const FSatoriMessage* Existing = Self->Messages.Find(Message.ID);
+				if (Existing && Existing->UpdateTime >= Message.UpdateTime && !Sync.bStartedEmpty)
+				{
+					// Everything from here down was merged by a previous sync.
+					bReachedKnown = true;
+					break;
+				}
+
+				Sync.SeenIds.Add(Message.ID);
+				if (Self->MergeMessage(Message))
+				{
+					Sync.NumChanged++;
+				}
+			}
+
+			const bool bEndOfList = Page.NextCursor.IsEmpty();
+			if (bReachedKnown)
+			{
+				Self->FinishSync(nullptr);
+				return;
+			}
+
+			if (bEndOfList)
+			{
+				// The whole server list was walked from the top without meeting a
+				// known message, so anything held locally but not seen was deleted
+				// or expired on the server.
+				TArray<FString> Stale;
+				for (const TPair<FString, FSatoriMessage>& Pair : Self->Messages)
+				{
+					if (!Sync.SeenIds.Contains(Pair.Key) && !Self->PendingMutations.Contains(Pair.Key))
+					{
+						Stale.Add(Pair.Key);
+					}
+				}
+				for (const FString& Id : Stale)
+				{
+					Self->Messages.Remove(Id);
+				}
+				Sync.NumChanged += Stale.Num();
+				Self->OlderCursor.Reset();
+				Self->FinishSync(nullptr);
+				return;
+			}
+
+			// A fresh inbox only needs the first page to render; the rest is
+			// loaded on demand through LoadOlder. Otherwise stop at the page budget
+			// and leave the remainder reachable from the older-page cursor.
+			if (Sync.bStartedEmpty || Sync.NumPages >= FMath::Max(1, Self->MaxSyncPages))
+			{
+				Self->OlderCursor = Page.NextCursor;
+				Self->FinishSync(nullptr);
+				return;
+			}
+
+			Self->SyncPage(Session, Page.NextCursor);
+		},
+		[WeakThis, RequestGeneration](const FSatoriError& Error)
+		{
+			USatoriMessageInbox* Self = WeakThis.Get();
+			if (Self && Self->Generation == RequestGeneration)
+			{
+				Self->FinishSync(&Error);
+			}
+		});
+}
+
+void USatoriMessageInbox::FinishSync(const FSatoriError* Error)
+{
+	const TSharedPtr<FPendingSync> Sync = MoveTemp(InFlightSync);
+	if (!Sync.IsValid())
+	{
+		return;
+	}
+
+	if (Sync->NumChanged > 0)
+	{
+		NotifyChanged();
+	}
+
+	if (Error)
+	{
+		for (const TFunction<void(const FSatoriError&)>& Cb : Sync->OnError)
+		{
+			if (Cb) { Cb(*Error); }
+		}
+		return;
+	}
+
+	for (const TFunction<void(int32)>& Cb : Sync->OnSuccess)
+	{
+		if (Cb) { Cb(Sync->NumChanged); }
+	}
+}
+
+void USatoriMessageInbox::LoadOlder(
+	USatoriSession* Session,
+	const TFunction<void(int32 NumAdded)>& SuccessCallback,
+	const TFunction<void(const FSatoriError& Error)>& ErrorCallback)
+{
+	if (!USatoriClient::IsClientActive(Client))
+	{
+		if (ErrorCallback) { ErrorCallback(FSatoriUtils::HandleInvalidClient()); }
+		return;
+	}
+
+	if (OlderCursor.IsEmpty())
+	{
+		if (SuccessCallback) { SuccessCallback(0); }
+		return;
+	}
+
+	TWeakObjectPtr<USatoriMessageInbox> WeakThis(this);
+	const FString RequestedCursor = OlderCursor;
+	const int32 RequestGeneration = Generation;
+
+	Client->GetMessages(Session, PageSize, false, RequestedCursor,
+		[WeakThis, RequestedCursor, RequestGeneration, SuccessCallback](const FSatoriMessageList& Page)
+		{
+			USatoriMessageInbox* Self = WeakThis.Get();
+			if (!Self || Self->Generation != RequestGeneration)
+			{
+				return;
+			}
+
+			int32 NumAdded = 0;
+			for (const FSatoriMessage& Message : Page.Messages)
+			{
+				if (Self->MergeMessage(Message))
+				{
+					NumAdded++;
+				}
+			}
+
+			// Only advance if no sync has moved the cursor in the meantime.
+			if (Self->OlderCursor == RequestedCursor)
+			{
+				Self->OlderCursor = Page.NextCursor;
+			}
+
+			Self->NotifyChanged();
+			if (SuccessCallback) { SuccessCallback(NumAdded); }
+		},
+		ErrorCallback);
+}
+
+void USatoriMessageInbox::MarkRead(
+	USatoriSession* Session,
+	const FString& MessageId,
+	const TFunction<void()>& SuccessCallback,
+	const TFunction<void(const FSatoriError& Error)>& ErrorCallback)
+{
+	UpdateMessageState(Session, MessageId, false, SuccessCallback, ErrorCallback);
+}
+
+void USatoriMessageInbox::MarkConsumed(
+	USatoriSession* Session,
+	const FString& MessageId,
+	const TFunction<void()>& SuccessCallback,
+	const TFunction<void(const FSatoriError& Error)>& ErrorCallback)
+{
+	UpdateMessageState(Session, MessageId, true, SuccessCallback, ErrorCallback);
+}
+
+void USatoriMessageInbox::UpdateMessageState(
+	USatoriSession* Session,
+	const FString& MessageId,
+	bool bConsume,
+	const TFunction<void()>& SuccessCallback,
+	const TFunction<void(const FSatoriError& Error)>& ErrorCallback)
+{
+	if (!USatoriClient::IsClientActive(Client))
+	{
+		if (ErrorCallback) { ErrorCallback(FSatoriUtils::HandleInvalidClient()); }
+		return;
+	}
+
+	FSatoriMessage* Message = Messages.Find(MessageId);
+	if (!Message)
+	{
+		if (ErrorCallback) { ErrorCallback(MakeMessageNotFoundError(MessageId)); }
+		return;
+	}
+
+	const FSatoriMessage Previous = *Message;
+	const int64 Now = FDateTime::UtcNow().ToUnixTimestamp();
+	if (Message->ReadTime == 0)
+	{
+		Message->ReadTime = Now;
+	}
+	if (bConsume && Message->ConsumeTime == 0)
+	{
+		Message->ConsumeTime = Now;
+	}
+
+	// Copy the new times out first: InboxChangedEvent listeners may change the
+	// map (e.g. by deleting a message), which would leave Message dangling.
+	const FDateTime ReadTime = FDateTime::FromUnixTimestamp(Message->ReadTime);
+	const FDateTime ConsumeTime = FDateTime::FromUnixTimestamp(Message->ConsumeTime);
+
+	BeginMutation(MessageId);
+	NotifyChanged();
+
+	TWeakObjectPtr<USatoriMessageInbox> WeakThis(this);
+	const int32 RequestGeneration = Generation;
+	Client->UpdateMessage(Session, MessageId, ReadTime, ConsumeTime,
+		[WeakThis, RequestGeneration, MessageId, SuccessCallback]()
+		{
+			USatoriMessageInbox* Self = WeakThis.Get();
+			if (Self && Self->Generation == RequestGeneration)
+			{
+				Self->EndMutation(MessageId);
+				if (Self->bAutoSave) { Self->Save(); }
+			}
+			if (SuccessCallback) { SuccessCallback(); }
+		},
+		[WeakThis, RequestGeneration, Previous, ErrorCallback](const FSatoriError& Error)
+		{
+			USatoriMessageInbox* Self = WeakThis.Get();
+			if (Self && Self->Generation == RequestGeneration)
+			{
+				Self->EndMutation(Previous.ID);
+				if (FSatoriMessage* Current = Self->Messages.Find(Previous.ID))
+				{
+					*Current = Previous;
+				}
+				Self->NotifyChanged();
+			}
+			if (ErrorCallback) { ErrorCallback(Error); }
+		});
+}
+
+void USatoriMessageInbox::DeleteMessage(
+	USatoriSession* Session,
+	const FString& MessageId,
+	const TFunction<void()>& SuccessCallback,
+	const TFunction<void(const FSatoriError& Error)>& ErrorCallback)
+{
+	if (!USatoriClient::IsClientActive(Client))
+	{
+		if (ErrorCallback) { ErrorCallback(FSatoriUtils::HandleInvalidClient()); }
+		return;
+	}
+
+	FSatoriMessage Removed;
+	if (!Messages.RemoveAndCopyValue(MessageId, Removed))
+	{
+		if (ErrorCallback) { ErrorCallback(MakeMessageNotFoundError(MessageId)); }
+		return;
+	}
+
+	BeginMutation(MessageId);
+	NotifyChanged();
+
+	TWeakObjectPtr<USatoriMessageInbox> WeakThis(this);
+	const int32 RequestGeneration = Generation;
+	Client->DeleteMessage(Session, MessageId,
+		[WeakThis, RequestGeneration, MessageId, SuccessCallback]()
+		{
+			USatoriMessageInbox* Self = WeakThis.Get();
+			if (Self && Self->Generation == RequestGeneration)
+			{
+				Self->EndMutation(MessageId);
+				if (Self->bAutoSave) { Self->Save(); }
+			}
+			if (SuccessCallback) { SuccessCallback(); }
+		},
+		[WeakThis, RequestGeneration, Removed, ErrorCallback](const FSatoriError& Error)
+		{
+			USatoriMessageInbox* Self = WeakThis.Get();
+			if (Self && Self->Generation == RequestGeneration)
+			{
+				Self->EndMutation(Removed.ID);
+				Self->Messages.Add(Removed.ID, Removed);
+				Self->NotifyChanged();
+			}
+			if (ErrorCallback) { ErrorCallback(Error); }
+		});
+}
+
+TArray<FSatoriMessage> USatoriMessageInbox::GetMessages() const
+{
+	TArray<FSatoriMessage> Result;
+	Messages.GenerateValueArray(Result);
+	Result.Sort([](const FSatoriMessage& A, const FSatoriMessage& B)
+	{
+		return A.CreateTime != B.CreateTime ? A.CreateTime > B.CreateTime : A.ID > B.ID;
+	});
+	return Result;
+}
+
+bool USatoriMessageInbox::FindMessage(const FString& MessageId, FSatoriMessage& OutMessage) const
+{
+	if (const FSatoriMessage* Message = Messages.Find(MessageId))
+	{
+		OutMessage = *Message;
+		return true;
+	}
+	return false;
+}
+
+int32 USatoriMessageInbox::GetUnreadCount() const
+{
+	int32 Count = 0;
+	for (const TPair<FString, FSatoriMessage>& Pair : Messages)
+	{
+		if (Pair.Value.ReadTime == 0)
+		{
+			Count++;
+		}
+	}
+	return Count;
+}
+
+bool USatoriMessageInbox::HasOlderMessages() const
+{
+	return !OlderCursor.IsEmpty();
+}
+
+bool USatoriMessageInbox::MergeMessage(const FSatoriMessage& Message)
+{
+	if (PendingMutations.Contains(Message.ID))
+	{
+		return false;
+	}
+
+	FSatoriMessage* Existing = Messages.Find(Message.ID);
+	if (Existing && Existing->UpdateTime >= Message.UpdateTime)
+	{
+		return false;
+	}
+
+	Messages.Add(Message.ID, Message);
+	return true;
+}
+
+void USatoriMessageInbox::BeginMutation(const FString& MessageId)
+{
+	PendingMutations.FindOrAdd(MessageId)++;
+}
+
+void USatoriMessageInbox::EndMutation(const FString& MessageId)
+{
+	if (int32* Count = PendingMutations.Find(MessageId))
+	{
+		if (--(*Count) <= 0)
+		{
+			PendingMutations.Remove(MessageId);
+		}
+	}
+}
+
+void USatoriMessageInbox::NotifyChanged()
+{
+	if (bAutoSave && PendingMutations.Num() == 0)
+	{
+		Save();
+	}
+	InboxChangedEvent.Broadcast();
+}
+
+FString USatoriMessageInbox::GetSaveFilePath() const
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Satori"), FString::Printf(TEXT("Inbox_%s.json"), *FPaths::MakeValidFileName(IdentityId)));
+}
+
+bool USatoriMessageInbox::Load(const FString& InIdentityId)
+{
+	if (!IdentityId.IsEmpty() && InIdentityId != IdentityId)
+	{
+		ResetForIdentity();
+	}
+	IdentityId = InIdentityId;
+	if (IdentityId.IsEmpty())
+	{
+		return false;
+	}
+
+	FString Content;
+	if (!FFileHelper::LoadFileToString(Content, *GetSaveFilePath()))
+	{
+		return false;
+	}
+
+	const TSharedPtr<FJsonObject> JsonObject = FSatoriUtils::DeserializeJsonObject(Content);
+	if (!JsonObject.IsValid())
+	{
+		SATORI_LOG_WARN(TEXT("Discarding unreadable saved message inbox."));
+		return false;
+	}
+
+	// The saved messages are the server state as of the last save; keep any
+	// newer copies that were already merged into this instance.
+	const FSatoriMessageList Saved(Content);
+	for (const FSatoriMessage& Message : Saved.Messages)
+	{
+		MergeMessage(Message);
+	}
+	if (OlderCursor.IsEmpty())
+	{
+		JsonObject->TryGetStringField(TEXT("older_cursor"), OlderCursor);
+	}
+
+	InboxChangedEvent.Broadcast();
+	return true;
+}
+
+bool USatoriMessageInbox::Save() const
+{
+	if (IdentityId.IsEmpty())
+	{
+		return false;
+	}
+
+	TArray<TSharedPtr<FJsonValue>> MessagesJson;
+	MessagesJson.Reserve(Messages.Num());
+	for (const TPair<FString, FSatoriMessage>& Pair : Messages)
+	{
+		MessagesJson.Add(MakeShared<FJsonValueObject>(MessageToJson(Pair.Value)));
+	}
+
+	const TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+	JsonObject->SetArrayField(TEXT("messages"), MessagesJson);
+	JsonObject->SetStringField(TEXT("older_cursor"), OlderCursor);
+
+	FString Content;
+	if (!FSatoriUtils::SerializeJsonObject(JsonObject, Content))
+	{
+		return false;
+	}
+	return FFileHelper::SaveStringToFile(Content, *GetSaveFilePath());
+}
+
+void USatoriMessageInbox::ResetForIdentity()
+{
+	// Start from nothing so the previous identity's messages and cursor can
+	// never be saved under the new identity's file.
+	Generation++;
+	Messages.Empty();
+	OlderCursor.Reset();
+	PendingMutations.Empty();
+
+	const TSharedPtr<FPendingSync> Sync = MoveTemp(InFlightSync);
+	if (Sync.IsValid())
+	{
+		FSatoriError Error;
+		Error.Message = TEXT("The inbox was loaded for another identity.");
+		for (const TFunction<void(const FSatoriError&)>& Cb : Sync->OnError)
+		{
+			if (Cb) { Cb(Error); }
+		}
+	}
+}
+
+void USatoriMessageInbox::Clear()
+{
+	Messages.Empty();
+	OlderCursor.Reset();
+	NotifyChanged();
+}
@@ -0,0 +1,48 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SatoriPagers.h"
+#include "SatoriClient.h"
+#include "SatoriSession.h"
+#include "SatoriUtils.h"
+
+TSharedRef<FSatoriMessagePager> FSatoriPagers::GetMessages(
+	USatoriClient* Client,
+	USatoriSession* Session,
+	int32 Limit,
+	bool Forward)
+{
+	TWeakObjectPtr<USatoriClient> WeakClient(Client);
+	TWeakObjectPtr<USatoriSession> WeakSession(Session);
+
+	return FSatoriMessagePager::Create(
+		[WeakClient, WeakSession, Limit, Forward](const FString& Cursor, const FSatoriMessagePager::FPageCallback& OnPage, const FSatoriMessagePager::FErrorCallback& OnError)
+		{
+			USatoriClient* LiveClient = WeakClient.Get();
+			if (!FSatoriUtils::IsClientActive(LiveClient))
+			{
+				OnError(FSatoriUtils::HandleInvalidClient());
+				return;
+			}
+			USatoriSession* LiveSession = WeakSession.Get();
+			if (!LiveSession)
+			{
+				OnError(FSatoriUtils::HandleInvalidSession());
+				return;
+			}
+			LiveClient->GetMessages(LiveSession, Limit, Forward, Cursor, OnPage, OnError);
+		});
+}
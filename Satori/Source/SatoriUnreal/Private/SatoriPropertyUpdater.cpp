@@ -0,0 +1,222 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SatoriPropertyUpdater.h"
+#include "SatoriClient.h"
+#include "SatoriSession.h"
+#include "SatoriUtils.h"
+
+namespace
+{
+	// Drop entries whose value matches what the server already holds.
+	void RemoveUnchanged(TMap<FString, FString>& Changes, const TMap<FString, FString>& Acked)
+	{
+		for (auto It = Changes.CreateIterator(); It; ++It)
+		{
+			const FString* AckedValue = Acked.Find(It.Key());
+			if (AckedValue && AckedValue->Equals(It.Value(), ESearchCase::CaseSensitive))
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	// Put failed changes back without overwriting newer ones for the same key.
+	void Restore(TMap<FString, FString>& Pending, const TMap<FString, FString>& Failed)
+	{
+		for (const TPair<FString, FString>& Pair : Failed)
+		{
+			if (!Pending.Contains(Pair.Key))
+			{
+				Pending.Add(Pair.Key, Pair.Value);
+			}
+		}
+	}
+}
+
+USatoriPropertyUpdater* USatoriPropertyUpdater::CreatePropertyUpdater(USatoriClient* Client, USatoriSession* Session)
+{
+	USatoriPropertyUpdater* Updater = NewObject<USatoriPropertyUpdater>();
+	Updater->Client = Client;
+	Updater->Session = Session;
+	return Updater;
+}
+
+void USatoriPropertyUpdater::SetDefaultProperty(const FString& Key, const FString& Value)
+{
+	PendingDefault.Add(Key, Value);
+	ScheduleFlush();
+}
+
+void USatoriPropertyUpdater::SetCustomProperty(const FString& Key, const FString& Value)
+{
+	PendingCustom.Add(Key, Value);
+	ScheduleFlush();
+}
+
+void USatoriPropertyUpdater::SetProperties(const TMap<FString, FString>& DefaultProperties, const TMap<FString, FString>& CustomProperties)
+{
+	PendingDefault.Append(DefaultProperties);
+	PendingCustom.Append(CustomProperties);
+	ScheduleFlush();
+}
+
+void USatoriPropertyUpdater::SetAcknowledgedProperties(const FSatoriProperties& Properties)
+{
+	AckedDefault = Properties.DefaultProperties;
+	AckedCustom = Properties.CustomProperties;
+}
+
+void USatoriPropertyUpdater::SetSession(USatoriSession* InSession)
+{
+	Session = InSession;
+}
+
+void USatoriPropertyUpdater::Flush()
+{
+	CancelScheduledFlush();
+
+	// The next flush is triggered from OnRequestComplete.
+	if (bRequestInFlight)
+	{
+		return;
+	}
+
+	RemoveUnchanged(PendingDefault, AckedDefault);
+	RemoveUnchanged(PendingCustom, AckedCustom);
+	if (PendingDefault.IsEmpty() && PendingCustom.IsEmpty())
+	{
+		PendingSince = 0.0;
+		return;
+	}
+
+	if (!USatoriClient::IsClientActive(Client))
+	{
+		OnFlushError.Broadcast(FSatoriUtils::HandleInvalidClient());
+		return;
+	}
+
+	InFlightDefault = MoveTemp(PendingDefault);
+	InFlightCustom = MoveTemp(PendingCustom);
+	PendingDefault.Reset();
+	PendingCustom.Reset();
+	PendingSince = 0.0;
+	bRequestInFlight = true;
+
+	TWeakObjectPtr<USatoriPropertyUpdater> WeakThis(this);
+	Client->UpdateProperties(Session, InFlightDefault, InFlightCustom, bRecompute,
+		[WeakThis]()
+		{
+			if (USatoriPropertyUpdater* Self = WeakThis.Get())
+			{
+				Self->OnRequestComplete(nullptr);
+			}
+		},
+		[WeakThis](const FSatoriError& Error)
+		{
+			if (USatoriPropertyUpdater* Self = WeakThis.Get())
+			{
+				Self->OnRequestComplete(&Error);
+			}
+		});
+}
+
+void USatoriPropertyUpdater::OnRequestComplete(const FSatoriError* Error)
+{
+	bRequestInFlight = false;
+
+	if (Error)
+	{
+		Restore(PendingDefault, InFlightDefault);
+		Restore(PendingCustom, InFlightCustom);
+		InFlightDefault.Reset();
+		InFlightCustom.Reset();
+		OnFlushError.Broadcast(*Error);
+		return;
+	}
+
+	AckedDefault.Append(InFlightDefault);
+	AckedCustom.Append(InFlightCustom);
+	InFlightDefault.Reset();
+	InFlightCustom.Reset();
+	OnFlushed.Broadcast();
+
+	// Changes made while the request was in flight.
+	if (!PendingDefault.IsEmpty() || !PendingCustom.IsEmpty())
+	{
+		ScheduleFlush();
+	}
+}
+
+void USatoriPropertyUpdater::DiscardPending()
+{
+	CancelScheduledFlush();
+	PendingDefault.Reset();
+	PendingCustom.Reset();
+	PendingSince = 0.0;
+}
+
+bool USatoriPropertyUpdater::HasPendingChanges() const
+{
+	return bRequestInFlight || !PendingDefault.IsEmpty() || !PendingCustom.IsEmpty();
+}
+
+void USatoriPropertyUpdater::ScheduleFlush()
+{
+	// Restart the debounce window on every change, but never past the
+	// deadline set by the oldest change still waiting.
+	CancelScheduledFlush();
+
+	const double Now = FPlatformTime::Seconds();
+	if (PendingSince == 0.0)
+	{
+		PendingSince = Now;
+	}
+
+	float Delay = FMath::Max(0.0f, DebounceSeconds);
+	if (MaxWaitSeconds > 0.0f)
+	{
+		const double Remaining = PendingSince + MaxWaitSeconds - Now;
+		Delay = FMath::Min(Delay, static_cast<float>(FMath::Max(0.0, Remaining)));
+	}
+
+	TWeakObjectPtr<USatoriPropertyUpdater> WeakThis(this);
+	DebounceHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+		[WeakThis](float /*DeltaTime*/) -> bool
+		{
+			if (USatoriPropertyUpdater* Self = WeakThis.Get())
+			{
+				Self->DebounceHandle.Reset();
+				Self->Flush();
+			}
+			return false; // one-shot
+		}), Delay);
+}
+
+void USatoriPropertyUpdater::CancelScheduledFlush()
+{
+	if (DebounceHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(DebounceHandle);
+		DebounceHandle.Reset();
+	}
+}
+
+void USatoriPropertyUpdater::BeginDestroy()
+{
+	CancelScheduledFlush();
+	Super::BeginDestroy();
+}
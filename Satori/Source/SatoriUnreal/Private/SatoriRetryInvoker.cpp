@@ -22,6 +22,9 @@ FSatoriError FSatoriRetryInvoker::MakeTerminalError(ESatoriRequestOutcome Outcom
 	case ESatoriRequestOutcome::Cancelled:
 		// Expected outcome, not a transport fault; must not log at Error level.
 		return FSatoriUtils::CreateRequestCancelledError();
+	case ESatoriRequestOutcome::Rejected:
+		// Bounded queue overflow: retrying would only add to the backlog.
+		return FSatoriUtils::CreateRequestRejectedError();
 	default:
 		return FSatoriUtils::CreateRequestFailureError();
 	}
@@ -0,0 +1,440 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SatoriServerEventWriter.h"
+#include "SatoriClient.h"
+#include "SatoriLoggingMacros.h"
+#include "Async/Async.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/RunnableThread.h"
+#include "Containers/StringConv.h"
+
+namespace
+{
+	void AppendAscii(TArray<uint8>& Buffer, const ANSICHAR* Str)
+	{
+		Buffer.Append(reinterpret_cast<const uint8*>(Str), FCStringAnsi::Strlen(Str));
+	}
+
+	void AppendInt64(TArray<uint8>& Buffer, int64 Value)
+	{
+		ANSICHAR Digits[24];
+		int32 Len = 0;
+		uint64 Magnitude = Value < 0 ? 0 - static_cast<uint64>(Value) : static_cast<uint64>(Value);
+		do
+		{
+			Digits[Len++] = static_cast<ANSICHAR>('0' + Magnitude % 10);
+			Magnitude /= 10;
+		} while (Magnitude > 0);
+
+		if (Value < 0)
+		{
+			Buffer.Add('-');
+		}
+		while (Len > 0)
+		{
+			Buffer.Add(static_cast<uint8>(Digits[--Len]));
+		}
+	}
+
+	// Append a quoted, escaped JSON string. Runs of characters that need no
+	// escaping are converted to UTF-8 in one go, keeping surrogate pairs intact.
+	void AppendJsonString(TArray<uint8>& Buffer, const FString& Value)
+	{
+		static const ANSICHAR Hex[] = "0123456789abcdef";
+
+		const TCHAR* Chars = *Value;
+		const int32 Len = Value.Len();
+		int32 RunStart = 0;
+
+		auto FlushRun = [&](int32 RunEnd)
+		{
+			if (RunEnd > RunStart)
+			{
+				const FTCHARToUTF8 Converted(Chars + RunStart, RunEnd - RunStart);
+				Buffer.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+			}
+		};
+
+		Buffer.Add('"');
+		for (int32 Index = 0; Index < Len; ++Index)
+		{
+			const TCHAR Char = Chars[Index];
+			if (Char != TEXT('"') && Char != TEXT('\\') && Char >= 0x20)
+			{
+				continue;
+			}
+
+			FlushRun(Index);
+			RunStart = Index + 1;
+
+			Buffer.Add('\\');
+			switch (Char)
+			{
+			case TEXT('"'):  Buffer.Add('"'); break;
+			case TEXT('\\'): Buffer.Add('\\'); break;
+			case TEXT('\n'): Buffer.Add('n'); break;
+			case TEXT('\r'): Buffer.Add('r'); break;
+			case TEXT('\t'): Buffer.Add('t'); break;
+			case TEXT('\b'): Buffer.Add('b'); break;
+			case TEXT('\f'): Buffer.Add('f'); break;
+			default:
+				AppendAscii(Buffer, "u00");
+				Buffer.Add(Hex[(Char >> 4) & 0xF]);
+				Buffer.Add(Hex[Char & 0xF]);
+				break;
+			}
+		}
+		FlushRun(Len);
+		Buffer.Add('"');
+	}
+
+	void AppendStringField(TArray<uint8>& Buffer, const ANSICHAR* Key, const FString& Value)
+	{
+		Buffer.Add(',');
+		Buffer.Add('"');
+		AppendAscii(Buffer, Key);
+		AppendAscii(Buffer, "\":");
+		AppendJsonString(Buffer, Value);
+	}
+
+	void AppendNumberField(TArray<uint8>& Buffer, const ANSICHAR* Key, int64 Value)
+	{
+		Buffer.Add(',');
+		Buffer.Add('"');
+		AppendAscii(Buffer, Key);
+		AppendAscii(Buffer, "\":");
+		AppendInt64(Buffer, Value);
+	}
+
+	const ANSICHAR BatchPrefix[] = "{\"events\":[";
+	const ANSICHAR BatchSuffix[] = "]}";
+}
+
+void FSatoriServerEventWriter::FShared::Wake()
+{
+	FScopeLock Lock(&WakeEventMutex);
+	if (WakeEvent)
+	{
+		WakeEvent->Trigger();
+	}
+}
+
+FSatoriServerEventWriter::FSatoriServerEventWriter(USatoriClient* InClient, const FSatoriServerEventWriterSettings& InSettings)
+	: Client(InClient)
+	, Settings(InSettings)
+	, Shared(MakeShared<FShared, ESPMode::ThreadSafe>())
+{
+	Settings.MaxBatchBytes = FMath::Max(1024, Settings.MaxBatchBytes);
+	Settings.MaxBatchEvents = FMath::Max(1, Settings.MaxBatchEvents);
+	Settings.MaxQueuedEvents = FMath::Max(1, Settings.MaxQueuedEvents);
+	Settings.MaxInFlightBatches = FMath::Max(1, Settings.MaxInFlightBatches);
+	Settings.FlushIntervalSeconds = FMath::Max(0.01f, Settings.FlushIntervalSeconds);
+
+	Shared->WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	Thread = FRunnableThread::Create(this, TEXT("SatoriServerEventWriter"), 0, TPri_BelowNormal);
+}
+
+FSatoriServerEventWriter::~FSatoriServerEventWriter()
+{
+	if (Thread)
+	{
+		Stop();
+		Thread->WaitForCompletion();
+		delete Thread;
+		Thread = nullptr;
+	}
+
+	FEvent* WakeEvent = nullptr;
+	{
+		FScopeLock Lock(&Shared->WakeEventMutex);
+		WakeEvent = Shared->WakeEvent;
+		Shared->WakeEvent = nullptr;
+	}
+	FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+}
+
+ESatoriEnqueueResult FSatoriServerEventWriter::Enqueue(FSatoriEvent&& Event)
+{
+	if (bStopping)
+	{
+		return ESatoriEnqueueResult::Stopped;
+	}
+
+	// Reserve a slot first so concurrent producers cannot overshoot the cap.
+	const int32 NewCount = ++Shared->NumQueued;
+	if (NewCount > Settings.MaxQueuedEvents)
+	{
+		if (Settings.OverflowPolicy == ENakamaOverflowPolicy::Reject)
+		{
+			--Shared->NumQueued;
+			++Shared->NumRejected;
+			return ESatoriEnqueueResult::QueueFull;
+		}
+
+		// Make room by discarding the oldest event. If the writer drained the
+		// queue in the meantime there is nothing to drop and room already.
+		FSatoriEvent Oldest;
+		if (DequeueEvent(Oldest))
+		{
+			--Shared->NumQueued;
+			++Shared->NumDropped;
+		}
+	}
+
+	Queue.Enqueue(MoveTemp(Event));
+	++Shared->NumEnqueued;
+
+	// Wake the writer once a full batch is waiting rather than on every event.
+	if (NewCount % Settings.MaxBatchEvents == 0)
+	{
+		Shared->Wake();
+	}
+	return ESatoriEnqueueResult::Accepted;
+}
+
+ESatoriEnqueueResult FSatoriServerEventWriter::Enqueue(const FSatoriEvent& Event)
+{
+	return Enqueue(FSatoriEvent(Event));
+}
+
+bool FSatoriServerEventWriter::IsUnderPressure() const
+{
+	return Shared->NumQueued.load() * 4 >= Settings.MaxQueuedEvents * 3
+		|| Shared->NumInFlightBatches.load() >= Settings.MaxInFlightBatches;
+}
+
+void FSatoriServerEventWriter::Flush()
+{
+	bFlushRequested = true;
+	Shared->Wake();
+}
+
+FSatoriServerEventWriterStats FSatoriServerEventWriter::GetStats() const
+{
+	FSatoriServerEventWriterStats Stats;
+	Stats.NumEnqueued = Shared->NumEnqueued.load();
+	Stats.NumRejected = Shared->NumRejected.load();
+	Stats.NumDropped = Shared->NumDropped.load();
+	Stats.NumEventsSent = Shared->NumEventsSent.load();
+	Stats.NumEventsFailed = Shared->NumEventsFailed.load();
+	Stats.NumBatchesSent = Shared->NumBatchesSent.load();
+	Stats.NumBatchesFailed = Shared->NumBatchesFailed.load();
+	Stats.BytesSent = Shared->BytesSent.load();
+	Stats.NumQueued = Shared->NumQueued.load();
+	Stats.NumInFlightBatches = Shared->NumInFlightBatches.load();
+	return Stats;
+}
+
+bool FSatoriServerEventWriter::DequeueEvent(FSatoriEvent& OutEvent)
+{
+	if (Settings.OverflowPolicy == ENakamaOverflowPolicy::DropOldest)
+	{
+		FScopeLock Lock(&DequeueMutex);
+		return Queue.Dequeue(OutEvent);
+	}
+	return Queue.Dequeue(OutEvent);
+}
+
+void FSatoriServerEventWriter::Stop()
+{
+	bStopping = true;
+	Shared->Wake();
+}
+
+uint32 FSatoriServerEventWriter::Run()
+{
+	TArray<uint8> Body;
+	TArray<uint8> Scratch;
+	int32 NumInBody = 0;
+	double BatchStartTime = 0.0;
+
+	auto SendCurrent = [&]()
+	{
+		Body.Append(reinterpret_cast<const uint8*>(BatchSuffix), sizeof(BatchSuffix) - 1);
+		SendBatch(MoveTemp(Body), NumInBody);
+		Body = TArray<uint8>();
+		NumInBody = 0;
+	};
+
+	while (true)
+	{
+		const bool bStopRequested = bStopping;
+
+		// Stop draining while every batch slot is taken; the queue then fills up
+		// and producers see backpressure. On shutdown everything is sent.
+		while (bStopRequested || Shared->NumInFlightBatches.load() < Settings.MaxInFlightBatches)
+		{
+			FSatoriEvent Event;
+			if (!DequeueEvent(Event))
+			{
+				break;
+			}
+			--Shared->NumQueued;
+
+			Scratch.Reset();
+			AppendEventJson(Scratch, Event);
+
+			// Cut before the event that would overflow the byte cap.
+			if (NumInBody > 0 && Body.Num() + Scratch.Num() + static_cast<int32>(sizeof(BatchSuffix)) > Settings.MaxBatchBytes)
+			{
+				SendCurrent();
+			}
+
+			if (NumInBody == 0)
+			{
+				Body.Reserve(Settings.MaxBatchBytes);
+				Body.Append(reinterpret_cast<const uint8*>(BatchPrefix), sizeof(BatchPrefix) - 1);
+				BatchStartTime = FPlatformTime::Seconds();
+			}
+			else
+			{
+				Body.Add(',');
+			}
+			Body.Append(Scratch);
+			NumInBody++;
+
+			if (NumInBody >= Settings.MaxBatchEvents)
+			{
+				SendCurrent();
+			}
+		}
+
+		const double Now = FPlatformTime::Seconds();
+		const bool bFlush = bFlushRequested.exchange(false);
+		if (NumInBody > 0 && (bStopRequested || bFlush || Now - BatchStartTime >= Settings.FlushIntervalSeconds))
+		{
+			SendCurrent();
+		}
+
+		if (bStopRequested && Queue.IsEmpty())
+		{
+			break;
+		}
+
+		const double WaitSeconds = NumInBody > 0
+			? Settings.FlushIntervalSeconds - (Now - BatchStartTime)
+			: Settings.FlushIntervalSeconds;
+		Shared->WakeEvent->Wait(FMath::Max(1, FMath::CeilToInt(WaitSeconds * 1000.0)));
+	}
+
+	return 0;
+}
+
+void FSatoriServerEventWriter::SendBatch(TArray<uint8>&& Body, int32 NumEvents)
+{
+	++Shared->NumInFlightBatches;
+
+	const TSharedRef<const TArray<uint8>, ESPMode::ThreadSafe> Payload = MakeShared<TArray<uint8>, ESPMode::ThreadSafe>(MoveTemp(Body));
+	const TSharedRef<FShared, ESPMode::ThreadSafe> State = Shared;
+	const TWeakObjectPtr<USatoriClient> WeakClient = Client;
+
+	auto OnFailed = [State, NumEvents]()
+	{
+		--State->NumInFlightBatches;
+		State->NumEventsFailed += NumEvents;
+		++State->NumBatchesFailed;
+		State->Wake();
+	};
+
+	// The client is a UObject and its requests are issued from the game thread;
+	// this is the only per-batch work done there.
+	AsyncTask(ENamedThreads::GameThread, [WeakClient, Payload, State, NumEvents, OnFailed]()
+	{
+		USatoriClient* SatoriClient = WeakClient.Get();
+		if (!USatoriClient::IsClientActive(SatoriClient))
+		{
+			OnFailed();
+			return;
+		}
+
+		SatoriClient->PostServerEventPayload(Payload,
+			[Payload, State, NumEvents]()
+			{
+				--State->NumInFlightBatches;
+				State->NumEventsSent += NumEvents;
+				++State->NumBatchesSent;
+				State->BytesSent += Payload->Num();
+				State->Wake();
+			},
+			[OnFailed, NumEvents](const FSatoriError& Error)
+			{
+				SATORI_LOGF_WARN(TEXT("Dropping batch of %d server events: %s"), NumEvents, *Error.Message);
+				OnFailed();
+			});
+	});
+}
+
+void FSatoriServerEventWriter::AppendEventJson(TArray<uint8>& Buffer, const FSatoriEvent& Event)
+{
+	// Same fields as USatoriClient::PostServerEvent.
+	AppendAscii(Buffer, "{\"name\":");
+	AppendJsonString(Buffer, Event.Name);
+
+	if (!Event.ID.IsEmpty())
+	{
+		AppendStringField(Buffer, "id", Event.ID);
+	}
+
+	if (Event.Metadata.Num() > 0)
+	{
+		AppendAscii(Buffer, ",\"metadata\":{");
+		bool bFirst = true;
+		for (const TPair<FString, FString>& Pair : Event.Metadata)
+		{
+			if (Pair.Key.IsEmpty() || Pair.Value.IsEmpty())
+			{
+				continue;
+			}
+			if (!bFirst)
+			{
+				Buffer.Add(',');
+			}
+			bFirst = false;
+			AppendJsonString(Buffer, Pair.Key);
+			Buffer.Add(':');
+			AppendJsonString(Buffer, Pair.Value);
+		}
+		Buffer.Add('}');
+	}
+
+	if (!Event.Value.IsEmpty())
+	{
+		AppendStringField(Buffer, "value", Event.Value);
+	}
+
+	AppendStringField(Buffer, "timestamp", Event.Timestamp.ToIso8601());
+
+	if (!Event.IdentityId.IsEmpty())
+	{
+		AppendStringField(Buffer, "identity_id", Event.IdentityId);
+	}
+	if (!Event.SessionId.IsEmpty())
+	{
+		AppendStringField(Buffer, "session_id", Event.SessionId);
+	}
+	if (Event.SessionIssuedAt > 0)
+	{
+		AppendNumberField(Buffer, "session_issued_at", Event.SessionIssuedAt);
+	}
+	if (Event.SessionExpiresAt > 0)
+	{
+		AppendNumberField(Buffer, "session_expires_at", Event.SessionExpiresAt);
+	}
+
+	Buffer.Add('}');
+}
@@ -53,6 +53,7 @@ USatoriSession* USatoriSession::SetupSession(const FString& AuthResponse)
 			{
 				ResultSession->_ExpireTime = FDateTime::FromUnixTimestamp(Expires);
 			}
+			PayloadJson->TryGetStringField(TEXT("iid"), ResultSession->_IdentityId);
 		}
 
 		// Parse the expiration time from the refresh token JWT payload.
@@ -90,6 +91,11 @@ const FSatoriProperties USatoriSession::GetProperties() const
 	return _Properties;
 }
 
+const FString USatoriSession::GetIdentityId() const
+{
+	return _IdentityId;
+}
+
 const FDateTime USatoriSession::GetExpireTime() const
 {
 	return _ExpireTime;
@@ -132,6 +138,7 @@ void USatoriSession::Update(const USatoriSession* Other)
 	_AuthToken         = Other->_AuthToken;
 	_RefreshToken      = Other->_RefreshToken;
 	_Properties        = Other->_Properties;
+	_IdentityId        = Other->_IdentityId;
 	_ExpireTime        = Other->_ExpireTime;
 	_RefreshExpireTime = Other->_RefreshExpireTime;
 }
@@ -153,6 +160,7 @@ USatoriSession* USatoriSession::RestoreSession(FString Token, FString RefreshTok
 		{
 			ResultSession->_ExpireTime = FDateTime::FromUnixTimestamp(Expires);
 		}
+		PayloadJson->TryGetStringField(TEXT("iid"), ResultSession->_IdentityId);
 	}
 
 	TSharedPtr<FJsonObject> RefreshPayloadJson;
@@ -77,6 +77,15 @@ FSatoriError FSatoriUtils::CreateRequestCancelledError()
 	return Error;
 }
 
+FSatoriError FSatoriUtils::CreateRequestRejectedError()
+{
+	SATORI_LOG_WARN(TEXT("Request rejected: the request queue is full."));
+	FSatoriError Error;
+	Error.Code = ESatoriErrorCode::ResourceExhausted;
+	Error.Message = TEXT("Request rejected: the request queue is full.");
+	return Error;
+}
+
 TSharedRef<IHttpRequest, ESPMode::ThreadSafe> FSatoriUtils::MakeRequest(
 	const FString& URL,
 	const FString& Content,
@@ -118,6 +127,6 @@ TSharedRef<IHttpRequest, ESPMode::ThreadSafe> FSatoriUtils::MakeRequest(
 
 	//SATORI_LOG_INFO(TEXT("..."));
 	//SATORI_LOG_INFO(FString::Printf(TEXT("Making Request to %s"), *Endpoint));
-	SATORI_LOG_INFO(FString::Printf(TEXT("Making %s request to %s with content: %s"), *VerbString, *URL, *Content));
+	SATORI_LOGF_INFO(TEXT("Making %s request to %s with content: %s"), *VerbString, *URL, *Content);
 	return HttpRequest;
 }
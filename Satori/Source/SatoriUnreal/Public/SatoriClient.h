@@ -19,6 +19,7 @@
 #include "CoreMinimal.h"
 #include "Interfaces/IHttpRequest.h"
 #include "HttpModule.h"
+#include "NakamaHttpPipeline.h"
 #include "SatoriError.h"
 #include "SatoriSession.h"
 #include "SatoriEvent.h"
@@ -301,6 +302,17 @@ public:
 		const TFunction<void(const FSatoriError& Error)>& ErrorCallback
 	);
 
+	/**
+	 * Post an already serialized server-event body: UTF-8 JSON of the form
+	 * {"events":[...]}. Used by FSatoriServerEventWriter to skip building a
+	 * JSON tree per event. Must be called on the game thread.
+	 */
+	void PostServerEventPayload(
+		const TSharedRef<const TArray<uint8>, ESPMode::ThreadSafe>& Utf8Body,
+		const TFunction<void()>& SuccessCallback,
+		const TFunction<void(const FSatoriError& Error)>& ErrorCallback
+	);
+
 	UFUNCTION(Category = "Satori|Events")
 	void PostEvent(
 		USatoriSession* Session,
@@ -481,7 +493,6 @@ private:
 	// Keyed by the session being refreshed. Game-thread only (see EnsureValidSession).
 	TMap<TWeakObjectPtr<USatoriSession>, TSharedPtr<FPendingRefresh>> InFlightRefreshes;
 
-	// Requests
-	TArray<FHttpRequestPtr> ActiveRequests;
-	FCriticalSection ActiveRequestsMutex;
+	// Requests of this client on the shared transport (see FNakamaHttpPipeline).
+	TSharedRef<FNakamaHttpRequestGroup, ESPMode::ThreadSafe> HttpRequests = MakeShared<FNakamaHttpRequestGroup, ESPMode::ThreadSafe>();
 };
@@ -0,0 +1,180 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "SatoriError.h"
+#include "SatoriExperiment.h"
+#include "SatoriExperimentCache.generated.h"
+
+class USatoriClient;
+class USatoriSession;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnSatoriExperimentsChanged);
+
+/**
+ * Last known experiment assignments of an identity.
+ *
+ * Lookups are served from memory by name and never wait on the network:
+ * until the first refresh completes they answer from the copy saved on a
+ * previous run, and with nothing saved they report the experiment as absent
+ * so callers fall back to their default variant. Refreshes replace the whole
+ * set and run in the background, either on demand (Refresh, RefreshIfStale)
+ * or on a timer (StartAutoRefresh).
+ *
+ * All methods must be called on the game thread.
+ */
+UCLASS(BlueprintType)
+class SATORIUNREAL_API USatoriExperimentCache : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	 * Creates a cache bound to a client.
+	 *
+	 * @param Client The client used for experiment requests.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Satori|Experiments")
+	static USatoriExperimentCache* CreateExperimentCache(USatoriClient* Client);
+
+	/** When true (default), the cache is saved after every refresh once Load has been called. */
+	UPROPERTY(BlueprintReadWrite, Category = "Satori|Experiments")
+	bool bAutoSave = true;
+
+	/** Fired when a refresh or Load changed the assignments. */
+	UPROPERTY(BlueprintAssignable, Category = "Satori|Experiments")
+	FOnSatoriExperimentsChanged ExperimentsChangedEvent;
+
+	/**
+	 * Fetch all experiments for the identity. Concurrent calls share one request.
+	 *
+	 * @param Session The session of the user.
+	 * @param SuccessCallback Called with true if any assignment changed.
+	 * @param ErrorCallback Called if the request fails; cached assignments are kept.
+	 */
+	void Refresh(
+		USatoriSession* Session,
+		const TFunction<void(bool bChanged)>& SuccessCallback,
+		const TFunction<void(const FSatoriError& Error)>& ErrorCallback
+	);
+
+	/** Refresh only if the assignments are older than MaxAgeSeconds (or were never fetched). */
+	UFUNCTION(BlueprintCallable, Category = "Satori|Experiments")
+	void RefreshIfStale(USatoriSession* Session, float MaxAgeSeconds);
+
+	/** Refresh every IntervalSeconds until StopAutoRefresh. Failures are logged and retried on the next tick. */
+	UFUNCTION(BlueprintCallable, Category = "Satori|Experiments")
+	void StartAutoRefresh(USatoriSession* Session, float IntervalSeconds);
+
+	UFUNCTION(BlueprintCallable, Category = "Satori|Experiments")
+	void StopAutoRefresh();
+
+	/**
+	 * Look up the assignment for an experiment.
+	 *
+	 * @return False if the identity is not in the experiment (or nothing is cached yet).
+	 */
+	UFUNCTION(BlueprintPure, Category = "Satori|Experiments")
+	bool GetExperiment(const FString& Name, FSatoriExperiment& OutExperiment) const;
+
+	/**
+	 * @return The assigned value of an experiment, or DefaultValue if not assigned.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Satori|Experiments")
+	FString GetExperimentValue(const FString& Name, const FString& DefaultValue) const;
+
+	/**
+	 * @return All cached assignments.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Satori|Experiments")
+	TArray<FSatoriExperiment> GetExperiments() const;
+
+	/**
+	 * @return When the cached assignments were fetched from the server, or FDateTime::MinValue() if never.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Satori|Experiments")
+	FDateTime GetLastRefreshTime() const;
+
+	/**
+	 * @return True if the assignments were fetched less than MaxAgeSeconds ago.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Satori|Experiments")
+	bool IsFresh(float MaxAgeSeconds) const;
+
+	/**
+	 * Load previously saved assignments for an identity and use that identity for
+	 * subsequent saves. Returns false if nothing was saved for it yet.
+	 * Switching to another identity first drops the previous identity's
+	 * assignments, and a refresh still running for it is ignored.
+	 *
+	 * @param IdentityId The identity the assignments belong to (see USatoriSession::GetIdentityId).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Satori|Experiments")
+	bool Load(const FString& IdentityId);
+
+	/**
+	 * Save the assignments for the identity passed to Load.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Satori|Experiments")
+	bool Save() const;
+
+	/**
+	 * Drop all cached assignments.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Satori|Experiments")
+	void Clear();
+
+	virtual void BeginDestroy() override;
+
+private:
+
+	UPROPERTY()
+	USatoriClient* Client;
+
+	UPROPERTY()
+	USatoriSession* AutoRefreshSession;
+
+	// Assignments keyed by experiment name.
+	TMap<FString, FSatoriExperiment> Experiments;
+
+	FDateTime LastRefreshTime = FDateTime::MinValue();
+
+	// Identity used to name the save file; empty until Load is called.
+	FString IdentityId;
+
+	// Bumped when Load switches identity so a refresh sent for the previous one is ignored.
+	int32 Generation = 0;
+
+	// Callbacks of callers waiting on the refresh in progress.
+	struct FPendingRefresh
+	{
+		TArray<TFunction<void(bool)>> OnSuccess;
+		TArray<TFunction<void(const FSatoriError&)>> OnError;
+	};
+	TSharedPtr<FPendingRefresh> InFlightRefresh;
+
+	FTSTicker::FDelegateHandle AutoRefreshHandle;
+
+	// Replace the assignments; returns true if anything changed.
+	bool SetExperiments(const TArray<FSatoriExperiment>& NewExperiments);
+
+	void ResetForIdentity();
+	FString GetSaveFilePath() const;
+};
@@ -53,8 +53,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Satori")
 	static void EnableLogging(bool bEnable);
 
+	// True if a message at InLogLevel would be written. Cheap enough to call
+	// before building a message (see SatoriLoggingMacros.h).
+	static bool IsLoggable(ESatoriLogLevel InLogLevel)
+	{
+		return bLoggingEnabled && InLogLevel >= CurrentLogLevel;
+	}
+
 private:
 	static ESatoriLogLevel CurrentLogLevel;
 	static bool bLoggingEnabled;
-	static bool IsLoggable(ESatoriLogLevel InLogLevel);
 };
@@ -16,33 +16,68 @@
 
 #pragma once
 
+#include "SatoriLogger.h"
+
 // Toggle logging on/off by defining SATORI_LOGS_ENABLED
 #define SATORI_LOGS_ENABLED
 
+// Build-time minimum level (0 Debug, 1 Info, 2 Warn, 3 Error, 4 Fatal). Call
+// sites below it compile to nothing, e.g. add "SATORI_LOG_MIN_LEVEL=2" to
+// PublicDefinitions to strip debug and info logging from a build.
+#ifndef SATORI_LOG_MIN_LEVEL
+	#define SATORI_LOG_MIN_LEVEL 0
+#endif
+
 #ifdef SATORI_LOGS_ENABLED
 
-	#define SATORI_LOG_DEBUG(Message) \
-	USatoriLogger::Log(ESatoriLogLevel::Debug, Message)
+	// The level is checked before the message expression is evaluated, so a
+	// disabled level never pays for building the message.
+	#define SATORI_LOG_AT(Level, Message) \
+	do { if (USatoriLogger::IsLoggable(Level)) { USatoriLogger::Log(Level, Message); } } while (0)
+
+	// Format-style variant: SATORI_LOGF_INFO(TEXT("Sent %d bytes"), Num)
+	#define SATORI_LOGF_AT(Level, Format, ...) \
+	do { if (USatoriLogger::IsLoggable(Level)) { USatoriLogger::Log(Level, FString::Printf(Format, ##__VA_ARGS__)); } } while (0)
+
+#else
 
-	#define SATORI_LOG_INFO(Message) \
-	USatoriLogger::Log(ESatoriLogLevel::Info, Message)
+	#define SATORI_LOG_AT(Level, Message) do { } while (0)
+	#define SATORI_LOGF_AT(Level, Format, ...) do { } while (0)
 
-	#define SATORI_LOG_WARN(Message) \
-	USatoriLogger::Log(ESatoriLogLevel::Warn, Message)
+#endif // SATORI_LOGS_ENABLED
 
-	#define SATORI_LOG_ERROR(Message) \
-	USatoriLogger::Log(ESatoriLogLevel::Error, Message)
+#if SATORI_LOG_MIN_LEVEL <= 0
+	#define SATORI_LOG_DEBUG(Message) SATORI_LOG_AT(ESatoriLogLevel::Debug, Message)
+	#define SATORI_LOGF_DEBUG(Format, ...) SATORI_LOGF_AT(ESatoriLogLevel::Debug, Format, ##__VA_ARGS__)
+#else
+	#define SATORI_LOG_DEBUG(Message) do { } while (0)
+	#define SATORI_LOGF_DEBUG(Format, ...) do { } while (0)
+#endif
 
-	#define SATORI_LOG_FATAL(Message) \
-	USatoriLogger::Log(ESatoriLogLevel::Fatal, Message)
+#if SATORI_LOG_MIN_LEVEL <= 1
+	#define SATORI_LOG_INFO(Message) SATORI_LOG_AT(ESatoriLogLevel::Info, Message)
+	#define SATORI_LOGF_INFO(Format, ...) SATORI_LOGF_AT(ESatoriLogLevel::Info, Format, ##__VA_ARGS__)
+#else
+	#define SATORI_LOG_INFO(Message) do { } while (0)
+	#define SATORI_LOGF_INFO(Format, ...) do { } while (0)
+#endif
 
+#if SATORI_LOG_MIN_LEVEL <= 2
+	#define SATORI_LOG_WARN(Message) SATORI_LOG_AT(ESatoriLogLevel::Warn, Message)
+	#define SATORI_LOGF_WARN(Format, ...) SATORI_LOGF_AT(ESatoriLogLevel::Warn, Format, ##__VA_ARGS__)
 #else
+	#define SATORI_LOG_WARN(Message) do { } while (0)
+	#define SATORI_LOGF_WARN(Format, ...) do { } while (0)
+#endif
 
-	// Define empty macros if logging is disabled
-	#define SATORI_LOG_DEBUG(Message)
-	#define SATORI_LOG_INFO(Message)
-	#define SATORI_LOG_WARN(Message)
-	#define SATORI_LOG_ERROR(Message)
-	#define SATORI_LOG_FATAL(Message)
+#if SATORI_LOG_MIN_LEVEL <= 3
+	#define SATORI_LOG_ERROR(Message) SATORI_LOG_AT(ESatoriLogLevel::Error, Message)
+	#define SATORI_LOGF_ERROR(Format, ...) SATORI_LOGF_AT(ESatoriLogLevel::Error, Format, ##__VA_ARGS__)
+#else
+	#define SATORI_LOG_ERROR(Message) do { } while (0)
+	#define SATORI_LOGF_ERROR(Format, ...) do { } while (0)
+#endif
 
-#endif // SATORI_LOGS_ENABLED
\ No newline at end of file
+// Fatal is never compiled out.
+#define SATORI_LOG_FATAL(Message) SATORI_LOG_AT(ESatoriLogLevel::Fatal, Message)
+#define SATORI_LOGF_FATAL(Format, ...) SATORI_LOGF_AT(ESatoriLogLevel::Fatal, Format, ##__VA_ARGS__)
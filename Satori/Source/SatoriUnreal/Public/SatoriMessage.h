@@ -84,6 +84,14 @@ struct SATORIUNREAL_API FSatoriMessageList
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "Satori|Messages")
 	TArray<FSatoriMessage> Messages;
 
+	// Cursor to fetch the next page of messages, empty if there are no more.
+	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "Satori|Messages")
+	FString NextCursor;
+
+	// Cursor to fetch the previous page of messages, empty if there are none.
+	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "Satori|Messages")
+	FString PrevCursor;
+
 	FSatoriMessageList(const FString& JsonString);
 	FSatoriMessageList(); // Default Constructor
 };
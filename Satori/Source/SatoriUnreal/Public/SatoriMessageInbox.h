@@ -0,0 +1,220 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SatoriError.h"
+#include "SatoriMessage.h"
+#include "SatoriMessageInbox.generated.h"
+
+class USatoriClient;
+class USatoriSession;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnSatoriInboxChanged);
+
+/**
+ * Local model of the identity's Satori message inbox.
+ *
+ * Messages are stored by ID and synced incrementally: Sync walks the server
+ * list newest-first and stops at the first message it already holds with an
+ * unchanged UpdateTime, so reopening the inbox only downloads what is new.
+ * Read/consume/delete are applied locally first and rolled back if the server
+ * rejects them. The inbox (messages and the cursor for older pages) can be
+ * persisted per identity so it is available immediately on the next launch.
+ *
+ * All methods must be called on the game thread.
+ */
+UCLASS(BlueprintType)
+class SATORIUNREAL_API USatoriMessageInbox : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	 * Creates an inbox bound to a client.
+	 *
+	 * @param Client The client used for message requests.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Satori|Messages")
+	static USatoriMessageInbox* CreateMessageInbox(USatoriClient* Client);
+
+	/** Number of messages requested per page. */
+	UPROPERTY(BlueprintReadWrite, Category = "Satori|Messages")
+	int32 PageSize = 50;
+
+	/** Upper bound on pages fetched by a single Sync before it stops walking. */
+	UPROPERTY(BlueprintReadWrite, Category = "Satori|Messages")
+	int32 MaxSyncPages = 10;
+
+	/** When true (default), the inbox is saved after every successful change once Load has been called. */
+	UPROPERTY(BlueprintReadWrite, Category = "Satori|Messages")
+	bool bAutoSave = true;
+
+	/** Fired whenever the local contents change (sync, optimistic update or rollback). */
+	UPROPERTY(BlueprintAssignable, Category = "Satori|Messages")
+	FOnSatoriInboxChanged InboxChangedEvent;
+
+	/**
+	 * Fetch messages newer than the local state. Concurrent calls share one sync.
+	 *
+	 * @param Session The session of the user.
+	 * @param SuccessCallback Called with the number of messages added, changed or removed.
+	 * @param ErrorCallback Called if a page request fails; already-merged pages are kept.
+	 */
+	void Sync(
+		USatoriSession* Session,
+		const TFunction<void(int32 NumChanged)>& SuccessCallback,
+		const TFunction<void(const FSatoriError& Error)>& ErrorCallback
+	);
+
+	/**
+	 * Fetch the next page of messages older than anything held locally.
+	 *
+	 * @param Session The session of the user.
+	 * @param SuccessCallback Called with the number of messages added.
+	 * @param ErrorCallback Called if the request fails.
+	 */
+	void LoadOlder(
+		USatoriSession* Session,
+		const TFunction<void(int32 NumAdded)>& SuccessCallback,
+		const TFunction<void(const FSatoriError& Error)>& ErrorCallback
+	);
+
+	/** Mark a message as read locally and on the server, rolling back on failure. */
+	void MarkRead(
+		USatoriSession* Session,
+		const FString& MessageId,
+		const TFunction<void()>& SuccessCallback,
+		const TFunction<void(const FSatoriError& Error)>& ErrorCallback
+	);
+
+	/** Mark a message as consumed locally and on the server, rolling back on failure. */
+	void MarkConsumed(
+		USatoriSession* Session,
+		const FString& MessageId,
+		const TFunction<void()>& SuccessCallback,
+		const TFunction<void(const FSatoriError& Error)>& ErrorCallback
+	);
+
+	/** Remove a message locally and on the server, restoring it on failure. */
+	void DeleteMessage(
+		USatoriSession* Session,
+		const FString& MessageId,
+		const TFunction<void()>& SuccessCallback,
+		const TFunction<void(const FSatoriError& Error)>& ErrorCallback
+	);
+
+	/**
+	 * @return All locally held messages, newest first.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Satori|Messages")
+	TArray<FSatoriMessage> GetMessages() const;
+
+	/**
+	 * Look up a message by ID.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Satori|Messages")
+	bool FindMessage(const FString& MessageId, FSatoriMessage& OutMessage) const;
+
+	/**
+	 * @return Number of locally held messages that have not been read.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Satori|Messages")
+	int32 GetUnreadCount() const;
+
+	/**
+	 * @return True if the server has older messages than the ones held locally.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Satori|Messages")
+	bool HasOlderMessages() const;
+
+	/**
+	 * Load a previously saved inbox for an identity and use that identity for
+	 * subsequent saves. Returns false if nothing was saved for it yet.
+	 * Switching to another identity first drops everything held for the
+	 * previous one, and replies to its requests are ignored.
+	 *
+	 * @param IdentityId The identity the inbox belongs to (see USatoriSession::GetIdentityId).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Satori|Messages")
+	bool Load(const FString& IdentityId);
+
+	/**
+	 * Save the inbox for the identity passed to Load.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Satori|Messages")
+	bool Save() const;
+
+	/**
+	 * Drop all local messages and the older-page cursor.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Satori|Messages")
+	void Clear();
+
+private:
+
+	UPROPERTY()
+	USatoriClient* Client;
+
+	// Messages keyed by ID.
+	TMap<FString, FSatoriMessage> Messages;
+
+	// Cursor continuing below the oldest locally held message. Persisted.
+	FString OlderCursor;
+
+	// Identity used to name the save file; empty until Load is called.
+	FString IdentityId;
+
+	// Bumped when Load switches identity so replies sent for the previous one are ignored.
+	int32 Generation = 0;
+
+	// In-flight optimistic mutations per message ID. A sync never overwrites
+	// a message with a pending mutation, or it would undo the local change.
+	TMap<FString, int32> PendingMutations;
+
+	// Callbacks of callers waiting on the sync in progress.
+	struct FPendingSync
+	{
+		TArray<TFunction<void(int32)>> OnSuccess;
+		TArray<TFunction<void(const FSatoriError&)>> OnError;
+		TSet<FString> SeenIds;
+		int32 NumChanged = 0;
+		int32 NumPages = 0;
+		bool bStartedEmpty = false;
+	};
+	TSharedPtr<FPendingSync> InFlightSync;
+
+	void SyncPage(USatoriSession* Session, const FString& Cursor);
+	void FinishSync(const FSatoriError* Error);
+
+	// Merge a server copy; returns true if the local state changed.
+	bool MergeMessage(const FSatoriMessage& Message);
+
+	void BeginMutation(const FString& MessageId);
+	void EndMutation(const FString& MessageId);
+	void UpdateMessageState(
+		USatoriSession* Session,
+		const FString& MessageId,
+		bool bConsume,
+		const TFunction<void()>& SuccessCallback,
+		const TFunction<void(const FSatoriError& Error)>& ErrorCallback);
+
+	void NotifyChanged();
+	void ResetForIdentity();
+	FString GetSaveFilePath() const;
+};
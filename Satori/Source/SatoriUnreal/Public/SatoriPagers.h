@@ -0,0 +1,46 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NakamaPager.h"
+#include "SatoriError.h"
+#include "SatoriMessage.h"
+
+class USatoriClient;
+class USatoriSession;
+
+template <>
+struct TNakamaPageTraits<FSatoriMessageList>
+{
+	static const FString& GetCursor(const FSatoriMessageList& Page) { return Page.NextCursor; }
+	static TArray<FSatoriMessage>& GetItems(FSatoriMessageList& Page) { return Page.Messages; }
+};
+
+using FSatoriMessagePager = TNakamaPager<FSatoriMessageList, FSatoriError>;
+
+/**
+ * Pagers over the cursor-based list requests of USatoriClient (see TNakamaPager).
+ */
+struct SATORIUNREAL_API FSatoriPagers
+{
+	static TSharedRef<FSatoriMessagePager> GetMessages(
+		USatoriClient* Client,
+		USatoriSession* Session,
+		int32 Limit,
+		bool Forward);
+};
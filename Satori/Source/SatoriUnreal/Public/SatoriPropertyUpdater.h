@@ -0,0 +1,151 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "SatoriError.h"
+#include "SatoriProperties.h"
+#include "SatoriPropertyUpdater.generated.h"
+
+class USatoriClient;
+class USatoriSession;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnSatoriPropertiesFlushed);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSatoriPropertiesFlushError, const FSatoriError&, Error);
+
+/**
+ * Coalesces identity property changes into as few UpdateProperties requests
+ * as possible.
+ *
+ * Changes are merged last-write-wins per key and sent together once no new
+ * change has arrived for DebounceSeconds, or at the latest MaxWaitSeconds
+ * after the first unsent change, so a steady stream of changes cannot hold
+ * them back indefinitely. Values equal to the last state the
+ * server acknowledged are dropped before sending, and a flush with nothing
+ * left to send issues no request. Only one request is in flight at a time;
+ * changes made meanwhile are sent by the next flush. If a request fails its
+ * changes are put back (newer changes to the same key win) and OnFlushError
+ * fires; the next change or an explicit Flush will try again.
+ *
+ * All methods must be called on the game thread.
+ */
+UCLASS(BlueprintType)
+class SATORIUNREAL_API USatoriPropertyUpdater : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	 * Creates an updater sending on behalf of a session.
+	 *
+	 * @param Client The client used for property requests.
+	 * @param Session The session of the identity whose properties are updated.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Satori|Properties")
+	static USatoriPropertyUpdater* CreatePropertyUpdater(USatoriClient* Client, USatoriSession* Session);
+
+	/** Seconds to wait after the last change before sending. Zero sends on the next tick. */
+	UPROPERTY(BlueprintReadWrite, Category = "Satori|Properties")
+	float DebounceSeconds = 0.5f;
+
+	/** Longest time a change waits to be sent while newer changes keep restarting the debounce. Zero for no limit. */
+	UPROPERTY(BlueprintReadWrite, Category = "Satori|Properties")
+	float MaxWaitSeconds = 5.0f;
+
+	/** Passed to UpdateProperties; whether the server should recompute audiences. */
+	UPROPERTY(BlueprintReadWrite, Category = "Satori|Properties")
+	bool bRecompute = true;
+
+	/** Fired after a batch of changes has been acknowledged by the server. */
+	UPROPERTY(BlueprintAssignable, Category = "Satori|Properties")
+	FOnSatoriPropertiesFlushed OnFlushed;
+
+	/** Fired when a batch fails to send. Its changes remain pending. */
+	UPROPERTY(BlueprintAssignable, Category = "Satori|Properties")
+	FOnSatoriPropertiesFlushError OnFlushError;
+
+	/** Queue a default property change. */
+	UFUNCTION(BlueprintCallable, Category = "Satori|Properties")
+	void SetDefaultProperty(const FString& Key, const FString& Value);
+
+	/** Queue a custom property change. */
+	UFUNCTION(BlueprintCallable, Category = "Satori|Properties")
+	void SetCustomProperty(const FString& Key, const FString& Value);
+
+	/** Queue several changes at once. */
+	UFUNCTION(BlueprintCallable, Category = "Satori|Properties")
+	void SetProperties(const TMap<FString, FString>& DefaultProperties, const TMap<FString, FString>& CustomProperties);
+
+	/**
+	 * Record the properties currently held by the server (e.g. from
+	 * ListIdentityProperties) so that changes to the same values are skipped.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Satori|Properties")
+	void SetAcknowledgedProperties(const FSatoriProperties& Properties);
+
+	/** Use a different session for subsequent requests, e.g. after re-authenticating. */
+	UFUNCTION(BlueprintCallable, Category = "Satori|Properties")
+	void SetSession(USatoriSession* InSession);
+
+	/** Send pending changes now instead of waiting for the debounce. */
+	UFUNCTION(BlueprintCallable, Category = "Satori|Properties")
+	void Flush();
+
+	/** Drop all changes that have not been sent yet. */
+	UFUNCTION(BlueprintCallable, Category = "Satori|Properties")
+	void DiscardPending();
+
+	/**
+	 * @return True if there are changes waiting to be sent or awaiting acknowledgement.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Satori|Properties")
+	bool HasPendingChanges() const;
+
+	virtual void BeginDestroy() override;
+
+private:
+
+	UPROPERTY()
+	USatoriClient* Client;
+
+	UPROPERTY()
+	USatoriSession* Session;
+
+	// Changes not yet sent.
+	TMap<FString, FString> PendingDefault;
+	TMap<FString, FString> PendingCustom;
+
+	// Changes in the request currently in flight.
+	TMap<FString, FString> InFlightDefault;
+	TMap<FString, FString> InFlightCustom;
+	bool bRequestInFlight = false;
+
+	// Last values the server acknowledged, used to skip no-op changes.
+	TMap<FString, FString> AckedDefault;
+	TMap<FString, FString> AckedCustom;
+
+	FTSTicker::FDelegateHandle DebounceHandle;
+
+	// FPlatformTime::Seconds() of the oldest unsent change; zero if nothing is pending.
+	double PendingSince = 0.0;
+
+	void ScheduleFlush();
+	void CancelScheduledFlush();
+	void OnRequestComplete(const FSatoriError* Error);
+};
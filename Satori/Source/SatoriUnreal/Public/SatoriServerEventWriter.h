@@ -0,0 +1,148 @@
+/*
+* Copyright 2025 The Nakama Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "Containers/Queue.h"
+#include <atomic>
+#include "SatoriEvent.h"
+#include "NakamaHttpPipeline.h"
+
+class USatoriClient;
+class FRunnableThread;
+
+/** Tunables for FSatoriServerEventWriter. */
+struct FSatoriServerEventWriterSettings
+{
+	/** A batch is sent once its serialized body reaches this many bytes. */
+	int32 MaxBatchBytes = 256 * 1024;
+
+	/** A batch is sent once it holds this many events. */
+	int32 MaxBatchEvents = 1000;
+
+	/** Partially filled batches are sent after this long. */
+	float FlushIntervalSeconds = 1.0f;
+
+	/** At most this many events wait to be serialized; OverflowPolicy decides what happens beyond it. */
+	int32 MaxQueuedEvents = 100000;
+
+	/** Reject new events (default) or drop the oldest queued event once MaxQueuedEvents is reached. */
+	ENakamaOverflowPolicy OverflowPolicy = ENakamaOverflowPolicy::Reject;
+
+	/** Batches allowed on the wire at once; the writer stops draining the queue beyond this. */
+	int32 MaxInFlightBatches = 4;
+};
+
+/** Throughput counters of FSatoriServerEventWriter (see GetStats). */
+struct FSatoriServerEventWriterStats
+{
+	int64 NumEnqueued = 0;
+	int64 NumRejected = 0;
+	int64 NumDropped = 0;
+	int64 NumEventsSent = 0;
+	int64 NumEventsFailed = 0;
+	int64 NumBatchesSent = 0;
+	int64 NumBatchesFailed = 0;
+	int64 BytesSent = 0;
+	int32 NumQueued = 0;
+	int32 NumInFlightBatches = 0;
+};
+
+/** Result of FSatoriServerEventWriter::Enqueue. */
+enum class ESatoriEnqueueResult : uint8
+{
+	Accepted,
+	QueueFull, // backpressure: MaxQueuedEvents reached under ENakamaOverflowPolicy::Reject, the event was dropped
+	Stopped,   // the writer is shutting down
+};
+
+/**
+ * High-throughput server-event publisher for dedicated servers.
+ *
+ * Enqueue is lock-free and may be called from any thread. A background
+ * thread drains the queue, serializes events straight into a UTF-8 request
+ * body (no FJsonObject tree) and cuts batches by size, count or age. Only
+ * the send of a finished batch is handed to the game thread. When the
+ * server falls behind, in-flight batches are capped and Enqueue starts
+ * rejecting; IsUnderPressure reports this before events are dropped.
+ *
+ * Failed batches are counted and dropped after the client's own retries.
+ * Destroying the writer sends what is still queued.
+ */
+class SATORIUNREAL_API FSatoriServerEventWriter : public FRunnable
+{
+public:
+
+	FSatoriServerEventWriter(USatoriClient* Client, const FSatoriServerEventWriterSettings& Settings = FSatoriServerEventWriterSettings());
+	virtual ~FSatoriServerEventWriter() override;
+
+	/** Queue an event for publishing. Thread-safe. */
+	ESatoriEnqueueResult Enqueue(FSatoriEvent&& Event);
+	ESatoriEnqueueResult Enqueue(const FSatoriEvent& Event);
+
+	/** True when the queue is above three quarters of MaxQueuedEvents or all batch slots are in use. */
+	bool IsUnderPressure() const;
+
+	/** Send the partially filled batch now instead of waiting for FlushIntervalSeconds. */
+	void Flush();
+
+	/** Counters snapshot. Thread-safe. */
+	FSatoriServerEventWriterStats GetStats() const;
+
+	// FRunnable
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+	/** Serialize one event as a JSON object into a UTF-8 buffer. Exposed for tests and tooling. */
+	static void AppendEventJson(TArray<uint8>& Buffer, const FSatoriEvent& Event);
+
+private:
+
+	// State shared with in-flight batch callbacks, which may outlive the writer.
+	struct FShared
+	{
+		std::atomic<int32> NumQueued { 0 };
+		std::atomic<int32> NumInFlightBatches { 0 };
+		std::atomic<int64> NumEnqueued { 0 };
+		std::atomic<int64> NumRejected { 0 };
+		std::atomic<int64> NumDropped { 0 };
+		std::atomic<int64> NumEventsSent { 0 };
+		std::atomic<int64> NumEventsFailed { 0 };
+		std::atomic<int64> NumBatchesSent { 0 };
+		std::atomic<int64> NumBatchesFailed { 0 };
+		std::atomic<int64> BytesSent { 0 };
+		FEvent* WakeEvent = nullptr;
+		FCriticalSection WakeEventMutex;
+
+		void Wake();
+	};
+
+	void SendBatch(TArray<uint8>&& Body, int32 NumEvents);
+
+	// Under DropOldest, producers also dequeue, so dequeues are serialized.
+	bool DequeueEvent(FSatoriEvent& OutEvent);
+
+	TWeakObjectPtr<USatoriClient> Client;
+	FSatoriServerEventWriterSettings Settings;
+	TQueue<FSatoriEvent, EQueueMode::Mpsc> Queue;
+	FCriticalSection DequeueMutex;
+	TSharedRef<FShared, ESPMode::ThreadSafe> Shared;
+	std::atomic<bool> bStopping { false };
+	std::atomic<bool> bFlushRequested { false };
+	FRunnableThread* Thread = nullptr;
+};
@@ -54,6 +54,12 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Satori|Authentication")
 	const FSatoriProperties GetProperties() const;
 
+	/**
+	 * @return The identity ID this session was issued for, parsed from the auth token.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Satori|Authentication")
+	const FString GetIdentityId() const;
+
 	/**
 	 * @return The timestamp when this session will expire.
 	 */
@@ -112,6 +118,7 @@ private:
 	FString _AuthToken;
 	FString _RefreshToken;
 	FSatoriProperties _Properties;
+	FString _IdentityId;
 	FDateTime _ExpireTime;
 	FDateTime _RefreshExpireTime;
 
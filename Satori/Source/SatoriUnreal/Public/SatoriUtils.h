@@ -22,6 +22,7 @@
 #include "Templates/SharedPointer.h"
 #include "SatoriLogger.h"
 #include "Misc/Base64.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 #include "Serialization/JsonSerializer.h"
 #include "SatoriLoggingMacros.h"
 
@@ -149,6 +150,7 @@ public:
 	}
 
 	static TSharedPtr<FJsonObject> DeserializeJsonObject(const FString& JsonString) {
+		TRACE_CPUPROFILER_EVENT_SCOPE(Satori::Json::Parse);
 		TSharedPtr<FJsonObject> JsonObject;
 		const TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(JsonString);
 		if (!FJsonSerializer::Deserialize(JsonReader, JsonObject))
@@ -272,6 +274,10 @@ public:
 	// rather than Error and never trips automation log-error capture.
 	static FSatoriError CreateRequestCancelledError();
 
+	// Terminal error for a request turned away by a full request queue
+	// (see FNakamaHttpPipeline::SetMaxQueuedRequests).
+	static FSatoriError CreateRequestRejectedError();
+
 	// Make HTTP request
 	static TSharedRef<IHttpRequest, ESPMode::ThreadSafe> MakeRequest(
 		const FString& URL,
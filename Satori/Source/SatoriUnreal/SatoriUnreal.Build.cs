@@ -44,7 +44,7 @@ public class SatoriUnreal : ModuleRules
 		PublicDependencyModuleNames.AddRange(
 			new string[]
 			{
-				"Core", "HTTP", "WebSockets", "JsonUtilities"
+				"Core", "HTTP", "WebSockets", "JsonUtilities", "NakamaHttp"
 				// ... add other public dependencies that you statically link with here ...
 			}
 			);